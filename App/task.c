@@ -3,6 +3,7 @@
 #include "./LED/led.h"
 // 1. 新增：添加USART头文件（必须）
 #include "./USART/usart.h"  
+#include "./latency/latency.h"
 
 /******************************************************************************************************/
 /*uC/OS-III配置*/
@@ -142,6 +143,11 @@ void start_task(void *p_arg)
                     (OS_OPT         )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
                     (OS_ERR        *)&err);
     
+#if LAT_MEAS_EN
+    /* 中断延迟测量：TIM2输入捕获，结果通过printf输出 */
+    Lat_Start();
+#endif
+    
     /* 删除Start Task */
     OSTaskDel((OS_TCB *)0, &err);
 }
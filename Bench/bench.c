@@ -0,0 +1,260 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench.c
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <time.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB             BenchTaskTCB;
+static  CPU_STK            BenchTaskStk[BENCH_TASK_STK_SIZE];
+
+static  const  CPU_CHAR   *BenchName;
+static  void             (*BenchFnct)(void);
+static  CPU_INT32U         BenchRandState = 0x2545F491u;
+static  CPU_BOOLEAN        BenchHdrDone    = DEF_NO;            /* Table header printed?                                */
+static  CPU_BOOLEAN        BenchLatHdrDone = DEF_NO;            /* CSV header printed?                                  */
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASK
+*
+* Description : Starts the kernel tick, runs the benchmark and terminates the process.
+*********************************************************************************************************
+*/
+
+static  void  BenchTask (void  *p_arg)
+{
+    (void)p_arg;
+
+    OS_CPU_SysTickInit();                                       /* The POSIX port does not start the tick by itself     */
+
+    printf("# %s\n", BenchName);
+
+    BenchFnct();
+
+    fflush(stdout);
+    exit(0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                              BenchRun()
+*********************************************************************************************************
+*/
+
+void  BenchRun (const  CPU_CHAR  *p_name,
+                       void     (*p_fnct)(void))
+{
+    OS_ERR  err;
+
+
+    BenchName = p_name;
+    BenchFnct = p_fnct;
+
+    CPU_Init();
+    OSInit(&err);
+    if (err != OS_ERR_NONE) {
+        printf("OSInit() failed: %u\n", (unsigned)err);
+        exit(1);
+    }
+
+    OSTaskCreate(&BenchTaskTCB,
+                 (CPU_CHAR *)"Bench",
+                  BenchTask,
+                  0,
+                  BENCH_TASK_PRIO,
+                 &BenchTaskStk[0],
+                  BENCH_TASK_STK_SIZE / 10u,
+                  BENCH_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &err);
+
+    OSStart(&err);
+    printf("OSStart() failed: %u\n", (unsigned)err);
+    exit(1);
+}
+
+
+/*
+*********************************************************************************************************
+*                              BenchNsGet() / BenchThreadNsGet() / BenchProcessNsGet()
+*********************************************************************************************************
+*/
+
+CPU_INT64U  BenchNsGet (void)
+{
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((CPU_INT64U)ts.tv_sec * 1000000000u + (CPU_INT64U)ts.tv_nsec);
+}
+
+
+CPU_INT64U  BenchThreadNsGet (void)
+{
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ((CPU_INT64U)ts.tv_sec * 1000000000u + (CPU_INT64U)ts.tv_nsec);
+}
+
+
+CPU_INT64U  BenchProcessNsGet (void)
+{
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ((CPU_INT64U)ts.tv_sec * 1000000000u + (CPU_INT64U)ts.tv_nsec);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    BenchRandGet() / BenchRandSeed()
+*
+* Note(s) : (1) xorshift32, so that every run (and every kernel variant) sees the same sequence.
+*
+*           (2) BenchRandSeed() restarts the sequence, e.g. to replay a workload.  'seed' MUST NOT be 0.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  BenchRandGet (void)
+{
+    BenchRandState ^= BenchRandState << 13;
+    BenchRandState ^= BenchRandState >> 17;
+    BenchRandState ^= BenchRandState <<  5;
+    return (BenchRandState);
+}
+
+
+void  BenchRandSeed (CPU_INT32U  seed)
+{
+    BenchRandState = seed;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BenchResult()
+*********************************************************************************************************
+*/
+
+void  BenchResult (const  CPU_CHAR  *p_test,
+                          CPU_INT32U  n,
+                          CPU_INT64U  ns_total,
+                          CPU_INT32U  ops)
+{
+    if (BenchHdrDone == DEF_NO) {
+        BenchHdrDone = DEF_YES;
+        printf("%-24s %8s %12s %14s\n", "test", "n", "ns/op", "op/s");
+    }
+    if ((ops == 0u) || (ns_total == 0u)) {
+        printf("%-24s %8u %12s %14s\n", p_test, (unsigned)n, "-", "-");
+        return;
+    }
+    printf("%-24s %8u %12.1f %14.0f\n", p_test, (unsigned)n,
+           (double)ns_total / (double)ops,
+           (double)ops * 1e9 / (double)ns_total);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BenchLatResult()
+*
+* Note(s) : (1) One CSV line per test, after a header line on the first call:
+*
+*                   lat,<variant>,<test>,<n>,<min>,<avg>,<p99>,<max>,<min ns>,<avg ns>,<p99 ns>,<max ns>
+*
+*               The first four statistics are in CPU_TS units, converted to ns with CPU_TS_TmrFreqGet().
+*               <variant> is the Makefile variant, see BENCH_VARIANT.
+*
+*           (2) 'p_ts_tbl' is sorted in place.
+*********************************************************************************************************
+*/
+
+static  int  BenchLatCmp (const  void  *p_a,
+                          const  void  *p_b)
+{
+    CPU_TS  a;
+    CPU_TS  b;
+
+
+    a = *(const CPU_TS *)p_a;
+    b = *(const CPU_TS *)p_b;
+
+    return ((a > b) - (a < b));
+}
+
+
+static  CPU_INT64U  BenchLatNsGet (CPU_INT64U  ts,
+                                   CPU_INT64U  freq)
+{
+    if (freq == 0u) {
+        return (0u);
+    }
+    return ((ts * 1000000000u) / freq);
+}
+
+
+void  BenchLatResult (const  CPU_CHAR  *p_test,
+                             CPU_TS    *p_ts_tbl,
+                             CPU_INT32U  nbr)
+{
+    CPU_INT64U  sum;
+    CPU_INT64U  avg;
+    CPU_INT64U  freq;
+    CPU_TS      p99;
+    CPU_INT32U  i;
+    CPU_ERR     err;
+
+
+    if (BenchLatHdrDone == DEF_NO) {
+        BenchLatHdrDone = DEF_YES;
+        printf("lat,variant,test,n,min,avg,p99,max,min_ns,avg_ns,p99_ns,max_ns\n");
+    }
+    if (nbr == 0u) {
+        printf("lat,%s,%s,0,,,,,,,,\n", BENCH_VARIANT, p_test);
+        return;
+    }
+
+    qsort(p_ts_tbl, nbr, sizeof(p_ts_tbl[0]), BenchLatCmp);
+    sum = 0u;
+    for (i = 0u; i < nbr; i++) {
+        sum += p_ts_tbl[i];
+    }
+    avg  = sum / nbr;
+    p99  = p_ts_tbl[((CPU_INT64U)(nbr - 1u) * 99u) / 100u];
+    freq = CPU_TS_TmrFreqGet(&err);
+
+    printf("lat,%s,%s,%u,%u,%u,%u,%u,%llu,%llu,%llu,%llu\n", BENCH_VARIANT, p_test, (unsigned)nbr,
+           (unsigned)p_ts_tbl[0], (unsigned)avg, (unsigned)p99, (unsigned)p_ts_tbl[nbr - 1u],
+           (unsigned long long)BenchLatNsGet(p_ts_tbl[0],       freq),
+           (unsigned long long)BenchLatNsGet(avg,               freq),
+           (unsigned long long)BenchLatNsGet(p99,               freq),
+           (unsigned long long)BenchLatNsGet(p_ts_tbl[nbr - 1u], freq));
+}
@@ -0,0 +1,63 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench.h
+*********************************************************************************************************
+* Note(s)  : (1) The benchmarks run the kernel on the POSIX port.  Each task is a SCHED_RR thread, so the
+*                process needs an unlimited RTPRIO limit ('ulimit -r unlimited') or root privileges.
+*********************************************************************************************************
+*/
+
+#ifndef  BENCH_H
+#define  BENCH_H
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_TASK_PRIO                                  4u    /* Above the timer and statistic tasks                  */
+#define  BENCH_TASK_STK_SIZE                           4096u
+
+#ifndef  BENCH_VARIANT
+#define  BENCH_VARIANT                               "host"     /* Set to the variant name by the Makefile              */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void        BenchRun       (const  CPU_CHAR  *p_name,
+                                   void     (*p_fnct)(void));   /* Start the kernel and run 'p_fnct' in a task          */
+
+CPU_INT64U  BenchNsGet     (void);                              /* Monotonic wall clock, in nanoseconds                 */
+
+CPU_INT64U  BenchThreadNsGet(void);                             /* CPU time of the calling task's thread, in ns         */
+
+CPU_INT64U  BenchProcessNsGet(void);                            /* CPU time of the whole process, in ns                 */
+
+CPU_INT32U  BenchRandGet   (void);                              /* Deterministic pseudo-random numbers                  */
+
+void        BenchRandSeed  (CPU_INT32U  seed);                  /* Restart the sequence of BenchRandGet()               */
+
+void        BenchResult    (const  CPU_CHAR  *p_test,
+                                   CPU_INT32U  n,
+                                   CPU_INT64U  ns_total,
+                                   CPU_INT32U  ops);            /* Print one result line (ns per op, ops per second)    */
+
+void        BenchLatResult (const  CPU_CHAR  *p_test,
+                                   CPU_TS    *p_ts_tbl,
+                                   CPU_INT32U  nbr);            /* Print latency statistics as one CSV line             */
+
+#endif
@@ -0,0 +1,364 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_buf.c
+*********************************************************************************************************
+* Note(s)  : (1) A three stage packet pipeline, run by one task:
+*
+*                    rx        takes a buffer, fills it with the payload and posts it to the first queue.
+*                    encap     gets it from the first queue, adds a BENCH_BUF_HDR_LEN octet header and posts
+*                              it to the second queue.
+*                    deliver   gets it from the second queue and hands it to two consumers, one of which
+*                              wants the payload without the header, then returns everything.
+*
+*                'copy'   OSMemGet() blocks of BENCH_BUF_COPY_BLK_SIZE octets, OSQPost()/OSQPend().  'encap'
+*                         copies the packet behind the header in a new block, 'deliver' copies the payload
+*                         for the second consumer.
+*                'buf'    OSBufAlloc() chains of BENCH_BUF_DATA_SIZE octet buffers, OSQPostBuf()/OSQPendBuf().
+*                         'encap' writes the header in the headroom with OSBufHdrPush(), 'deliver' gives the
+*                         second consumer a clone and removes the header from it with OSBufHdrPop().
+*
+*            (2) The 'n' column is the payload size, the figures are per packet.  The copy into the first
+*                buffer, standing for the receive DMA, is done by both.  On the host, the packets stay in the
+*                data cache and a copy costs less than the buffers of a chain: 'buf' is ahead only where copies
+*                run at the speed of the memory bus.
+*
+*            (3) The pends are non-blocking: the packet is always there, and no task switch is measured.
+*
+*            (4) After the rounds, each queue is filled with chains of the largest payload, the first one
+*                followed by a clone of it, and emptied without a pend: the first queue by OSQFlushBuf(), the
+*                second by OSQDel() with OS_OPT_DEL_BUF.  A 'buf_drain' line gives the messages released by
+*                each, BENCH_BUF_Q_SIZE, and the buffers and clone headers still in use, which must be 0.
+*
+*            (5) A 'buf_stat' line gives the pool counters after the 'buf' rounds.  Every buffer must be back
+*                in its pool: 'used' is 0 and 'alloc' equals 'free'.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <string.h>
+#include  "bench.h"
+
+#if (OS_CFG_BUF_EN == 0u)
+#error  "bench_buf.c needs OS_CFG_BUF_EN > 0u"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_BUF_PKTS                             200000u     /* Packets per payload size                             */
+#define  BENCH_BUF_HDR_LEN                              14u     /* Ethernet header                                      */
+#define  BENCH_BUF_PAYLOAD_MAX                        1460u
+
+#define  BENCH_BUF_COPY_BLKS                             8u
+#define  BENCH_BUF_COPY_BLK_SIZE                      1536u     /* Header and largest payload                           */
+
+#define  BENCH_BUF_DATA_SIZE                           512u     /* Data per buffer, larger payloads are chained         */
+#define  BENCH_BUF_BUF_SIZE       (sizeof(OS_BUF) + BENCH_BUF_DATA_SIZE)
+#define  BENCH_BUF_BUFS                                 16u
+#define  BENCH_BUF_CLONES                                4u
+
+#define  BENCH_BUF_Q_SIZE                                4u
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U        BenchBufCopyStor[BENCH_BUF_COPY_BLKS * BENCH_BUF_COPY_BLK_SIZE] __attribute__((aligned(16)));
+static  OS_MEM            BenchBufCopyPart;
+
+static  CPU_INT08U        BenchBufStor[BENCH_BUF_BUFS * BENCH_BUF_BUF_SIZE] __attribute__((aligned(16)));
+static  OS_BUF_POOL       BenchBufPool;
+static  CPU_INT08U        BenchBufCloneStor[BENCH_BUF_CLONES * sizeof(OS_BUF)] __attribute__((aligned(16)));
+static  OS_BUF_POOL       BenchBufClonePool;                    /* Clone headers only, no data                          */
+
+static  OS_Q              BenchBufQ1;
+static  OS_Q              BenchBufQ2;
+
+static  CPU_INT08U        BenchBufWire[BENCH_BUF_PAYLOAD_MAX];  /* Payload of every packet                              */
+static  CPU_INT08U        BenchBufHdr[BENCH_BUF_HDR_LEN];
+static  CPU_INT32U        BenchBufErrCtr;                       /* Failed calls and wrong deliveries                    */
+
+static  const  OS_MSG_SIZE  BenchBufPayloadTbl[] = { 64u, 256u, 1024u, 1460u };
+
+
+/*
+*********************************************************************************************************
+*                                                CONSUMER
+*********************************************************************************************************
+*/
+
+static  void  BenchBufDeliver (const  CPU_INT08U  *p_pkt,
+                                      CPU_INT08U   first)
+{
+    if (p_pkt[0] != first) {
+        BenchBufErrCtr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            COPY PIPELINE
+*********************************************************************************************************
+*/
+
+static  void  BenchBufCopyRun (OS_MSG_SIZE  len)
+{
+    CPU_INT08U   *p_pkt;
+    CPU_INT08U   *p_new;
+    CPU_INT08U   *p_copy;
+    OS_MSG_SIZE   size;
+    CPU_INT32U    i;
+    CPU_INT64U    t0;
+    CPU_INT64U    ns;
+    OS_ERR        err;
+
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_BUF_PKTS; i++) {
+                                                                /* --- RX ---                                           */
+        p_pkt = (CPU_INT08U *)OSMemGet(&BenchBufCopyPart, &err);
+        if (p_pkt == (CPU_INT08U *)0) {
+            BenchBufErrCtr++;
+            continue;
+        }
+        (void)memcpy(p_pkt, BenchBufWire, len);
+        OSQPost(&BenchBufQ1, p_pkt, len, OS_OPT_POST_FIFO, &err);
+
+                                                                /* --- ENCAP ---                                        */
+        p_pkt = (CPU_INT08U *)OSQPend(&BenchBufQ1, 0u, OS_OPT_PEND_NON_BLOCKING, &size, (CPU_TS *)0, &err);
+        p_new = (CPU_INT08U *)OSMemGet(&BenchBufCopyPart, &err);
+        (void)memcpy(p_new, BenchBufHdr, BENCH_BUF_HDR_LEN);
+        (void)memcpy(p_new + BENCH_BUF_HDR_LEN, p_pkt, size);
+        OSMemPut(&BenchBufCopyPart, p_pkt, &err);
+        OSQPost(&BenchBufQ2, p_new, size + BENCH_BUF_HDR_LEN, OS_OPT_POST_FIFO, &err);
+
+                                                                /* --- DELIVER ---                                      */
+        p_pkt  = (CPU_INT08U *)OSQPend(&BenchBufQ2, 0u, OS_OPT_PEND_NON_BLOCKING, &size, (CPU_TS *)0, &err);
+        p_copy = (CPU_INT08U *)OSMemGet(&BenchBufCopyPart, &err);
+        (void)memcpy(p_copy, p_pkt + BENCH_BUF_HDR_LEN, size - BENCH_BUF_HDR_LEN);
+        BenchBufDeliver(p_pkt,  BenchBufHdr[0]);
+        BenchBufDeliver(p_copy, BenchBufWire[0]);
+        OSMemPut(&BenchBufCopyPart, p_copy, &err);
+        OSMemPut(&BenchBufCopyPart, p_pkt,  &err);
+    }
+    ns = BenchNsGet() - t0;
+
+    BenchResult("copy", len, ns, BENCH_BUF_PKTS);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BUFFER PIPELINE
+*********************************************************************************************************
+*/
+
+static  void  BenchBufRun (OS_MSG_SIZE  len)
+{
+    OS_BUF       *p_buf;
+    OS_BUF       *p_seg;
+    OS_BUF       *p_clone;
+    CPU_INT08U   *p_hdr;
+    OS_MSG_SIZE   offset;
+    CPU_INT32U    i;
+    CPU_INT64U    t0;
+    CPU_INT64U    ns;
+    OS_ERR        err;
+
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_BUF_PKTS; i++) {
+                                                                /* --- RX ---                                           */
+        p_buf = OSBufAlloc(&BenchBufPool, len, &err);
+        if (p_buf == (OS_BUF *)0) {
+            BenchBufErrCtr++;
+            continue;
+        }
+        offset = 0u;
+        for (p_seg = p_buf; p_seg != (OS_BUF *)0; p_seg = p_seg->NextPtr) {
+            (void)memcpy(p_seg->PayloadPtr, &BenchBufWire[offset], p_seg->Len);
+            offset += p_seg->Len;
+        }
+        OSQPostBuf(&BenchBufQ1, p_buf, OS_OPT_POST_FIFO, &err);
+
+                                                                /* --- ENCAP ---                                        */
+        p_buf = OSQPendBuf(&BenchBufQ1, 0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+        p_hdr = OSBufHdrPush(p_buf, BENCH_BUF_HDR_LEN, &err);
+        if (p_hdr == (CPU_INT08U *)0) {
+            BenchBufErrCtr++;
+            OSBufFree(p_buf, &err);
+            continue;
+        }
+        (void)memcpy(p_hdr, BenchBufHdr, BENCH_BUF_HDR_LEN);
+        OSQPostBuf(&BenchBufQ2, p_buf, OS_OPT_POST_FIFO, &err);
+
+                                                                /* --- DELIVER ---                                      */
+        p_buf   = OSQPendBuf(&BenchBufQ2, 0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+        p_clone = OSBufClone(p_buf, &BenchBufClonePool, &err);
+        if (p_clone != (OS_BUF *)0) {
+            (void)OSBufHdrPop(p_clone, BENCH_BUF_HDR_LEN, &err);
+            BenchBufDeliver(p_clone->PayloadPtr, BenchBufWire[0]);
+            OSBufFree(p_clone, &err);
+        } else {
+            BenchBufErrCtr++;
+        }
+        BenchBufDeliver(p_buf->PayloadPtr, BenchBufHdr[0]);
+        OSBufFree(p_buf, &err);
+    }
+    ns = BenchNsGet() - t0;
+
+    BenchResult("buf", len, ns, BENCH_BUF_PKTS);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            QUEUE DRAINS
+*
+* Note(s) : (1) See Note #4.  The clone of a chain takes one clone header per buffer of the chain.
+*********************************************************************************************************
+*/
+
+static  void  BenchBufFill (OS_Q  *p_q)
+{
+    OS_BUF      *p_buf;
+    OS_BUF      *p_clone;
+    CPU_INT32U   i;
+    OS_ERR       err;
+
+
+    p_clone = (OS_BUF *)0;
+    for (i = 0u; i < BENCH_BUF_Q_SIZE; i++) {
+        if (p_clone != (OS_BUF *)0) {                           /* Clone of the first chain                             */
+            p_buf   = p_clone;
+            p_clone = (OS_BUF *)0;
+        } else {
+            p_buf = OSBufAlloc(&BenchBufPool, BENCH_BUF_PAYLOAD_MAX, &err);
+            if (p_buf == (OS_BUF *)0) {
+                BenchBufErrCtr++;
+                return;
+            }
+            if (i == 0u) {
+                p_clone = OSBufClone(p_buf, &BenchBufClonePool, &err);
+                if (p_clone == (OS_BUF *)0) {
+                    BenchBufErrCtr++;
+                }
+            }
+        }
+        OSQPostBuf(p_q, p_buf, OS_OPT_POST_FIFO, &err);
+        if (err != OS_ERR_NONE) {
+            BenchBufErrCtr++;
+        }
+    }
+}
+
+
+static  void  BenchBufDrain (void)
+{
+    OS_MSG_QTY  flushed;
+    OS_MSG_QTY  deleted;
+    OS_ERR      err;
+
+
+    BenchBufFill(&BenchBufQ1);
+    flushed = OSQFlushBuf(&BenchBufQ1, &err);
+    if ((err != OS_ERR_NONE) || (flushed != BENCH_BUF_Q_SIZE)) {
+        BenchBufErrCtr++;
+    }
+
+    BenchBufFill(&BenchBufQ2);
+    deleted = BenchBufQ2.MsgQ.NbrEntries;
+    (void)OSQDel(&BenchBufQ2, OS_OPT_DEL_ALWAYS | OS_OPT_DEL_BUF, &err);
+    if (err != OS_ERR_NONE) {
+        BenchBufErrCtr++;
+    }
+
+    printf("buf_drain,%s,flushed,%u,deleted,%u,used,%u,clone_used,%u\n",
+            BENCH_VARIANT,
+           (unsigned)flushed,
+           (unsigned)deleted,
+           (unsigned)BenchBufPool.NbrUsed,
+           (unsigned)BenchBufClonePool.NbrUsed);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchBufMain (void)
+{
+    CPU_INT32U  i;
+    OS_ERR      err;
+
+
+    for (i = 0u; i < BENCH_BUF_PAYLOAD_MAX; i++) {
+        BenchBufWire[i] = (CPU_INT08U)(i + 1u);
+    }
+    for (i = 0u; i < BENCH_BUF_HDR_LEN; i++) {
+        BenchBufHdr[i]  = (CPU_INT08U)(0xF0u + i);
+    }
+
+    OSMemCreate(&BenchBufCopyPart, (CPU_CHAR *)"Bench copy partition", &BenchBufCopyStor[0],
+                 BENCH_BUF_COPY_BLKS, BENCH_BUF_COPY_BLK_SIZE, &err);
+    if (err == OS_ERR_NONE) {
+        OSBufPoolCreate(&BenchBufPool, (CPU_CHAR *)"Bench buffers", &BenchBufStor[0],
+                         BENCH_BUF_BUFS, BENCH_BUF_BUF_SIZE, BENCH_BUF_HDR_LEN, &err);
+    }
+    if (err == OS_ERR_NONE) {
+        OSBufPoolCreate(&BenchBufClonePool, (CPU_CHAR *)"Bench clone headers", &BenchBufCloneStor[0],
+                         BENCH_BUF_CLONES, sizeof(OS_BUF), 0u, &err);
+    }
+    if (err == OS_ERR_NONE) {
+        OSQCreate(&BenchBufQ1, (CPU_CHAR *)"Bench encap Q",   BENCH_BUF_Q_SIZE, &err);
+    }
+    if (err == OS_ERR_NONE) {
+        OSQCreate(&BenchBufQ2, (CPU_CHAR *)"Bench deliver Q", BENCH_BUF_Q_SIZE, &err);
+    }
+    if (err != OS_ERR_NONE) {
+        printf("# Pipeline creation failed: %u\n", (unsigned)err);
+        return;
+    }
+
+    BenchBufErrCtr = 0u;
+    for (i = 0u; i < sizeof(BenchBufPayloadTbl) / sizeof(BenchBufPayloadTbl[0]); i++) {
+        BenchBufCopyRun(BenchBufPayloadTbl[i]);
+        BenchBufRun(BenchBufPayloadTbl[i]);
+    }
+    BenchBufDrain();
+    if (BenchBufErrCtr != 0u) {
+        printf("# %u failed calls or wrong deliveries\n", (unsigned)BenchBufErrCtr);
+    }
+
+    printf("buf_stat,%s,used,%u,used_max,%u,alloc,%lu,free,%lu,fail,%lu,clone_used_max,%u\n",
+            BENCH_VARIANT,
+           (unsigned)BenchBufPool.NbrUsed,
+           (unsigned)BenchBufPool.NbrUsedMax,
+           (unsigned long)BenchBufPool.AllocCtr,
+           (unsigned long)BenchBufPool.FreeCtr,
+           (unsigned long)BenchBufPool.FailCtr,
+           (unsigned)BenchBufClonePool.NbrUsedMax);
+}
+
+
+int  main (void)
+{
+    BenchRun("Packet pipeline through two queues, copies vs reference counted buffer chains", BenchBufMain);
+
+    return (0);
+}
@@ -0,0 +1,226 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_cond.c
+*********************************************************************************************************
+* Note(s)  : (1) Higher priority consumer tasks wait, with a mutex, for a counter guarded by that mutex to
+*                change.  The bench task takes the mutex, increments the counter, wakes up the consumers and
+*                releases the mutex:
+*
+*                    'handoff'       one consumer, woken up with a signal.
+*                    'broadcast'     three consumers, all woken up.
+*
+*            (2) Each case is run with a condition variable ('cond') and with the usual emulation of one by a
+*                mutex and a counting semaphore ('mutex + sem'): the waiter counts itself, releases the mutex,
+*                pends on the semaphore and takes the mutex back; the signaler posts the semaphore once per
+*                waiter.
+*
+*            (3) The 'n' column is the number of context switches per round.
+*
+*            (4) The consumers are created once per case and never deleted.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_COND_ROUNDS                            20000u
+#define  BENCH_COND_WAITERS_MAX                           3u
+
+#define  BENCH_COND_MODE_COND                             0u
+#define  BENCH_COND_MODE_EMU                              1u
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  bench_cond_grp {
+    CPU_INT32U   Mode;
+    OS_MUTEX     Mutex;
+    OS_COND      Cond;                                          /* With BENCH_COND_MODE_COND                            */
+    OS_SEM       Sem;                                           /* With BENCH_COND_MODE_EMU                             */
+    CPU_INT32U   NbrWaiting;                                    /* With BENCH_COND_MODE_EMU, guarded by '.Mutex'        */
+    CPU_INT32U   Ctr;                                           /* Guarded by '.Mutex'                                  */
+    CPU_INT32U   NbrWakes;
+} BENCH_COND_GRP;
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  BENCH_COND_GRP   BenchCondGrp[4];
+
+static  OS_TCB           BenchCondTCB[4][BENCH_COND_WAITERS_MAX];
+static  CPU_STK          BenchCondStk[4][BENCH_COND_WAITERS_MAX][BENCH_TASK_STK_SIZE];
+
+
+/*
+*********************************************************************************************************
+*                                        WAIT AND SIGNAL HELPERS
+*********************************************************************************************************
+*/
+
+static  void  BenchCondWait (BENCH_COND_GRP  *p_grp)
+{
+    OS_ERR  err;
+
+
+    if (p_grp->Mode == BENCH_COND_MODE_COND) {
+        OSCondWait(&p_grp->Cond, (CPU_TS *)0, &err);
+    } else {
+        p_grp->NbrWaiting++;
+        OSMutexPost(&p_grp->Mutex, OS_OPT_POST_NONE, &err);
+        (void)OSSemPend(&p_grp->Sem, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&p_grp->Mutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+
+
+static  void  BenchCondSignal (BENCH_COND_GRP  *p_grp,
+                               CPU_BOOLEAN      all)
+{
+    OS_ERR  err;
+
+
+    if (p_grp->Mode == BENCH_COND_MODE_COND) {
+        if (all == DEF_YES) {
+            OSCondBroadcast(&p_grp->Cond, OS_OPT_POST_NONE, &err);
+        } else {
+            OSCondSignal(&p_grp->Cond, OS_OPT_POST_NONE, &err);
+        }
+    } else {
+        while (p_grp->NbrWaiting > 0u) {
+            p_grp->NbrWaiting--;
+            (void)OSSemPost(&p_grp->Sem, OS_OPT_POST_1, &err);
+            if (all == DEF_NO) {
+                break;
+            }
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            CONSUMER TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchCondTask (void  *p_arg)
+{
+    BENCH_COND_GRP  *p_grp;
+    CPU_INT32U       seen;
+    OS_ERR           err;
+
+
+    p_grp = (BENCH_COND_GRP *)p_arg;
+
+    OSMutexPend(&p_grp->Mutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    seen = p_grp->Ctr;
+    for (;;) {
+        while (p_grp->Ctr == seen) {
+            BenchCondWait(p_grp);
+        }
+        seen = p_grp->Ctr;
+        p_grp->NbrWakes++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BENCH ONE CASE
+*********************************************************************************************************
+*/
+
+static  void  BenchCondRun (const  CPU_CHAR     *p_test,
+                                   CPU_INT32U    ix,
+                                   CPU_INT32U    mode,
+                                   CPU_INT32U    nbr_waiters)
+{
+    BENCH_COND_GRP  *p_grp;
+    OS_ERR           err;
+    CPU_INT32U       i;
+    OS_CTX_SW_CTR    ctx_sw;
+    CPU_INT64U       t0;
+    CPU_INT64U       ns;
+
+
+    p_grp       = &BenchCondGrp[ix];
+    p_grp->Mode = mode;
+    OSMutexCreate(&p_grp->Mutex, (CPU_CHAR *)"Bench Mutex", &err);
+    OSCondCreate(&p_grp->Cond, (CPU_CHAR *)"Bench Cond", &p_grp->Mutex, &err);
+    OSSemCreate(&p_grp->Sem, (CPU_CHAR *)"Bench Sem", 0u, &err);
+
+    for (i = 0u; i < nbr_waiters; i++) {                        /* Consumers run until they wait                        */
+        OSTaskCreate(&BenchCondTCB[ix][i],
+                     (CPU_CHAR *)"Bench Consumer",
+                      BenchCondTask,
+                     (void *)p_grp,
+                     (OS_PRIO)(BENCH_TASK_PRIO - 1u - i),
+                     &BenchCondStk[ix][i][0],
+                      BENCH_TASK_STK_SIZE / 10u,
+                      BENCH_TASK_STK_SIZE,
+                      0u,
+                      0u,
+                      0,
+                      OS_OPT_TASK_STK_CHK,
+                     &err);
+    }
+
+    ctx_sw = OSTaskCtxSwCtr;
+    t0     = BenchNsGet();
+    for (i = 0u; i < BENCH_COND_ROUNDS; i++) {
+        OSMutexPend(&p_grp->Mutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        p_grp->Ctr++;
+        BenchCondSignal(p_grp, (nbr_waiters > 1u) ? DEF_YES : DEF_NO);
+        OSMutexPost(&p_grp->Mutex, OS_OPT_POST_NONE, &err);
+    }
+    ns     = BenchNsGet() - t0;
+    ctx_sw = OSTaskCtxSwCtr - ctx_sw;
+
+    if (p_grp->NbrWakes != BENCH_COND_ROUNDS * nbr_waiters) {
+        printf("%s: %u wake-ups\n", p_test, (unsigned)p_grp->NbrWakes);
+    }
+    BenchResult(p_test, (ctx_sw + (BENCH_COND_ROUNDS / 2u)) / BENCH_COND_ROUNDS, ns, BENCH_COND_ROUNDS);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchCondMain (void)
+{
+    BenchCondRun("handoff, cond",          0u, BENCH_COND_MODE_COND, 1u);
+    BenchCondRun("handoff, mutex + sem",   1u, BENCH_COND_MODE_EMU,  1u);
+    BenchCondRun("broadcast, cond",        2u, BENCH_COND_MODE_COND, BENCH_COND_WAITERS_MAX);
+    BenchCondRun("broadcast, mutex + sem", 3u, BENCH_COND_MODE_EMU,  BENCH_COND_WAITERS_MAX);
+}
+
+
+int  main (void)
+{
+    BenchRun("Condition variable vs mutex and semaphore emulation", BenchCondMain);
+
+    return (0);
+}
@@ -0,0 +1,171 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_crit.c
+*********************************************************************************************************
+* Note(s)  : (1) Critical sections of the POSIX port, built with and without CPU_CFG_POSIX_INT_FLAG_EN:
+*
+*                    'critical'         an empty CPU_CRITICAL_ENTER()/CPU_CRITICAL_EXIT() pair.
+*                    'sem post + pend'  OSSemPost() then a non-blocking OSSemPend(), as a kernel call
+*                                       made of critical sections.
+*                    'interrupt'        CPU_InterruptTrigger() of a software interrupt whose ISR only
+*                                       counts itself.
+*
+*            (2) The 'n' column is the number of calls per round.  The ISR must have run by the time
+*                CPU_InterruptTrigger() returns, in both modes.
+*
+*            (3) The tick keeps running during the rounds.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_CRIT_ROUNDS                         10000000u
+#define  BENCH_CRIT_ROUNDS_SEM                      1000000u
+#define  BENCH_CRIT_ROUNDS_INT                       200000u
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchCritISR (void);
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_SEM                   BenchCritSem;
+
+static  CPU_INTERRUPT            BenchCritInt = { .NamePtr  = "Bench sw interrupt",
+                                                  .Prio     =  5u,
+                                                  .TraceEn  =  0u,
+                                                  .ISR_Fnct =  BenchCritISR,
+                                                  .En       =  1u,
+                                                };
+
+static  volatile  CPU_INT32U     BenchCritIsrCtr;
+
+
+/*
+*********************************************************************************************************
+*                                         SOFTWARE INTERRUPT
+*********************************************************************************************************
+*/
+
+static  void  BenchCritISR (void)
+{
+    OSIntEnter();
+    BenchCritIsrCtr++;
+    CPU_ISR_End();
+    OSIntExit();
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BENCH ONE CASE
+*********************************************************************************************************
+*/
+
+static  void  BenchCritEmpty (void)
+{
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+    CPU_SR_ALLOC();
+
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_CRIT_ROUNDS; i++) {
+        CPU_CRITICAL_ENTER();
+        CPU_CRITICAL_EXIT();
+    }
+    BenchResult("critical", 1u, BenchNsGet() - t0, BENCH_CRIT_ROUNDS);
+}
+
+
+static  void  BenchCritSemPostPend (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_CRIT_ROUNDS_SEM; i++) {
+        (void)OSSemPost(&BenchCritSem, OS_OPT_POST_1, &err);
+        (void)OSSemPend(&BenchCritSem, 0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+    }
+    BenchResult("sem post + pend", 2u, BenchNsGet() - t0, BENCH_CRIT_ROUNDS_SEM);
+}
+
+
+static  void  BenchCritInterrupt (void)
+{
+    CPU_INT32U  i;
+    CPU_INT32U  late;
+    CPU_INT64U  t0;
+
+
+    BenchCritIsrCtr = 0u;
+    late            = 0u;
+    t0              = BenchNsGet();
+    for (i = 0u; i < BENCH_CRIT_ROUNDS_INT; i++) {
+        CPU_InterruptTrigger(&BenchCritInt);
+        if (BenchCritIsrCtr != (i + 1u)) {                      /* See Note #2.                                         */
+            late++;
+        }
+    }
+    if (late != 0u) {
+        printf("interrupt: %u ISRs not run on return\n", (unsigned)late);
+    }
+    BenchResult("interrupt", 1u, BenchNsGet() - t0, BENCH_CRIT_ROUNDS_INT);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchCritMain (void)
+{
+    OS_ERR  err;
+
+
+    OSSemCreate(&BenchCritSem, (CPU_CHAR *)"Bench Sem", 0u, &err);
+
+    BenchCritEmpty();
+    BenchCritSemPostPend();
+    BenchCritInterrupt();
+}
+
+
+int  main (void)
+{
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    BenchRun("Critical sections, interrupts masked with an atomic flag", BenchCritMain);
+#else
+    BenchRun("Critical sections, interrupts masked with pthread_sigmask()", BenchCritMain);
+#endif
+
+    return (0);
+}
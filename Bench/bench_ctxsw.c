@@ -0,0 +1,208 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_ctxsw.c
+*********************************************************************************************************
+* Note(s)  : (1) Context switches of the POSIX port, with one host thread per task ('thread' and 'flag'
+*                variants) and with every task on a single host thread (OS_CPU_POSIX_UCONTEXT_EN):
+*
+*                    'ping-pong'     the bench task posts the task semaphore of a higher priority task,
+*                                    which counts itself and pends again.
+*                    'isr wake-up'   the same, posted from a software interrupt raised by the bench task,
+*                                    through the ISR handler task.
+*
+*            (2) The 'n' column is the number of context switches per round.
+*
+*            (3) The woken task is created once and never deleted.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_CTXSW_ROUNDS                          200000u
+#define  BENCH_CTXSW_ROUNDS_ISR                      100000u
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchCtxSwISR (void);
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB                   BenchCtxSwHiTCB;
+static  CPU_STK                  BenchCtxSwHiStk[BENCH_TASK_STK_SIZE];
+
+static  CPU_INTERRUPT            BenchCtxSwInt = { .NamePtr  = "Bench sw interrupt",
+                                                   .Prio     =  5u,
+                                                   .TraceEn  =  0u,
+                                                   .ISR_Fnct =  BenchCtxSwISR,
+                                                   .En       =  1u,
+                                                 };
+
+static  volatile  CPU_INT32U     BenchCtxSwHiCtr;
+
+
+/*
+*********************************************************************************************************
+*                                         SOFTWARE INTERRUPT
+*********************************************************************************************************
+*/
+
+static  void  BenchCtxSwISR (void)
+{
+    OS_ERR  err;
+
+
+    OSIntEnter();
+    OSTaskSemPost(&BenchCtxSwHiTCB, OS_OPT_POST_NONE, &err);
+    CPU_ISR_End();
+    OSIntExit();
+}
+
+
+/*
+*********************************************************************************************************
+*                                             WOKEN TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchCtxSwHiTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchCtxSwHiCtr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BENCH ONE CASE
+*********************************************************************************************************
+*/
+
+static  void  BenchCtxSwResult (const  CPU_CHAR       *p_test,
+                                       CPU_INT32U      rounds,
+                                       OS_CTX_SW_CTR   ctx_sw,
+                                       CPU_INT64U      ns)
+{
+    if (BenchCtxSwHiCtr != rounds) {
+        printf("%s: %u wake-ups\n", p_test, (unsigned)BenchCtxSwHiCtr);
+    }
+    BenchResult(p_test, (ctx_sw + (rounds / 2u)) / rounds, ns, rounds);
+}
+
+
+static  void  BenchCtxSwPingPong (void)
+{
+    OS_ERR          err;
+    CPU_INT32U      i;
+    OS_CTX_SW_CTR   ctx_sw;
+    CPU_INT64U      t0;
+    CPU_INT64U      ns;
+
+
+    BenchCtxSwHiCtr = 0u;
+    ctx_sw          = OSTaskCtxSwCtr;
+    t0              = BenchNsGet();
+    for (i = 0u; i < BENCH_CTXSW_ROUNDS; i++) {
+        OSTaskSemPost(&BenchCtxSwHiTCB, OS_OPT_POST_NONE, &err);
+    }
+    ns              = BenchNsGet() - t0;
+    ctx_sw          = OSTaskCtxSwCtr - ctx_sw;
+    BenchCtxSwResult("ping-pong", BENCH_CTXSW_ROUNDS, ctx_sw, ns);
+}
+
+
+static  void  BenchCtxSwIsr (void)
+{
+    OS_ERR          err;
+    CPU_INT32U      i;
+    OS_CTX_SW_CTR   ctx_sw;
+    CPU_INT64U      t0;
+    CPU_INT64U      ns;
+
+
+    BenchCtxSwHiCtr = 0u;
+    ctx_sw          = OSTaskCtxSwCtr;
+    t0              = BenchNsGet();
+    for (i = 0u; i < BENCH_CTXSW_ROUNDS_ISR; i++) {
+        CPU_InterruptTrigger(&BenchCtxSwInt);
+        while (BenchCtxSwHiCtr != (i + 1u)) {                   /* Until the ISR handler task has run                   */
+            OSTimeDly(0u, OS_OPT_TIME_DLY, &err);
+        }
+    }
+    ns              = BenchNsGet() - t0;
+    ctx_sw          = OSTaskCtxSwCtr - ctx_sw;
+    BenchCtxSwResult("isr wake-up", BENCH_CTXSW_ROUNDS_ISR, ctx_sw, ns);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchCtxSwMain (void)
+{
+    OS_ERR  err;
+
+
+    OSTaskCreate(&BenchCtxSwHiTCB,
+                 (CPU_CHAR *)"Bench Woken Task",
+                  BenchCtxSwHiTask,
+                  0,
+                 (OS_PRIO)(BENCH_TASK_PRIO - 1u),
+                 &BenchCtxSwHiStk[0],
+                  BENCH_TASK_STK_SIZE / 10u,
+                  BENCH_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                  OS_OPT_TASK_STK_CHK,
+                 &err);
+
+    BenchCtxSwPingPong();
+    BenchCtxSwIsr();
+}
+
+
+int  main (void)
+{
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    BenchRun("Context switches, all tasks on one host thread", BenchCtxSwMain);
+#elif (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    BenchRun("Context switches, one host thread per task, interrupts masked with an atomic flag", BenchCtxSwMain);
+#else
+    BenchRun("Context switches, one host thread per task, interrupts masked with pthread_sigmask()", BenchCtxSwMain);
+#endif
+
+    return (0);
+}
@@ -0,0 +1,146 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_dyntick.c
+*********************************************************************************************************
+* Note(s)  : (1) Idle-heavy workload: a few tasks wake up periodically with OSTimeDly() and do no work.
+*                Build with OS_CFG_DYN_TICK_EN set to 0 (periodic tick) or 1 (dynamic tick).  Round robin
+*                is disabled in both variants, since it cannot be used with the dynamic tick.  The hooks are
+*                enabled in both, so that the idle task sleeps in the port's OSIdleTaskHook().
+*
+*            (2) Over a fixed window, the bench counts the tick interrupts serviced by the port and the task
+*                wake-ups, and reads the CPU time of the whole process.  With nothing else to do, that CPU
+*                time is the cost of the kernel and of the port's tick.
+*
+*            (3) The '_virt' variants run every task on one host thread, on the port's virtual clock
+*                (CPU_CFG_POSIX_VIRT_TIME_EN).  The window then takes no wall time beyond the CPU time, and
+*                the tick interrupts and wake-ups are the same on every run.
+*
+*            (4) The ticks accounted for by a late tick interrupt and the drift of OSTickCtr from the tick
+*                timer's clock are reported as well.  Both tick variants generate ticks at absolute deadlines,
+*                so the drift stays within about one tick however long the window is.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdint.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_DYN_TASKS                                  8u
+#define  BENCH_DYN_PERIOD_MIN                            10u    /* Task i waits MIN * (i + 1) ticks                     */
+#define  BENCH_DYN_WARMUP                               100u
+#define  BENCH_DYN_WINDOW                              2000u    /* In ticks                                             */
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB                   BenchDynTCB[BENCH_DYN_TASKS];
+static  CPU_STK                  BenchDynStk[BENCH_DYN_TASKS][BENCH_TASK_STK_SIZE];
+
+static  volatile  CPU_INT32U     BenchDynWakes;
+
+
+/*
+*********************************************************************************************************
+*                                            PERIODIC TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchDynTask (void  *p_arg)
+{
+    OS_TICK  period;
+    OS_ERR   err;
+
+
+    period = (OS_TICK)(uintptr_t)p_arg;
+    for (;;) {
+        OSTimeDly(period, OS_OPT_TIME_PERIODIC, &err);
+        BenchDynWakes++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchDynMain (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT32U  wakes;
+    CPU_INT32U  irqs;
+    CPU_INT32U  missed;
+    CPU_INT64U  t0;
+    CPU_INT64U  ns_wall;
+    CPU_INT64U  ns_cpu;
+
+
+    for (i = 0u; i < BENCH_DYN_TASKS; i++) {
+        OSTaskCreate(&BenchDynTCB[i],
+                     (CPU_CHAR *)"Bench Periodic",
+                      BenchDynTask,
+                     (void *)(uintptr_t)(BENCH_DYN_PERIOD_MIN * (i + 1u)),
+                     (OS_PRIO)(BENCH_TASK_PRIO + 1u + i),
+                     &BenchDynStk[i][0],
+                      BENCH_TASK_STK_SIZE / 10u,
+                      BENCH_TASK_STK_SIZE,
+                      0u,
+                      0u,
+                      0,
+                      OS_OPT_TASK_STK_CHK,
+                     &err);
+    }
+    OSTimeDly(BENCH_DYN_WARMUP, OS_OPT_TIME_DLY, &err);
+
+    wakes   = BenchDynWakes;
+    irqs    = OS_CPU_TickIntCtr;
+    missed  = OS_CPU_TickMissedCtr;
+    ns_cpu  = BenchProcessNsGet();
+    t0      = BenchNsGet();
+    OSTimeDly(BENCH_DYN_WINDOW, OS_OPT_TIME_DLY, &err);
+    ns_wall = BenchNsGet() - t0;
+    ns_cpu  = BenchProcessNsGet() - ns_cpu;
+    wakes   = BenchDynWakes - wakes;
+    irqs    = OS_CPU_TickIntCtr - irqs;
+    missed  = OS_CPU_TickMissedCtr - missed;
+
+    BenchResult("tick interrupts", irqs, 0u, 0u);
+    BenchResult("ticks missed", missed, 0u, 0u);               /* See Note #4.                                         */
+    BenchResult("task wake-ups", wakes, 0u, 0u);
+    BenchResult("cpu per wake-up", wakes, ns_cpu, wakes);
+    BenchResult("cpu per tick window", BENCH_DYN_WINDOW, ns_cpu, BENCH_DYN_WINDOW);
+    BenchResult("wall per tick window", BENCH_DYN_WINDOW, ns_wall, BENCH_DYN_WINDOW);
+    printf("tick drift: %lld ns\n", (long long)OS_CPU_TickDriftGet());
+}
+
+
+int  main (void)
+{
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)
+    BenchRun((OS_CFG_DYN_TICK_EN > 0u) ? "Idle-heavy workload, dynamic tick, virtual time" : "Idle-heavy workload, periodic tick, virtual time",
+              BenchDynMain);
+#else
+    BenchRun((OS_CFG_DYN_TICK_EN > 0u) ? "Idle-heavy workload, dynamic tick" : "Idle-heavy workload, periodic tick",
+              BenchDynMain);
+#endif
+
+    return (0);
+}
@@ -0,0 +1,348 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_heap.c
+*********************************************************************************************************
+* Note(s)  : (1) Segment heap (TLSF, 'lib_mem.c'  Mem_SegHeapAlloc()) vs the C library allocator.  Both run
+*                the same workload of BENCH_HEAP_OPS operations on BENCH_HEAP_SLOTS slots : a random slot is
+*                allocated when empty, otherwise reallocated (1 in 4) or freed.  Sizes are 16..256 octets
+*                (80%), 256..4096 octets (18%) and 4096..65536 octets (2%).
+*
+*            (2) The C library calls are made under a kernel mutex, as the toolchain's malloc lock hooks do
+*                on the target.  On the host the C library is glibc, not newlib : its figures are a
+*                reference for a general purpose allocator, not the target's.
+*
+*            (3) Each operation is timed and goes to a log-linear histogram of
+*                'Drivers/BSP/latency/lat_hist.c'.  Results are printed as CSV lines:
+*
+*                    heap,<variant>,<allocator>_<op>,<n>,<min ns>,<avg ns>,<p50 ns>,<p90 ns>,<p99 ns>,<p99.9 ns>,<max ns>
+*
+*                followed by the segment heap statistics of Mem_SegHeapRemSizeGet() and by the
+*                Mem_OutputUsage() report.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <lib_mem.h>
+#include  "bench.h"
+#include  "lat_hist.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_HEAP_OPS                            1000000u
+#define  BENCH_HEAP_SLOTS                             1024u
+#define  BENCH_HEAP_SIZE                   (8u * 1024u * 1024u)  /* Segment of the TLSF heap                             */
+#define  BENCH_HEAP_SEED                        0x2545F491u     /* Same workload for every allocator                    */
+
+#define  BENCH_HEAP_OP_ALLOC                             0u
+#define  BENCH_HEAP_OP_FREE                              1u
+#define  BENCH_HEAP_OP_REALLOC                           2u
+#define  BENCH_HEAP_OP_NBR                               3u
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  bench_heap_alloc {                             /* One allocator under test                             */
+    const  CPU_CHAR  *NamePtr;
+    void           *(*AllocFnct)  (CPU_SIZE_T  size);
+    void            (*FreeFnct)   (void       *p_mem);
+    void           *(*ReallocFnct)(void       *p_mem,
+                                   CPU_SIZE_T  size);
+} BENCH_HEAP_ALLOC;
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  *BenchHeapSegAlloc    (CPU_SIZE_T  size);
+static  void   BenchHeapSegFree     (void       *p_mem);
+static  void  *BenchHeapSegRealloc  (void       *p_mem,
+                                     CPU_SIZE_T  size);
+static  void  *BenchHeapLibcAlloc   (CPU_SIZE_T  size);
+static  void   BenchHeapLibcFree    (void       *p_mem);
+static  void  *BenchHeapLibcRealloc (void       *p_mem,
+                                     CPU_SIZE_T  size);
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U        BenchHeapMem[BENCH_HEAP_SIZE] __attribute__((aligned(16)));
+static  MEM_SEG           BenchHeapSeg;
+static  MEM_SEG_HEAP      BenchHeapSegHeap;
+static  OS_MUTEX          BenchHeapLibcMutex;
+
+static  void             *BenchHeapSlotTbl[BENCH_HEAP_SLOTS];
+static  CPU_SIZE_T        BenchHeapSlotSize[BENCH_HEAP_SLOTS];
+static  CPU_INT32U        BenchHeapFailCtr;
+
+static  LAT_HIST          BenchHeapHist[BENCH_HEAP_OP_NBR];
+
+static  const  CPU_CHAR  *BenchHeapOpName[BENCH_HEAP_OP_NBR] = { "alloc", "free", "realloc" };
+
+static  const  BENCH_HEAP_ALLOC  BenchHeapAllocTbl[] = {
+    { "tlsf", BenchHeapSegAlloc,  BenchHeapSegFree,  BenchHeapSegRealloc  },
+    { "libc", BenchHeapLibcAlloc, BenchHeapLibcFree, BenchHeapLibcRealloc },
+};
+
+
+/*
+*********************************************************************************************************
+*                                             ALLOCATORS
+*********************************************************************************************************
+*/
+
+static  void  *BenchHeapSegAlloc (CPU_SIZE_T  size)
+{
+    LIB_ERR  err;
+
+
+    return (Mem_SegHeapAlloc(&BenchHeapSegHeap, size, &err));
+}
+
+
+static  void  BenchHeapSegFree (void  *p_mem)
+{
+    LIB_ERR  err;
+
+
+    Mem_SegHeapFree(&BenchHeapSegHeap, p_mem, &err);
+}
+
+
+static  void  *BenchHeapSegRealloc (void        *p_mem,
+                                    CPU_SIZE_T   size)
+{
+    LIB_ERR  err;
+
+
+    return (Mem_SegHeapRealloc(&BenchHeapSegHeap, p_mem, size, &err));
+}
+
+
+static  void  *BenchHeapLibcAlloc (CPU_SIZE_T  size)
+{
+    void    *p_mem;
+    OS_ERR   err;
+
+
+    OSMutexPend(&BenchHeapLibcMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    p_mem = malloc(size);
+    OSMutexPost(&BenchHeapLibcMutex, OS_OPT_POST_NONE, &err);
+
+    return (p_mem);
+}
+
+
+static  void  BenchHeapLibcFree (void  *p_mem)
+{
+    OS_ERR  err;
+
+
+    OSMutexPend(&BenchHeapLibcMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    free(p_mem);
+    OSMutexPost(&BenchHeapLibcMutex, OS_OPT_POST_NONE, &err);
+}
+
+
+static  void  *BenchHeapLibcRealloc (void        *p_mem,
+                                     CPU_SIZE_T   size)
+{
+    void    *p_mem_new;
+    OS_ERR   err;
+
+
+    OSMutexPend(&BenchHeapLibcMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    p_mem_new = realloc(p_mem, size);
+    OSMutexPost(&BenchHeapLibcMutex, OS_OPT_POST_NONE, &err);
+
+    return (p_mem_new);
+}
+
+
+/*
+*********************************************************************************************************
+*                                              WORKLOAD
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  BenchHeapSizeGet (void)
+{
+    CPU_INT32U  r;
+
+
+    r = BenchRandGet() % 100u;
+    if (r < 80u) {
+        return (  16u + (BenchRandGet() %   241u));
+    } else if (r < 98u) {
+        return ( 256u + (BenchRandGet() %  3841u));
+    } else {
+        return (4096u + (BenchRandGet() % 61441u));
+    }
+}
+
+
+static  void  BenchHeapRun (const  BENCH_HEAP_ALLOC  *p_alloc)
+{
+    CPU_INT32U   i;
+    CPU_INT32U   slot;
+    CPU_INT32U   op;
+    CPU_SIZE_T   size;
+    CPU_INT08U  *p_mem;
+    CPU_INT64U   t0;
+    CPU_INT64U   t1;
+    CPU_CHAR     name[32];
+
+
+    for (op = 0u; op < BENCH_HEAP_OP_NBR; op++) {
+        LatHist_Init(&BenchHeapHist[op]);
+    }
+    for (slot = 0u; slot < BENCH_HEAP_SLOTS; slot++) {
+        BenchHeapSlotTbl[slot] = DEF_NULL;
+    }
+    BenchHeapFailCtr = 0u;
+    BenchRandSeed(BENCH_HEAP_SEED);
+
+    for (i = 0u; i < BENCH_HEAP_OPS; i++) {
+        slot  = BenchRandGet() % BENCH_HEAP_SLOTS;
+        p_mem = BenchHeapSlotTbl[slot];
+        if (p_mem == DEF_NULL) {
+            op    = BENCH_HEAP_OP_ALLOC;
+            size  = BenchHeapSizeGet();
+            t0    = BenchNsGet();
+            p_mem = p_alloc->AllocFnct(size);
+            t1    = BenchNsGet();
+        } else if ((BenchRandGet() % 4u) == 0u) {
+            op    = BENCH_HEAP_OP_REALLOC;
+            size  = BenchHeapSizeGet();
+            t0    = BenchNsGet();
+            p_mem = p_alloc->ReallocFnct(p_mem, size);
+            t1    = BenchNsGet();
+            if (p_mem == DEF_NULL) {                            /* Block left untouched, keep it                        */
+                p_mem = BenchHeapSlotTbl[slot];
+                size  = BenchHeapSlotSize[slot];
+                BenchHeapFailCtr++;
+            } else if (p_mem[0] != (CPU_INT08U)slot) {          /* Content must survive the move                        */
+                printf("# %s: realloc lost the content of slot %u\n", p_alloc->NamePtr, (unsigned)slot);
+            }
+        } else {
+            op    = BENCH_HEAP_OP_FREE;
+            size  = 0u;
+            t0    = BenchNsGet();
+            p_alloc->FreeFnct(p_mem);
+            t1    = BenchNsGet();
+            p_mem = DEF_NULL;
+        }
+        LatHist_Add(&BenchHeapHist[op], (CPU_INT32U)(t1 - t0));
+
+        if (p_mem != DEF_NULL) {                                /* Touch both ends of the block                         */
+            p_mem[0]         = (CPU_INT08U)slot;
+            p_mem[size - 1u] = (CPU_INT08U)slot;
+        } else if (op == BENCH_HEAP_OP_ALLOC) {
+            BenchHeapFailCtr++;
+        }
+        BenchHeapSlotTbl[slot]  = p_mem;
+        BenchHeapSlotSize[slot] = size;
+    }
+
+    for (op = 0u; op < BENCH_HEAP_OP_NBR; op++) {
+        (void)snprintf(name, sizeof(name), "%s_%s", p_alloc->NamePtr, BenchHeapOpName[op]);
+        LatHist_Export(&BenchHeapHist[op], "heap," BENCH_VARIANT, name, 1000000000u);
+    }
+    printf("# %s: %u failed allocations\n", p_alloc->NamePtr, (unsigned)BenchHeapFailCtr);
+}
+
+
+static  void  BenchHeapOut (CPU_CHAR  *p_str)
+{
+    printf("%s", p_str);
+    fflush(stdout);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchHeapMain (void)
+{
+    MEM_SEG_HEAP_INFO  info;
+    CPU_INT32U         slot;
+    LIB_ERR            lib_err;
+    OS_ERR             err;
+
+
+    Mem_Init();
+    Mem_SegCreate("Bench heap seg", &BenchHeapSeg, (CPU_ADDR)&BenchHeapMem[0], BENCH_HEAP_SIZE,
+                   LIB_MEM_PADDING_ALIGN_NONE, &lib_err);
+    if (lib_err == LIB_MEM_ERR_NONE) {
+        Mem_SegHeapCreate("Bench TLSF heap", &BenchHeapSegHeap, &BenchHeapSeg, 0u, &lib_err);
+    }
+    if (lib_err != LIB_MEM_ERR_NONE) {
+        printf("# Segment heap creation failed: %u\n", (unsigned)lib_err);
+        return;
+    }
+    OSMutexCreate(&BenchHeapLibcMutex, (CPU_CHAR *)"Bench libc mutex", &err);
+
+    LatHist_ExportHdr("heap,variant");
+    BenchHeapRun(&BenchHeapAllocTbl[0]);
+
+    (void)Mem_SegHeapRemSizeGet(&BenchHeapSegHeap, &info, &lib_err);
+    printf("heap_stat,%s,used,%lu,peak,%lu,total,%lu,free_blk_max,%lu,used_blks,%lu,free_blks,%lu,frag_pct,%u,fail,%lu\n",
+            BENCH_VARIANT,
+           (unsigned long)info.UsedSize,
+           (unsigned long)info.UsedSizeMax,
+           (unsigned long)info.TotalSize,
+           (unsigned long)info.FreeBlkSizeMax,
+           (unsigned long)info.UsedBlkNbr,
+           (unsigned long)info.FreeBlkNbr,
+           (unsigned)info.FragPct,
+           (unsigned long)info.AllocFailCtr);
+    Mem_OutputUsage(BenchHeapOut, &lib_err);
+
+    for (slot = 0u; slot < BENCH_HEAP_SLOTS; slot++) {          /* Everything freed : one free blk, no frag             */
+        if (BenchHeapSlotTbl[slot] != DEF_NULL) {
+            BenchHeapSegFree(BenchHeapSlotTbl[slot]);
+        }
+    }
+    (void)Mem_SegHeapRemSizeGet(&BenchHeapSegHeap, &info, &lib_err);
+    if ((info.UsedSize != 0u) || (info.FreeBlkNbr != 1u)) {
+        printf("# tlsf: %lu octets and %lu free blocks left after freeing everything\n",
+               (unsigned long)info.UsedSize, (unsigned long)info.FreeBlkNbr);
+    }
+
+    BenchHeapRun(&BenchHeapAllocTbl[1]);
+    for (slot = 0u; slot < BENCH_HEAP_SLOTS; slot++) {
+        BenchHeapLibcFree(BenchHeapSlotTbl[slot]);
+    }
+}
+
+
+int  main (void)
+{
+    BenchRun("Segment heap (TLSF) vs C library allocator", BenchHeapMain);
+
+    return (0);
+}
@@ -0,0 +1,185 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_intlat.c
+*********************************************************************************************************
+* Note(s)  : (1) Interrupt latency, both intervals of every event:
+*
+*                    'irq_to_isr'    from CPU_InterruptTrigger() in the bench task to the first instruction
+*                                    of the ISR.
+*                    'isr_to_task'   from the first instruction of the ISR, which posts the task semaphore
+*                                    of a higher priority task, to the first instruction of that task after
+*                                    OSTaskSemPend() returns.
+*
+*                The woken task then posts the bench task's semaphore, so one event is in flight at a time.
+*
+*            (2) Samples go to the log-linear histograms of 'Drivers/BSP/latency/lat_hist.c', which are also
+*                used by the STM32 harness.  Results are printed as CSV lines:
+*
+*                    intlat,<variant>,<name>,<n>,<min ns>,<avg ns>,<p50 ns>,<p90 ns>,<p99 ns>,<p99.9 ns>,<max ns>
+*
+*                Percentiles are the upper bound of their bucket, accurate to 1/16.  With BENCH_INTLAT_BKT_EN,
+*                the non-empty buckets follow as 'intlat_bkt,<variant>/<name>,<lo ns>,<hi ns>,<count>' lines.
+*
+*            (3) The tick keeps running during the rounds.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+#include  "lat_hist.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_INTLAT_ROUNDS                        100000u
+
+#define  BENCH_INTLAT_HI_PRIO      (OS_PRIO)(BENCH_TASK_PRIO - 1u)
+
+#ifndef  BENCH_INTLAT_BKT_EN
+#define  BENCH_INTLAT_BKT_EN                             0u     /* Print the histogram buckets, see Note #2             */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchIntLatISR (void);
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INTERRUPT            BenchIntLatInt = { .NamePtr  = "Bench intlat interrupt",
+                                                    .Prio     =  5u,
+                                                    .TraceEn  =  0u,
+                                                    .ISR_Fnct =  BenchIntLatISR,
+                                                    .En       =  1u,
+                                                  };
+
+static  OS_TCB                   BenchIntLatTCB;
+static  CPU_STK                  BenchIntLatStk[BENCH_TASK_STK_SIZE];
+static  OS_TCB                  *BenchIntLatBenchTCBPtr;        /* Bench task, posted by the woken task                 */
+
+static  volatile  CPU_INT64U     BenchIntLatT0;                 /* Trigger time                                         */
+static  volatile  CPU_INT64U     BenchIntLatT1;                 /* First instruction of the ISR                         */
+
+static  LAT_HIST                 BenchIntLatIsrHist;
+static  LAT_HIST                 BenchIntLatTaskHist;
+
+
+/*
+*********************************************************************************************************
+*                                        SOFTWARE ISR AND WOKEN TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchIntLatISR (void)
+{
+    CPU_INT64U  t1;
+    OS_ERR      err;
+
+
+    t1 = BenchNsGet();
+    OSIntEnter();
+    BenchIntLatT1 = t1;
+    LatHist_Add(&BenchIntLatIsrHist, (CPU_INT32U)(t1 - BenchIntLatT0));
+    (void)OSTaskSemPost(&BenchIntLatTCB, OS_OPT_POST_NONE, &err);
+    CPU_ISR_End();
+    OSIntExit();
+}
+
+
+static  void  BenchIntLatTask (void  *p_arg)
+{
+    CPU_INT64U  t2;
+    OS_ERR      err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        t2 = BenchNsGet();
+        LatHist_Add(&BenchIntLatTaskHist, (CPU_INT32U)(t2 - BenchIntLatT1));
+        (void)OSTaskSemPost(BenchIntLatBenchTCBPtr, OS_OPT_POST_NONE, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchIntLatMain (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+
+
+    LatHist_Init(&BenchIntLatIsrHist);
+    LatHist_Init(&BenchIntLatTaskHist);
+    BenchIntLatBenchTCBPtr = OSTCBCurPtr;
+
+    OSTaskCreate(&BenchIntLatTCB,
+                 (CPU_CHAR *)"Bench IntLat Task",
+                  BenchIntLatTask,
+                  0,
+                  BENCH_INTLAT_HI_PRIO,
+                 &BenchIntLatStk[0],
+                  BENCH_TASK_STK_SIZE / 10u,
+                  BENCH_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                  OS_OPT_TASK_STK_CHK,
+                 &err);
+    if (err != OS_ERR_NONE) {
+        printf("# OSTaskCreate() failed: %u\n", (unsigned)err);
+        return;
+    }
+
+    for (i = 0u; i < BENCH_INTLAT_ROUNDS; i++) {
+        BenchIntLatT0 = BenchNsGet();
+        CPU_InterruptTrigger(&BenchIntLatInt);
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+
+    LatHist_ExportHdr("intlat,variant");
+    LatHist_Export(&BenchIntLatIsrHist,  "intlat," BENCH_VARIANT, "irq_to_isr",  1000000000u);
+    LatHist_Export(&BenchIntLatTaskHist, "intlat," BENCH_VARIANT, "isr_to_task", 1000000000u);
+#if (BENCH_INTLAT_BKT_EN > 0u)
+    LatHist_Dump(&BenchIntLatIsrHist,    "intlat", BENCH_VARIANT "/irq_to_isr",  1000000000u);
+    LatHist_Dump(&BenchIntLatTaskHist,   "intlat", BENCH_VARIANT "/isr_to_task", 1000000000u);
+#endif
+}
+
+
+int  main (void)
+{
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    BenchRun("Interrupt latency, all tasks on one host thread", BenchIntLatMain);
+#elif (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    BenchRun("Interrupt latency, one host thread per task, interrupts masked with an atomic flag", BenchIntLatMain);
+#else
+    BenchRun("Interrupt latency, one host thread per task, interrupts masked with pthread_sigmask()", BenchIntLatMain);
+#endif
+
+    return (0);
+}
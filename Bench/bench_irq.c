@@ -0,0 +1,220 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_irq.c
+*********************************************************************************************************
+* Note(s)  : (1) Latency of the simulated interrupts of the POSIX port, from the trigger to the first
+*                instruction of the ISR:
+*
+*                    'trigger'       the bench task calls CPU_InterruptTrigger().
+*                    'timer'         a one-shot simulated timer expires, its host thread queues the
+*                                    interrupt and the ISR runs in the bench task's thread.  The bench
+*                                    task waits for the ISR in a loop of critical sections, then arms
+*                                    the next deadline.
+*
+*            (2) The 'n' column is the number of interrupts that did not run.  Latencies are printed as
+*                percentiles, in ns.
+*
+*            (3) The tick keeps running during the rounds.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_IRQ_ROUNDS                          1000000u
+#define  BENCH_IRQ_ROUNDS_TMR                       100000u
+
+#define  BENCH_IRQ_TMR_DLY_NS                         5000u     /* Deadline, from the time it is armed                  */
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchIrqTriggerISR (void);
+static  void  BenchIrqTmrISR     (void);
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INTERRUPT            BenchIrqInt = { .NamePtr  = "Bench sw interrupt",
+                                                 .Prio     =  5u,
+                                                 .TraceEn  =  0u,
+                                                 .ISR_Fnct =  BenchIrqTriggerISR,
+                                                 .En       =  1u,
+                                               };
+
+static  CPU_TMR_INTERRUPT        BenchIrqTmr = { .Interrupt.NamePtr  = "Bench tmr interrupt",
+                                                 .Interrupt.Prio     =  5u,
+                                                 .Interrupt.TraceEn  =  0u,
+                                                 .Interrupt.ISR_Fnct =  BenchIrqTmrISR,
+                                                 .Interrupt.En       =  1u,
+                                               };
+
+static  volatile  CPU_INT64U     BenchIrqT0;                    /* Trigger time or deadline of the current round        */
+static  volatile  CPU_INT32U     BenchIrqNbr;                   /* Latencies recorded                                   */
+static  CPU_INT32U               BenchIrqLat[BENCH_IRQ_ROUNDS];
+
+
+/*
+*********************************************************************************************************
+*                                        SOFTWARE AND TIMER ISRs
+*********************************************************************************************************
+*/
+
+static  void  BenchIrqTriggerISR (void)
+{
+    CPU_INT64U  t1;
+
+
+    t1 = BenchNsGet();
+    OSIntEnter();
+    BenchIrqLat[BenchIrqNbr] = (CPU_INT32U)(t1 - BenchIrqT0);
+    BenchIrqNbr++;
+    CPU_ISR_End();
+    OSIntExit();
+}
+
+
+static  void  BenchIrqTmrISR (void)
+{
+    CPU_INT64U  t1;
+
+
+    t1 = CPU_TmrInterruptTimeGet();
+    OSIntEnter();
+    BenchIrqLat[BenchIrqNbr] = (CPU_INT32U)(t1 - BenchIrqT0);
+    BenchIrqNbr++;
+    CPU_ISR_End();
+    OSIntExit();
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BENCH ONE CASE
+*********************************************************************************************************
+*/
+
+static  int  BenchIrqCmp (const  void  *p_a,
+                          const  void  *p_b)
+{
+    CPU_INT32U  a;
+    CPU_INT32U  b;
+
+
+    a = *(const CPU_INT32U *)p_a;
+    b = *(const CPU_INT32U *)p_b;
+
+    return ((a > b) - (a < b));
+}
+
+
+static  CPU_INT32U  BenchIrqPct (CPU_INT32U  nbr,
+                                 CPU_INT32U  pct_x10)
+{
+    return (BenchIrqLat[((CPU_INT64U)(nbr - 1u) * pct_x10) / 1000u]);
+}
+
+
+static  void  BenchIrqResult (const  CPU_CHAR    *p_test,
+                                     CPU_INT32U   rounds,
+                                     CPU_INT64U   ns)
+{
+    CPU_INT32U  nbr;
+
+
+    nbr = BenchIrqNbr;
+    BenchResult(p_test, rounds - nbr, ns, rounds);
+    if (nbr == 0u) {
+        return;
+    }
+
+    qsort(BenchIrqLat, nbr, sizeof(BenchIrqLat[0]), BenchIrqCmp);
+    printf("  latency ns: p50 %u  p90 %u  p99 %u  p99.9 %u  max %u\n",
+           (unsigned)BenchIrqPct(nbr,  500u),
+           (unsigned)BenchIrqPct(nbr,  900u),
+           (unsigned)BenchIrqPct(nbr,  990u),
+           (unsigned)BenchIrqPct(nbr,  999u),
+           (unsigned)BenchIrqLat[nbr - 1u]);
+}
+
+
+static  void  BenchIrqTrigger (void)
+{
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+
+
+    BenchIrqNbr = 0u;
+    t0          = BenchNsGet();
+    for (i = 0u; i < BENCH_IRQ_ROUNDS; i++) {
+        BenchIrqT0 = BenchNsGet();
+        CPU_InterruptTrigger(&BenchIrqInt);
+    }
+    BenchIrqResult("trigger", BENCH_IRQ_ROUNDS, BenchNsGet() - t0);
+}
+
+
+static  void  BenchIrqTimer (void)
+{
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+    CPU_SR_ALLOC();
+
+
+    CPU_TmrInterruptDeadlineCreate(&BenchIrqTmr);
+
+    BenchIrqNbr = 0u;
+    t0          = BenchNsGet();
+    for (i = 0u; i < BENCH_IRQ_ROUNDS_TMR; i++) {
+        BenchIrqT0 = CPU_TmrInterruptTimeGet() + BENCH_IRQ_TMR_DLY_NS;
+        CPU_TmrInterruptDeadlineSet(&BenchIrqTmr, BenchIrqT0);
+        while (BenchIrqNbr == i) {                              /* Interrupts are run when they are enabled             */
+            CPU_CRITICAL_ENTER();
+            CPU_CRITICAL_EXIT();
+        }
+    }
+    CPU_TmrInterruptDeadlineSet(&BenchIrqTmr, 0u);
+    BenchIrqResult("timer", BENCH_IRQ_ROUNDS_TMR, BenchNsGet() - t0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchIrqMain (void)
+{
+    BenchIrqTrigger();
+    BenchIrqTimer();
+}
+
+
+int  main (void)
+{
+    BenchRun("Simulated interrupt latency", BenchIrqMain);
+
+    return (0);
+}
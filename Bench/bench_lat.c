@@ -0,0 +1,432 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_lat.c
+*********************************************************************************************************
+* Note(s)  : (1) Latency of the kernel services, one sample per round, timed with OS_TS_GET():
+*
+*                    'sem ping-pong'     OSSemPost() to a higher priority task, which posts a second
+*                                        semaphore back: round trip until the bench task's OSSemPend()
+*                                        returns.
+*                    'task sem signal'   OSTaskSemPost() until the higher priority task returns from
+*                                        OSTaskSemPend().
+*                    'q round-trip'      OSQPost() of a message that the higher priority task posts back
+*                                        to a second queue: round trip until OSQPend() returns it.
+*                    'flag fan-out'      one OSFlagPost() of BENCH_LAT_FLAG_TASKS bits, until the last of
+*                                        the tasks pending on one bit each returns from OSFlagPend().
+*                    'mutex hand-off'    the bench task pends on a mutex owned by a lower priority task,
+*                                        which inherits the bench task's priority and releases it: from
+*                                        OSMutexPost() until the bench task's OSMutexPend() returns.
+*                    'time dly jitter'   OSTimeDly(1): from the tick interrupt until OSTimeDly() returns.
+*                    'tmr callback'      OSTmrStart() of a one-shot timer of one timer tick: from the tick
+*                                        interrupt until the callback runs.
+*
+*            (2) Results are printed as CSV lines, see 'bench.c  BenchLatResult()'.  The tick interrupt is
+*                timed by the tick hook, which requires OS_CFG_APP_HOOKS_EN.
+*
+*            (3) The tasks are created once and never deleted.  Between the cases, they wait on their own
+*                kernel object.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_LAT_ROUNDS                             10000u
+#define  BENCH_LAT_ROUNDS_TICK                         2000u    /* One tick per round                                   */
+
+#define  BENCH_LAT_FLAG_TASKS                             4u
+
+#define  BENCH_LAT_HI_PRIO         (OS_PRIO)(BENCH_TASK_PRIO - 1u)
+#define  BENCH_LAT_LO_PRIO         (OS_PRIO)(BENCH_TASK_PRIO + 2u)
+
+#if (OS_CFG_APP_HOOKS_EN == 0u)
+#error  "bench_lat.c requires OS_CFG_APP_HOOKS_EN, see Note #2"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB                   BenchLatSemTCB;
+static  CPU_STK                  BenchLatSemStk[BENCH_TASK_STK_SIZE];
+static  OS_TCB                   BenchLatTaskSemTCB;
+static  CPU_STK                  BenchLatTaskSemStk[BENCH_TASK_STK_SIZE];
+static  OS_TCB                   BenchLatQTCB;
+static  CPU_STK                  BenchLatQStk[BENCH_TASK_STK_SIZE];
+static  OS_TCB                   BenchLatFlagTCB[BENCH_LAT_FLAG_TASKS];
+static  CPU_STK                  BenchLatFlagStk[BENCH_LAT_FLAG_TASKS][BENCH_TASK_STK_SIZE];
+static  OS_TCB                   BenchLatMutexTCB;
+static  CPU_STK                  BenchLatMutexStk[BENCH_TASK_STK_SIZE];
+
+static  OS_SEM                   BenchLatSemPing;
+static  OS_SEM                   BenchLatSemPong;
+static  OS_SEM                   BenchLatSemHeld;               /* Mutex owned by the lower priority task               */
+static  OS_SEM                   BenchLatSemTmr;
+static  OS_Q                     BenchLatQPing;
+static  OS_Q                     BenchLatQPong;
+static  OS_FLAG_GRP              BenchLatFlagGrp;
+static  OS_MUTEX                 BenchLatMutex;
+static  OS_TMR                   BenchLatTmr;
+
+static  volatile  CPU_TS         BenchLatTickTS;                /* Time of the last tick interrupt                      */
+static  volatile  CPU_TS         BenchLatWakeTS;                /* Time the woken task or callback ran                  */
+static  volatile  CPU_TS         BenchLatFlagTS[BENCH_LAT_FLAG_TASKS];
+static  volatile  CPU_INT32U     BenchLatInheritErrCtr;
+
+static  CPU_TS                   BenchLatTbl[BENCH_LAT_ROUNDS];
+
+
+/*
+*********************************************************************************************************
+*                                              TICK HOOK
+*********************************************************************************************************
+*/
+
+static  void  BenchLatTickHook (void)
+{
+    BenchLatTickTS = OS_TS_GET();
+}
+
+
+/*
+*********************************************************************************************************
+*                                            WOKEN TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchLatSemTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSSemPend(&BenchLatSemPing, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        (void)OSSemPost(&BenchLatSemPong, OS_OPT_POST_1, &err);
+    }
+}
+
+
+static  void  BenchLatTaskSemTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchLatWakeTS = OS_TS_GET();
+    }
+}
+
+
+static  void  BenchLatQTask (void  *p_arg)
+{
+    OS_ERR       err;
+    OS_MSG_SIZE  size;
+    void        *p_msg;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        p_msg = OSQPend(&BenchLatQPing, 0u, OS_OPT_PEND_BLOCKING, &size, (CPU_TS *)0, &err);
+        OSQPost(&BenchLatQPong, p_msg, size, OS_OPT_POST_FIFO, &err);
+    }
+}
+
+
+static  void  BenchLatFlagTask (void  *p_arg)
+{
+    OS_ERR      err;
+    CPU_INT32U  ix;
+
+
+    ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+
+    for (;;) {
+        (void)OSFlagPend(&BenchLatFlagGrp,
+                         (OS_FLAGS)(1u << ix),
+                          0u,
+                         (OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_BLOCKING),
+                         (CPU_TS *)0,
+                         &err);
+        BenchLatFlagTS[ix] = OS_TS_GET();
+    }
+}
+
+
+static  void  BenchLatMutexTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&BenchLatMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        (void)OSSemPost(&BenchLatSemHeld, OS_OPT_POST_1, &err); /* The bench task runs and pends on the mutex          */
+        if (BenchLatMutexTCB.Prio != BENCH_TASK_PRIO) {         /* Priority inherited from the bench task?              */
+            BenchLatInheritErrCtr++;
+        }
+        BenchLatWakeTS = OS_TS_GET();
+        OSMutexPost(&BenchLatMutex, OS_OPT_POST_NONE, &err);
+    }
+}
+
+
+static  void  BenchLatTmrCallback (void  *p_tmr,
+                                   void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_tmr;
+    (void)p_arg;
+
+    BenchLatWakeTS = OS_TS_GET() - BenchLatTickTS;
+    (void)OSSemPost(&BenchLatSemTmr, OS_OPT_POST_1, &err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                              BENCH CASES
+*********************************************************************************************************
+*/
+
+static  void  BenchLatSem (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_TS      ts;
+
+
+    for (i = 0u; i < BENCH_LAT_ROUNDS; i++) {
+        ts = OS_TS_GET();
+        (void)OSSemPost(&BenchLatSemPing, OS_OPT_POST_1, &err);
+        (void)OSSemPend(&BenchLatSemPong, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchLatTbl[i] = OS_TS_GET() - ts;
+    }
+    BenchLatResult("sem ping-pong", BenchLatTbl, BENCH_LAT_ROUNDS);
+}
+
+
+static  void  BenchLatTaskSem (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_TS      ts;
+
+
+    for (i = 0u; i < BENCH_LAT_ROUNDS; i++) {
+        ts = OS_TS_GET();
+        (void)OSTaskSemPost(&BenchLatTaskSemTCB, OS_OPT_POST_NONE, &err);
+        BenchLatTbl[i] = BenchLatWakeTS - ts;                   /* The woken task ran before the post returned          */
+    }
+    BenchLatResult("task sem signal", BenchLatTbl, BENCH_LAT_ROUNDS);
+}
+
+
+static  void  BenchLatQ (void)
+{
+    OS_ERR       err;
+    OS_MSG_SIZE  size;
+    CPU_INT32U   i;
+    CPU_TS       ts;
+
+
+    for (i = 0u; i < BENCH_LAT_ROUNDS; i++) {
+        ts = OS_TS_GET();
+        OSQPost(&BenchLatQPing, (void *)&BenchLatTbl[i], sizeof(BenchLatTbl[i]), OS_OPT_POST_FIFO, &err);
+        (void)OSQPend(&BenchLatQPong, 0u, OS_OPT_PEND_BLOCKING, &size, (CPU_TS *)0, &err);
+        BenchLatTbl[i] = OS_TS_GET() - ts;
+    }
+    BenchLatResult("q round-trip", BenchLatTbl, BENCH_LAT_ROUNDS);
+}
+
+
+static  void  BenchLatFlag (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT32U  j;
+    CPU_TS      ts;
+    CPU_TS      lat;
+
+
+    for (i = 0u; i < BENCH_LAT_ROUNDS; i++) {
+        ts = OS_TS_GET();
+        (void)OSFlagPost(&BenchLatFlagGrp, (OS_FLAGS)((1u << BENCH_LAT_FLAG_TASKS) - 1u), OS_OPT_POST_FLAG_SET, &err);
+        lat = 0u;
+        for (j = 0u; j < BENCH_LAT_FLAG_TASKS; j++) {           /* Until the last woken task ran                        */
+            if (lat < (CPU_TS)(BenchLatFlagTS[j] - ts)) {
+                lat = BenchLatFlagTS[j] - ts;
+            }
+        }
+        BenchLatTbl[i] = lat;
+    }
+    BenchLatResult("flag fan-out", BenchLatTbl, BENCH_LAT_ROUNDS);
+}
+
+
+static  void  BenchLatMutexHandOff (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+
+
+    BenchLatInheritErrCtr = 0u;
+    for (i = 0u; i < BENCH_LAT_ROUNDS; i++) {
+        (void)OSTaskSemPost(&BenchLatMutexTCB, OS_OPT_POST_NONE, &err);
+        (void)OSSemPend(&BenchLatSemHeld, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&BenchLatMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchLatTbl[i] = OS_TS_GET() - BenchLatWakeTS;
+        OSMutexPost(&BenchLatMutex, OS_OPT_POST_NONE, &err);
+    }
+    if (BenchLatInheritErrCtr != 0u) {
+        printf("# mutex hand-off: priority not inherited %u times\n", (unsigned)BenchLatInheritErrCtr);
+    }
+    BenchLatResult("mutex hand-off", BenchLatTbl, BENCH_LAT_ROUNDS);
+}
+
+
+static  void  BenchLatTimeDly (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+
+
+    OSTimeDly(1u, OS_OPT_TIME_DLY, &err);                       /* Start on a tick                                      */
+    for (i = 0u; i < BENCH_LAT_ROUNDS_TICK; i++) {
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);
+        BenchLatTbl[i] = OS_TS_GET() - BenchLatTickTS;
+    }
+    BenchLatResult("time dly jitter", BenchLatTbl, BENCH_LAT_ROUNDS_TICK);
+}
+
+
+static  void  BenchLatTmrCb (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+
+
+    for (i = 0u; i < BENCH_LAT_ROUNDS_TICK; i++) {
+        OSTmrStart(&BenchLatTmr, &err);
+        (void)OSSemPend(&BenchLatSemTmr, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchLatTbl[i] = BenchLatWakeTS;
+    }
+    BenchLatResult("tmr callback", BenchLatTbl, BENCH_LAT_ROUNDS_TICK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchLatTaskCreate (OS_TCB       *p_tcb,
+                                  CPU_CHAR     *p_name,
+                                  OS_TASK_PTR   p_task,
+                                  void         *p_arg,
+                                  OS_PRIO       prio,
+                                  CPU_STK      *p_stk)
+{
+    OS_ERR  err;
+
+
+    OSTaskCreate(p_tcb,
+                 p_name,
+                 p_task,
+                 p_arg,
+                 prio,
+                 p_stk,
+                 BENCH_TASK_STK_SIZE / 10u,
+                 BENCH_TASK_STK_SIZE,
+                 0u,
+                 0u,
+                 0,
+                 OS_OPT_TASK_STK_CHK,
+                &err);
+    if (err != OS_ERR_NONE) {
+        printf("# OSTaskCreate() failed: %u\n", (unsigned)err);
+    }
+}
+
+
+static  void  BenchLatMain (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OS_AppTimeTickHookPtr = BenchLatTickHook;
+    CPU_CRITICAL_EXIT();
+
+    OSSemCreate(&BenchLatSemPing, (CPU_CHAR *)"Bench Ping Sem", 0u, &err);
+    OSSemCreate(&BenchLatSemPong, (CPU_CHAR *)"Bench Pong Sem", 0u, &err);
+    OSSemCreate(&BenchLatSemHeld, (CPU_CHAR *)"Bench Held Sem", 0u, &err);
+    OSSemCreate(&BenchLatSemTmr,  (CPU_CHAR *)"Bench Tmr Sem",  0u, &err);
+    OSQCreate(&BenchLatQPing, (CPU_CHAR *)"Bench Ping Q", 1u, &err);
+    OSQCreate(&BenchLatQPong, (CPU_CHAR *)"Bench Pong Q", 1u, &err);
+    OSFlagCreate(&BenchLatFlagGrp, (CPU_CHAR *)"Bench Flags", 0u, &err);
+    OSMutexCreate(&BenchLatMutex, (CPU_CHAR *)"Bench Mutex", &err);
+    OSTmrCreate(&BenchLatTmr, (CPU_CHAR *)"Bench Tmr", 1u, 0u, OS_OPT_TMR_ONE_SHOT, BenchLatTmrCallback, 0, &err);
+
+    BenchLatTaskCreate(&BenchLatSemTCB,     (CPU_CHAR *)"Bench Sem Task",      BenchLatSemTask,     0,
+                        BENCH_LAT_HI_PRIO, &BenchLatSemStk[0]);
+    BenchLatTaskCreate(&BenchLatTaskSemTCB, (CPU_CHAR *)"Bench Task Sem Task", BenchLatTaskSemTask, 0,
+                        BENCH_LAT_HI_PRIO, &BenchLatTaskSemStk[0]);
+    BenchLatTaskCreate(&BenchLatQTCB,       (CPU_CHAR *)"Bench Q Task",        BenchLatQTask,       0,
+                        BENCH_LAT_HI_PRIO, &BenchLatQStk[0]);
+    for (i = 0u; i < BENCH_LAT_FLAG_TASKS; i++) {
+        BenchLatTaskCreate(&BenchLatFlagTCB[i], (CPU_CHAR *)"Bench Flag Task", BenchLatFlagTask, (void *)(CPU_ADDR)i,
+                            BENCH_LAT_HI_PRIO, &BenchLatFlagStk[i][0]);
+    }
+    BenchLatTaskCreate(&BenchLatMutexTCB,   (CPU_CHAR *)"Bench Mutex Task",    BenchLatMutexTask,   0,
+                        BENCH_LAT_LO_PRIO, &BenchLatMutexStk[0]);
+
+    BenchLatSem();
+    BenchLatTaskSem();
+    BenchLatQ();
+    BenchLatFlag();
+    BenchLatMutexHandOff();
+    BenchLatTimeDly();
+    BenchLatTmrCb();
+}
+
+
+int  main (void)
+{
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    BenchRun("Kernel service latency, all tasks on one host thread", BenchLatMain);
+#elif (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    BenchRun("Kernel service latency, one host thread per task, interrupts masked with an atomic flag", BenchLatMain);
+#else
+    BenchRun("Kernel service latency, one host thread per task, interrupts masked with pthread_sigmask()", BenchLatMain);
+#endif
+
+    return (0);
+}
@@ -0,0 +1,250 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_memclass.c
+*********************************************************************************************************
+* Note(s)  : (1) Size-class allocator vs direct partition calls.  Both run the same workload of
+*                BENCH_MEMCLASS_OPS operations on BENCH_MEMCLASS_SLOTS slots : a random slot is allocated when
+*                empty, otherwise freed.  Sizes are 1..128 octets (80%) and 129..2048 octets (20%).
+*
+*                    'part'    OSMemGet()/OSMemPut() on the partition of the size class, picked by the caller.
+*                    'class'   OSMemAlloc()/OSMemFree(), with the magazines of the 'memclass_mag' variant.
+*
+*            (2) Each operation is timed and goes to a log-linear histogram of
+*                'Drivers/BSP/latency/lat_hist.c'.  Results are printed as CSV lines:
+*
+*                    memclass,<variant>,<api>_<op>,<n>,<min ns>,<avg ns>,<p50 ns>,<p90 ns>,<p99 ns>,<p99.9 ns>,<max ns>
+*
+*                followed by one 'memclass_stat' line per size class with the partition's debug counters.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+#include  "lat_hist.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_MEMCLASS_OPS                        1000000u
+#define  BENCH_MEMCLASS_SLOTS                          256u
+#define  BENCH_MEMCLASS_BLKS                           256u     /* Blocks per size class partition                      */
+#define  BENCH_MEMCLASS_SEED                    0x7F4A7C15u     /* Same workload for both APIs                          */
+
+#define  BENCH_MEMCLASS_BLK_SIZE(ix)     (1u << (OS_CFG_MEM_CLASS_SIZE_MIN_LOG2 + (ix)))
+
+#define  BENCH_MEMCLASS_OP_ALLOC                         0u
+#define  BENCH_MEMCLASS_OP_FREE                          1u
+#define  BENCH_MEMCLASS_OP_NBR                           2u
+
+#if (OS_CFG_MEM_CLASS_NBR == 0u)
+#error  "bench_memclass.c needs OS_CFG_MEM_CLASS_NBR > 0u"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U        BenchMemClassStor[BENCH_MEMCLASS_BLKS * (BENCH_MEMCLASS_BLK_SIZE(OS_CFG_MEM_CLASS_NBR) - BENCH_MEMCLASS_BLK_SIZE(0u))]
+                                           __attribute__((aligned(16)));
+static  OS_MEM            BenchMemClassPart[OS_CFG_MEM_CLASS_NBR];
+
+static  CPU_INT08U       *BenchMemClassSlotTbl[BENCH_MEMCLASS_SLOTS];
+static  CPU_INT08U        BenchMemClassSlotIx[BENCH_MEMCLASS_SLOTS];
+static  CPU_INT32U        BenchMemClassFailCtr;
+
+static  LAT_HIST          BenchMemClassHist[BENCH_MEMCLASS_OP_NBR];
+
+static  const  CPU_CHAR  *BenchMemClassOpName[BENCH_MEMCLASS_OP_NBR] = { "alloc", "free" };
+
+
+/*
+*********************************************************************************************************
+*                                              WORKLOAD
+*********************************************************************************************************
+*/
+
+static  OS_MEM_SIZE  BenchMemClassSizeGet (void)
+{
+    if ((BenchRandGet() % 100u) < 80u) {
+        return ((OS_MEM_SIZE)(  1u + (BenchRandGet() %  128u)));
+    } else {
+        return ((OS_MEM_SIZE)(129u + (BenchRandGet() % 1920u)));
+    }
+}
+
+
+static  CPU_INT08U  BenchMemClassIxGet (OS_MEM_SIZE  size)
+{
+    CPU_INT08U  ix;
+
+
+    ix = 0u;
+    while (BENCH_MEMCLASS_BLK_SIZE(ix) < size) {
+        ix++;
+    }
+    return (ix);
+}
+
+
+static  void  BenchMemClassRun (CPU_BOOLEAN  class_en)
+{
+    CPU_INT32U   i;
+    CPU_INT32U   slot;
+    CPU_INT32U   op;
+    OS_MEM_SIZE  size;
+    CPU_INT08U   ix;
+    CPU_INT08U  *p_blk;
+    CPU_INT64U   t0;
+    CPU_INT64U   t1;
+    CPU_CHAR     name[32];
+    OS_ERR       err;
+
+
+    for (op = 0u; op < BENCH_MEMCLASS_OP_NBR; op++) {
+        LatHist_Init(&BenchMemClassHist[op]);
+    }
+    for (slot = 0u; slot < BENCH_MEMCLASS_SLOTS; slot++) {
+        BenchMemClassSlotTbl[slot] = (CPU_INT08U *)0;
+    }
+    BenchMemClassFailCtr = 0u;
+    BenchRandSeed(BENCH_MEMCLASS_SEED);
+
+    for (i = 0u; i < BENCH_MEMCLASS_OPS; i++) {
+        slot  = BenchRandGet() % BENCH_MEMCLASS_SLOTS;
+        p_blk = BenchMemClassSlotTbl[slot];
+        if (p_blk == (CPU_INT08U *)0) {
+            op   = BENCH_MEMCLASS_OP_ALLOC;
+            size = BenchMemClassSizeGet();
+            if (class_en == DEF_YES) {
+                t0    = BenchNsGet();
+                p_blk = (CPU_INT08U *)OSMemAlloc(size, &err);
+                t1    = BenchNsGet();
+            } else {
+                t0    = BenchNsGet();
+                ix    = BenchMemClassIxGet(size);
+                p_blk = (CPU_INT08U *)OSMemGet(&BenchMemClassPart[ix], &err);
+                t1    = BenchNsGet();
+                BenchMemClassSlotIx[slot] = ix;
+            }
+            if (p_blk != (CPU_INT08U *)0) {                     /* Touch both ends of the block                         */
+                p_blk[0]         = (CPU_INT08U)slot;
+                p_blk[size - 1u] = (CPU_INT08U)slot;
+            } else {
+                BenchMemClassFailCtr++;
+            }
+        } else {
+            op = BENCH_MEMCLASS_OP_FREE;
+            if (class_en == DEF_YES) {
+                t0 = BenchNsGet();
+                OSMemFree(p_blk, &err);
+                t1 = BenchNsGet();
+            } else {
+                t0 = BenchNsGet();
+                OSMemPut(&BenchMemClassPart[BenchMemClassSlotIx[slot]], p_blk, &err);
+                t1 = BenchNsGet();
+            }
+            if (err != OS_ERR_NONE) {
+                printf("# %s: free of slot %u failed: %u\n", (class_en == DEF_YES) ? "class" : "part",
+                       (unsigned)slot, (unsigned)err);
+            }
+            p_blk = (CPU_INT08U *)0;
+        }
+        LatHist_Add(&BenchMemClassHist[op], (CPU_INT32U)(t1 - t0));
+        BenchMemClassSlotTbl[slot] = p_blk;
+    }
+
+    for (op = 0u; op < BENCH_MEMCLASS_OP_NBR; op++) {
+        (void)snprintf(name, sizeof(name), "%s_%s", (class_en == DEF_YES) ? "class" : "part", BenchMemClassOpName[op]);
+        LatHist_Export(&BenchMemClassHist[op], "memclass," BENCH_VARIANT, name, 1000000000u);
+    }
+    printf("# %s: %u failed allocations\n", (class_en == DEF_YES) ? "class" : "part", (unsigned)BenchMemClassFailCtr);
+
+    for (slot = 0u; slot < BENCH_MEMCLASS_SLOTS; slot++) {      /* Return everything before the next run                */
+        p_blk = BenchMemClassSlotTbl[slot];
+        if (p_blk != (CPU_INT08U *)0) {
+            if (class_en == DEF_YES) {
+                OSMemFree(p_blk, &err);
+            } else {
+                OSMemPut(&BenchMemClassPart[BenchMemClassSlotIx[slot]], p_blk, &err);
+            }
+        }
+    }
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+    OSMemMagFlush(&err);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchMemClassMain (void)
+{
+    CPU_INT08U  ix;
+    CPU_INT32U  offset;
+    OS_ERR      err;
+
+
+    offset = 0u;
+    for (ix = 0u; ix < OS_CFG_MEM_CLASS_NBR; ix++) {
+        OSMemCreate(&BenchMemClassPart[ix], (CPU_CHAR *)"Bench class partition", &BenchMemClassStor[offset],
+                     BENCH_MEMCLASS_BLKS, BENCH_MEMCLASS_BLK_SIZE(ix), &err);
+        offset += BENCH_MEMCLASS_BLKS * BENCH_MEMCLASS_BLK_SIZE(ix);
+        if (err == OS_ERR_NONE) {
+            OSMemClassAdd(&BenchMemClassPart[ix], &err);
+        }
+        if (err != OS_ERR_NONE) {
+            printf("# Size class %u creation failed: %u\n", (unsigned)ix, (unsigned)err);
+            return;
+        }
+    }
+
+    LatHist_ExportHdr("memclass,variant");
+    BenchMemClassRun(DEF_NO);
+    BenchMemClassRun(DEF_YES);
+
+    for (ix = 0u; ix < OS_CFG_MEM_CLASS_NBR; ix++) {            /* Everything returned : all partitions full            */
+        if (BenchMemClassPart[ix].NbrFree != BenchMemClassPart[ix].NbrMax) {
+            printf("# Size class %u: %u blocks not returned\n", (unsigned)ix,
+                   (unsigned)(BenchMemClassPart[ix].NbrMax - BenchMemClassPart[ix].NbrFree));
+        }
+#if (OS_CFG_DBG_EN > 0u)
+        printf("memclass_stat,%s,%u,used_max,%u,miss,%lu",
+                BENCH_VARIANT,
+               (unsigned)BENCH_MEMCLASS_BLK_SIZE(ix),
+               (unsigned)BenchMemClassPart[ix].NbrUsedMax,
+               (unsigned long)BenchMemClassPart[ix].MissCtr);
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+        printf(",mag_miss,%lu", (unsigned long)BenchMemClassPart[ix].MagMissCtr);
+#endif
+        printf("\n");
+#endif
+    }
+}
+
+
+int  main (void)
+{
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+    BenchRun("Size-class allocator with per-task magazines vs direct partition calls", BenchMemClassMain);
+#else
+    BenchRun("Size-class allocator vs direct partition calls", BenchMemClassMain);
+#endif
+
+    return (0);
+}
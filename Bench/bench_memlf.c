@@ -0,0 +1,331 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_memlf.c
+*********************************************************************************************************
+* Note(s)  : (1) One memory partition shared by an ISR producer and a task consumer, as network buffers
+*                are, built without and with OS_CFG_MEM_LOCK_FREE_EN and LIB_MEM_CFG_LOCK_FREE_EN:
+*
+*                    'isr_get'       a periodic simulated timer ISR takes a block with OSMemGet() and posts
+*                                    it to the consumer task with OSTaskQPost().
+*                    'task_put_rx'   the consumer returns each received block with OSMemPut().
+*                    'task_get'      the consumer also takes and returns BENCH_MEMLF_TASK_PAIRS blocks of
+*                    'task_put'      its own per received block, so that the ISR finds it inside
+*                                    OSMemGet()/OSMemPut().
+*                    'isr_lib_get'   the ISR also takes a block of a 'lib_mem.c' dynamic pool, grown from
+*                    'task_lib_get'  its own segment, and returns it, while the consumer takes and returns
+*                    'task_lib_put'  BENCH_MEMLF_TASK_PAIRS blocks of that pool per received block.
+*
+*            (2) Each operation is timed and goes to a log-linear histogram of
+*                'Drivers/BSP/latency/lat_hist.c'.  Results are printed as CSV lines:
+*
+*                    memlf,<variant>,<op>,<n>,<min ns>,<avg ns>,<p50 ns>,<p90 ns>,<p99 ns>,<p99.9 ns>,<max ns>
+*
+*                followed by a 'memlf_stat' line with the blocks the ISR could not get or post, and the
+*                blocks left available in the dynamic pool, which must be BENCH_MEMLF_BLKS.  With
+*                OS_CFG_ISR_POST_EN, a 'memlf_isr_q' line gives the posts lost because the ISR queue was full
+*                and those that failed when replayed, see Note #3.
+*
+*            (3) The consumer polls its queue with OS_OPT_PEND_NON_BLOCKING, so the ISR never switches tasks.
+*                In the thread modes of the port, an ISR that wakes a task while the next timer interrupt
+*                is pending nests its handler once more each round.
+*
+*                With OS_CFG_ISR_POST_EN, the post is replayed by the ISR handler task, which cannot report
+*                a full queue to the ISR.  The queue holds as many messages as the partition has blocks.
+*
+*            (4) The consumer never blocks and has a higher priority than the bench task, so the timer is
+*                created first and the consumer starts the production when it runs.
+*
+*            (5) The tick keeps running during the rounds.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+#include  "lat_hist.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_MEMLF_ROUNDS                         100000u     /* Blocks produced by the ISR                           */
+#define  BENCH_MEMLF_PERIOD_US                          50u     /* Period of the producer ISR                           */
+#define  BENCH_MEMLF_TASK_PAIRS                          8u     /* Consumer's own OSMemGet()/OSMemPut() per rx block    */
+
+#define  BENCH_MEMLF_BLKS                               64u
+#define  BENCH_MEMLF_BLK_SIZE                          128u
+#define  BENCH_MEMLF_Q_SIZE           BENCH_MEMLF_BLKS          /* Room for every block, see Note #3                    */
+#define  BENCH_MEMLF_LIB_BLKS_INIT                      16u     /* Dyn pool blocks created up front, rest from its seg  */
+
+#define  BENCH_MEMLF_HI_PRIO       (OS_PRIO)(BENCH_TASK_PRIO - 1u)
+
+#define  BENCH_MEMLF_OP_ISR_GET                          0u
+#define  BENCH_MEMLF_OP_TASK_PUT_RX                      1u
+#define  BENCH_MEMLF_OP_TASK_GET                         2u
+#define  BENCH_MEMLF_OP_TASK_PUT                         3u
+#define  BENCH_MEMLF_OP_ISR_LIB_GET                      4u
+#define  BENCH_MEMLF_OP_TASK_LIB_GET                     5u
+#define  BENCH_MEMLF_OP_TASK_LIB_PUT                     6u
+#define  BENCH_MEMLF_OP_NBR                              7u
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchMemLfISR (void);
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_TMR_INTERRUPT        BenchMemLfTmr = { .Interrupt.NamePtr  = "Bench memlf rx interrupt",
+                                                   .Interrupt.Prio     =  5u,
+                                                   .Interrupt.TraceEn  =  0u,
+                                                   .Interrupt.ISR_Fnct =  BenchMemLfISR,
+                                                   .Interrupt.En       =  1u,
+                                                   .OneShot            =  DEF_NO,
+                                                   .PeriodSec          =  0u,
+                                                   .PeriodMuSec        =  BENCH_MEMLF_PERIOD_US,
+                                                 };
+
+static  CPU_INT08U               BenchMemLfStor[BENCH_MEMLF_BLKS * BENCH_MEMLF_BLK_SIZE] __attribute__((aligned(16)));
+static  OS_MEM                   BenchMemLfPart;
+
+static  CPU_INT08U               BenchMemLfLibStor[BENCH_MEMLF_BLKS * BENCH_MEMLF_BLK_SIZE] __attribute__((aligned(16)));
+static  MEM_SEG                  BenchMemLfLibSeg;
+static  MEM_DYN_POOL             BenchMemLfLibPool;
+
+static  OS_TCB                   BenchMemLfTCB;
+static  CPU_STK                  BenchMemLfStk[BENCH_TASK_STK_SIZE];
+static  OS_TCB                  *BenchMemLfBenchTCBPtr;         /* Bench task, posted when all blocks are consumed      */
+
+static  volatile  CPU_BOOLEAN    BenchMemLfRun;                 /* ISR produces while set                               */
+static  CPU_INT32U               BenchMemLfProdCtr;             /* Blocks posted by the ISR                             */
+static  CPU_INT32U               BenchMemLfNoBlkCtr;            /* OSMemGet() found the partition empty                 */
+static  CPU_INT32U               BenchMemLfNoPostCtr;           /* OSTaskQPost() failed, block returned by the ISR      */
+static  CPU_INT32U               BenchMemLfLibNoBlkCtr;         /* Mem_DynPoolBlkGet() failed                           */
+
+static  LAT_HIST                 BenchMemLfHist[BENCH_MEMLF_OP_NBR];
+
+static  const  CPU_CHAR         *BenchMemLfOpName[BENCH_MEMLF_OP_NBR] = { "isr_get", "task_put_rx", "task_get", "task_put",
+                                                                          "isr_lib_get", "task_lib_get", "task_lib_put" };
+
+
+/*
+*********************************************************************************************************
+*                                     PRODUCER ISR AND CONSUMER TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchMemLfISR (void)
+{
+    void        *p_blk;
+    CPU_INT64U   t0;
+    CPU_INT64U   t1;
+    LIB_ERR      lib_err;
+    OS_ERR       err;
+
+
+    OSIntEnter();
+    if ((BenchMemLfRun == DEF_YES) && (BenchMemLfProdCtr < BENCH_MEMLF_ROUNDS)) {
+        t0    = BenchNsGet();
+        p_blk = OSMemGet(&BenchMemLfPart, &err);
+        t1    = BenchNsGet();
+        LatHist_Add(&BenchMemLfHist[BENCH_MEMLF_OP_ISR_GET], (CPU_INT32U)(t1 - t0));
+        if (p_blk == (void *)0) {
+            BenchMemLfNoBlkCtr++;
+        } else {
+            OSTaskQPost(&BenchMemLfTCB, p_blk, BENCH_MEMLF_BLK_SIZE, OS_OPT_POST_FIFO, &err);
+            if (err == OS_ERR_NONE) {
+                BenchMemLfProdCtr++;
+            } else {
+                OSMemPut(&BenchMemLfPart, p_blk, &err);
+                BenchMemLfNoPostCtr++;
+            }
+        }
+
+        t0    = BenchNsGet();
+        p_blk = Mem_DynPoolBlkGet(&BenchMemLfLibPool, &lib_err);
+        t1    = BenchNsGet();
+        LatHist_Add(&BenchMemLfHist[BENCH_MEMLF_OP_ISR_LIB_GET], (CPU_INT32U)(t1 - t0));
+        if (lib_err == LIB_MEM_ERR_NONE) {
+            Mem_DynPoolBlkFree(&BenchMemLfLibPool, p_blk, &lib_err);
+        } else {
+            BenchMemLfLibNoBlkCtr++;
+        }
+    }
+    CPU_ISR_End();
+    OSIntExit();
+}
+
+
+static  void  BenchMemLfTask (void  *p_arg)
+{
+    void         *p_blk;
+    void         *p_blk_own;
+    OS_MSG_SIZE   size;
+    CPU_INT32U    cons_ctr;
+    CPU_INT32U    i;
+    CPU_INT64U    t0;
+    CPU_INT64U    t1;
+    LIB_ERR       lib_err;
+    OS_ERR        err;
+
+
+    (void)p_arg;
+
+    BenchMemLfRun = DEF_YES;                                    /* See Note #4                                          */
+    cons_ctr      = 0u;
+    while (cons_ctr < BENCH_MEMLF_ROUNDS) {
+        p_blk = OSTaskQPend(0u, OS_OPT_PEND_NON_BLOCKING, &size, (CPU_TS *)0, &err);
+        if (p_blk == (void *)0) {                               /* See Note #3                                          */
+            continue;
+        }
+        ((CPU_INT08U *)p_blk)[0] = (CPU_INT08U)cons_ctr;
+
+        for (i = 0u; i < BENCH_MEMLF_TASK_PAIRS; i++) {         /* Own blocks, see Note #1                              */
+            t0        = BenchNsGet();
+            p_blk_own = OSMemGet(&BenchMemLfPart, &err);
+            t1        = BenchNsGet();
+            LatHist_Add(&BenchMemLfHist[BENCH_MEMLF_OP_TASK_GET], (CPU_INT32U)(t1 - t0));
+            if (p_blk_own != (void *)0) {
+                t0 = BenchNsGet();
+                OSMemPut(&BenchMemLfPart, p_blk_own, &err);
+                t1 = BenchNsGet();
+                LatHist_Add(&BenchMemLfHist[BENCH_MEMLF_OP_TASK_PUT], (CPU_INT32U)(t1 - t0));
+            }
+
+            t0        = BenchNsGet();
+            p_blk_own = Mem_DynPoolBlkGet(&BenchMemLfLibPool, &lib_err);
+            t1        = BenchNsGet();
+            LatHist_Add(&BenchMemLfHist[BENCH_MEMLF_OP_TASK_LIB_GET], (CPU_INT32U)(t1 - t0));
+            if (lib_err == LIB_MEM_ERR_NONE) {
+                t0 = BenchNsGet();
+                Mem_DynPoolBlkFree(&BenchMemLfLibPool, p_blk_own, &lib_err);
+                t1 = BenchNsGet();
+                LatHist_Add(&BenchMemLfHist[BENCH_MEMLF_OP_TASK_LIB_PUT], (CPU_INT32U)(t1 - t0));
+            }
+        }
+
+        t0 = BenchNsGet();
+        OSMemPut(&BenchMemLfPart, p_blk, &err);
+        t1 = BenchNsGet();
+        LatHist_Add(&BenchMemLfHist[BENCH_MEMLF_OP_TASK_PUT_RX], (CPU_INT32U)(t1 - t0));
+        if (err != OS_ERR_NONE) {
+            printf("# OSMemPut() of a received block failed: %u\n", (unsigned)err);
+        }
+
+        cons_ctr++;
+    }
+
+    BenchMemLfRun = DEF_NO;
+    (void)OSTaskSemPost(BenchMemLfBenchTCBPtr, OS_OPT_POST_NONE, &err);
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchMemLfMain (void)
+{
+    CPU_INT32U  op;
+    LIB_ERR     lib_err;
+    OS_ERR      err;
+
+
+    for (op = 0u; op < BENCH_MEMLF_OP_NBR; op++) {
+        LatHist_Init(&BenchMemLfHist[op]);
+    }
+    BenchMemLfBenchTCBPtr = OSTCBCurPtr;
+
+    OSMemCreate(&BenchMemLfPart, (CPU_CHAR *)"Bench memlf partition", &BenchMemLfStor[0],
+                 BENCH_MEMLF_BLKS, BENCH_MEMLF_BLK_SIZE, &err);
+    if (err != OS_ERR_NONE) {
+        printf("# OSMemCreate() failed: %u\n", (unsigned)err);
+        return;
+    }
+
+    Mem_Init();
+    Mem_SegCreate("Bench memlf seg", &BenchMemLfLibSeg, (CPU_ADDR)&BenchMemLfLibStor[0], sizeof(BenchMemLfLibStor),
+                   LIB_MEM_PADDING_ALIGN_NONE, &lib_err);
+    if (lib_err == LIB_MEM_ERR_NONE) {
+        Mem_DynPoolCreate("Bench memlf dyn pool", &BenchMemLfLibPool, &BenchMemLfLibSeg, BENCH_MEMLF_BLK_SIZE,
+                           sizeof(CPU_ALIGN), BENCH_MEMLF_LIB_BLKS_INIT, BENCH_MEMLF_BLKS, &lib_err);
+    }
+    if (lib_err != LIB_MEM_ERR_NONE) {
+        printf("# Dynamic pool creation failed: %u\n", (unsigned)lib_err);
+        return;
+    }
+
+    BenchMemLfRun = DEF_NO;
+    CPU_TmrInterruptCreate(&BenchMemLfTmr);                     /* See Note #4                                          */
+
+    OSTaskCreate(&BenchMemLfTCB,
+                 (CPU_CHAR *)"Bench MemLf Task",
+                  BenchMemLfTask,
+                  0,
+                  BENCH_MEMLF_HI_PRIO,
+                 &BenchMemLfStk[0],
+                  BENCH_TASK_STK_SIZE / 10u,
+                  BENCH_TASK_STK_SIZE,
+                  BENCH_MEMLF_Q_SIZE,
+                  0u,
+                  0,
+                  OS_OPT_TASK_STK_CHK,
+                 &err);
+    if (err != OS_ERR_NONE) {
+        printf("# OSTaskCreate() failed: %u\n", (unsigned)err);
+        return;
+    }
+
+    (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+
+    LatHist_ExportHdr("memlf,variant");
+    for (op = 0u; op < BENCH_MEMLF_OP_NBR; op++) {
+        LatHist_Export(&BenchMemLfHist[op], "memlf," BENCH_VARIANT, BenchMemLfOpName[op], 1000000000u);
+    }
+    printf("memlf_stat,%s,no_blk,%lu,no_post,%lu,free,%lu,lib_no_blk,%lu,lib_free,%lu\n",
+            BENCH_VARIANT,
+           (unsigned long)BenchMemLfNoBlkCtr,
+           (unsigned long)BenchMemLfNoPostCtr,
+           (unsigned long)BenchMemLfPart.NbrFree,
+           (unsigned long)BenchMemLfLibNoBlkCtr,
+           (unsigned long)Mem_DynPoolBlkNbrAvailGet(&BenchMemLfLibPool, &lib_err));
+#if (OS_CFG_ISR_POST_EN > 0u)
+    printf("memlf_isr_q,%s,ovf,%lu,replay_fail,%lu\n",
+            BENCH_VARIANT,
+           (unsigned long)OSIntQOvfCtr,
+           (unsigned long)OSIntQRePostFailCtr);
+#endif
+}
+
+
+int  main (void)
+{
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    BenchRun("Memory partition and pool shared by an ISR and a task, lock-free free lists", BenchMemLfMain);
+#else
+    BenchRun("Memory partition and pool shared by an ISR and a task, free lists in critical sections", BenchMemLfMain);
+#endif
+
+    return (0);
+}
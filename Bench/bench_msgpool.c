@@ -0,0 +1,195 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_msgpool.c
+*********************************************************************************************************
+* Note(s)  : (1) A receive queue fed one byte per message, as a UART receive interrupt would, and a control
+*                queue, built without and with OS_CFG_MSG_POOL_PRIV_EN.  Each round:
+*
+*                    'rx_post'     posts a burst of OS_CFG_MSG_POOL_SIZE bytes to the receive queue, before its
+*                                  reader runs.
+*                    'ctrl_post'   posts BENCH_MSGPOOL_CTRL_MSGS messages to the control queue.
+*                    'rx_pend'     the readers empty both queues.
+*                    'ctrl_pend'
+*
+*                Without private pools, both queues take their OS_MSGs from the global pool, which the burst
+*                uses up: the control messages are lost.  With them, the receive queue has a pool of
+*                BENCH_MSGPOOL_RX_MSGS OS_MSGs of its own, given with OSQPoolSet(), and only the end of the burst
+*                is lost.
+*
+*            (2) The 'n' column is the number of calls, the figures are per call, failed calls included.  A
+*                'msgpool_stat' line gives the failed posts of each queue and the peak usage of each pool.
+*
+*            (3) One task does everything with non-blocking pends, no task switch is measured.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdint.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_MSGPOOL_ROUNDS                         1000u
+#define  BENCH_MSGPOOL_BURST            OS_CFG_MSG_POOL_SIZE    /* Enough to use up the global pool                     */
+#define  BENCH_MSGPOOL_CTRL_MSGS                         8u
+#define  BENCH_MSGPOOL_RX_MSGS                         256u     /* Private pool of the receive queue                    */
+
+#define  BENCH_MSGPOOL_OP_RX_POST                        0u
+#define  BENCH_MSGPOOL_OP_CTRL_POST                      1u
+#define  BENCH_MSGPOOL_OP_RX_PEND                        2u
+#define  BENCH_MSGPOOL_OP_CTRL_PEND                      3u
+#define  BENCH_MSGPOOL_OP_NBR                            4u
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_Q              BenchMsgPoolRxQ;
+static  OS_Q              BenchMsgPoolCtrlQ;
+
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+static  OS_MSG            BenchMsgPoolRxTbl[BENCH_MSGPOOL_RX_MSGS];
+static  OS_MSG_POOL       BenchMsgPoolRx;
+#endif
+
+static  CPU_INT64U        BenchMsgPoolNs[BENCH_MSGPOOL_OP_NBR];
+static  CPU_INT32U        BenchMsgPoolCalls[BENCH_MSGPOOL_OP_NBR];
+static  CPU_INT32U        BenchMsgPoolRxFailCtr;                /* Receive posts refused                                */
+static  CPU_INT32U        BenchMsgPoolCtrlFailCtr;              /* Control posts refused                                */
+
+static  const  CPU_CHAR  *BenchMsgPoolOpName[BENCH_MSGPOOL_OP_NBR] = { "rx_post", "ctrl_post", "rx_pend", "ctrl_pend" };
+
+
+/*
+*********************************************************************************************************
+*                                             ONE ROUND
+*********************************************************************************************************
+*/
+
+static  void  BenchMsgPoolDrain (OS_Q        *p_q,
+                                 CPU_INT32U   op)
+{
+    OS_MSG_SIZE  size;
+    CPU_INT32U   n;
+    CPU_INT64U   t0;
+    OS_ERR       err;
+
+
+    n  = 0u;
+    t0 = BenchNsGet();
+    do {
+        (void)OSQPend(p_q, 0u, OS_OPT_PEND_NON_BLOCKING, &size, (CPU_TS *)0, &err);
+        n++;
+    } while (err == OS_ERR_NONE);
+    BenchMsgPoolNs[op]    += BenchNsGet() - t0;
+    BenchMsgPoolCalls[op] += n;
+}
+
+
+static  void  BenchMsgPoolRound (CPU_INT32U  round)
+{
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+    OS_ERR      err;
+
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_MSGPOOL_BURST; i++) {
+        OSQPost(&BenchMsgPoolRxQ, (void *)(uintptr_t)(i & 0xFFu), 1u, OS_OPT_POST_FIFO, &err);
+        if (err != OS_ERR_NONE) {
+            BenchMsgPoolRxFailCtr++;
+        }
+    }
+    BenchMsgPoolNs[BENCH_MSGPOOL_OP_RX_POST]    += BenchNsGet() - t0;
+    BenchMsgPoolCalls[BENCH_MSGPOOL_OP_RX_POST] += BENCH_MSGPOOL_BURST;
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_MSGPOOL_CTRL_MSGS; i++) {
+        OSQPost(&BenchMsgPoolCtrlQ, (void *)(uintptr_t)(round + 1u), sizeof(CPU_INT32U), OS_OPT_POST_FIFO, &err);
+        if (err != OS_ERR_NONE) {
+            BenchMsgPoolCtrlFailCtr++;
+        }
+    }
+    BenchMsgPoolNs[BENCH_MSGPOOL_OP_CTRL_POST]    += BenchNsGet() - t0;
+    BenchMsgPoolCalls[BENCH_MSGPOOL_OP_CTRL_POST] += BENCH_MSGPOOL_CTRL_MSGS;
+
+    BenchMsgPoolDrain(&BenchMsgPoolRxQ,   BENCH_MSGPOOL_OP_RX_PEND);
+    BenchMsgPoolDrain(&BenchMsgPoolCtrlQ, BENCH_MSGPOOL_OP_CTRL_PEND);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchMsgPoolMain (void)
+{
+    CPU_INT32U  round;
+    CPU_INT32U  op;
+    OS_ERR      err;
+
+
+    OSQCreate(&BenchMsgPoolRxQ,   (CPU_CHAR *)"Bench rx Q",   BENCH_MSGPOOL_BURST,     &err);
+    if (err == OS_ERR_NONE) {
+        OSQCreate(&BenchMsgPoolCtrlQ, (CPU_CHAR *)"Bench ctrl Q", BENCH_MSGPOOL_CTRL_MSGS, &err);
+    }
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+    if (err == OS_ERR_NONE) {
+        OSMsgPoolCreate(&BenchMsgPoolRx, (CPU_CHAR *)"Bench rx pool", &BenchMsgPoolRxTbl[0], BENCH_MSGPOOL_RX_MSGS, &err);
+    }
+    if (err == OS_ERR_NONE) {
+        OSQPoolSet(&BenchMsgPoolRxQ, &BenchMsgPoolRx, &err);
+    }
+#endif
+    if (err != OS_ERR_NONE) {
+        printf("# Queue creation failed: %u\n", (unsigned)err);
+        return;
+    }
+
+    for (round = 0u; round < BENCH_MSGPOOL_ROUNDS; round++) {
+        BenchMsgPoolRound(round);
+    }
+
+    for (op = 0u; op < BENCH_MSGPOOL_OP_NBR; op++) {
+        BenchResult(BenchMsgPoolOpName[op], BenchMsgPoolCalls[op], BenchMsgPoolNs[op], BenchMsgPoolCalls[op]);
+    }
+    printf("msgpool_stat,%s,rx_fail,%lu,ctrl_fail,%lu",
+            BENCH_VARIANT,
+           (unsigned long)BenchMsgPoolRxFailCtr,
+           (unsigned long)BenchMsgPoolCtrlFailCtr);
+#if (OS_CFG_DBG_EN > 0u)
+    printf(",global_used_max,%u", (unsigned)OSMsgPool.NbrUsedMax);
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+    printf(",rx_pool_used_max,%u,rx_pool_empty,%lu", (unsigned)BenchMsgPoolRx.NbrUsedMax,
+           (unsigned long)BenchMsgPoolRx.EmptyCtr);
+#endif
+#endif
+    printf("\n");
+}
+
+
+int  main (void)
+{
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+    BenchRun("Byte stream burst and control messages, receive queue with its own OS_MSG pool", BenchMsgPoolMain);
+#else
+    BenchRun("Byte stream burst and control messages, one global OS_MSG pool", BenchMsgPoolMain);
+#endif
+
+    return (0);
+}
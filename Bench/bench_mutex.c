@@ -0,0 +1,272 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_mutex.c
+*********************************************************************************************************
+* Note(s)  : (1) Mutex pend/post pairs, built with and without OS_CFG_MUTEX_FAST_EN:
+*
+*                    'uncontended'   the bench task takes and releases a free mutex, as fputc() does
+*                                    with the USART mutex for every character printed.
+*                    'nested'        the same with a second, nested pend/post pair.
+*                    'contended'     a higher priority task pends on the mutex while the bench task
+*                                    owns it, so every round goes through priority inheritance and
+*                                    a handoff.
+*                    'task_del'      a task that holds the mutex is deleted: the mutex must be free
+*                                    afterwards.  Timed once, OSTaskDel() only.
+*                    'task_del_wait' the same while the contending task waits for the mutex, which it
+*                                    must get.
+*
+*            (2) The 'n' column is the number of pends and posts done on the fast path per round, out
+*                of the per-mutex counters.  It is 0 without OS_CFG_MUTEX_FAST_EN.
+*
+*            (3) The contending task is created once and never deleted.  Each 'task_del' case deletes a
+*                task of its own.  Both are created before the first deletion: the port cannot create
+*                a task once another one has been deleted.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_MUTEX_ROUNDS                         1000000u
+#define  BENCH_MUTEX_ROUNDS_CONTENDED                 20000u
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_MUTEX                 BenchMutex;
+
+static  OS_TCB                   BenchMutexHiTCB;
+static  CPU_STK                  BenchMutexHiStk[BENCH_TASK_STK_SIZE];
+
+static  OS_TCB                   BenchMutexDelTCB[2];
+static  CPU_STK                  BenchMutexDelStk[2][BENCH_TASK_STK_SIZE];
+
+static  volatile  CPU_INT32U     BenchMutexHiCtr;
+
+
+/*
+*********************************************************************************************************
+*                                           CONTENDING TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchMutexHiTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchMutexHiCtr++;
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);
+    }
+}
+
+
+static  void  BenchMutexDelTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    OSMutexPend(&BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    for (;;) {                                                  /* Holds the mutex until deleted                        */
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BENCH ONE CASE
+*********************************************************************************************************
+*/
+
+static  void  BenchMutexResult (const  CPU_CHAR    *p_test,
+                                       CPU_INT32U   rounds,
+                                       CPU_INT64U   ns)
+{
+    CPU_INT32U  fast;
+
+
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    fast               = (BenchMutex.FastCtr + (rounds / 2u)) / rounds;
+    BenchMutex.FastCtr = 0u;
+    BenchMutex.SlowCtr = 0u;
+#else
+    fast               = 0u;
+#endif
+    BenchResult(p_test, fast, ns, rounds);
+}
+
+
+static  void  BenchMutexUncontended (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_MUTEX_ROUNDS; i++) {
+        OSMutexPend(&BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);
+    }
+    BenchMutexResult("uncontended", BENCH_MUTEX_ROUNDS, BenchNsGet() - t0);
+}
+
+
+static  void  BenchMutexNested (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_MUTEX_ROUNDS; i++) {
+        OSMutexPend(&BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);
+    }
+    BenchMutexResult("nested", BENCH_MUTEX_ROUNDS, BenchNsGet() - t0);
+}
+
+
+static  void  BenchMutexContended (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+
+
+    BenchMutexHiCtr = 0u;
+    t0              = BenchNsGet();
+    for (i = 0u; i < BENCH_MUTEX_ROUNDS_CONTENDED; i++) {
+        OSMutexPend(&BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSTaskSemPost(&BenchMutexHiTCB, OS_OPT_POST_NONE, &err);  /* Runs until it blocks on the mutex         */
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);           /* Hands the mutex over                      */
+    }
+    if (BenchMutexHiCtr != BENCH_MUTEX_ROUNDS_CONTENDED) {
+        printf("contended: %u handoffs\n", (unsigned)BenchMutexHiCtr);
+    }
+    BenchMutexResult("contended", BENCH_MUTEX_ROUNDS_CONTENDED, BenchNsGet() - t0);
+}
+
+
+static  void  BenchMutexTaskDel (const  CPU_CHAR     *p_test,
+                                        CPU_INT32U    ix,
+                                        CPU_BOOLEAN   wait)
+{
+    OS_ERR      err;
+    CPU_INT64U  t0;
+    CPU_INT64U  ns;
+
+
+                                                                /* The owner runs and takes the mutex                  */
+    OSTaskSemPost(&BenchMutexDelTCB[ix], OS_OPT_POST_NONE, &err);
+
+    BenchMutexHiCtr = 0u;
+    if (wait == DEF_YES) {                                      /* The contending task blocks on the mutex              */
+        OSTaskSemPost(&BenchMutexHiTCB, OS_OPT_POST_NONE, &err);
+    }
+
+    t0 = BenchNsGet();
+    OSTaskDel(&BenchMutexDelTCB[ix], &err);                     /* Releases the mutex                                   */
+    ns = BenchNsGet() - t0;
+    if ((wait == DEF_YES) && (BenchMutexHiCtr != 1u)) {
+        printf("# %s: the waiting task did not get the mutex\n", p_test);
+    }
+
+    OSMutexPend(&BenchMutex, 0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+    if (err != OS_ERR_NONE) {
+        printf("# %s: the mutex is not free: %u\n", p_test, (unsigned)err);
+    } else {
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);
+    }
+    BenchMutexResult(p_test, 1u, ns);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchMutexMain (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  ix;
+
+
+    OSMutexCreate(&BenchMutex, (CPU_CHAR *)"Bench Mutex", &err);
+    OSTaskCreate(&BenchMutexHiTCB,
+                 (CPU_CHAR *)"Bench Mutex Contender",
+                  BenchMutexHiTask,
+                  0,
+                 (OS_PRIO)(BENCH_TASK_PRIO - 1u),
+                 &BenchMutexHiStk[0],
+                  BENCH_TASK_STK_SIZE / 10u,
+                  BENCH_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                  OS_OPT_TASK_STK_CHK,
+                 &err);
+    for (ix = 0u; ix < 2u; ix++) {                              /* See Note #3                                          */
+        OSTaskCreate(&BenchMutexDelTCB[ix],
+                     (CPU_CHAR *)"Bench Mutex Owner",
+                      BenchMutexDelTask,
+                      0,
+                     (OS_PRIO)(BENCH_TASK_PRIO - 2u),
+                     &BenchMutexDelStk[ix][0],
+                      BENCH_TASK_STK_SIZE / 10u,
+                      BENCH_TASK_STK_SIZE,
+                      0u,
+                      0u,
+                      0,
+                      OS_OPT_TASK_STK_CHK,
+                     &err);
+    }
+
+    BenchMutexUncontended();
+    BenchMutexNested();
+    BenchMutexContended();
+    BenchMutexTaskDel("task_del",      0u, DEF_NO);
+    BenchMutexTaskDel("task_del_wait", 1u, DEF_YES);
+}
+
+
+int  main (void)
+{
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    BenchRun("Mutex pend/post, with the fast path", BenchMutexMain);
+#else
+    BenchRun("Mutex pend/post, without the fast path", BenchMutexMain);
+#endif
+
+    return (0);
+}
@@ -0,0 +1,138 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_pend.c
+*********************************************************************************************************
+* Note(s)  : (1) Measures the pend list operations for 10 to 1,000 waiters on one semaphore.  Build with
+*                OS_CFG_PEND_LIST_PRIO_TBL_EN set to 0 (sorted list walk) or 1 (priority table).
+*
+*            (2) The waiters are TCBs that are linked directly with OS_PendListInsertPrio(), so that no thread
+*                switch of the port is included in the figures.  The timed loops run in one critical section.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_PEND_MAX                                1000u
+#define  BENCH_PEND_REPS                              10000u
+
+#define  BENCH_PEND_PRIO_MIN             (BENCH_TASK_PRIO + 1u)
+#define  BENCH_PEND_PRIO_MAX             (OS_CFG_PRIO_MAX - 3u) /* Lowest waiter priority, the probe goes below it      */
+#define  BENCH_PEND_PRIO_SPAN            (BENCH_PEND_PRIO_MAX - BENCH_PEND_PRIO_MIN + 1u)
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_SEM   BenchPendSem;
+static  OS_TCB   BenchPendTCB[BENCH_PEND_MAX];
+static  OS_TCB   BenchPendProbeTCB;
+
+
+/*
+*********************************************************************************************************
+*                                          BENCH ONE SIZE
+*********************************************************************************************************
+*/
+
+static  void  BenchPendInsert (OS_TCB   *p_tcb,
+                               OS_PRIO   prio)
+{
+    p_tcb->Prio       =  prio;
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)((void *)&BenchPendSem);
+    OS_PendListInsertPrio(&BenchPendSem.PendList, p_tcb);
+}
+
+
+static  void  BenchPendRun (CPU_INT32U  n)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+    CPU_INT64U  ns;
+    OS_TCB     *p_tcb;
+    CPU_SR_ALLOC();
+
+
+    OSSemCreate(&BenchPendSem, (CPU_CHAR *)"Bench Sem", 0u, &err);
+    for (i = 0u; i < n; i++) {
+        BenchPendInsert(&BenchPendTCB[i], (OS_PRIO)(BENCH_PEND_PRIO_MIN + (BenchRandGet() % BENCH_PEND_PRIO_SPAN)));
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* ------- INSERT/REMOVE BELOW ALL THE WAITERS -------- */
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_PEND_REPS; i++) {
+        BenchPendInsert(&BenchPendProbeTCB, (OS_PRIO)(BENCH_PEND_PRIO_MAX + 1u));
+        OS_PendListRemove(&BenchPendProbeTCB);
+    }
+    ns = BenchNsGet() - t0;
+    CPU_CRITICAL_EXIT();
+    BenchResult("insert+remove (lowest)", n, ns, BENCH_PEND_REPS);
+
+    CPU_CRITICAL_ENTER();                                       /* -------- INSERT/REMOVE AT A RANDOM PRIORITY -------- */
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_PEND_REPS; i++) {
+        BenchPendInsert(&BenchPendProbeTCB, (OS_PRIO)(BENCH_PEND_PRIO_MIN + (BenchRandGet() % BENCH_PEND_PRIO_SPAN)));
+        OS_PendListRemove(&BenchPendProbeTCB);
+    }
+    ns = BenchNsGet() - t0;
+    CPU_CRITICAL_EXIT();
+    BenchResult("insert+remove (random)", n, ns, BENCH_PEND_REPS);
+
+    CPU_CRITICAL_ENTER();                                       /* ----------- CHANGE PRIORITY OF A WAITER ------------ */
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_PEND_REPS; i++) {
+        p_tcb       = &BenchPendTCB[BenchRandGet() % n];
+        p_tcb->Prio = (OS_PRIO)(BENCH_PEND_PRIO_MIN + (BenchRandGet() % BENCH_PEND_PRIO_SPAN));
+        OS_PendListChangePrio(p_tcb);
+    }
+    ns = BenchNsGet() - t0;
+    CPU_CRITICAL_EXIT();
+    BenchResult("change prio", n, ns, BENCH_PEND_REPS);
+
+    while (BenchPendSem.PendList.HeadPtr != (OS_TCB *)0) {      /* Unlink the waiters before the next size              */
+        OS_PendListRemove(BenchPendSem.PendList.HeadPtr);
+    }
+    (void)OSSemDel(&BenchPendSem, OS_OPT_DEL_ALWAYS, &err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchPendMain (void)
+{
+    CPU_INT32U  n;
+
+
+    for (n = 10u; n <= BENCH_PEND_MAX; n *= 10u) {
+        BenchPendRun(n);
+    }
+}
+
+
+int  main (void)
+{
+    BenchRun((OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u) ? "Pend list, priority table" : "Pend list, sorted list walk",
+              BenchPendMain);
+
+    return (0);
+}
@@ -0,0 +1,143 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_prio.c
+*********************************************************************************************************
+* Note(s)  : (1) Measures OS_PrioGetHighest(), OS_PrioInsert() and OS_PrioRemove() for the OS_CFG_PRIO_MAX
+*                of the build.  The worst case for the search is a bitmap where only the idle task is ready.
+*
+*            (2) The loops run on the kernel's bitmap in one critical section.  The bitmap is saved first and
+*                restored before the critical section ends, so that the scheduler never sees the test values.
+*
+*            (3) 'linear scan' is the former OS_PrioGetHighest() search of OSPrioTbl[], one entry at a time,
+*                run on the same bitmap for reference.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <string.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_PRIO_REPS                            1000000u
+#define  BENCH_PRIO_RAND_SIZE                          1024u    /* Must be a power of 2                                 */
+
+#define  BENCH_PRIO_TWO_LEVEL            (OS_CFG_PRIO_MAX > (2u * (CPU_CFG_DATA_SIZE * 8u)))
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_DATA             BenchPrioTblSave[OS_PRIO_TBL_SIZE];
+#if (BENCH_PRIO_TWO_LEVEL)
+static  CPU_DATA             BenchPrioGrpSave;
+#endif
+static  OS_PRIO              BenchPrioRand[BENCH_PRIO_RAND_SIZE];
+
+static  volatile  OS_PRIO    BenchPrioSink;
+
+
+/*
+*********************************************************************************************************
+*                                       LINEAR SCAN (REFERENCE)
+*********************************************************************************************************
+*/
+
+static  OS_PRIO  BenchPrioScan (void)
+{
+    CPU_DATA  *p_tbl;
+    OS_PRIO    prio;
+
+
+    prio  = 0u;
+    p_tbl = &OSPrioTbl[0];
+    while (*p_tbl == 0u) {
+        prio = (OS_PRIO)(prio + (CPU_CFG_DATA_SIZE * 8u));
+        p_tbl++;
+    }
+    prio += (OS_PRIO)CPU_CntLeadZeros(*p_tbl);
+
+    return (prio);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchPrioMain (void)
+{
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+    CPU_INT64U  ns_highest;
+    CPU_INT64U  ns_scan;
+    CPU_INT64U  ns_ins_rem;
+    CPU_SR_ALLOC();
+
+
+    for (i = 0u; i < BENCH_PRIO_RAND_SIZE; i++) {               /* Random priorities above the idle task                */
+        BenchPrioRand[i] = (OS_PRIO)(BenchRandGet() % (OS_CFG_PRIO_MAX - 1u));
+    }
+
+    CPU_CRITICAL_ENTER();
+    (void)memcpy(BenchPrioTblSave, OSPrioTbl, sizeof(OSPrioTbl));
+#if (BENCH_PRIO_TWO_LEVEL)
+    BenchPrioGrpSave = OSPrioGrp;
+#endif
+
+    OS_PrioInit();                                              /* Only the idle task is ready                          */
+    OS_PrioInsert((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));
+
+    t0 = BenchNsGet();                                          /* ------------- HIGHEST PRIORITY SEARCH -------------- */
+    for (i = 0u; i < BENCH_PRIO_REPS; i++) {
+        BenchPrioSink = OS_PrioGetHighest();
+    }
+    ns_highest = BenchNsGet() - t0;
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_PRIO_REPS; i++) {
+        BenchPrioSink = BenchPrioScan();
+    }
+    ns_scan = BenchNsGet() - t0;
+
+    t0 = BenchNsGet();                                          /* ---------------- INSERT AND REMOVE ----------------- */
+    for (i = 0u; i < BENCH_PRIO_REPS; i++) {
+        OS_PrioInsert(BenchPrioRand[i & (BENCH_PRIO_RAND_SIZE - 1u)]);
+        OS_PrioRemove(BenchPrioRand[i & (BENCH_PRIO_RAND_SIZE - 1u)]);
+    }
+    ns_ins_rem = BenchNsGet() - t0;
+
+    (void)memcpy(OSPrioTbl, BenchPrioTblSave, sizeof(OSPrioTbl));
+#if (BENCH_PRIO_TWO_LEVEL)
+    OSPrioGrp = BenchPrioGrpSave;
+#endif
+    CPU_CRITICAL_EXIT();
+
+    BenchResult("OS_PrioGetHighest", OS_CFG_PRIO_MAX, ns_highest, BENCH_PRIO_REPS);
+    BenchResult("linear scan", OS_CFG_PRIO_MAX, ns_scan, BENCH_PRIO_REPS);
+    BenchResult("insert+remove", OS_CFG_PRIO_MAX, ns_ins_rem, BENCH_PRIO_REPS);
+}
+
+
+int  main (void)
+{
+    BenchRun((BENCH_PRIO_TWO_LEVEL) ? "Priority bitmap, two levels" : "Priority bitmap, one or two words",
+              BenchPrioMain);
+
+    return (0);
+}
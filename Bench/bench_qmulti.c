@@ -0,0 +1,219 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_qmulti.c
+*********************************************************************************************************
+* Note(s)  : (1) A producer sends bursts of 1 to 64 messages to a higher priority consumer, which is waiting
+*                for them.  For each burst size:
+*
+*                    'OSQPost'           one OSQPost() per message, the consumer calls OSQPend().
+*                    'OSQPostMulti'      one OSQPostMulti() per burst, the consumer calls OSQPendMulti().
+*                    'OSTaskQPost'       one OSTaskQPost() per message, the consumer calls OSTaskQPend().
+*                    'OSTaskQPostMulti'  one OSTaskQPostMulti() per burst, the consumer calls OSTaskQPend().
+*
+*            (2) The 'n' column is the burst size, the figures are per message.  With one post per message,
+*                the consumer preempts the producer on every message.
+*
+*            (3) The consumers are created once, and read the mode of the current round when they wake up.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdint.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_QM_MSGS                               128000u    /* Multiple of every burst size                         */
+#define  BENCH_QM_BURST_MAX                              64u
+
+#define  BENCH_QM_MODE_Q                                  0u
+#define  BENCH_QM_MODE_Q_MULTI                            1u
+#define  BENCH_QM_MODE_TASK_Q                             2u
+#define  BENCH_QM_MODE_TASK_Q_MULTI                       3u
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_Q                     BenchQMQ;
+static  OS_MSG_INFO              BenchQMMsgs[BENCH_QM_BURST_MAX];
+
+static  OS_TCB                   BenchQMRxTCB;
+static  CPU_STK                  BenchQMRxStk[BENCH_TASK_STK_SIZE];
+static  OS_TCB                   BenchQMTaskRxTCB;
+static  CPU_STK                  BenchQMTaskRxStk[BENCH_TASK_STK_SIZE];
+
+static  volatile  CPU_INT32U     BenchQMMode;
+static  volatile  CPU_INT32U     BenchQMRxCtr;
+
+
+/*
+*********************************************************************************************************
+*                                           CONSUMER TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchQMRxTask (void  *p_arg)
+{
+    OS_MSG_INFO  msgs[BENCH_QM_BURST_MAX];
+    OS_MSG_SIZE  size;
+    OS_ERR       err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        if (BenchQMMode == BENCH_QM_MODE_Q_MULTI) {
+            BenchQMRxCtr += OSQPendMulti(&BenchQMQ, &msgs[0], BENCH_QM_BURST_MAX, 0u, OS_OPT_PEND_BLOCKING,
+                                         (CPU_TS *)0, &err);
+        } else {
+            (void)OSQPend(&BenchQMQ, 0u, OS_OPT_PEND_BLOCKING, &size, (CPU_TS *)0, &err);
+            BenchQMRxCtr++;
+        }
+    }
+}
+
+
+static  void  BenchQMTaskRxTask (void  *p_arg)
+{
+    OS_MSG_SIZE  size;
+    OS_ERR       err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskQPend(0u, OS_OPT_PEND_BLOCKING, &size, (CPU_TS *)0, &err);
+        BenchQMRxCtr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       BENCH ONE MODE AND BURST
+*********************************************************************************************************
+*/
+
+static  void  BenchQMRun (const  CPU_CHAR    *p_test,
+                                 CPU_INT32U   mode,
+                                 OS_MSG_QTY   burst)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    OS_MSG_QTY  j;
+    CPU_INT64U  t0;
+    CPU_INT64U  ns;
+
+
+    BenchQMMode  = mode;
+    BenchQMRxCtr = 0u;
+    t0           = BenchNsGet();
+    for (i = 0u; i < BENCH_QM_MSGS; i += burst) {
+        switch (mode) {
+            case BENCH_QM_MODE_Q:
+                 for (j = 0u; j < burst; j++) {
+                     OSQPost(&BenchQMQ, BenchQMMsgs[j].MsgPtr, BenchQMMsgs[j].MsgSize, OS_OPT_POST_FIFO, &err);
+                 }
+                 break;
+
+            case BENCH_QM_MODE_Q_MULTI:
+                 (void)OSQPostMulti(&BenchQMQ, &BenchQMMsgs[0], burst, OS_OPT_POST_FIFO, &err);
+                 break;
+
+            case BENCH_QM_MODE_TASK_Q:
+                 for (j = 0u; j < burst; j++) {
+                     OSTaskQPost(&BenchQMTaskRxTCB, BenchQMMsgs[j].MsgPtr, BenchQMMsgs[j].MsgSize,
+                                  OS_OPT_POST_FIFO, &err);
+                 }
+                 break;
+
+            case BENCH_QM_MODE_TASK_Q_MULTI:
+            default:
+                 (void)OSTaskQPostMulti(&BenchQMTaskRxTCB, &BenchQMMsgs[0], burst, OS_OPT_POST_FIFO, &err);
+                 break;
+        }
+    }
+    ns = BenchNsGet() - t0;
+
+    if (BenchQMRxCtr != BENCH_QM_MSGS) {
+        printf("%s: %u messages received\n", p_test, (unsigned)BenchQMRxCtr);
+    }
+    BenchResult(p_test, burst, ns, BENCH_QM_MSGS);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchQMMain (void)
+{
+    OS_ERR      err;
+    OS_MSG_QTY  burst;
+    OS_MSG_QTY  i;
+
+
+    for (i = 0u; i < BENCH_QM_BURST_MAX; i++) {
+        BenchQMMsgs[i].MsgPtr  = (void *)(uintptr_t)(i + 1u);
+        BenchQMMsgs[i].MsgSize = sizeof(uintptr_t);
+    }
+
+    OSQCreate(&BenchQMQ, (CPU_CHAR *)"Bench Q", BENCH_QM_BURST_MAX, &err);
+    OSTaskCreate(&BenchQMRxTCB,
+                 (CPU_CHAR *)"Bench Q Consumer",
+                  BenchQMRxTask,
+                  0,
+                 (OS_PRIO)(BENCH_TASK_PRIO - 1u),
+                 &BenchQMRxStk[0],
+                  BENCH_TASK_STK_SIZE / 10u,
+                  BENCH_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                  OS_OPT_TASK_STK_CHK,
+                 &err);
+    OSTaskCreate(&BenchQMTaskRxTCB,
+                 (CPU_CHAR *)"Bench Task Q Consumer",
+                  BenchQMTaskRxTask,
+                  0,
+                 (OS_PRIO)(BENCH_TASK_PRIO - 1u),
+                 &BenchQMTaskRxStk[0],
+                  BENCH_TASK_STK_SIZE / 10u,
+                  BENCH_TASK_STK_SIZE,
+                  BENCH_QM_BURST_MAX,
+                  0u,
+                  0,
+                  OS_OPT_TASK_STK_CHK,
+                 &err);
+
+    for (burst = 1u; burst <= BENCH_QM_BURST_MAX; burst *= 2u) {
+        BenchQMRun("OSQPost",          BENCH_QM_MODE_Q,            burst);
+        BenchQMRun("OSQPostMulti",     BENCH_QM_MODE_Q_MULTI,      burst);
+        BenchQMRun("OSTaskQPost",      BENCH_QM_MODE_TASK_Q,       burst);
+        BenchQMRun("OSTaskQPostMulti", BENCH_QM_MODE_TASK_Q_MULTI, burst);
+    }
+}
+
+
+int  main (void)
+{
+    BenchRun("Message bursts, one post per message vs one post per burst", BenchQMMain);
+
+    return (0);
+}
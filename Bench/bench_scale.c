@@ -0,0 +1,280 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_scale.c
+*********************************************************************************************************
+* Note(s)  : (1) Scaling of the tick list, the pend lists and the timer list with 10 to 5,000 tasks and
+*                timers.  Each level adds tasks and timers to the ones of the previous levels:
+*
+*                    'task_create'   OSTaskCreate() of the tasks added at this level.
+*                    'tmr_create'    OSTmrCreate() and OSTmrStart() of the timers added at this level,
+*                                    periodic with random delays and periods.
+*                    'tmr_start'     OSTmrSet() and OSTmrStart() of one more timer, with a random delay,
+*                                    among the running ones.
+*                    'run'           BENCH_SCALE_TICKS ticks of the whole population: even tasks wait for
+*                                    OSTimeDly() with random delays and sometimes post the semaphore, odd
+*                                    tasks pend on it with random timeouts.  The operations are the task
+*                                    wake-ups and timer callbacks, timed with the CPU time of the process,
+*                                    which includes the ticks.  The idle task sleeps in OSIdleTaskHook().
+*
+*            (2) One CSV line per test and level, after a header line:
+*
+*                    scale,variant,test,n,ops,ns_op,int_dis_max_ns
+*
+*                'int_dis_max_ns' is the longest interrupts disabled time of the test, from
+*                CPU_IntDisMeasMaxGet() after a CPU_StatReset() at its start.  Build with
+*                CPU_CFG_INT_DIS_MEAS_EN, else it is empty.
+*
+*            (3) The tasks and timers are created once and never deleted.  Build with
+*                OS_CPU_POSIX_UCONTEXT_EN, so that 5,000 tasks do not need 5,000 host threads.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_SCALE_MAX                               5000u
+#define  BENCH_SCALE_STK_SIZE                          1024u    /* OS_CPU_UCTX_STK_SIZE_MIN                             */
+#define  BENCH_SCALE_TICKS         (OS_CFG_TICK_RATE_HZ / 2u)   /* Length of a 'run'                                    */
+#define  BENCH_SCALE_DLY_MAX                            100u    /* Longest delay, timeout or timer period, in ticks     */
+#define  BENCH_SCALE_REPS                              1000u
+
+#define  BENCH_SCALE_PRIO_MIN            (BENCH_TASK_PRIO + 1u)
+#define  BENCH_SCALE_PRIO_MAX            (OS_CFG_PRIO_MAX - 4u) /* Above the timer task                                 */
+#define  BENCH_SCALE_PRIO_SPAN           (BENCH_SCALE_PRIO_MAX - BENCH_SCALE_PRIO_MIN + 1u)
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_INT32U        BenchScaleLevel[] = { 10u, 100u, 1000u, BENCH_SCALE_MAX };
+
+static  OS_TCB                   BenchScaleTCB[BENCH_SCALE_MAX];
+static  CPU_STK                  BenchScaleStk[BENCH_SCALE_MAX][BENCH_SCALE_STK_SIZE];
+static  OS_TMR                   BenchScaleTmr[BENCH_SCALE_MAX];
+static  OS_TMR                   BenchScaleProbeTmr;
+static  OS_SEM                   BenchScaleSem;
+
+static  volatile  CPU_INT32U     BenchScaleOps;
+
+
+/*
+*********************************************************************************************************
+*                                          RESULTS AS CSV LINES
+*********************************************************************************************************
+*/
+
+static  void  BenchScaleResult (const  CPU_CHAR    *p_test,
+                                       CPU_INT32U   n,
+                                       CPU_INT32U   ops,
+                                       CPU_INT64U   ns_total)
+{
+    static  CPU_BOOLEAN  hdr_done = DEF_NO;
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+            CPU_ERR      err;
+            CPU_INT64U   dis_ns;
+#endif
+
+
+    if (hdr_done == DEF_NO) {
+        printf("scale,variant,test,n,ops,ns_op,int_dis_max_ns\n");
+        hdr_done = DEF_YES;
+    }
+
+    printf("scale,%s,%s,%u,%u,%.1f,", BENCH_VARIANT, p_test, (unsigned)n, (unsigned)ops,
+           (ops != 0u) ? ((double)ns_total / (double)ops) : 0.0);
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    dis_ns = (CPU_INT64U)CPU_IntDisMeasMaxGet() * 1000000000u / CPU_TS_TmrFreqGet(&err);
+    printf("%llu", (unsigned long long)dis_ns);
+#endif
+    printf("\n");
+}
+
+
+static  void  BenchScaleMeasReset (void)
+{
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    CPU_StatReset();
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        WORKLOAD TASKS AND TIMERS
+*********************************************************************************************************
+*/
+
+static  void  BenchScaleTask (void  *p_arg)
+{
+    OS_ERR      err;
+    CPU_INT32U  ix;
+    CPU_INT32U  r;
+
+
+    ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+
+    for (;;) {
+        r = BenchRandGet();
+        if ((ix & 1u) == 0u) {
+            OSTimeDly((OS_TICK)(1u + (r % BENCH_SCALE_DLY_MAX)), OS_OPT_TIME_DLY, &err);
+            if ((r & 0x300u) == 0u) {                           /* One wake-up in four posts a waiter                   */
+                (void)OSSemPost(&BenchScaleSem, OS_OPT_POST_1, &err);
+            }
+        } else {
+            (void)OSSemPend(&BenchScaleSem, (OS_TICK)(1u + (r % BENCH_SCALE_DLY_MAX)),
+                            OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        }
+        BenchScaleOps++;
+    }
+}
+
+
+static  void  BenchScaleTmrCallback (void  *p_tmr,
+                                     void  *p_arg)
+{
+    (void)p_tmr;
+    (void)p_arg;
+
+    BenchScaleOps++;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BENCH ONE LEVEL
+*********************************************************************************************************
+*/
+
+static  void  BenchScaleCreate (CPU_INT32U  from,
+                                CPU_INT32U  to)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+
+
+    BenchScaleMeasReset();                                      /* ------------------ CREATE TASKS ------------------- */
+    t0 = BenchNsGet();
+    for (i = from; i < to; i++) {
+        OSTaskCreate(&BenchScaleTCB[i],
+                     (CPU_CHAR *)"Bench Scale Task",
+                     BenchScaleTask,
+                     (void *)(CPU_ADDR)i,
+                     (OS_PRIO)(BENCH_SCALE_PRIO_MIN + (BenchRandGet() % BENCH_SCALE_PRIO_SPAN)),
+                     &BenchScaleStk[i][0],
+                     0u,
+                     BENCH_SCALE_STK_SIZE,
+                     0u,
+                     0u,
+                     0,
+                     OS_OPT_NONE,
+                    &err);
+        if (err != OS_ERR_NONE) {
+            printf("OSTaskCreate() failed: %u\n", (unsigned)err);
+        }
+    }
+    BenchScaleResult("task_create", to, to - from, BenchNsGet() - t0);
+
+    BenchScaleMeasReset();                                      /* ------------------ CREATE TIMERS ------------------ */
+    t0 = BenchNsGet();
+    for (i = from; i < to; i++) {
+        OSTmrCreate(&BenchScaleTmr[i],
+                    (CPU_CHAR *)"Bench Scale Tmr",
+                    (OS_TICK)(1u + (BenchRandGet() % BENCH_SCALE_DLY_MAX)),
+                    (OS_TICK)(1u + (BenchRandGet() % BENCH_SCALE_DLY_MAX)),
+                     OS_OPT_TMR_PERIODIC,
+                     BenchScaleTmrCallback,
+                     0,
+                    &err);
+        (void)OSTmrStart(&BenchScaleTmr[i], &err);
+        if (err != OS_ERR_NONE) {
+            printf("OSTmrStart() failed: %u\n", (unsigned)err);
+        }
+    }
+    BenchScaleResult("tmr_create", to, to - from, BenchNsGet() - t0);
+}
+
+
+static  void  BenchScaleTmrStart (CPU_INT32U  n)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+
+
+    BenchScaleMeasReset();
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_SCALE_REPS; i++) {                   /* Restarting removes it from the list, then inserts it */
+        OSTmrSet(&BenchScaleProbeTmr, (OS_TICK)(1u + (BenchRandGet() % BENCH_SCALE_DLY_MAX)), 0u,
+                  BenchScaleTmrCallback, 0, &err);
+        (void)OSTmrStart(&BenchScaleProbeTmr, &err);
+    }
+    BenchScaleResult("tmr_start", n, BENCH_SCALE_REPS, BenchNsGet() - t0);
+    (void)OSTmrStop(&BenchScaleProbeTmr, OS_OPT_TMR_NONE, 0, &err);
+}
+
+
+static  void  BenchScaleRun (CPU_INT32U  n)
+{
+    OS_ERR      err;
+    CPU_INT32U  ops;
+    CPU_INT64U  t0;
+
+
+    BenchScaleOps = 0u;
+    BenchScaleMeasReset();
+    t0  = BenchProcessNsGet();
+    OSTimeDly(BENCH_SCALE_TICKS, OS_OPT_TIME_DLY, &err);        /* The whole population runs meanwhile                  */
+    ops = BenchScaleOps;
+    BenchScaleResult("run", n, ops, BenchProcessNsGet() - t0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchScaleMain (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT32U  n;
+
+
+    OSSemCreate(&BenchScaleSem, (CPU_CHAR *)"Bench Scale Sem", 0u, &err);
+    OSTmrCreate(&BenchScaleProbeTmr, (CPU_CHAR *)"Bench Probe Tmr", 1u, 0u, OS_OPT_TMR_ONE_SHOT,
+                 BenchScaleTmrCallback, 0, &err);
+
+    n = 0u;
+    for (i = 0u; i < (sizeof(BenchScaleLevel) / sizeof(BenchScaleLevel[0])); i++) {
+        BenchScaleCreate(n, BenchScaleLevel[i]);
+        n = BenchScaleLevel[i];
+        BenchScaleTmrStart(n);
+        BenchScaleRun(n);
+    }
+}
+
+
+int  main (void)
+{
+    BenchRun("Tick list, pend list and timer list scaling", BenchScaleMain);
+
+    return (0);
+}
@@ -0,0 +1,347 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_smp.c
+*********************************************************************************************************
+* Note(s)  : (1) Scaling of the POSIX port with OS_CFG_SMP_CORE_NBR simulated cores:
+*
+*                    'spin any core'     BENCH_SMP_TASKS tasks of equal priority run CPU-bound chunks of work,
+*                                        round-robin, on any core.
+*                    'spin pinned'       the same, task 'i' pinned to core 'i % OS_CFG_SMP_CORE_NBR' with
+*                                        OS_OPT_TASK_CORE().
+*                    'ping-pong'         two tasks wake each other BENCH_SMP_ROUNDS times with their task
+*                                        semaphores, one pinned to the first core and one to the last.
+*                    'mutex'             BENCH_SMP_TASKS tasks, task 'i' pinned to core 'i % OS_CFG_SMP_CORE_NBR',
+*                                        each increment a shared counter BENCH_SMP_MUTEX_ITER times under one
+*                                        mutex.  The counter is checked at the end: a lost update means two
+*                                        tasks owned the mutex at once.
+*
+*            (2) The 'n' column is the number of simulated cores.  The spin cases count chunks of work done
+*                in BENCH_SMP_TICKS ticks: with as many host CPUs as cores, op/s grows with the cores.
+*                The number of host CPUs is printed in the title.  The 'mutex' case counts pend/post pairs.
+*
+*            (3) The tasks are created once and never deleted.  Between the cases, they wait on their task
+*                semaphore.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <unistd.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_SMP_TASKS                                  8u
+#define  BENCH_SMP_TASK_PRIO                             10u    /* Below the bench task, which only waits               */
+#define  BENCH_SMP_TICKS               (OS_CFG_TICK_RATE_HZ)    /* Length of a spin case                                */
+#define  BENCH_SMP_CHUNK                              10000u    /* Iterations per chunk of work                         */
+#define  BENCH_SMP_ROUNDS                            100000u
+#define  BENCH_SMP_MUTEX_ITER                         20000u    /* Pend/post pairs per mutex task                       */
+#define  BENCH_SMP_MUTEX_HOLD                            64u    /* Iterations of work while the mutex is held           */
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB                   BenchSmpSpinTCB[2u][BENCH_SMP_TASKS];
+static  CPU_STK                  BenchSmpSpinStk[2u][BENCH_SMP_TASKS][BENCH_TASK_STK_SIZE];
+
+static  OS_TCB                   BenchSmpPingTCB;
+static  CPU_STK                  BenchSmpPingStk[BENCH_TASK_STK_SIZE];
+static  OS_TCB                   BenchSmpPongTCB;
+static  CPU_STK                  BenchSmpPongStk[BENCH_TASK_STK_SIZE];
+
+static  OS_TCB                   BenchSmpMutexTCB[BENCH_SMP_TASKS];
+static  CPU_STK                  BenchSmpMutexStk[BENCH_SMP_TASKS][BENCH_TASK_STK_SIZE];
+static  OS_MUTEX                 BenchSmpMutex;
+
+static  volatile  CPU_BOOLEAN    BenchSmpSpinRun;
+static  volatile  CPU_INT32U     BenchSmpSpinCtr[BENCH_SMP_TASKS];
+static  volatile  CPU_INT32U     BenchSmpSink;
+static  volatile  CPU_INT64U     BenchSmpPingNs;
+static  volatile  CPU_INT32U     BenchSmpMutexCtr;              /* Shared counter, only changed with the mutex held     */
+static  volatile  CPU_INT32U     BenchSmpMutexDoneCtr;          /* Mutex tasks done, idem                               */
+
+
+/*
+*********************************************************************************************************
+*                                              SPIN TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchSmpSpinTask (void  *p_arg)
+{
+    OS_ERR      err;
+    CPU_INT32U  ix;
+    CPU_INT32U  i;
+    CPU_INT32U  x;
+
+
+    ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+    x  = ix + 1u;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        while (BenchSmpSpinRun == DEF_YES) {
+            for (i = 0u; i < BENCH_SMP_CHUNK; i++) {            /* xorshift32, kept out of registers by the sink        */
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x <<  5;
+            }
+            BenchSmpSink = x;
+            BenchSmpSpinCtr[ix]++;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           PING-PONG TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchSmpPingTask (void  *p_arg)
+{
+    OS_ERR      err;
+    CPU_INT64U  t0;
+    CPU_INT32U  i;
+
+
+    (void)p_arg;
+
+    (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    t0 = BenchNsGet();
+    for (i = 0u; i < BENCH_SMP_ROUNDS; i++) {
+        OSTaskSemPost(&BenchSmpPongTCB, OS_OPT_POST_NONE, &err);
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+    BenchSmpPingNs = BenchNsGet() - t0;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+
+
+static  void  BenchSmpPongTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSTaskSemPost(&BenchSmpPingTCB, OS_OPT_POST_NONE, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             MUTEX TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchSmpMutexTask (void  *p_arg)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT32U  j;
+    CPU_INT32U  ctr;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        for (i = 0u; i < BENCH_SMP_MUTEX_ITER; i++) {
+            OSMutexPend(&BenchSmpMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+            ctr = BenchSmpMutexCtr;                             /* Read, work, write: a window for lost updates         */
+            for (j = 0u; j < BENCH_SMP_MUTEX_HOLD; j++) {
+                BenchSmpSink = j;
+            }
+            BenchSmpMutexCtr = ctr + 1u;
+            OSMutexPost(&BenchSmpMutex, OS_OPT_POST_NONE, &err);
+        }
+        OSMutexPend(&BenchSmpMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchSmpMutexDoneCtr++;
+        OSMutexPost(&BenchSmpMutex, OS_OPT_POST_NONE, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BENCH ONE CASE
+*********************************************************************************************************
+*/
+
+static  void  BenchSmpSpin (const  CPU_CHAR  *p_test,
+                                   OS_TCB    *p_tcb_tbl)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT32U  ops;
+    CPU_INT64U  t0;
+    CPU_INT64U  ns;
+
+
+    for (i = 0u; i < BENCH_SMP_TASKS; i++) {
+        BenchSmpSpinCtr[i] = 0u;
+    }
+    BenchSmpSpinRun = DEF_YES;
+    t0              = BenchNsGet();
+    for (i = 0u; i < BENCH_SMP_TASKS; i++) {
+        OSTaskSemPost(&p_tcb_tbl[i], OS_OPT_POST_NONE, &err);
+    }
+    OSTimeDly(BENCH_SMP_TICKS, OS_OPT_TIME_DLY, &err);
+    ops             = 0u;
+    for (i = 0u; i < BENCH_SMP_TASKS; i++) {                    /* Chunks in progress are not counted                   */
+        ops += BenchSmpSpinCtr[i];
+    }
+    ns              = BenchNsGet() - t0;
+    BenchSmpSpinRun = DEF_NO;
+    OSTimeDly(1u, OS_OPT_TIME_DLY, &err);                       /* Until every spin task waits again                    */
+
+    BenchResult(p_test, OS_CFG_SMP_CORE_NBR, ns, ops);
+}
+
+
+static  void  BenchSmpPingPong (void)
+{
+    OS_ERR  err;
+
+
+    BenchSmpPingNs = 0u;
+    OSTaskSemPost(&BenchSmpPingTCB, OS_OPT_POST_NONE, &err);
+    while (BenchSmpPingNs == 0u) {                              /* Until the ping task is done                          */
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);
+    }
+
+    BenchResult("ping-pong", OS_CFG_SMP_CORE_NBR, BenchSmpPingNs, BENCH_SMP_ROUNDS);
+}
+
+
+static  void  BenchSmpMutexRun (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT64U  t0;
+    CPU_INT64U  ns;
+
+
+    BenchSmpMutexCtr     = 0u;
+    BenchSmpMutexDoneCtr = 0u;
+    t0                   = BenchNsGet();
+    for (i = 0u; i < BENCH_SMP_TASKS; i++) {
+        OSTaskSemPost(&BenchSmpMutexTCB[i], OS_OPT_POST_NONE, &err);
+    }
+    while (BenchSmpMutexDoneCtr < BENCH_SMP_TASKS) {            /* Until every mutex task is done                       */
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);
+    }
+    ns                   = BenchNsGet() - t0;
+
+    BenchResult("mutex", OS_CFG_SMP_CORE_NBR, ns, BENCH_SMP_TASKS * BENCH_SMP_MUTEX_ITER);
+    if (BenchSmpMutexCtr != (BENCH_SMP_TASKS * BENCH_SMP_MUTEX_ITER)) {
+        printf("# Mutex counter is %lu, expected %lu\n",
+               (unsigned long)BenchSmpMutexCtr,
+               (unsigned long)(BENCH_SMP_TASKS * BENCH_SMP_MUTEX_ITER));
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchSmpTaskCreate (OS_TCB       *p_tcb,
+                                  CPU_CHAR     *p_name,
+                                  OS_TASK_PTR   p_task,
+                                  void         *p_arg,
+                                  CPU_STK      *p_stk,
+                                  OS_OPT        opt)
+{
+    OS_ERR  err;
+
+
+    OSTaskCreate(p_tcb,
+                 p_name,
+                 p_task,
+                 p_arg,
+                 BENCH_SMP_TASK_PRIO,
+                 p_stk,
+                 BENCH_TASK_STK_SIZE / 10u,
+                 BENCH_TASK_STK_SIZE,
+                 0u,
+                 1u,                                            /* One tick per round-robin turn                        */
+                 0,
+                (OS_OPT_TASK_STK_CHK | opt),
+                &err);
+    if (err != OS_ERR_NONE) {
+        printf("OSTaskCreate() failed: %u\n", (unsigned)err);
+    }
+}
+
+
+static  void  BenchSmpMain (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+
+
+    OSSchedRoundRobinCfg(OS_TRUE, 1u, &err);
+    OSMutexCreate(&BenchSmpMutex, (CPU_CHAR *)"Bench Mutex", &err);
+    if (err != OS_ERR_NONE) {
+        printf("OSMutexCreate() failed: %u\n", (unsigned)err);
+        return;
+    }
+
+    for (i = 0u; i < BENCH_SMP_TASKS; i++) {
+        BenchSmpTaskCreate(&BenchSmpSpinTCB[0u][i], (CPU_CHAR *)"Bench Spin Task",   BenchSmpSpinTask,
+                           (void *)(CPU_ADDR)i, &BenchSmpSpinStk[0u][i][0], OS_OPT_NONE);
+        BenchSmpTaskCreate(&BenchSmpSpinTCB[1u][i], (CPU_CHAR *)"Bench Pinned Task", BenchSmpSpinTask,
+                           (void *)(CPU_ADDR)i, &BenchSmpSpinStk[1u][i][0],
+                            OS_OPT_TASK_CORE(i % OS_CFG_SMP_CORE_NBR));
+        BenchSmpTaskCreate(&BenchSmpMutexTCB[i],       (CPU_CHAR *)"Bench Mutex Task",  BenchSmpMutexTask,
+                           (void *)(CPU_ADDR)i, &BenchSmpMutexStk[i][0],
+                            OS_OPT_TASK_CORE(i % OS_CFG_SMP_CORE_NBR));
+    }
+    BenchSmpTaskCreate(&BenchSmpPingTCB, (CPU_CHAR *)"Bench Ping Task", BenchSmpPingTask, 0,
+                       &BenchSmpPingStk[0], OS_OPT_TASK_CORE(0u));
+    BenchSmpTaskCreate(&BenchSmpPongTCB, (CPU_CHAR *)"Bench Pong Task", BenchSmpPongTask, 0,
+                       &BenchSmpPongStk[0], OS_OPT_TASK_CORE(OS_CFG_SMP_CORE_NBR - 1u));
+
+    BenchSmpSpin("spin any core", &BenchSmpSpinTCB[0u][0u]);
+    BenchSmpSpin("spin pinned",   &BenchSmpSpinTCB[1u][0u]);
+    BenchSmpPingPong();
+    BenchSmpMutexRun();
+}
+
+
+int  main (void)
+{
+    CPU_CHAR  title[96];
+
+
+    (void)snprintf(title, sizeof(title), "Multi-core scaling, %u simulated cores, %ld host CPUs",
+                   (unsigned)OS_CFG_SMP_CORE_NBR, sysconf(_SC_NPROCESSORS_ONLN));
+    BenchRun(title, BenchSmpMain);
+
+    return (0);
+}
@@ -0,0 +1,179 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_stream.c
+*********************************************************************************************************
+* Note(s)  : (1) Moves a byte stream from a producer task to a higher priority consumer task, the way a
+*                receive interrupt hands bytes to a driver task.  The producer writes one byte per call:
+*
+*                    'queue'         one OSQPost() per byte, one OSQPend() per byte.
+*                    'stream, N'     OSStreamWrite() of one byte, OSStreamRead() of up to 64 bytes, with a
+*                                    trigger level of N bytes.
+*
+*            (2) The consumer preempts the producer each time it is made ready, so the number of wake-ups is
+*                also the number of context switches.  The time is the wall time per byte received.
+*
+*            (3) The producer is created once, and started for each mode through its task semaphore.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdint.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_STREAM_BYTES                          100000u    /* Multiple of every trigger level                      */
+#define  BENCH_STREAM_BUF_SIZE                          256u    /* Must be a power of 2                                 */
+#define  BENCH_STREAM_RD_SIZE                            64u
+
+#define  BENCH_STREAM_MODE_Q                              0u
+#define  BENCH_STREAM_MODE_STREAM                         1u
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_Q          BenchStreamQ;
+static  OS_STREAM     BenchStream;
+static  CPU_INT08U    BenchStreamBuf[BENCH_STREAM_BUF_SIZE];
+
+static  CPU_INT32U    BenchStreamMode;
+
+static  OS_TCB        BenchStreamTxTCB;
+static  CPU_STK       BenchStreamTxStk[BENCH_TASK_STK_SIZE];
+
+
+/*
+*********************************************************************************************************
+*                                            PRODUCER TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchStreamTxTask (void  *p_arg)
+{
+    CPU_INT32U  i;
+    CPU_INT08U  byte;
+    OS_ERR      err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        for (i = 0u; i < BENCH_STREAM_BYTES; i++) {
+            byte = (CPU_INT08U)i;
+            if (BenchStreamMode == BENCH_STREAM_MODE_Q) {
+                OSQPost(&BenchStreamQ, (void *)(uintptr_t)byte, sizeof(byte), OS_OPT_POST_FIFO, &err);
+            } else {
+                (void)OSStreamWrite(&BenchStream, &byte, sizeof(byte), OS_OPT_POST_NONE, &err);
+            }
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BENCH ONE MODE
+*********************************************************************************************************
+*/
+
+static  void  BenchStreamRun (const  CPU_CHAR    *p_test,
+                                     CPU_INT32U   mode,
+                                     OS_MSG_SIZE  trigger_level)
+{
+    OS_ERR       err;
+    OS_MSG_SIZE  size;
+    CPU_INT08U   buf[BENCH_STREAM_RD_SIZE];
+    CPU_INT32U   nbr_bytes;
+    CPU_INT32U   nbr_wakes;
+    CPU_INT64U   t0;
+    CPU_INT64U   ns;
+
+
+    if (mode == BENCH_STREAM_MODE_Q) {
+        OSQCreate(&BenchStreamQ, (CPU_CHAR *)"Bench Q", BENCH_STREAM_BUF_SIZE, &err);
+    } else {
+        OSStreamCreate(&BenchStream, (CPU_CHAR *)"Bench Stream", &BenchStreamBuf[0], BENCH_STREAM_BUF_SIZE,
+                        trigger_level, &err);
+    }
+
+    BenchStreamMode = mode;
+    nbr_bytes       = 0u;
+    nbr_wakes       = 0u;
+    t0              = BenchNsGet();
+    OSTaskSemPost(&BenchStreamTxTCB, OS_OPT_POST_NONE, &err);   /* Producer runs once this task pends               */
+    while (nbr_bytes < BENCH_STREAM_BYTES) {
+        if (mode == BENCH_STREAM_MODE_Q) {
+            (void)OSQPend(&BenchStreamQ, 0u, OS_OPT_PEND_BLOCKING, &size, (CPU_TS *)0, &err);
+            nbr_bytes++;
+        } else {
+            nbr_bytes += OSStreamRead(&BenchStream, &buf[0], BENCH_STREAM_RD_SIZE, 0u, OS_OPT_PEND_BLOCKING,
+                                      (CPU_TS *)0, &err);
+        }
+        nbr_wakes++;
+    }
+    ns = BenchNsGet() - t0;
+
+    OSTimeDly(1u, OS_OPT_TIME_DLY, &err);                       /* Let the producer return to its task semaphore        */
+    if (mode == BENCH_STREAM_MODE_Q) {
+        (void)OSQDel(&BenchStreamQ, OS_OPT_DEL_ALWAYS, &err);
+    } else {
+        (void)OSStreamDel(&BenchStream, OS_OPT_DEL_ALWAYS, &err);
+    }
+
+    BenchResult(p_test, nbr_wakes, ns, nbr_bytes);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchStreamMain (void)
+{
+    OS_ERR  err;
+
+
+    OSTaskCreate(&BenchStreamTxTCB,
+                 (CPU_CHAR *)"Bench Producer",
+                  BenchStreamTxTask,
+                  0,
+                 (OS_PRIO)(BENCH_TASK_PRIO + 1u),
+                 &BenchStreamTxStk[0],
+                  BENCH_TASK_STK_SIZE / 10u,
+                  BENCH_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                  OS_OPT_TASK_STK_CHK,
+                 &err);
+
+    BenchStreamRun("queue",      BENCH_STREAM_MODE_Q,       0u);
+    BenchStreamRun("stream, 1",  BENCH_STREAM_MODE_STREAM,  1u);
+    BenchStreamRun("stream, 8",  BENCH_STREAM_MODE_STREAM,  8u);
+    BenchStreamRun("stream, 32", BENCH_STREAM_MODE_STREAM, 32u);
+}
+
+
+int  main (void)
+{
+    BenchRun("Byte stream, producer task to consumer task", BenchStreamMain);
+
+    return (0);
+}
@@ -0,0 +1,326 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_tm.c
+*********************************************************************************************************
+* Note(s)  : (1) Throughput workloads in the style of the Thread-Metric suite.  Each one runs for
+*                BENCH_TM_TICKS ticks while the bench task waits, and counts its operations:
+*
+*                    'cooperative'       BENCH_TM_TASKS tasks of equal priority count and yield with
+*                                        OSSchedRoundRobinYield().
+*                    'preemptive'        BENCH_TM_TASKS tasks of increasing priority: each one counts and
+*                                        resumes the next with OSTaskResume(), which runs at once, counts
+*                                        and suspends itself with OSTaskSuspend().
+*                    'interrupt'         a task triggers a software interrupt whose ISR posts a semaphore,
+*                                        and pends on it.
+*                    'message'           a task posts a 16-byte message to a queue and pends on it.
+*                    'synchronization'   a task pends on a semaphore without blocking, then posts it.
+*                    'memory'            a task gets a 128-byte block from a memory partition and puts it
+*                                        back.
+*
+*            (2) The 'n' column is the number of tasks of the workload.  op/s is the figure of merit, see
+*                'Bench/matrix.sh' for the comparison of kernel configurations.
+*
+*            (3) The tasks of a workload are created when it starts and suspended when it ends.  They are
+*                never deleted.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_TM_TASKS                                   5u
+#define  BENCH_TM_PRIO                                   10u    /* Highest priority of the workload tasks               */
+#define  BENCH_TM_TICKS                (OS_CFG_TICK_RATE_HZ)    /* Length of a workload                                 */
+
+#define  BENCH_TM_MSG_SIZE                               16u
+#define  BENCH_TM_MEM_BLK_SIZE                          128u
+#define  BENCH_TM_MEM_BLK_NBR                            16u
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchTmISR (void);
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB                   BenchTmCoopTCB[BENCH_TM_TASKS];
+static  CPU_STK                  BenchTmCoopStk[BENCH_TM_TASKS][BENCH_TASK_STK_SIZE];
+static  OS_TCB                   BenchTmPreemptTCB[BENCH_TM_TASKS];
+static  CPU_STK                  BenchTmPreemptStk[BENCH_TM_TASKS][BENCH_TASK_STK_SIZE];
+static  OS_TCB                   BenchTmOneTCB[4u];             /* Interrupt, message, synchronization and memory      */
+static  CPU_STK                  BenchTmOneStk[4u][BENCH_TASK_STK_SIZE];
+
+static  OS_SEM                   BenchTmIntSem;
+static  OS_SEM                   BenchTmSyncSem;
+static  OS_Q                     BenchTmQ;
+static  OS_MEM                   BenchTmMem;
+static  CPU_INT08U               BenchTmMemStorage[BENCH_TM_MEM_BLK_NBR][BENCH_TM_MEM_BLK_SIZE];
+static  CPU_INT32U               BenchTmMsg[BENCH_TM_MSG_SIZE / sizeof(CPU_INT32U)];
+
+static  CPU_INTERRUPT            BenchTmInt = { .NamePtr  = "Bench sw interrupt",
+                                                .Prio     =  5u,
+                                                .TraceEn  =  0u,
+                                                .ISR_Fnct =  BenchTmISR,
+                                                .En       =  1u,
+                                              };
+
+static  volatile  CPU_INT32U     BenchTmCtr[BENCH_TM_TASKS];
+
+
+/*
+*********************************************************************************************************
+*                                          SOFTWARE INTERRUPT
+*********************************************************************************************************
+*/
+
+static  void  BenchTmISR (void)
+{
+    OS_ERR  err;
+
+
+    OSIntEnter();
+    (void)OSSemPost(&BenchTmIntSem, OS_OPT_POST_1, &err);
+    CPU_ISR_End();
+    OSIntExit();
+}
+
+
+/*
+*********************************************************************************************************
+*                                            WORKLOAD TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchTmCoopTask (void  *p_arg)
+{
+    OS_ERR      err;
+    CPU_INT32U  ix;
+
+
+    ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+
+    for (;;) {
+        BenchTmCtr[ix]++;
+        OSSchedRoundRobinYield(&err);
+    }
+}
+
+
+static  void  BenchTmPreemptTask (void  *p_arg)
+{
+    OS_ERR      err;
+    CPU_INT32U  ix;
+
+
+    ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+
+    for (;;) {
+        if (ix != 0u) {                                         /* All but the lowest priority task wait to be resumed  */
+            OSTaskSuspend((OS_TCB *)0, &err);
+        }
+        BenchTmCtr[ix]++;
+        if (ix != (BENCH_TM_TASKS - 1u)) {
+            OSTaskResume(&BenchTmPreemptTCB[ix + 1u], &err);
+        }
+    }
+}
+
+
+static  void  BenchTmIntTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        CPU_InterruptTrigger(&BenchTmInt);
+        (void)OSSemPend(&BenchTmIntSem, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchTmCtr[0]++;
+    }
+}
+
+
+static  void  BenchTmMsgTask (void  *p_arg)
+{
+    OS_ERR       err;
+    OS_MSG_SIZE  size;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        BenchTmMsg[0] = BenchTmCtr[0];
+        OSQPost(&BenchTmQ, (void *)&BenchTmMsg[0], BENCH_TM_MSG_SIZE, OS_OPT_POST_FIFO, &err);
+        (void)OSQPend(&BenchTmQ, 0u, OS_OPT_PEND_BLOCKING, &size, (CPU_TS *)0, &err);
+        BenchTmCtr[0]++;
+    }
+}
+
+
+static  void  BenchTmSyncTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSSemPend(&BenchTmSyncSem, 0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+        (void)OSSemPost(&BenchTmSyncSem, OS_OPT_POST_1, &err);
+        BenchTmCtr[0]++;
+    }
+}
+
+
+static  void  BenchTmMemTask (void  *p_arg)
+{
+    OS_ERR   err;
+    void    *p_blk;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        p_blk = OSMemGet(&BenchTmMem, &err);
+        OSMemPut(&BenchTmMem, p_blk, &err);
+        BenchTmCtr[0]++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BENCH ONE CASE
+*********************************************************************************************************
+*/
+
+static  void  BenchTmTaskCreate (OS_TCB       *p_tcb,
+                                 OS_TASK_PTR   p_task,
+                                 CPU_INT32U    ix,
+                                 OS_PRIO       prio,
+                                 CPU_STK      *p_stk)
+{
+    OS_ERR  err;
+
+
+    OSTaskCreate(p_tcb,
+                 (CPU_CHAR *)"Bench Workload Task",
+                 p_task,
+                 (void *)(CPU_ADDR)ix,
+                 prio,
+                 p_stk,
+                 BENCH_TASK_STK_SIZE / 10u,
+                 BENCH_TASK_STK_SIZE,
+                 0u,
+                 0u,
+                 0,
+                 OS_OPT_TASK_STK_CHK,
+                &err);
+    if (err != OS_ERR_NONE) {
+        printf("OSTaskCreate() failed: %u\n", (unsigned)err);
+    }
+}
+
+
+static  void  BenchTmRun (const  CPU_CHAR    *p_test,
+                                 OS_TCB      *p_tcb_tbl,
+                                 CPU_INT32U   nbr)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT32U  ops;
+    CPU_INT64U  t0;
+    CPU_INT64U  ns;
+
+
+    t0  = BenchNsGet();
+    OSTimeDly(BENCH_TM_TICKS, OS_OPT_TIME_DLY, &err);           /* The workload tasks run meanwhile                     */
+    ops = 0u;
+    for (i = 0u; i < nbr; i++) {
+        ops += BenchTmCtr[i];
+    }
+    ns  = BenchNsGet() - t0;
+
+    for (i = 0u; i < nbr; i++) {
+        OSTaskSuspend(&p_tcb_tbl[i], &err);
+    }
+    for (i = 0u; i < BENCH_TM_TASKS; i++) {
+        BenchTmCtr[i] = 0u;
+    }
+
+    BenchResult(p_test, nbr, ns, ops);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchTmMain (void)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+
+
+    OSSemCreate(&BenchTmIntSem,  (CPU_CHAR *)"Bench Int Sem",  0u, &err);
+    OSSemCreate(&BenchTmSyncSem, (CPU_CHAR *)"Bench Sync Sem", 1u, &err);
+    OSQCreate(&BenchTmQ, (CPU_CHAR *)"Bench Q", 1u, &err);
+    OSMemCreate(&BenchTmMem, (CPU_CHAR *)"Bench Mem", &BenchTmMemStorage[0][0],
+                BENCH_TM_MEM_BLK_NBR, BENCH_TM_MEM_BLK_SIZE, &err);
+    OSSchedRoundRobinCfg(OS_TRUE, 0u, &err);
+
+    for (i = 0u; i < BENCH_TM_TASKS; i++) {
+        BenchTmTaskCreate(&BenchTmCoopTCB[i], BenchTmCoopTask, i, BENCH_TM_PRIO, &BenchTmCoopStk[i][0]);
+    }
+    BenchTmRun("cooperative", &BenchTmCoopTCB[0], BENCH_TM_TASKS);
+
+    for (i = 0u; i < BENCH_TM_TASKS; i++) {                     /* Task 0 has the lowest priority                       */
+        BenchTmTaskCreate(&BenchTmPreemptTCB[i], BenchTmPreemptTask, i,
+                          (OS_PRIO)(BENCH_TM_PRIO + BENCH_TM_TASKS - 1u - i), &BenchTmPreemptStk[i][0]);
+    }
+    BenchTmRun("preemptive", &BenchTmPreemptTCB[0], BENCH_TM_TASKS);
+
+    BenchTmTaskCreate(&BenchTmOneTCB[0], BenchTmIntTask,  0u, BENCH_TM_PRIO, &BenchTmOneStk[0][0]);
+    BenchTmRun("interrupt", &BenchTmOneTCB[0], 1u);
+
+    BenchTmTaskCreate(&BenchTmOneTCB[1], BenchTmMsgTask,  0u, BENCH_TM_PRIO, &BenchTmOneStk[1][0]);
+    BenchTmRun("message", &BenchTmOneTCB[1], 1u);
+
+    BenchTmTaskCreate(&BenchTmOneTCB[2], BenchTmSyncTask, 0u, BENCH_TM_PRIO, &BenchTmOneStk[2][0]);
+    BenchTmRun("synchronization", &BenchTmOneTCB[2], 1u);
+
+    BenchTmTaskCreate(&BenchTmOneTCB[3], BenchTmMemTask,  0u, BENCH_TM_PRIO, &BenchTmOneStk[3][0]);
+    BenchTmRun("memory", &BenchTmOneTCB[3], 1u);
+}
+
+
+int  main (void)
+{
+    BenchRun("Thread-Metric style throughput, kernel configuration " BENCH_VARIANT, BenchTmMain);
+
+    return (0);
+}
@@ -0,0 +1,191 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                        POSIX HOST BENCHMARKS
+*
+* Filename : bench_tmr.c
+*********************************************************************************************************
+* Note(s)  : (1) Measures the cost of OSTmrStart(), OSTmrStop() and of a timer expiry for 10 to 10,000
+*                active timers.  Build with OS_CFG_TMR_WHEEL_EN set to 0 (sorted list) or 1 (wheel).
+*
+*            (2) Start/stop are timed from the bench task with the wall clock.  The expiry cost is the CPU
+*                time consumed by the timer task thread divided by the number of callbacks it executed.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  "bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_TMR_MAX                                10000u
+
+#define  BENCH_TMR_DLY_MIN                           100000u    /* Start/stop: long delays, timers never expire         */
+#define  BENCH_TMR_DLY_SPAN                          100000u
+
+#define  BENCH_TMR_PERIOD_MIN                           500u    /* Expiry: periodic timers, in ticks                    */
+#define  BENCH_TMR_PERIOD_SPAN                         1000u
+#define  BENCH_TMR_WARMUP                              1500u
+#define  BENCH_TMR_WINDOW                              2000u
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TMR               BenchTmr[BENCH_TMR_MAX];
+static  CPU_INT32U           BenchTmrOrder[BENCH_TMR_MAX];
+
+static  volatile  CPU_INT32U   BenchTmrFired;
+static  volatile  CPU_BOOLEAN  BenchTmrSampleReq;
+static  volatile  CPU_INT32U   BenchTmrSampleFired;
+static  volatile  CPU_INT64U   BenchTmrSampleNs;
+
+
+/*
+*********************************************************************************************************
+*                                           TIMER CALLBACK
+*
+* Note(s) : (1) Runs in the timer task.  The thread CPU time is only read on request so that the
+*               callback itself stays negligible.
+*********************************************************************************************************
+*/
+
+static  void  BenchTmrCallback (void  *p_tmr,
+                                void  *p_arg)
+{
+    (void)p_tmr;
+    (void)p_arg;
+
+    BenchTmrFired++;
+    if (BenchTmrSampleReq == DEF_TRUE) {
+        BenchTmrSampleNs    = BenchThreadNsGet();
+        BenchTmrSampleFired = BenchTmrFired;
+        BenchTmrSampleReq   = DEF_FALSE;
+    }
+}
+
+
+static  void  BenchTmrSample (CPU_INT64U  *p_ns,
+                              CPU_INT32U  *p_fired)
+{
+    OS_ERR  err;
+
+
+    BenchTmrSampleReq = DEF_TRUE;
+    while (BenchTmrSampleReq == DEF_TRUE) {
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);
+    }
+   *p_ns    = BenchTmrSampleNs;
+   *p_fired = BenchTmrSampleFired;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BENCH ONE SIZE
+*********************************************************************************************************
+*/
+
+static  void  BenchTmrRun (CPU_INT32U  n)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+    CPU_INT32U  j;
+    CPU_INT32U  tmp;
+    CPU_INT64U  t0;
+    CPU_INT64U  ns0;
+    CPU_INT64U  ns1;
+    CPU_INT32U  fired0;
+    CPU_INT32U  fired1;
+
+
+    for (i = 0u; i < n; i++) {                                  /* ---------------- START / STOP COST ----------------- */
+        OSTmrCreate(&BenchTmr[i],
+                    (CPU_CHAR *)"Bench Tmr",
+                     BENCH_TMR_DLY_MIN + (BenchRandGet() % BENCH_TMR_DLY_SPAN),
+                     0u,
+                     OS_OPT_TMR_ONE_SHOT,
+                     BenchTmrCallback,
+                     0,
+                    &err);
+        BenchTmrOrder[i] = i;
+    }
+    for (i = n - 1u; i > 0u; i--) {                             /* Stop in a random order                               */
+        j                = BenchRandGet() % (i + 1u);
+        tmp              = BenchTmrOrder[i];
+        BenchTmrOrder[i] = BenchTmrOrder[j];
+        BenchTmrOrder[j] = tmp;
+    }
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < n; i++) {
+        (void)OSTmrStart(&BenchTmr[i], &err);
+    }
+    BenchResult("OSTmrStart", n, BenchNsGet() - t0, n);
+
+    t0 = BenchNsGet();
+    for (i = 0u; i < n; i++) {
+        (void)OSTmrStop(&BenchTmr[BenchTmrOrder[i]], OS_OPT_TMR_NONE, 0, &err);
+    }
+    BenchResult("OSTmrStop", n, BenchNsGet() - t0, n);
+
+    for (i = 0u; i < n; i++) {                                  /* ------------------- EXPIRY COST -------------------- */
+        tmp = BENCH_TMR_PERIOD_MIN + (BenchRandGet() % BENCH_TMR_PERIOD_SPAN);
+        (void)OSTmrDel(&BenchTmr[i], &err);
+        OSTmrCreate(&BenchTmr[i],
+                    (CPU_CHAR *)"Bench Tmr",
+                     tmp,
+                     tmp,
+                     OS_OPT_TMR_PERIODIC,
+                     BenchTmrCallback,
+                     0,
+                    &err);
+        (void)OSTmrStart(&BenchTmr[i], &err);
+    }
+
+    OSTimeDly(BENCH_TMR_WARMUP, OS_OPT_TIME_DLY, &err);         /* Let the expiries spread out                          */
+    BenchTmrSample(&ns0, &fired0);
+    OSTimeDly(BENCH_TMR_WINDOW, OS_OPT_TIME_DLY, &err);
+    BenchTmrSample(&ns1, &fired1);
+    BenchResult("expiry (tmr task)", n, ns1 - ns0, fired1 - fired0);
+
+    for (i = 0u; i < n; i++) {
+        (void)OSTmrDel(&BenchTmr[i], &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH MAIN
+*********************************************************************************************************
+*/
+
+static  void  BenchTmrMain (void)
+{
+    CPU_INT32U  n;
+
+
+    for (n = 10u; n <= BENCH_TMR_MAX; n *= 10u) {
+        BenchTmrRun(n);
+    }
+}
+
+
+int  main (void)
+{
+    BenchRun((OS_CFG_TMR_WHEEL_EN > 0u) ? "OS_TMR, hierarchical timer wheel" : "OS_TMR, sorted delta list",
+              BenchTmrMain);
+
+    return (0);
+}
@@ -0,0 +1,199 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          CONFIGURATION FILE
+*
+*                                      POSIX HOST BENCHMARKS
+*
+* Filename : os_cfg.h
+* Version  : V3.08.01
+*********************************************************************************************************
+*/
+
+#ifndef OS_CFG_H
+#define OS_CFG_H
+
+/*
+* Note(s) : (1) Options guarded by #ifndef are selected per benchmark build from 'Bench/Makefile', or by a
+*               configuration header of 'Bench/matrix/'.
+*/
+
+                                                                /* --------------------------- MISCELLANEOUS --------------------------- */
+#ifndef  OS_CFG_APP_HOOKS_EN
+#define OS_CFG_APP_HOOKS_EN                        0u           /* Enable (1) or Disable (0) application specific hooks                  */
+#endif
+#ifndef  OS_CFG_ARG_CHK_EN
+#define OS_CFG_ARG_CHK_EN                          1u           /* Enable (1) or Disable (0) argument checking                           */
+#endif
+#ifndef  OS_CFG_CALLED_FROM_ISR_CHK_EN
+#define OS_CFG_CALLED_FROM_ISR_CHK_EN              1u           /* Enable (1) or Disable (0) check for called from ISR                   */
+#endif
+#ifndef  OS_CFG_DBG_EN
+#define OS_CFG_DBG_EN                              1u           /* Enable (1) or Disable (0) debug code/variables                        */
+#endif
+#define OS_CFG_TICK_EN                             1u           /* Enable (1) or Disable (0) the kernel tick                             */
+#ifndef  OS_CFG_DYN_TICK_EN
+#define OS_CFG_DYN_TICK_EN                         0u           /* Enable (1) or Disable (0) the Dynamic Tick                            */
+#endif
+#ifndef  OS_CFG_TICK_WHEEL_EN
+#define OS_CFG_TICK_WHEEL_EN                       0u           /* Enable (1) or Disable (0) the hashed tick wheel for delays/timeouts   */
+#endif
+#ifndef  OS_CFG_PEND_LIST_PRIO_TBL_EN
+#define OS_CFG_PEND_LIST_PRIO_TBL_EN               0u           /* Enable (1) or Disable (0) O(1) priority tables in the pend lists      */
+#endif
+#ifndef  OS_CFG_INVALID_OS_CALLS_CHK_EN
+#define OS_CFG_INVALID_OS_CALLS_CHK_EN             1u           /* Enable (1) or Disable (0) checks for invalid kernel calls             */
+#endif
+#ifndef  OS_CFG_OBJ_TYPE_CHK_EN
+#define OS_CFG_OBJ_TYPE_CHK_EN                     1u           /* Enable (1) or Disable (0) object type checking                        */
+#endif
+#ifndef  OS_CFG_OBJ_CREATED_CHK_EN
+#define OS_CFG_OBJ_CREATED_CHK_EN                  1u           /* Enable (1) or Disable (0) object created checks                       */
+#endif
+#ifndef  OS_CFG_TS_EN
+#define OS_CFG_TS_EN                               1u           /* Enable (1) or Disable (0) time stamping                               */
+#endif
+
+#ifndef  OS_CFG_PRIO_MAX
+#define OS_CFG_PRIO_MAX                           32u           /* Defines the maximum number of task priorities (see OS_PRIO data type) */
+#endif
+
+#ifndef  OS_CFG_SCHED_LOCK_TIME_MEAS_EN
+#define OS_CFG_SCHED_LOCK_TIME_MEAS_EN             0u           /* Include code to measure scheduler lock time                           */
+#endif
+#ifndef  OS_CFG_SCHED_ROUND_ROBIN_EN
+#define OS_CFG_SCHED_ROUND_ROBIN_EN                1u           /* Include code for Round-Robin scheduling                               */
+#endif
+#ifndef  OS_CFG_SMP_CORE_NBR
+#define OS_CFG_SMP_CORE_NBR                        1u           /* Number of cores running tasks (> 1: experimental POSIX port SMP mode) */
+#endif
+
+#define OS_CFG_STK_SIZE_MIN                       64u           /* Minimum allowable task stack size                                     */
+
+
+                                                                /* --------------------------- EVENT FLAGS ----------------------------- */
+#define OS_CFG_FLAG_EN                             1u           /* Enable (1) or Disable (0) code generation for EVENT FLAGS             */
+#define OS_CFG_FLAG_DEL_EN                         1u           /*     Include code for OSFlagDel()                                      */
+#define OS_CFG_FLAG_MODE_CLR_EN                    1u           /*     Include code for Wait on Clear EVENT FLAGS                        */
+#define OS_CFG_FLAG_PEND_ABORT_EN                  1u           /*     Include code for OSFlagPendAbort()                                */
+
+
+                                                                /* ------------------------ MEMORY MANAGEMENT -------------------------  */
+#define OS_CFG_MEM_EN                              1u           /* Enable (1) or Disable (0) code generation for the MEMORY MANAGER      */
+#ifndef  OS_CFG_MEM_CLASS_NBR
+#define OS_CFG_MEM_CLASS_NBR                       8u           /*     Size classes of OSMemAlloc(), 0 disables OSMemAlloc()/OSMemFree() */
+#endif
+#ifndef  OS_CFG_MEM_CLASS_SIZE_MIN_LOG2
+#define OS_CFG_MEM_CLASS_SIZE_MIN_LOG2             4u           /*     Log2 of the block size of the smallest size class                 */
+#endif
+#ifndef  OS_CFG_MEM_MAG_SIZE
+#define OS_CFG_MEM_MAG_SIZE                        0u           /*     Blocks cached per task and size class, 0 disables the magazines   */
+#endif
+#ifndef  OS_CFG_MEM_LOCK_FREE_EN
+#define OS_CFG_MEM_LOCK_FREE_EN                    0u           /*     OSMemGet()/OSMemPut() with compare and swap, interrupts enabled   */
+#endif
+#ifndef  OS_CFG_BUF_EN
+#define OS_CFG_BUF_EN                              1u           /*     Reference counted buffer chains, OSBufAlloc() and OSQPostBuf()    */
+#endif
+
+
+                                                                /* ------------------- MUTUAL EXCLUSION SEMAPHORES --------------------  */
+#define OS_CFG_MUTEX_EN                            1u           /* Enable (1) or Disable (0) code generation for MUTEX                   */
+#define OS_CFG_MUTEX_DEL_EN                        1u           /*     Include code for OSMutexDel()                                     */
+#define OS_CFG_MUTEX_PEND_ABORT_EN                 1u           /*     Include code for OSMutexPendAbort()                               */
+#ifndef  OS_CFG_MUTEX_FAST_EN
+#define OS_CFG_MUTEX_FAST_EN                       1u           /*     Uncontended OSMutexPend()/OSMutexPost() without critical section  */
+#endif
+#define OS_CFG_COND_EN                             1u           /* Enable (1) or Disable (0) code generation for CONDITION VARIABLES     */
+#define OS_CFG_COND_DEL_EN                         1u           /*     Include code for OSCondDel()                                      */
+
+
+                                                                /* -------------------------- MESSAGE QUEUES --------------------------  */
+#define OS_CFG_Q_EN                                1u           /* Enable (1) or Disable (0) code generation for QUEUES                  */
+#define OS_CFG_Q_DEL_EN                            1u           /*     Include code for OSQDel()                                         */
+#define OS_CFG_Q_FLUSH_EN                          1u           /*     Include code for OSQFlush()                                       */
+#define OS_CFG_Q_PEND_ABORT_EN                     1u           /*     Include code for OSQPendAbort()                                   */
+#define OS_CFG_Q_MULTI_EN                          1u           /*     Include code for OSQPostMulti() and OSQPendMulti()                */
+#ifndef  OS_CFG_MSG_POOL_PRIV_EN
+#define OS_CFG_MSG_POOL_PRIV_EN                    1u           /*     OSMsgPoolCreate(), OSQPoolSet() and OSTaskQPoolSet()              */
+#endif
+#define OS_CFG_ISR_POST_EN                         1u           /* Defer kernel posts from ISRs to the ISR handler task                  */
+
+
+                                                                /* ---------------------------- SEMAPHORES ----------------------------- */
+#define OS_CFG_SEM_EN                              1u           /* Enable (1) or Disable (0) code generation for SEMAPHORES              */
+#define OS_CFG_SEM_DEL_EN                          1u           /*     Include code for OSSemDel()                                       */
+#define OS_CFG_SEM_PEND_ABORT_EN                   1u           /*     Include code for OSSemPendAbort()                                 */
+#define OS_CFG_SEM_SET_EN                          1u           /*     Include code for OSSemSet()                                       */
+
+
+                                                                /* -------------------------- STREAM BUFFERS --------------------------  */
+#define OS_CFG_STREAM_EN                           1u           /* Enable (1) or Disable (0) code generation for STREAM BUFFERS          */
+#define OS_CFG_STREAM_DEL_EN                       1u           /*     Include code for OSStreamDel()                                    */
+
+
+                                                                /* -------------------------- TASK MANAGEMENT -------------------------- */
+#ifndef  OS_CFG_STAT_TASK_EN
+#define OS_CFG_STAT_TASK_EN                        1u           /* Enable (1) or Disable (0) the statistics task                         */
+#endif
+#ifndef  OS_CFG_STAT_TASK_STK_CHK_EN
+#define OS_CFG_STAT_TASK_STK_CHK_EN                1u           /*     Check task stacks from the statistic task                         */
+#endif
+
+#define OS_CFG_TASK_CHANGE_PRIO_EN                 1u           /* Include code for OSTaskChangePrio()                                   */
+#define OS_CFG_TASK_DEL_EN                         1u           /* Include code for OSTaskDel()                                          */
+#define OS_CFG_TASK_IDLE_EN                        1u           /* Include the idle task                                                 */
+#ifndef  OS_CFG_TASK_PROFILE_EN
+#define OS_CFG_TASK_PROFILE_EN                     1u           /* Include variables in OS_TCB for profiling                             */
+#endif
+#define OS_CFG_TASK_Q_EN                           1u           /* Include code for OSTaskQXXXX()                                        */
+#define OS_CFG_TASK_Q_PEND_ABORT_EN                1u           /* Include code for OSTaskQPendAbort()                                   */
+#define OS_CFG_TASK_Q_MULTI_EN                     1u           /* Include code for OSTaskQPostMulti()                                   */
+#define OS_CFG_TASK_REG_TBL_SIZE                   0u           /* Number of task specific registers                                     */
+
+#define OS_CFG_TASK_STK_REDZONE_EN                 0u           /* Enable (1) or Disable (0) stack redzone (not supported by POSIX port) */
+#define OS_CFG_TASK_STK_REDZONE_DEPTH              8u           /* Depth of the stack redzone                                            */
+
+#define OS_CFG_TASK_SEM_PEND_ABORT_EN              1u           /* Include code for OSTaskSemPendAbort()                                 */
+#define OS_CFG_TASK_SUSPEND_EN                     1u           /* Include code for OSTaskSuspend() and OSTaskResume()                   */
+
+
+                                                                /* ------------------ TASK LOCAL STORAGE MANAGEMENT -------------------  */
+#define OS_CFG_TLS_TBL_SIZE                        0u           /* Include code for Task Local Storage (TLS) registers                   */
+
+
+                                                                /* ------------------------- TIME MANAGEMENT --------------------------  */
+#define OS_CFG_TIME_DLY_HMSM_EN                    1u           /* Include code for OSTimeDlyHMSM()                                      */
+#define OS_CFG_TIME_DLY_RESUME_EN                  1u           /* Include code for OSTimeDlyResume()                                    */
+
+
+                                                                /* ------------------------- TIMER MANAGEMENT -------------------------- */
+#define OS_CFG_TMR_EN                              1u           /* Enable (1) or Disable (0) code generation for TIMERS                  */
+#define OS_CFG_TMR_DEL_EN                          1u           /* Enable (1) or Disable (0) code generation for OSTmrDel()              */
+#ifndef  OS_CFG_TMR_WHEEL_EN
+#define OS_CFG_TMR_WHEEL_EN                        0u           /*     Use a hierarchical timer wheel instead of the sorted timer list   */
+#endif
+
+
+                                                                /* ------------------------- TRACE RECORDER ---------------------------- */
+#define OS_CFG_TRACE_EN                            0u           /* Enable (1) or Disable (0) uC/OS-III Trace instrumentation             */
+#define OS_CFG_TRACE_API_ENTER_EN                  0u           /* Enable (1) or Disable (0) uC/OS-III Trace API enter instrumentation   */
+#define OS_CFG_TRACE_API_EXIT_EN                   0u           /* Enable (1) or Disable (0) uC/OS-III Trace API exit  instrumentation   */
+
+#endif
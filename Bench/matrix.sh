@@ -0,0 +1,31 @@
+#!/bin/sh
+#
+# Runs bench_tm once per kernel configuration built by 'make matrix' and
+# prints one line per configuration: the op/s of each workload and the
+# text/data/bss footprint of the kernel objects (size -t).
+#
+#   matrix.sh <dir> <config>...
+#
+# <dir>/<config>/bench_tm and <dir>/<config>/size.txt come from the
+# MATRIX_RULE of the Makefile.
+#
+
+dir=$1
+shift
+
+printf '%-16s %12s %12s %12s %12s %12s %12s %8s %8s %8s\n' \
+       config cooperative preemptive interrupt message sync memory text data bss
+
+for cfg in "$@"; do
+    out=`"$dir/$cfg/bench_tm"` || { echo "$cfg: bench_tm failed" >&2; exit 1; }
+    size=`tail -n 1 "$dir/$cfg/size.txt"`
+    echo "$out" | awk -v cfg="$cfg" -v size="$size" '
+        { ops[$1] = $4 }
+        END {
+            split(size, sz, " ")
+            text = sz[1]; data = sz[2]; bss = sz[3]
+            printf "%-16s %12s %12s %12s %12s %12s %12s %8s %8s %8s\n", cfg,
+                   ops["cooperative"], ops["preemptive"], ops["interrupt"],
+                   ops["message"], ops["synchronization"], ops["memory"], text, data, bss
+        }'
+done
@@ -0,0 +1,13 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    POSIX HOST BENCHMARK MATRIX
+*
+* Filename : baseline.h
+*********************************************************************************************************
+* Note(s)  : (1) Bench configuration, 'cfg/os_cfg.h' unchanged.
+*********************************************************************************************************
+*/
+
@@ -0,0 +1,24 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    POSIX HOST BENCHMARK MATRIX
+*
+* Filename : minimal.h
+*********************************************************************************************************
+* Note(s)  : (1) Every check, debug and measurement option disabled, and no statistic task.
+*********************************************************************************************************
+*/
+
+#define  OS_CFG_ARG_CHK_EN                   0u
+#define  OS_CFG_CALLED_FROM_ISR_CHK_EN       0u
+#define  OS_CFG_DBG_EN                       0u
+#define  OS_CFG_INVALID_OS_CALLS_CHK_EN      0u
+#define  OS_CFG_OBJ_TYPE_CHK_EN              0u
+#define  OS_CFG_OBJ_CREATED_CHK_EN           0u
+#define  OS_CFG_TS_EN                        0u
+#define  OS_CFG_SCHED_LOCK_TIME_MEAS_EN      0u
+#define  OS_CFG_STAT_TASK_EN                 0u
+#define  OS_CFG_STAT_TASK_STK_CHK_EN         0u
+#define  OS_CFG_TASK_PROFILE_EN              0u
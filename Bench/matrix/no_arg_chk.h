@@ -0,0 +1,14 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    POSIX HOST BENCHMARK MATRIX
+*
+* Filename : no_arg_chk.h
+*********************************************************************************************************
+* Note(s)  : (1) OS_CFG_ARG_CHK_EN disabled.
+*********************************************************************************************************
+*/
+
+#define  OS_CFG_ARG_CHK_EN                   0u
@@ -0,0 +1,14 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    POSIX HOST BENCHMARK MATRIX
+*
+* Filename : no_isr_chk.h
+*********************************************************************************************************
+* Note(s)  : (1) OS_CFG_CALLED_FROM_ISR_CHK_EN disabled.
+*********************************************************************************************************
+*/
+
+#define  OS_CFG_CALLED_FROM_ISR_CHK_EN       0u
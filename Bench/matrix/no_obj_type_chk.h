@@ -0,0 +1,14 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    POSIX HOST BENCHMARK MATRIX
+*
+* Filename : no_obj_type_chk.h
+*********************************************************************************************************
+* Note(s)  : (1) OS_CFG_OBJ_TYPE_CHK_EN disabled.
+*********************************************************************************************************
+*/
+
+#define  OS_CFG_OBJ_TYPE_CHK_EN              0u
@@ -0,0 +1,14 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    POSIX HOST BENCHMARK MATRIX
+*
+* Filename : no_profile.h
+*********************************************************************************************************
+* Note(s)  : (1) OS_CFG_TASK_PROFILE_EN disabled.
+*********************************************************************************************************
+*/
+
+#define  OS_CFG_TASK_PROFILE_EN              0u
@@ -0,0 +1,14 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    POSIX HOST BENCHMARK MATRIX
+*
+* Filename : no_ts.h
+*********************************************************************************************************
+* Note(s)  : (1) OS_CFG_TS_EN disabled.
+*********************************************************************************************************
+*/
+
+#define  OS_CFG_TS_EN                        0u
@@ -0,0 +1,185 @@
+#include "lat_hist.h"
+#include "cpu_core.h"
+#include "stdio.h"
+
+/**
+ * @brief  计算样本值所在的桶号
+ * @note   val < LAT_HIST_SUB_NBR时桶号即val；否则桶号由最高位位置和其后LAT_HIST_SUB_BITS位组成
+ */
+static CPU_INT32U LatHist_Idx(CPU_INT32U val)
+{
+    CPU_INT32U msb;
+    CPU_INT32U shift;
+
+    if (val < LAT_HIST_SUB_NBR)
+    {
+        return val;
+    }
+    msb   = 31u - (CPU_INT32U)CPU_CntLeadZeros32(val);
+    shift = msb - LAT_HIST_SUB_BITS;
+
+    return ((shift + 1u) << LAT_HIST_SUB_BITS) + ((val >> shift) - LAT_HIST_SUB_NBR);
+}
+
+/**
+ * @brief  桶的上界（包含）
+ */
+static CPU_INT32U LatHist_BktHi(CPU_INT32U idx)
+{
+    CPU_INT32U shift;
+
+    if (idx < LAT_HIST_SUB_NBR)
+    {
+        return idx;
+    }
+    shift = (idx >> LAT_HIST_SUB_BITS) - 1u;
+
+    return ((LAT_HIST_SUB_NBR + (idx & (LAT_HIST_SUB_NBR - 1u))) << shift) + ((1u << shift) - 1u);
+}
+
+/**
+ * @brief  桶的下界
+ */
+static CPU_INT32U LatHist_BktLo(CPU_INT32U idx)
+{
+    CPU_INT32U shift;
+
+    if (idx < LAT_HIST_SUB_NBR)
+    {
+        return idx;
+    }
+    shift = (idx >> LAT_HIST_SUB_BITS) - 1u;
+
+    return (LAT_HIST_SUB_NBR + (idx & (LAT_HIST_SUB_NBR - 1u))) << shift;
+}
+
+/**
+ * @brief  计数值换算为ns
+ */
+static CPU_INT64U LatHist_Ns(CPU_INT32U val, CPU_INT32U freq_hz)
+{
+    return ((CPU_INT64U)val * 1000000000u + freq_hz / 2u) / freq_hz;
+}
+
+/**
+ * @brief  清空直方图
+ */
+void LatHist_Init(LAT_HIST *p_hist)
+{
+    CPU_INT32U i;
+
+    for (i = 0; i < LAT_HIST_BKT_NBR; i++)
+    {
+        p_hist->Bkt[i] = 0;
+    }
+    p_hist->Nbr = 0;
+    p_hist->Min = DEF_INT_32U_MAX_VAL;
+    p_hist->Max = 0;
+    p_hist->Sum = 0;
+}
+
+/**
+ * @brief  记录一个样本
+ * @note   可在中断中调用，耗时固定（一次前导零计数）
+ */
+void LatHist_Add(LAT_HIST *p_hist, CPU_INT32U val)
+{
+    p_hist->Bkt[LatHist_Idx(val)]++;
+    p_hist->Nbr++;
+    p_hist->Sum += val;
+    if (val < p_hist->Min)
+    {
+        p_hist->Min = val;
+    }
+    if (val > p_hist->Max)
+    {
+        p_hist->Max = val;
+    }
+}
+
+/**
+ * @brief  百分位
+ * @param  pct_x100 : 万分比，5000=P50，9900=P99，9990=P99.9
+ * @retval 样本所在桶的上界，不超过最大值；没有样本时返回0
+ */
+CPU_INT32U LatHist_Pct(const LAT_HIST *p_hist, CPU_INT32U pct_x100)
+{
+    CPU_INT64U rank;
+    CPU_INT64U cum;
+    CPU_INT32U hi;
+    CPU_INT32U i;
+
+    if (p_hist->Nbr == 0)
+    {
+        return 0;
+    }
+    rank = ((CPU_INT64U)p_hist->Nbr * pct_x100 + 9999u) / 10000u;   /* 向上取整的名次 */
+    if (rank == 0)
+    {
+        rank = 1;
+    }
+    cum = 0;
+    for (i = 0; i < LAT_HIST_BKT_NBR; i++)
+    {
+        cum += p_hist->Bkt[i];
+        if (cum >= rank)
+        {
+            break;
+        }
+    }
+    hi = LatHist_BktHi(i);
+
+    return (hi < p_hist->Max) ? hi : p_hist->Max;
+}
+
+/**
+ * @brief  输出CSV表头，p_prefix为每行的第一列
+ */
+void LatHist_ExportHdr(const char *p_prefix)
+{
+    printf("%s,name,n,min_ns,avg_ns,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n", p_prefix);
+}
+
+/**
+ * @brief  输出一行CSV：样本数和各百分位
+ * @param  freq_hz : 样本计数频率，用于换算为ns（样本已是ns时传1000000000）
+ */
+void LatHist_Export(const LAT_HIST *p_hist, const char *p_prefix, const char *p_name, CPU_INT32U freq_hz)
+{
+    CPU_INT32U avg;
+
+    if (p_hist->Nbr == 0)
+    {
+        printf("%s,%s,0,,,,,,,\n", p_prefix, p_name);
+        return;
+    }
+    avg = (CPU_INT32U)(p_hist->Sum / p_hist->Nbr);
+    printf("%s,%s,%lu,%llu,%llu,%llu,%llu,%llu,%llu,%llu\n", p_prefix, p_name,
+           (unsigned long)p_hist->Nbr,
+           (unsigned long long)LatHist_Ns(p_hist->Min, freq_hz),
+           (unsigned long long)LatHist_Ns(avg, freq_hz),
+           (unsigned long long)LatHist_Ns(LatHist_Pct(p_hist, 5000u), freq_hz),
+           (unsigned long long)LatHist_Ns(LatHist_Pct(p_hist, 9000u), freq_hz),
+           (unsigned long long)LatHist_Ns(LatHist_Pct(p_hist, 9900u), freq_hz),
+           (unsigned long long)LatHist_Ns(LatHist_Pct(p_hist, 9990u), freq_hz),
+           (unsigned long long)LatHist_Ns(p_hist->Max, freq_hz));
+}
+
+/**
+ * @brief  输出非空桶，每桶一行：<p_prefix>_bkt,名称,下界ns,上界ns,计数
+ */
+void LatHist_Dump(const LAT_HIST *p_hist, const char *p_prefix, const char *p_name, CPU_INT32U freq_hz)
+{
+    CPU_INT32U i;
+
+    for (i = 0; i < LAT_HIST_BKT_NBR; i++)
+    {
+        if (p_hist->Bkt[i] != 0)
+        {
+            printf("%s_bkt,%s,%llu,%llu,%lu\n", p_prefix, p_name,
+                   (unsigned long long)LatHist_Ns(LatHist_BktLo(i), freq_hz),
+                   (unsigned long long)LatHist_Ns(LatHist_BktHi(i), freq_hz),
+                   (unsigned long)p_hist->Bkt[i]);
+        }
+    }
+}
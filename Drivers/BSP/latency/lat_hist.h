@@ -0,0 +1,32 @@
+#ifndef __LAT_HIST_H
+#define __LAT_HIST_H
+
+#include "cpu.h"
+
+/* 对数-线性直方图：小于LAT_HIST_SUB_NBR的值各占一个桶，
+ * 更大的值每个2的幂区间分成LAT_HIST_SUB_NBR个桶，相对误差不超过1/LAT_HIST_SUB_NBR
+ */
+#define LAT_HIST_SUB_BITS       4u
+#define LAT_HIST_SUB_NBR        (1u << LAT_HIST_SUB_BITS)
+#define LAT_HIST_BKT_NBR        ((32u - LAT_HIST_SUB_BITS + 1u) * LAT_HIST_SUB_NBR)     /* 464个桶，覆盖32位 */
+
+typedef struct
+{
+    CPU_INT32U  Bkt[LAT_HIST_BKT_NBR];  /* 各桶计数 */
+    CPU_INT32U  Nbr;                    /* 样本数 */
+    CPU_INT32U  Min;                    /* 精确最小值 */
+    CPU_INT32U  Max;                    /* 精确最大值 */
+    CPU_INT64U  Sum;                    /* 样本和，用于平均值 */
+} LAT_HIST;
+
+/* 函数声明：同一个直方图只能有一个写者（一个中断或一个任务） */
+void       LatHist_Init(LAT_HIST *p_hist);                                      // 清空直方图
+void       LatHist_Add(LAT_HIST *p_hist, CPU_INT32U val);                      // 记录一个样本
+CPU_INT32U LatHist_Pct(const LAT_HIST *p_hist, CPU_INT32U pct_x100);           // 百分位（万分比，9900=P99），返回桶上界
+void       LatHist_ExportHdr(const char *p_prefix);                             // 输出CSV表头
+void       LatHist_Export(const LAT_HIST *p_hist, const char *p_prefix,
+                          const char *p_name, CPU_INT32U freq_hz);              // 输出一行CSV百分位（ns）
+void       LatHist_Dump(const LAT_HIST *p_hist, const char *p_prefix,
+                        const char *p_name, CPU_INT32U freq_hz);                // 输出非空桶（ns）
+
+#endif /* __LAT_HIST_H */
@@ -0,0 +1,198 @@
+#include "latency.h"
+#include "stdio.h"
+
+LAT_HIST   Lat_IsrHist;
+LAT_HIST   Lat_TaskHist;
+CPU_INT32U Lat_OvrCtr;
+
+static CPU_INT32U          Lat_TimFreq;     /* TIM2计数频率 */
+static volatile CPU_INT32U Lat_IsrCnt;      /* 最近一次ISR入口的CNT */
+static volatile CPU_INT08U Lat_Busy;        /* 测量任务尚未处理最近一次事件 */
+
+static OS_TCB  Lat_TCB;
+static CPU_STK Lat_Stk[LAT_TASK_STK_SIZE];
+static OS_TCB  Lat_TrigTCB;
+static CPU_STK Lat_TrigStk[LAT_TRIG_TASK_STK_SIZE];
+
+/**
+ * @brief  TIM2底层硬件配置（标准库）
+ * @note   自由运行32位计数器，CH1输入捕获PA0上升沿，使能CC1中断
+ */
+static void Lat_HW_Config(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct;
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseInitStruct;
+    TIM_ICInitTypeDef TIM_ICInitStruct;
+    NVIC_InitTypeDef NVIC_InitStruct;
+    RCC_ClocksTypeDef rcc_clocks;
+
+    /* 1. 使能时钟 */
+    RCC_AHB1PeriphClockCmd(LAT_GPIO_CLK, ENABLE);
+    RCC_APB1PeriphClockCmd(LAT_TIM_CLK, ENABLE);
+
+    /* 2. APB1分频不为1时定时器时钟为PCLK1的2倍（168MHz系统时钟下为84MHz） */
+    RCC_GetClocksFreq(&rcc_clocks);
+    Lat_TimFreq = (rcc_clocks.HCLK_Frequency == rcc_clocks.PCLK1_Frequency) ?
+                   rcc_clocks.PCLK1_Frequency : (rcc_clocks.PCLK1_Frequency * 2u);
+
+    /* 3. 配置PA0为TIM2_CH1复用输入，下拉（WK_UP按下为高电平） */
+    GPIO_InitStruct.GPIO_Pin = LAT_GPIO_PIN;
+    GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AF;
+    GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_InitStruct.GPIO_OType = GPIO_OType_PP;
+    GPIO_InitStruct.GPIO_PuPd = GPIO_PuPd_DOWN;
+    GPIO_Init(LAT_GPIO_PORT, &GPIO_InitStruct);
+    GPIO_PinAFConfig(LAT_GPIO_PORT, GPIO_PinSource0, GPIO_AF_TIM2);
+
+    /* 4. 时基：不分频，32位满量程自由运行 */
+    TIM_TimeBaseInitStruct.TIM_Prescaler = 0;
+    TIM_TimeBaseInitStruct.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseInitStruct.TIM_Period = 0xFFFFFFFF;
+    TIM_TimeBaseInitStruct.TIM_ClockDivision = TIM_CKD_DIV1;
+    TIM_TimeBaseInitStruct.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(LAT_TIM, &TIM_TimeBaseInitStruct);
+
+    /* 5. CH1输入捕获：上升沿，不分频，轻微滤波 */
+    TIM_ICInitStruct.TIM_Channel = TIM_Channel_1;
+    TIM_ICInitStruct.TIM_ICPolarity = TIM_ICPolarity_Rising;
+    TIM_ICInitStruct.TIM_ICSelection = TIM_ICSelection_DirectTI;
+    TIM_ICInitStruct.TIM_ICPrescaler = TIM_ICPSC_DIV1;
+    TIM_ICInitStruct.TIM_ICFilter = 0x3;
+    TIM_ICInit(LAT_TIM, &TIM_ICInitStruct);
+
+    /* 6. 使能捕获中断和NVIC */
+    TIM_ITConfig(LAT_TIM, TIM_IT_CC1, ENABLE);
+    NVIC_InitStruct.NVIC_IRQChannel = LAT_TIM_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = LAT_TIM_IRQ_PRIO;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruct);
+
+    /* 7. 启动计数 */
+    TIM_Cmd(LAT_TIM, ENABLE);
+}
+
+/**
+ * @brief  TIM2中断服务函数
+ * @note   第一条语句读取CNT，CCR1为硬件锁存的事件时刻；读CCR1同时清除CC1IF
+ */
+void TIM2_IRQHandler(void)
+{
+    CPU_INT32U cnt_isr = LAT_TIM->CNT;      /* ISR第一条指令 */
+    CPU_INT32U cnt_evt = LAT_TIM->CCR1;
+    OS_ERR err;
+
+    OSIntEnter();
+
+    LatHist_Add(&Lat_IsrHist, cnt_isr - cnt_evt);
+    if (Lat_Busy == 0)
+    {
+        Lat_IsrCnt = cnt_isr;
+        Lat_Busy   = 1;
+        OSTaskSemPost(&Lat_TCB, OS_OPT_POST_NONE, &err);
+    }
+    else
+    {
+        Lat_OvrCtr++;                       /* 上一个事件还没处理完，不测ISR->任务 */
+    }
+
+    OSIntExit();
+}
+
+/**
+ * @brief  测量任务：被TIM2中断唤醒，记录ISR->任务延迟
+ */
+static void Lat_Task(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT32U cnt_task;
+
+    (void)p_arg;
+
+    while (1)
+    {
+        OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        cnt_task = LAT_TIM->CNT;            /* 任务第一条指令 */
+        LatHist_Add(&Lat_TaskHist, cnt_task - Lat_IsrCnt);
+        Lat_Busy = 0;
+
+        if ((Lat_TaskHist.Nbr % LAT_REPORT_NBR) == 0)
+        {
+            Lat_Report();
+        }
+    }
+}
+
+/**
+ * @brief  触发任务：周期性产生软件捕获事件，硬件把当前CNT锁存到CCR1并触发中断
+ */
+static void Lat_TrigTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+
+    while (1)
+    {
+        OSTimeDly(LAT_TRIG_DLY, OS_OPT_TIME_DLY, &err);
+        TIM_GenerateEvent(LAT_TIM, TIM_EventSource_CC1);
+    }
+}
+
+/**
+ * @brief  输出结果：CSV百分位（ns）和非空桶
+ */
+void Lat_Report(void)
+{
+    LatHist_ExportHdr("intlat");
+    LatHist_Export(&Lat_IsrHist,  "intlat", "irq_to_isr",  Lat_TimFreq);
+    LatHist_Export(&Lat_TaskHist, "intlat", "isr_to_task", Lat_TimFreq);
+    LatHist_Dump(&Lat_IsrHist,    "intlat", "irq_to_isr",  Lat_TimFreq);
+    LatHist_Dump(&Lat_TaskHist,   "intlat", "isr_to_task", Lat_TimFreq);
+    printf("intlat_ovr,%lu\n", (unsigned long)Lat_OvrCtr);
+}
+
+/**
+ * @brief  启动中断延迟测量（在start_task中、OSStart之后调用）
+ */
+void Lat_Start(void)
+{
+    OS_ERR err;
+
+    LatHist_Init(&Lat_IsrHist);
+    LatHist_Init(&Lat_TaskHist);
+    Lat_OvrCtr = 0;
+    Lat_Busy   = 0;
+
+    OSTaskCreate(   (OS_TCB        *)&Lat_TCB,
+                    (CPU_CHAR      *)"lat_task",
+                    (OS_TASK_PTR    )Lat_Task,
+                    (void          *)0,
+                    (OS_PRIO        )LAT_TASK_PRIO,
+                    (CPU_STK       *)&Lat_Stk[0],
+                    (CPU_STK_SIZE   )LAT_TASK_STK_SIZE / 10,
+                    (CPU_STK_SIZE   )LAT_TASK_STK_SIZE,
+                    (OS_MSG_QTY     )0,
+                    (OS_TICK        )0,
+                    (void          *)0,
+                    (OS_OPT         )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                    (OS_ERR        *)&err);
+
+    Lat_HW_Config();
+
+#if LAT_TRIG_DLY > 0
+    OSTaskCreate(   (OS_TCB        *)&Lat_TrigTCB,
+                    (CPU_CHAR      *)"lat_trig_task",
+                    (OS_TASK_PTR    )Lat_TrigTask,
+                    (void          *)0,
+                    (OS_PRIO        )LAT_TRIG_TASK_PRIO,
+                    (CPU_STK       *)&Lat_TrigStk[0],
+                    (CPU_STK_SIZE   )LAT_TRIG_TASK_STK_SIZE / 10,
+                    (CPU_STK_SIZE   )LAT_TRIG_TASK_STK_SIZE,
+                    (OS_MSG_QTY     )0,
+                    (OS_TICK        )0,
+                    (void          *)0,
+                    (OS_OPT         )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                    (OS_ERR        *)&err);
+#endif
+}
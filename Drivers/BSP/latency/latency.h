@@ -0,0 +1,39 @@
+#ifndef __LATENCY_H
+#define __LATENCY_H
+
+#include "stm32f4xx.h"
+#include "os.h"
+#include "lat_hist.h"
+
+/* 中断延迟测量：TIM2（32位，APB1定时器时钟84MHz）CH1输入捕获，PA0（WK_UP）上升沿
+ * 或软件捕获事件（TIM_GenerateEvent）都会锁存事件时刻并进入TIM2中断：
+ *   事件 -> ISR第一条指令    ：TIM2_IRQHandler入口读取的CNT - CCR1
+ *   ISR  -> 被唤醒任务第一条指令：任务从OSTaskSemPend()返回后读取的CNT - ISR入口的CNT
+ */
+#define LAT_MEAS_EN              0              // 1：start_task中调用Lat_Start()
+
+#define LAT_TIM                  TIM2
+#define LAT_TIM_CLK              RCC_APB1Periph_TIM2
+#define LAT_GPIO_CLK             RCC_AHB1Periph_GPIOA
+#define LAT_GPIO_PORT            GPIOA
+#define LAT_GPIO_PIN             GPIO_Pin_0
+#define LAT_TIM_IRQn             TIM2_IRQn
+#define LAT_TIM_IRQ_PRIO         4              // 内核可管理的最高优先级（CPU_CFG_KA_IPL_BOUNDARY）
+
+#define LAT_TASK_PRIO            3              // 测量任务：被中断唤醒，优先级高于应用任务
+#define LAT_TASK_STK_SIZE        512
+#define LAT_TRIG_TASK_PRIO       (OS_CFG_PRIO_MAX - 7)  // 软件触发任务：低于应用任务
+#define LAT_TRIG_TASK_STK_SIZE   128
+#define LAT_TRIG_DLY             10             // 软件触发间隔（节拍），0：只测外部PA0上升沿
+#define LAT_REPORT_NBR           1000           // 每测量多少个事件输出一次结果
+
+/* 直方图（计数单位为TIM2时钟周期） */
+extern LAT_HIST  Lat_IsrHist;    // 事件 -> ISR
+extern LAT_HIST  Lat_TaskHist;   // ISR  -> 任务
+extern CPU_INT32U Lat_OvrCtr;    // 任务还没处理完上一个事件时到来的事件数
+
+/* 函数声明 */
+void Lat_Start(void);            // 配置TIM2，创建测量任务和触发任务
+void Lat_Report(void);           // 通过printf输出CSV百分位和非空桶
+
+#endif /* __LATENCY_H */
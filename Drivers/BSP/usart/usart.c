@@ -4,7 +4,10 @@
 
 /* uC/OS-III 同步对象定义 */
 OS_MUTEX  USART_Mutex;
-OS_Q      USART_Rx_Queue;
+OS_STREAM USART_Rx_Stream;
+
+/* 接收环形缓冲区（由USART_Rx_Stream管理） */
+static uint8_t USART_Rx_Buf[USART_RX_BUF_SIZE];
 
 /**
  * @brief  USART底层硬件配置（标准库）
@@ -71,8 +74,8 @@ void USART_Config(void)
     /* 1. 创建uC/OS同步对象 */
     // 互斥锁：解决多任务串口发送冲突
     OSMutexCreate(&USART_Mutex, "USART1 Mutex", &err);
-    // 消息队列：存储中断接收的字节（每个消息1字节）
-    OSQCreate(&USART_Rx_Queue, "USART1 Rx Queue", USART_RX_QUEUE_SIZE, &err);
+    // 流缓冲区：中断写入接收字节，任务按触发级别批量读取
+    OSStreamCreate(&USART_Rx_Stream, "USART1 Rx Stream", USART_Rx_Buf, USART_RX_BUF_SIZE, USART_RX_TRIGGER_LEVEL, &err);
 
     /* 2. 配置硬件 */
     USART_HW_Config();
@@ -107,22 +110,38 @@ void USART_Send_Buf(uint8_t *buf, uint16_t len)
 }
 
 /**
- * @brief  接收单个字节（从uC/OS队列读取，带超时）
+ * @brief  接收单个字节（从uC/OS流缓冲区读取，带超时）
  * @param  timeout: 超时时间（OS_TICK，1000=1秒 @OS_CFG_TICK_RATE_HZ=1000）
  * @retval 接收的字节（超时返回0xFF）
  */
 uint8_t USART_Recv_Byte(OS_TICK timeout)
 {
     OS_ERR err;
-    void *msg;
+    uint8_t byte;
 
-    /* 从队列读取1字节（阻塞等待） */
-    msg = OSQPend(&USART_Rx_Queue, timeout, OS_OPT_PEND_BLOCKING, NULL, NULL, &err);
-    if (err != OS_ERR_NONE)
+    /* 从流缓冲区读取1字节（阻塞等待） */
+    if (OSStreamRead(&USART_Rx_Stream, &byte, 1, timeout, OS_OPT_PEND_BLOCKING, NULL, &err) == 0)
     {
         return 0xFF; // 超时
     }
-    return (uint8_t)msg;
+    return byte;
+}
+
+/**
+ * @brief  接收多个字节（从uC/OS流缓冲区读取，带超时）
+ * @param  buf: 接收缓冲区
+ * @param  len: 最多读取的字节数
+ * @param  timeout: 超时时间（OS_TICK）
+ * @note   缓冲区达到min(len, USART_RX_TRIGGER_LEVEL)字节时才唤醒任务，超时则返回已收到的字节
+ * @retval 实际读取的字节数
+ */
+uint16_t USART_Recv_Buf(uint8_t *buf, uint16_t len, OS_TICK timeout)
+{
+    OS_ERR err;
+
+    if (buf == NULL || len == 0) return 0;
+
+    return OSStreamRead(&USART_Rx_Stream, buf, len, timeout, OS_OPT_PEND_BLOCKING, NULL, &err);
 }
 
 
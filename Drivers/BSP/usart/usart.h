@@ -17,18 +17,20 @@
 #define USARTx_IRQHandler        USART1_IRQHandler
 
 /* ͬ */
-#define USART_RX_QUEUE_SIZE      256  // նдСֽڣ
+#define USART_RX_BUF_SIZE        256  // СֽڣΪ2ݣ
+#define USART_RX_TRIGGER_LEVEL   16   // մ𣺻ﵽֽʱѽ
 #define USART_BAUDRATE           115200
 
 /* uC/OS-III ͬȫ֣ */
 extern OS_MUTEX  USART_Mutex;    // ͻ
-extern OS_Q      USART_Rx_Queue; // Ϣ
+extern OS_STREAM USART_Rx_Stream; // 
 
 /*  */
 void USART_Config(void);         // USARTʼӲ+uC/OS
 void USART_Send_Byte(uint8_t byte); // ͵ֽ
 void USART_Send_Buf(uint8_t *buf, uint16_t len); // ͻȫ
 uint8_t USART_Recv_Byte(OS_TICK timeout); // յֽڣʱ
+uint16_t USART_Recv_Buf(uint8_t *buf, uint16_t len, OS_TICK timeout); // նֽڣʱ
 int fputc(int ch, FILE *f);      // ضprintf
 
 #endif /* __USART_H */
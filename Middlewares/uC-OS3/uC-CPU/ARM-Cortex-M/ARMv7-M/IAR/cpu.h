@@ -378,6 +378,19 @@ typedef  CPU_INT32U                 CPU_SR;                     /* Defines   CPU
 #define  CPU_CFG_TRAIL_ZEROS_ASM_PRESENT                        /* ... assembly-version (see Note #1b).                 */
 
 
+/*
+*********************************************************************************************************
+*                                  CPU COMPARE AND SWAP CONFIGURATION
+*
+* Note(s) : (1) CPU_CFG_CMP_XCHG_PRESENT is #define'd when the port provides CPU_CmpXchg(), an atomic
+*               compare and swap of a CPU_ADDR word, in 'cpu_a.asm'.  Lock-free code, e.g. the
+*               memory pools of 'lib_mem.c' (see LIB_MEM_CFG_LOCK_FREE_EN), requires it.
+*********************************************************************************************************
+*/
+
+#define  CPU_CFG_CMP_XCHG_PRESENT
+
+
 /*
 *********************************************************************************************************
 *                                         FUNCTION PROTOTYPES
@@ -406,6 +419,10 @@ void        CPU_WaitForExcept(void);
 
 CPU_DATA    CPU_RevBits      (CPU_DATA    val);
 
+CPU_BOOLEAN CPU_CmpXchg      (CPU_ADDR   *p_dst,
+                              CPU_ADDR    cmp,
+                              CPU_ADDR    val);
+
 void        CPU_BitBandClr   (CPU_ADDR    addr,
                               CPU_INT08U  bit_nbr);
 void        CPU_BitBandSet   (CPU_ADDR    addr,
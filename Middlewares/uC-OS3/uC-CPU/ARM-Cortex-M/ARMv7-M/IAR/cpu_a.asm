@@ -43,6 +43,7 @@
         PUBLIC  CPU_CntLeadZeros
         PUBLIC  CPU_CntTrailZeros
         PUBLIC  CPU_RevBits
+        PUBLIC  CPU_CmpXchg
 
 
 ;********************************************************************************************************
@@ -278,6 +279,49 @@ CPU_RevBits:
         BX      LR
 
 
+;********************************************************************************************************
+;                                           CPU_CmpXchg()
+;                                      ATOMIC COMPARE AND SWAP
+;
+; Description : Stores a value in a word if the word holds an expected value, as one atomic operation.
+;
+; Prototypes  : CPU_BOOLEAN  CPU_CmpXchg(CPU_ADDR  *p_dst,
+;                                        CPU_ADDR   cmp,
+;                                        CPU_ADDR   val);
+;
+; Argument(s) : p_dst       Pointer to the word.
+;
+;               cmp         Value the word must hold.
+;
+;               val         Value to store.
+;
+; Return(s)   : DEF_YES, if '*p_dst' held 'cmp' and now holds 'val'.
+;
+;               DEF_NO,  otherwise.
+;
+; Note(s)     : (1) The exclusive monitor is cleared on exception entry and return, so STREX fails if the
+;                   caller was preempted since LDREX.  The sequence is then started over.
+;
+;               (2) Used by the lock-free memory pools of 'lib_mem.c' (see LIB_MEM_CFG_LOCK_FREE_EN).
+;********************************************************************************************************
+
+CPU_CmpXchg:
+CPU_CmpXchgLoop:
+        LDREX   R3, [R0]                        ; Load '*p_dst' with exclusive access
+        CMP     R3, R1                          ; Does it hold 'cmp'?
+        BNE     CPU_CmpXchgFail
+        STREX   R3, R2, [R0]                    ; Yes, try to store 'val'
+        CMP     R3, #0
+        BNE     CPU_CmpXchgLoop                 ; Preempted, see Note #1
+        MOVS    R0, #1
+        BX      LR
+
+CPU_CmpXchgFail:
+        CLREX                                   ; No, release the exclusive access
+        MOVS    R0, #0
+        BX      LR
+
+
 ;********************************************************************************************************
 ;                                     CPU ASSEMBLY PORT FILE END
 ;********************************************************************************************************
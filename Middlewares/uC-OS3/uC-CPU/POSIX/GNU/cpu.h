@@ -148,16 +148,22 @@ struct  CPU_Interrupt {
     CPU_BOOLEAN     En;
     CPU_CHAR       *NamePtr;
     CPU_BOOLEAN     TraceEn;
+    CPU_BOOLEAN     Pend;                                       /* Port internal: the interrupt is pending.             */
+    CPU_INTERRUPT  *PendNextPtr;                                /* Port internal: next pending interrupt, same prio.    */
 };
 
 
 typedef  struct  CPU_Tmr_Interrupt  CPU_TMR_INTERRUPT;
 
 struct  CPU_Tmr_Interrupt {
-    CPU_INTERRUPT  Interrupt;
-    CPU_BOOLEAN    OneShot;
-    CPU_INT32U     PeriodSec;
-    CPU_INT32U     PeriodMuSec;
+    CPU_INTERRUPT       Interrupt;
+    CPU_BOOLEAN         OneShot;
+    CPU_INT32U          PeriodSec;
+    CPU_INT32U          PeriodMuSec;
+    int                 Fd;                                     /* timerfd of a one-shot (deadline) timer.              */
+    CPU_INT64U          Deadline;                               /* Port internal: next deadline, 0 if stopped.          */
+    CPU_INT32U          ExpCtr;                                 /* Port internal: expiries not yet seen by the ISR.     */
+    CPU_TMR_INTERRUPT  *VirtNextPtr;                            /* Port internal: next virtual time timer.              */
 };
 
 /*
@@ -373,12 +379,28 @@ typedef  CPU_BOOLEAN                CPU_SR;                     /* Defines   CPU
 *                   CPU_RMB     Read (Loads) memory barrier.
 *                   CPU_WMB     Write (Stores) memory barrier.
 *
+*               (b) Tasks and simulated interrupts run in host threads that may be on different cores, so
+*                   the barriers are real fences.
+*
+*********************************************************************************************************
+*/
+
+#define  CPU_MB()       __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define  CPU_RMB()      __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define  CPU_WMB()      __atomic_thread_fence(__ATOMIC_RELEASE)
+
+
+/*
+*********************************************************************************************************
+*                                  CPU COMPARE AND SWAP CONFIGURATION
+*
+* Note(s) : (1) CPU_CFG_CMP_XCHG_PRESENT is #define'd when the port provides CPU_CmpXchg(), an atomic
+*               compare and swap of a CPU_ADDR word, in 'cpu_c.c'.  Lock-free code, e.g. the
+*               memory pools of 'lib_mem.c' (see LIB_MEM_CFG_LOCK_FREE_EN), requires it.
 *********************************************************************************************************
 */
 
-#define  CPU_MB()
-#define  CPU_RMB()
-#define  CPU_WMB()
+#define  CPU_CFG_CMP_XCHG_PRESENT
 
 
 /*
@@ -397,8 +419,35 @@ void  CPU_ISR_End            (void);
 
 void  CPU_TmrInterruptCreate (CPU_TMR_INTERRUPT  *p_tmr_interrupt);
 
+void  CPU_TmrInterruptDeadlineCreate (CPU_TMR_INTERRUPT  *p_tmr_interrupt);
+
+void  CPU_TmrInterruptDeadlineSet    (CPU_TMR_INTERRUPT  *p_tmr_interrupt,
+                                      CPU_INT64U          deadline);
+
+CPU_INT64U  CPU_TmrInterruptTimeGet  (void);
+
+CPU_INT32U  CPU_TmrInterruptSkip     (CPU_TMR_INTERRUPT  *p_tmr_interrupt,
+                                      CPU_INT32U          periods);
+
+CPU_INT32U  CPU_TmrInterruptExpGet   (CPU_TMR_INTERRUPT  *p_tmr_interrupt);
+
 void  CPU_InterruptTrigger   (CPU_INTERRUPT  *p_interrupt);
 
+void  CPU_InterruptTriggerCore (CPU_INTERRUPT  *p_interrupt,
+                                CPU_INT08U      core);
+
+CPU_INT08U  CPU_CoreIdGet    (void);
+
+void  CPU_CoreIdSet          (CPU_INT08U  core);
+
+void  CPU_IntDisLocal        (void);
+
+void  CPU_WaitForInt         (void);
+
+CPU_BOOLEAN  CPU_CmpXchg     (CPU_ADDR  *p_dst,
+                              CPU_ADDR   cmp,
+                              CPU_ADDR   val);
+
 
 /*
 *********************************************************************************************************
@@ -39,7 +39,7 @@
 /* 199309UL: CLOCK_MONOTONIC, clock_gettime, clock_settime
  * 199506UL: pthread_sigmask
  * 200112UL: clock_nanosleep
- * 200809UL: PTHREAD_MUTEX_RECURSIVE, SA_NODEFER, pthread_mutexattr_settype
+ * 200809UL: SA_NODEFER
  */
 #define _POSIX_C_SOURCE 200809UL
 
@@ -48,20 +48,20 @@
 #include  <stdlib.h>
 #include  <string.h>
 #include  <signal.h>
+#include  <semaphore.h>
 #include  <unistd.h>
 #include  <stdlib.h>
 #include  <sys/types.h>
 #include  <sys/syscall.h>
 #include  <sys/resource.h>
+#include  <sys/timerfd.h>
 #include  <errno.h>
+#include  <time.h>
+#include  <sched.h>
 
 #include  <cpu.h>
 #include  <cpu_core.h>
 
-#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
-#include  <time.h>
-#endif
-
 #ifdef __cplusplus
 extern  "C" {
 #endif
@@ -90,34 +90,111 @@ extern  "C" {
 #define  CPU_TMR_INT_TASK_PRIO         sched_get_priority_max(SCHED_RR)     /* Tmr interrupt task priority.             */
 #define  CPU_IRQ_SIG                  (SIGURG)                              /* IRQ trigger signal.                      */
 
-/*
-*********************************************************************************************************
-*                                          LOCAL DATA TYPES
-*********************************************************************************************************
-*/
+#ifndef  CPU_CFG_POSIX_INT_FLAG_EN                                          /* See 'CPU_IntEn()  Note #1'.              */
+#define  CPU_CFG_POSIX_INT_FLAG_EN     DEF_DISABLED
+#endif
+
+#ifndef  CPU_CFG_POSIX_INT_SAFE_PT_EN                                       /* See 'CPU_IntEn()  Note #2'.              */
+#define  CPU_CFG_POSIX_INT_SAFE_PT_EN  DEF_DISABLED
+#endif
+
+#if ((CPU_CFG_POSIX_INT_SAFE_PT_EN == DEF_ENABLED) && \
+     (CPU_CFG_POSIX_INT_FLAG_EN    != DEF_ENABLED))
+#error  "CPU_CFG_POSIX_INT_SAFE_PT_EN   requires CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED"
+#endif
+
+#ifndef  CPU_CFG_POSIX_VIRT_TIME_EN                                         /* See 'CPU_TmrInterruptTimeGet() Note #1'. */
+#define  CPU_CFG_POSIX_VIRT_TIME_EN    DEF_DISABLED
+#endif
+
+#if ((CPU_CFG_POSIX_VIRT_TIME_EN   == DEF_ENABLED) && \
+     (CPU_CFG_POSIX_INT_SAFE_PT_EN != DEF_ENABLED))
+#error  "CPU_CFG_POSIX_VIRT_TIME_EN     requires CPU_CFG_POSIX_INT_SAFE_PT_EN == DEF_ENABLED"
+#endif
+
+#ifndef  CPU_CFG_POSIX_VIRT_TIME_STEP_NS                                    /* See 'CPU_TmrInterruptTimeGet() Note #1'. */
+#define  CPU_CFG_POSIX_VIRT_TIME_STEP_NS  100u
+#endif
+
+#define  CPU_VIRT_TIME_INIT            1000000000u                          /* Virtual time at start, in ns (not 0).    */
 
-typedef  struct  cpu_interrupt_node  CPU_INTERRUPT_NODE;
+#ifndef  CPU_CFG_POSIX_CORE_NBR                                             /* See 'CPU_CoreIdGet()  Note #1'.          */
+#define  CPU_CFG_POSIX_CORE_NBR        1u
+#endif
+
+#if ((CPU_CFG_POSIX_CORE_NBR    >  1u) && \
+     (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED))
+#error  "CPU_CFG_POSIX_CORE_NBR > 1     requires CPU_CFG_POSIX_INT_FLAG_EN == DEF_DISABLED"
+#endif
+
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+#define  CPU_CORE_LOCAL                __thread                             /* One copy per simulated core's thread.    */
+#else
+#define  CPU_CORE_LOCAL
+#endif
+
+#define  CPU_INT_LOCK_SPIN_MAX         64u                                  /* Spins on the kernel lock between yields. */
 
-struct  cpu_interrupt_node {
-    CPU_INTERRUPT       *InterruptPtr;
-    CPU_INTERRUPT_NODE  *NextPtr;
-};
+#define  CPU_INT_THREAD_NONE          ((pthread_t)0)                        /* No thread has interrupts enabled.        */
+
+#define  CPU_INT_PRIO_NBR             (DEF_INT_08U_MAX_VAL + 1u)            /* Number of interrupt priorities.          */
+#define  CPU_INT_PEND_TBL_SIZE        (CPU_INT_PRIO_NBR / DEF_INT_64_NBR_BITS)
 
 
 /*
 *********************************************************************************************************
 *                                            LOCAL VARIABLES
+*
+* Note(s) : (1) Pending interrupts are kept in a table indexed by priority, see 'CPU_InterruptQueue()  Note #1':
+*
+*               (a) 'CPU_InterruptPendTbl[prio]' is a stack of the pending interrupts of priority 'prio',
+*                   linked through their '.PendNextPtr'.
+*
+*               (b) 'CPU_InterruptRdyTbl[prio]' is a list of the pending interrupts of priority 'prio' taken
+*                   off the stack, in the order of their triggers.  Only the thread with interrupts disabled
+*                   uses it.
+*
+*               (c) 'CPU_InterruptPendBitmap' has bit 'prio' set when 'CPU_InterruptPendTbl[prio]' or
+*                   'CPU_InterruptRdyTbl[prio]' may not be empty.
+*
+*           (2) 'CPU_InterruptRunStk' holds the running interrupts, innermost last.  An interrupt only
+*               preempts one of a lower priority, so there are never more than CPU_INT_PRIO_NBR of them.
+*               With CPU_CFG_POSIX_CORE_NBR > 1, every thread has its own, see 'CPU_CoreIdGet()  Note #2'.
 *********************************************************************************************************
 */
 
-static  pthread_mutex_t       CPU_InterruptQueueMutex = PTHREAD_MUTEX_INITIALIZER;
-static  pthread_mutexattr_t   CPU_InterruptQueueMutexAttr;
+static  CPU_INTERRUPT        *CPU_InterruptPendTbl[CPU_INT_PRIO_NBR];
+static  CPU_INTERRUPT        *CPU_InterruptRdyTbl[CPU_INT_PRIO_NBR];
+static  CPU_INT64U            CPU_InterruptPendBitmap[CPU_INT_PEND_TBL_SIZE];
 
-static  CPU_INTERRUPT_NODE   *CPU_InterruptPendListHeadPtr;
-static  CPU_INTERRUPT_NODE   *CPU_InterruptRunningListHeadPtr;
+static  CPU_CORE_LOCAL  CPU_INTERRUPT  *CPU_InterruptRunStk[CPU_INT_PRIO_NBR];
+static  CPU_CORE_LOCAL  CPU_INT32U      CPU_InterruptRunStkNbr;
 
 static  sigset_t              CPU_IRQ_SigMask;
 
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+static  pthread_t             CPU_IntEnThread;                  /* Thread with interrupts enabled, if any.              */
+static  CPU_BOOLEAN           CPU_IntPend;                      /* IRQ signal received with interrupts disabled.        */
+#endif
+
+#if (CPU_CFG_POSIX_INT_SAFE_PT_EN == DEF_ENABLED)
+static  sem_t                 CPU_IntWaitSem;                   /* Wakes up CPU_WaitForInt().                           */
+static  CPU_BOOLEAN           CPU_IntWaiting;                   /* CPU_WaitForInt() is, or is about to be, waiting.     */
+#endif
+
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+static  CPU_BOOLEAN           CPU_IntLock;                      /* Kernel lock, see 'CPU_CoreIdGet()  Note #3'.         */
+static  CPU_CORE_LOCAL  CPU_INT08U  CPU_CoreIdCur;              /* Core the calling thread runs as.                     */
+static  pthread_t             CPU_CoreThreadTbl[CPU_CFG_POSIX_CORE_NBR];      /* Thread running as each core.       */
+static  CPU_INTERRUPT        *CPU_CoreIntPendTbl[CPU_CFG_POSIX_CORE_NBR];     /* Pending interrupts of each core.   */
+#endif
+
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)
+static  CPU_INT64U            CPU_VirtTime = CPU_VIRT_TIME_INIT;  /* Virtual time, in ns.                               */
+static  CPU_TMR_INTERRUPT    *CPU_VirtTmrListPtr;               /* Simulated timers, last created first.                */
+static  CPU_INT64U            CPU_VirtDeadline;                 /* Earliest deadline of the timers, 0 if none.          */
+#endif
+
 /*
 *********************************************************************************************************
 *                                       LOCAL FUNCTION PROTOTYPES
@@ -128,10 +205,38 @@ static  void   CPU_IRQ_Handler       (int  sig);
 
 static  void   CPU_InterruptTriggerInternal (CPU_INTERRUPT  *p_interrupt);
 
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+static  void   CPU_IRQ_Post          (void);
+#endif
+
 static  void   CPU_InterruptQueue    (CPU_INTERRUPT  *p_isr);
 
+static  CPU_INTERRUPT  *CPU_InterruptDequeue (CPU_INT08U  prio_min);
+
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+static  void            CPU_IntLockAcquire       (void);
+
+static  CPU_INTERRUPT  *CPU_CoreInterruptDequeue (CPU_INT08U  prio_min);
+#endif
+
+static  CPU_INT64U   CPU_TmrInterruptPeriodGet (CPU_TMR_INTERRUPT  *p_tmr_interrupt);
+
+static  void         CPU_TmrInterruptExpAdd    (CPU_TMR_INTERRUPT  *p_tmr_interrupt,
+                                                CPU_INT64U          nbr);
+
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)
+static  void         CPU_TmrInterruptVirtUpdate(void);
+
+static  CPU_BOOLEAN  CPU_TmrInterruptVirtExpire(CPU_BOOLEAN  jump);
+#else
+static  void   CPU_TmrInterruptThreadCreate(void  *(*p_fnct)(void  *p_arg),
+                                            void     *p_arg);
+
 static  void  *CPU_TmrInterruptTask  (void  *p_arg);
 
+static  void  *CPU_TmrInterruptDeadlineTask(void  *p_arg);
+#endif
+
 static  void   CPU_ISR_Sched         (void);
 
 
@@ -156,16 +261,24 @@ void  CPU_IntInit (void)
     int     res;
 
 
-    CPU_InterruptPendListHeadPtr    = DEF_NULL;
-    CPU_InterruptRunningListHeadPtr = DEF_NULL;
+    memset(CPU_InterruptPendTbl,    0, sizeof(CPU_InterruptPendTbl));
+    memset(CPU_InterruptRdyTbl,     0, sizeof(CPU_InterruptRdyTbl));
+    memset(CPU_InterruptPendBitmap, 0, sizeof(CPU_InterruptPendBitmap));
+    CPU_InterruptRunStkNbr          = 0u;
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    CPU_IntEnThread                 = CPU_INT_THREAD_NONE;
+    CPU_IntPend                     = DEF_NO;
+#endif
+#if (CPU_CFG_POSIX_INT_SAFE_PT_EN == DEF_ENABLED)
+    CPU_IntWaiting                  = DEF_NO;
+    if (sem_init(&CPU_IntWaitSem, 0, 0u) != 0) {
+        raise(SIGABRT);
+    }
+#endif
 
     sigemptyset(&CPU_IRQ_SigMask);
     sigaddset(&CPU_IRQ_SigMask, CPU_IRQ_SIG);;
 
-    pthread_mutexattr_init(&CPU_InterruptQueueMutexAttr);
-    pthread_mutexattr_settype(&CPU_InterruptQueueMutexAttr, PTHREAD_MUTEX_RECURSIVE);
-    pthread_mutex_init(&CPU_InterruptQueueMutex, &CPU_InterruptQueueMutexAttr);
-
                                                                 /* Register interrupt trigger signal handler.           */
     memset(&on_isr_trigger_sig_action, 0, sizeof(on_isr_trigger_sig_action));
     res = sigemptyset(&on_isr_trigger_sig_action.sa_mask);
@@ -191,13 +304,55 @@ void  CPU_IntInit (void)
 *
 * Return(s)   : none.
 *
-* Note(s)     : none.
+* Note(s)     : (1) With CPU_CFG_POSIX_INT_FLAG_EN, only the thread that has interrupts enabled can disable
+*                   them.  In any other thread, interrupts are already disabled and this call does nothing.
+*
+*                   See also 'CPU_IntEn()  Note #1'.
+*
+*               (2) With CPU_CFG_POSIX_CORE_NBR > 1, the kernel lock is also taken, see 'CPU_CoreIdGet()
+*                   Note #3'.
 *********************************************************************************************************
 */
 
 void  CPU_IntDis (void)
 {
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    if (__atomic_load_n(&CPU_IntEnThread, __ATOMIC_RELAXED) == pthread_self()) {
+        __atomic_store_n(&CPU_IntEnThread, CPU_INT_THREAD_NONE, __ATOMIC_RELAXED);
+    }
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);                    /* Keep the critical section after the store.           */
+#else
     pthread_sigmask(SIG_BLOCK, &CPU_IRQ_SigMask, DEF_NULL);
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+    CPU_IntLockAcquire();                                       /* See Note #2.                                         */
+#endif
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          CPU_IntDisLocal()
+*
+* Description : Disable interrupts on the calling thread only.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) With CPU_CFG_POSIX_CORE_NBR > 1, the kernel lock is not taken.  This is meant for a
+*                   thread that waits to be handed the lock by a context switch, see 'CPU_CoreIdGet()
+*                   Note #3c'.  Otherwise, this is CPU_IntDis().
+*********************************************************************************************************
+*/
+
+void  CPU_IntDisLocal (void)
+{
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+    pthread_sigmask(SIG_BLOCK, &CPU_IRQ_SigMask, DEF_NULL);     /* See Note #1.                                         */
+#else
+    CPU_IntDis();
+#endif
 }
 
 
@@ -211,13 +366,54 @@ void  CPU_IntDis (void)
 *
 * Return(s)   : none.
 *
-* Note(s)     : none.
+* Note(s)     : (1) With CPU_CFG_POSIX_INT_FLAG_EN, interrupts are masked without system calls :
+*
+*                   (a) 'CPU_IntEnThread' is the thread of the running task when it has interrupts enabled,
+*                       and CPU_INT_THREAD_NONE otherwise.  Only one task thread runs at a time, so this
+*                       word is the simulated CPU's interrupt enable bit.
+*
+*                   (b) The IRQ signal is sent with pthread_kill() to 'CPU_IntEnThread' instead of to the
+*                       process.  A thread that receives it but does not have interrupts enabled forwards
+*                       it to 'CPU_IntEnThread' or, if there is none, sets 'CPU_IntPend'.
+*
+*                   (c) CPU_IntEn() replays a pending IRQ signal by scheduling the interrupts, as the
+*                       unblocked signal would be delivered when pthread_sigmask() returns.
+*
+*                   (d) Setting 'CPU_IntEnThread' then reading 'CPU_IntPend' here, and setting 'CPU_IntPend'
+*                       then reading 'CPU_IntEnThread' in CPU_IRQ_Post(), are both sequentially consistent:
+*                       an IRQ signal is either replayed here or sent to this thread.  A spurious replay
+*                       only calls CPU_ISR_Sched() with nothing to run.
+*
+*               (2) With CPU_CFG_POSIX_INT_SAFE_PT_EN, interrupts are only run at safe points: here, when
+*                   interrupts are enabled, and when CPU_WaitForInt() returns.  No IRQ signal is sent,
+*                   CPU_IRQ_Post() only sets 'CPU_IntPend'.  This is meant for ports that run every task
+*                   on one host thread and switch stacks in user space, where the ISR must not run in a
+*                   signal handler.  A task that loops without a kernel call is not interrupted.
 *********************************************************************************************************
 */
 
 void  CPU_IntEn (void)
 {
+#if ((CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED) && (CPU_CFG_POSIX_VIRT_TIME_STEP_NS > 0u))
+    __atomic_store_n(&CPU_VirtTime, CPU_VirtTime + CPU_CFG_POSIX_VIRT_TIME_STEP_NS, __ATOMIC_RELAXED);
+    if ((CPU_VirtDeadline != 0u) && (CPU_VirtDeadline <= CPU_VirtTime)) {
+        (void)CPU_TmrInterruptVirtExpire(DEF_NO);               /* See 'CPU_TmrInterruptTimeGet()  Note #1a'.           */
+    }
+#endif
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);                    /* Keep the critical section before the store.          */
+    __atomic_store_n(&CPU_IntEnThread, pthread_self(), __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&CPU_IntPend, __ATOMIC_SEQ_CST) != DEF_NO) {
+        if (__atomic_exchange_n(&CPU_IntPend, DEF_NO, __ATOMIC_SEQ_CST) != DEF_NO) {
+            CPU_ISR_Sched();                                    /* See Note #1c.                                        */
+        }
+    }
+#else
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+    __atomic_store_n(&CPU_IntLock, DEF_NO, __ATOMIC_RELEASE);   /* See 'CPU_IntDis()  Note #2'.                         */
+#endif
     pthread_sigmask(SIG_UNBLOCK, &CPU_IRQ_SigMask, DEF_NULL);
+#endif
 }
 
 
@@ -238,21 +434,13 @@ void  CPU_IntEn (void)
 
 void  CPU_ISR_End (void)
 {
-    CPU_INTERRUPT_NODE  *p_interrupt_node;
-
-
     CPU_INT_DIS();
-    pthread_mutex_lock(&CPU_InterruptQueueMutex);
-    if (CPU_InterruptRunningListHeadPtr == DEF_NULL) {
+    if (CPU_InterruptRunStkNbr == 0u) {
         raise(SIGABRT);
     }
-    p_interrupt_node                = CPU_InterruptRunningListHeadPtr;
-    CPU_InterruptRunningListHeadPtr = CPU_InterruptRunningListHeadPtr->NextPtr;
-    pthread_mutex_unlock(&CPU_InterruptQueueMutex);
+    CPU_InterruptRunStkNbr--;
     CPU_INT_EN();
 
-    free(p_interrupt_node);
-
     CPU_ISR_Sched();
 }
 
@@ -267,38 +455,256 @@ void  CPU_ISR_End (void)
 *
 * Return(s)   : none.
 *
-* Note(s)     : none.
+* Note(s)     : (1) The first deadline is one period from now.  The following ones are multiples of the
+*                   period from it, however late the host wakes up the timer.  See 'CPU_TmrInterruptTask()
+*                   Note #1'.
+*
+*               (2) With CPU_CFG_POSIX_VIRT_TIME_EN, the timer is only linked in the list of simulated timers.
+*                   See 'CPU_TmrInterruptTimeGet()  Note #1'.
 *
 *********************************************************************************************************
 */
 
 void  CPU_TmrInterruptCreate (CPU_TMR_INTERRUPT  *p_tmr_interrupt)
 {
-    pthread_t            thread;
-    pthread_attr_t       attr;
-    struct  sched_param  param;
-    int                  res;
+    p_tmr_interrupt->ExpCtr      = 0u;
+    p_tmr_interrupt->Deadline    = CPU_TmrInterruptTimeGet() + CPU_TmrInterruptPeriodGet(p_tmr_interrupt);
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)                 /* See Note #2.                                         */
+    p_tmr_interrupt->VirtNextPtr = CPU_VirtTmrListPtr;
+    CPU_VirtTmrListPtr           = p_tmr_interrupt;
+    CPU_TmrInterruptVirtUpdate();
+#else
+    CPU_TmrInterruptThreadCreate(CPU_TmrInterruptTask, p_tmr_interrupt);
+#endif
+}
 
 
-    res = pthread_attr_init(&attr);
-    if (res != 0u) {
+/*
+*********************************************************************************************************
+*                                   CPU_TmrInterruptDeadlineCreate()
+*
+* Description : Simulated one-shot hardware timer instance creation.
+*
+* Argument(s) : p_tmr_interrupt     Pointer to a timer interrupt descriptor.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The timer is created stopped.  It triggers its interrupt at the absolute deadline set
+*                   by CPU_TmrInterruptDeadlineSet().  'OneShot' and the period fields are not used.
+*
+*               (2) With CPU_CFG_POSIX_VIRT_TIME_EN, the timer is only linked in the list of simulated timers.
+*                   'OneShot' is set so that it is never re-armed when it expires.
+*
+*********************************************************************************************************
+*/
+
+void  CPU_TmrInterruptDeadlineCreate (CPU_TMR_INTERRUPT  *p_tmr_interrupt)
+{
+    p_tmr_interrupt->ExpCtr      = 0u;
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)                 /* See Note #2.                                         */
+    p_tmr_interrupt->OneShot     = DEF_YES;
+    p_tmr_interrupt->Deadline    = 0u;
+    p_tmr_interrupt->VirtNextPtr = CPU_VirtTmrListPtr;
+    CPU_VirtTmrListPtr           = p_tmr_interrupt;
+#else
+    p_tmr_interrupt->Fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if (p_tmr_interrupt->Fd < 0) {
         raise(SIGABRT);
     }
-    res = pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
-    if (res != 0u) {
-        raise(SIGABRT);
+
+    CPU_TmrInterruptThreadCreate(CPU_TmrInterruptDeadlineTask, p_tmr_interrupt);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_TmrInterruptDeadlineSet()
+*
+* Description : Set the deadline of a one-shot timer.
+*
+* Argument(s) : p_tmr_interrupt     Pointer to a timer interrupt descriptor.
+*
+*               deadline            Absolute deadline, in ns of CPU_TmrInterruptTimeGet(), 0 to stop the timer.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A deadline that has already passed triggers the interrupt immediately.  A zero 'it_value'
+*                   disarms the timer.
+*
+*               (2) The previous deadline is replaced.  Its interrupt may still fire if it expired while the
+*                   new deadline was being set.
+*
+*********************************************************************************************************
+*/
+
+void  CPU_TmrInterruptDeadlineSet (CPU_TMR_INTERRUPT  *p_tmr_interrupt,
+                                   CPU_INT64U          deadline)
+{
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)
+    if ((deadline != 0u) && (deadline <= CPU_VirtTime)) {       /* See Note #1.                                         */
+        p_tmr_interrupt->Deadline = 0u;
+        CPU_TmrInterruptExpAdd(p_tmr_interrupt, 1u);
+        CPU_InterruptTriggerInternal(&(p_tmr_interrupt->Interrupt));
+    } else {
+        p_tmr_interrupt->Deadline = deadline;
     }
-    param.__sched_priority = CPU_TMR_INT_TASK_PRIO;
-    pthread_attr_setschedpolicy(&attr, SCHED_RR);
-    if (res != 0u) {
+    CPU_TmrInterruptVirtUpdate();
+#else
+    struct  itimerspec  tspec;
+
+
+    tspec.it_interval.tv_sec  = 0;
+    tspec.it_interval.tv_nsec = 0;
+    tspec.it_value.tv_sec     = (time_t)(deadline / 1000000000u);
+    tspec.it_value.tv_nsec    = (long  )(deadline % 1000000000u);
+
+    if (timerfd_settime(p_tmr_interrupt->Fd, TFD_TIMER_ABSTIME, &tspec, DEF_NULL) != 0) {
         raise(SIGABRT);
     }
-    pthread_attr_setschedparam(&attr, &param);
-    if (res != 0u) {
-        raise(SIGABRT);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                      CPU_TmrInterruptTimeGet()
+*
+* Description : Get the time base of the simulated hardware timers.
+*
+* Argument(s) : none.
+*
+* Return(s)   : CLOCK_MONOTONIC time, or virtual time with CPU_CFG_POSIX_VIRT_TIME_EN, in ns.
+*
+* Note(s)     : (1) With CPU_CFG_POSIX_VIRT_TIME_EN, the simulated timers run on a virtual clock instead of
+*                   host threads sleeping on CLOCK_MONOTONIC :
+*
+*                   (a) The virtual time moves by CPU_CFG_POSIX_VIRT_TIME_STEP_NS each time interrupts are
+*                       enabled, as the cost of the code run between two critical sections, and the timers
+*                       that are due are triggered.  In CPU_WaitForInt(), i.e. when the idle task runs because
+*                       every task is blocked, it jumps to the earliest deadline instead.  With a step of 0,
+*                       code takes no time and a task that never blocks stops the clock.
+*
+*                   (b) No host thread is involved, so a run is reproducible: the same program always sees
+*                       the same interrupts at the same virtual times, however fast the host is.  Interrupts
+*                       triggered by other host threads (e.g. simulated peripherals) are not.
+*
+*                   (c) The timers MUST be created and set from the thread that runs the tasks.
+*
+*                   (d) The virtual time starts at CPU_VIRT_TIME_INIT, so that it is never 0.
+*
+*********************************************************************************************************
+*/
+
+CPU_INT64U  CPU_TmrInterruptTimeGet (void)
+{
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)                 /* See Note #1.                                         */
+    return (__atomic_load_n(&CPU_VirtTime, __ATOMIC_RELAXED));
+#else
+    struct  timespec  tspec;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &tspec);
+
+    return ((CPU_INT64U)tspec.tv_sec * 1000000000u + (CPU_INT64U)tspec.tv_nsec);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_TmrInterruptSkip()
+*
+* Description : Skip periods of a periodic timer without triggering its interrupt.
+*
+* Argument(s) : p_tmr_interrupt     Pointer to a timer interrupt descriptor.
+*
+*               periods             Number of expiries to skip.
+*
+* Return(s)   : Number of expiries skipped.
+*
+* Note(s)     : (1) Only the virtual time can be skipped, 0 is returned without CPU_CFG_POSIX_VIRT_TIME_EN.
+*                   It is moved to the last expiry skipped, which never passes the deadline of another
+*                   timer.  Nothing is skipped while an interrupt is pending.
+*
+*               (2) This lets the idle task of a periodic tick move straight to its next deadline, with
+*                   the caller accounting for the skipped periods.  It MUST be called from the thread that
+*                   runs the tasks, with interrupts disabled.
+*
+*********************************************************************************************************
+*/
+
+CPU_INT32U  CPU_TmrInterruptSkip (CPU_TMR_INTERRUPT  *p_tmr_interrupt,
+                                  CPU_INT32U          periods)
+{
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)
+    CPU_TMR_INTERRUPT  *p_tmr;
+    CPU_INT64U          period;
+    CPU_INT64U          limit;
+    CPU_INT64U          nbr;
+
+
+    period = CPU_TmrInterruptPeriodGet(p_tmr_interrupt);
+    if ((periods                    == 0u)      ||
+        (period                     == 0u)      ||
+        (p_tmr_interrupt->OneShot   == DEF_YES) ||
+        (p_tmr_interrupt->Deadline  == 0u)      ||
+        (__atomic_load_n(&CPU_IntPend, __ATOMIC_SEQ_CST) != DEF_NO)) {
+        return (0u);
     }
 
-    pthread_create(&thread, &attr, CPU_TmrInterruptTask, p_tmr_interrupt);
+    limit = DEF_INT_64U_MAX_VAL;                                /* Earliest deadline of the other timers.               */
+    for (p_tmr = CPU_VirtTmrListPtr; p_tmr != DEF_NULL; p_tmr = p_tmr->VirtNextPtr) {
+        if ((p_tmr           != p_tmr_interrupt) &&
+            (p_tmr->Deadline != 0u)              &&
+            (p_tmr->Deadline <  limit)) {
+            limit = p_tmr->Deadline;
+        }
+    }
+    if (limit <= p_tmr_interrupt->Deadline) {
+        return (0u);
+    }
+
+    nbr = ((limit - p_tmr_interrupt->Deadline - 1u) / period) + 1u;     /* Expiries before 'limit'.                     */
+    if (nbr > periods) {
+        nbr = periods;
+    }
+    __atomic_store_n(&CPU_VirtTime, p_tmr_interrupt->Deadline + ((nbr - 1u) * period), __ATOMIC_RELAXED);
+    p_tmr_interrupt->Deadline += nbr * period;
+    CPU_TmrInterruptVirtUpdate();
+
+    return ((CPU_INT32U)nbr);
+#else
+    (void)&p_tmr_interrupt;
+    (void)&periods;
+
+    return (0u);                                                /* See Note #1.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       CPU_TmrInterruptExpGet()
+*
+* Description : Get, and clear, the number of expiries of a timer since the last call.
+*
+* Argument(s) : p_tmr_interrupt     Pointer to a timer interrupt descriptor.
+*
+* Return(s)   : Number of expiries.
+*
+* Note(s)     : (1) Expiries are counted before the interrupt is triggered.  A pending interrupt is only
+*                   taken once, so when the host runs the ISR late, e.g. because the process was descheduled,
+*                   several expiries are seen by a single ISR run, which then accounts for all of them.
+*
+*               (2) A timer whose ISR never calls this function just keeps counting, with wrap around.
+*
+*********************************************************************************************************
+*/
+
+CPU_INT32U  CPU_TmrInterruptExpGet (CPU_TMR_INTERRUPT  *p_tmr_interrupt)
+{
+    return (__atomic_exchange_n(&(p_tmr_interrupt->ExpCtr), 0u, __ATOMIC_SEQ_CST));
 }
 
 
@@ -312,19 +718,254 @@ void  CPU_TmrInterruptCreate (CPU_TMR_INTERRUPT  *p_tmr_interrupt)
 *
 * Return(s)   : none.
 *
-* Note(s)     : none.
+* Note(s)     : (1) With CPU_CFG_POSIX_INT_FLAG_EN, a thread without interrupts enabled (e.g. a simulated
+*                   peripheral's thread) never receives the IRQ signal, so it queues the interrupt directly.
+*                   It must not call CPU_IntEn(), which would enable interrupts for that thread.
 *
 *********************************************************************************************************
 */
 
 void  CPU_InterruptTrigger (CPU_INTERRUPT  *p_interrupt)
 {
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    if (__atomic_load_n(&CPU_IntEnThread, __ATOMIC_RELAXED) != pthread_self()) {
+        CPU_InterruptTriggerInternal(p_interrupt);              /* See Note #1.                                         */
+        return;
+    }
+#endif
     CPU_INT_DIS();
     CPU_InterruptTriggerInternal(p_interrupt);                  /* Signal are now blocked: rest of Trigger is internal. */
     CPU_INT_EN();
 }
 
 
+/*
+*********************************************************************************************************
+*                                      CPU_InterruptTriggerCore()
+*
+* Description : Queue an interrupt for one core and send the IRQ signal to that core's thread.
+*
+* Argument(s) : p_interrupt     Interrupt to be queued.
+*
+*               core            Core that must run the interrupt.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The interrupt is pushed on the core's own stack of pending interrupts, with the same
+*                   '.Pend' bit protocol as 'CPU_InterruptQueue()  Note #1'.  Only the thread running as
+*                   that core dequeues it.
+*
+*               (2) The push and the read of 'CPU_CoreThreadTbl[core]' are sequentially consistent, as are
+*                   the opposite in CPU_CoreIdSet().  If the core changes threads meanwhile, the new thread
+*                   sends the IRQ signal to itself.  The old one only runs CPU_ISR_Sched() for nothing.
+*
+*               (3) With CPU_CFG_POSIX_CORE_NBR == 1, this is CPU_InterruptTrigger().
+*********************************************************************************************************
+*/
+
+void  CPU_InterruptTriggerCore (CPU_INTERRUPT  *p_interrupt,
+                                CPU_INT08U      core)
+{
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+    CPU_INTERRUPT  *p_head;
+    pthread_t       thread;
+
+
+    if ((p_interrupt->En == DEF_NO) ||
+        (core >= CPU_CFG_POSIX_CORE_NBR)) {
+        return;
+    }
+    if (__atomic_exchange_n(&p_interrupt->Pend, DEF_YES, __ATOMIC_ACQ_REL) != DEF_NO) {
+        return;                                                 /* Already pending, see Note #1.                        */
+    }
+
+    p_head = __atomic_load_n(&CPU_CoreIntPendTbl[core], __ATOMIC_RELAXED);
+    do {
+        p_interrupt->PendNextPtr = p_head;
+    } while (__atomic_compare_exchange_n(&CPU_CoreIntPendTbl[core], &p_head, p_interrupt,
+                                         DEF_YES, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) == 0);
+
+    thread = __atomic_load_n(&CPU_CoreThreadTbl[core], __ATOMIC_SEQ_CST);   /* See Note #2.                             */
+    if (thread != CPU_INT_THREAD_NONE) {
+        pthread_kill(thread, CPU_IRQ_SIG);
+    }
+#else
+    (void)core;
+    CPU_InterruptTrigger(p_interrupt);                          /* See Note #3.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_CoreIdGet()
+*
+* Description : Get the simulated core the calling thread runs as.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Core number, from 0 to CPU_CFG_POSIX_CORE_NBR - 1.
+*
+* Note(s)     : (1) CPU_CFG_POSIX_CORE_NBR sets the number of simulated cores, 1 by default.  With more than
+*                   one, up to CPU_CFG_POSIX_CORE_NBR task threads run at once, one per core.  The IRQ signal
+*                   is still sent to the process: any core with interrupts enabled runs the ISR.  This
+*                   requires the signal mask, i.e. CPU_CFG_POSIX_INT_FLAG_EN disabled.
+*
+*               (2) The core of a thread is a thread-local variable, set by CPU_CoreIdSet() each time the
+*                   port resumes a task thread.  'CPU_InterruptRunStk' is thread-local too: a thread only
+*                   switches out of an ISR after CPU_ISR_End() popped it, so its stack is its core's.
+*
+*               (3) Disabling interrupts masks the IRQ signal on the calling thread AND takes the kernel
+*                   lock, so that CPU_CRITICAL_ENTER() serializes all the cores:
+*
+*                   (a) The lock is a spinlock.  Every task thread has the same real-time priority and the
+*                       holder may be preempted by the host, so the host CPU is yielded every
+*                       CPU_INT_LOCK_SPIN_MAX tries.
+*
+*                   (b) The lock is not recursive.  Critical sections never nest in the kernel.
+*
+*                   (c) The lock is not owned by a thread.  A context switch hands it from the thread of
+*                       the old task to the thread of the new one, which releases it when it leaves the
+*                       critical section.  A thread waiting to be resumed disables interrupts with
+*                       CPU_IntDisLocal().
+*
+*               (4) With CPU_CFG_POSIX_CORE_NBR == 1, the core is always 0.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  CPU_CoreIdGet (void)
+{
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+    return (CPU_CoreIdCur);
+#else
+    return (0u);                                                /* See Note #4.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_CoreIdSet()
+*
+* Description : Make the calling thread run as a simulated core.
+*
+* Argument(s) : core            Core number, from 0 to CPU_CFG_POSIX_CORE_NBR - 1.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Interrupts MUST be disabled.  The IRQ signal is sent to the calling thread if the core
+*                   has pending interrupts, and runs them when interrupts are enabled.  See
+*                   'CPU_InterruptTriggerCore()  Note #2'.
+*
+*               (2) With CPU_CFG_POSIX_CORE_NBR == 1, this function does nothing.
+*********************************************************************************************************
+*/
+
+void  CPU_CoreIdSet (CPU_INT08U  core)
+{
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+    pthread_t  self;
+
+
+    if (core >= CPU_CFG_POSIX_CORE_NBR) {
+        raise(SIGABRT);
+    }
+    self          = pthread_self();
+    CPU_CoreIdCur = core;
+    __atomic_store_n(&CPU_CoreThreadTbl[core], self, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&CPU_CoreIntPendTbl[core], __ATOMIC_SEQ_CST) != DEF_NULL) {
+        pthread_kill(self, CPU_IRQ_SIG);                        /* See Note #1.                                         */
+    }
+#else
+    (void)core;                                                 /* See Note #2.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          CPU_WaitForInt()
+*
+* Description : Wait for an interrupt, the host equivalent of the WFI instruction.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) This function MUST be called with interrupts enabled, e.g. from the idle task.  Without
+*                   CPU_CFG_POSIX_INT_SAFE_PT_EN, the ISR runs in the IRQ signal handler, before pause()
+*                   returns.
+*
+*               (2) With CPU_CFG_POSIX_INT_SAFE_PT_EN, the thread sleeps on 'CPU_IntWaitSem' unless an
+*                   interrupt is already pending.  'CPU_IntWaiting' is set before 'CPU_IntPend' is read,
+*                   and CPU_IRQ_Post() does the opposite, so a wake up is never lost.  A stale post only
+*                   makes a later wait return early.  The pending interrupts are then run, as at any safe
+*                   point.
+*
+*               (3) With CPU_CFG_POSIX_VIRT_TIME_EN, the wait is simulated: the virtual time jumps to the next
+*                   deadline and the timer's interrupt is triggered.  The thread only sleeps if no timer is
+*                   armed.  See 'CPU_TmrInterruptTimeGet()  Note #1'.
+*********************************************************************************************************
+*/
+
+void  CPU_WaitForInt (void)
+{
+#if (CPU_CFG_POSIX_INT_SAFE_PT_EN == DEF_ENABLED)
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)
+    while ((__atomic_load_n(&CPU_IntPend, __ATOMIC_SEQ_CST) == DEF_NO) &&
+           (CPU_TmrInterruptVirtExpire(DEF_YES) == DEF_YES)) {  /* See Note #3.                                         */
+        ;
+    }
+#endif
+    __atomic_store_n(&CPU_IntWaiting, DEF_YES, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&CPU_IntPend, __ATOMIC_SEQ_CST) == DEF_NO) {
+        while ((sem_wait(&CPU_IntWaitSem) != 0) && (errno == EINTR)) {
+            ;
+        }
+    }
+    __atomic_store_n(&CPU_IntWaiting, DEF_NO, __ATOMIC_SEQ_CST);
+
+    CPU_IntDis();                                               /* See Note #2.                                         */
+    CPU_IntEn();
+#else
+    pause();                                                    /* See Note #1.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                            CPU_CmpXchg()
+*
+* Description : Atomic compare and swap.
+*
+* Argument(s) : p_dst       Pointer to the word.
+*
+*               cmp         Value the word must hold.
+*
+*               val         Value to store.
+*
+* Return(s)   : DEF_YES, if '*p_dst' held 'cmp' and now holds 'val'.
+*
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : (1) Tasks and simulated interrupts run in host threads that may be on different host CPUs,
+*                   so the swap is a host atomic, as OS_CPU_CmpXchg() in the kernel port.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  CPU_CmpXchg (CPU_ADDR  *p_dst,
+                          CPU_ADDR   cmp,
+                          CPU_ADDR   val)
+{
+    if (__atomic_compare_exchange_n(p_dst, &cmp, val, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return (DEF_YES);
+    }
+
+    return (DEF_NO);
+}
+
+
 /*
 *********************************************************************************************************
 *                                            CPU_Printf()
@@ -590,6 +1231,7 @@ CPU_DATA  CPU_CntTrailZeros (CPU_DATA  val)
 #if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
 void  CPU_TS_TmrInit (void)
 {
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_DISABLED)
     struct  timespec   res;
 
 
@@ -597,6 +1239,7 @@ void  CPU_TS_TmrInit (void)
     res.tv_nsec = 0;
 
 	(void)clock_settime(CLOCK_MONOTONIC, &res);
+#endif
 
     CPU_TS_TmrFreqSet(1000000000);
 }
@@ -673,12 +1316,18 @@ void  CPU_TS_TmrInit (void)
 *                       (2) Timer period SHOULD be less than the typical measured time but MUST be less
 *                           than the maximum measured time; otherwise, timer resolution inadequate to
 *                           measure desired times.
+*
+*               (3) With CPU_CFG_POSIX_VIRT_TIME_EN, timestamps are virtual cycles of a 1 GHz CPU, i.e. the
+*                   virtual time in ns.  See 'CPU_TmrInterruptTimeGet()  Note #1'.
 *********************************************************************************************************
 */
 
 #if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
 CPU_TS_TMR  CPU_TS_TmrRd (void)
 {
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)                 /* See Note #3.                                         */
+    return ((CPU_TS_TMR)CPU_TmrInterruptTimeGet());
+#else
     struct  timespec    res;
             CPU_TS_TMR  ts;
 
@@ -688,6 +1337,7 @@ CPU_TS_TMR  CPU_TS_TmrRd (void)
     ts = (CPU_TS_TMR)(res.tv_sec * 1000000000u + res.tv_nsec);
 
     return (ts);
+#endif
 }
 #endif
 
@@ -715,7 +1365,8 @@ CPU_TS_TMR  CPU_TS_TmrRd (void)
 *
 * Return(s)   : none.
 *
-* Note(s)     : none.
+* Note(s)     : (1) With CPU_CFG_POSIX_INT_FLAG_EN, the interrupts are only scheduled if this thread has
+*                   interrupts enabled.  See 'CPU_IntEn()  Note #1b'.
 *
 *********************************************************************************************************
 */
@@ -723,10 +1374,61 @@ CPU_TS_TMR  CPU_TS_TmrRd (void)
 static  void  CPU_IRQ_Handler (int sig)
 {
     (void)&sig;
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    if (__atomic_load_n(&CPU_IntEnThread, __ATOMIC_SEQ_CST) != pthread_self()) {
+        CPU_IRQ_Post();                                         /* See Note #1.                                         */
+        return;
+    }
+#endif
     CPU_ISR_Sched();
 }
 
 
+/*
+*********************************************************************************************************
+*                                           CPU_IRQ_Post()
+*
+* Description : Send the IRQ signal to the thread with interrupts enabled, or leave it pending.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) See 'CPU_IntEn()  Note #1d'.
+*
+*               (2) pthread_kill() is async-signal-safe, this function is also called by CPU_IRQ_Handler().
+*
+*               (3) With CPU_CFG_POSIX_INT_SAFE_PT_EN, the interrupt is left pending for the next safe point
+*                   and CPU_WaitForInt() is woken up.  See 'CPU_WaitForInt()  Note #2'.
+*
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+static  void  CPU_IRQ_Post (void)
+{
+#if (CPU_CFG_POSIX_INT_SAFE_PT_EN == DEF_ENABLED)               /* See Note #3.                                         */
+    __atomic_store_n(&CPU_IntPend, DEF_YES, __ATOMIC_SEQ_CST);
+    if (__atomic_exchange_n(&CPU_IntWaiting, DEF_NO, __ATOMIC_SEQ_CST) != DEF_NO) {
+        sem_post(&CPU_IntWaitSem);
+    }
+#else
+    pthread_t  thread;
+
+
+    thread = __atomic_load_n(&CPU_IntEnThread, __ATOMIC_SEQ_CST);
+    if (thread == CPU_INT_THREAD_NONE) {
+        __atomic_store_n(&CPU_IntPend, DEF_YES, __ATOMIC_SEQ_CST);
+        thread = __atomic_load_n(&CPU_IntEnThread, __ATOMIC_SEQ_CST);   /* See Note #1.                                 */
+    }
+    if (thread != CPU_INT_THREAD_NONE) {
+        pthread_kill(thread, CPU_IRQ_SIG);
+    }
+#endif
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    CPU_InterruptTriggerInternal()
@@ -737,7 +1439,7 @@ static  void  CPU_IRQ_Handler (int sig)
 *
 * Return(s)   : none.
 *
-* Note(s)     : (1) The Interrupt signal must be blocked before calling this function.
+* Note(s)     : (1) The Interrupt signal must be blocked, or interrupts disabled, before calling this function.
 *********************************************************************************************************
 */
 
@@ -749,12 +1451,16 @@ void  CPU_InterruptTriggerInternal (CPU_INTERRUPT  *p_interrupt)
 
     CPU_InterruptQueue(p_interrupt);
 
+#if (CPU_CFG_POSIX_INT_FLAG_EN == DEF_ENABLED)
+    CPU_IRQ_Post();
+#else
     kill(getpid(), CPU_IRQ_SIG);
+#endif
 
     if (p_interrupt->TraceEn == DEF_ENABLED) {
-        struct  timespec  ts;
-        clock_gettime(CLOCK_MONOTONIC, &ts);
-        printf("@ %lu:%06lu", ts.tv_sec, ts.tv_nsec / 1000u);
+        CPU_INT64U  ts;
+        ts = CPU_TmrInterruptTimeGet();
+        printf("@ %lu:%06lu", (unsigned long)(ts / 1000000000u), (unsigned long)((ts % 1000000000u) / 1000u));
         printf("  %s interrupt fired.\r\n", p_interrupt->NamePtr);
     }
 }
@@ -770,39 +1476,196 @@ void  CPU_InterruptTriggerInternal (CPU_INTERRUPT  *p_interrupt)
 *
 * Return(s)   : none.
 *
-* Note(s)     : (1) The signals for this thread are already blocked during this function call.
+* Note(s)     : (1) Any thread may queue an interrupt, with or without interrupts disabled, and only the
+*                   thread with interrupts disabled dequeues them.  No lock is taken:
+*
+*                   (a) '.Pend' is the interrupt's pending bit.  Only the thread that sets it pushes the
+*                       interrupt, so it is never queued twice.  Triggering a pending interrupt again has no
+*                       effect, as with the pending bit of an interrupt controller.
+*
+*                   (b) The interrupt is pushed on the stack of its priority with a compare-and-swap, then
+*                       the priority's bit is set.  See 'CPU_InterruptDequeue()  Note #1'.
 *
-*               (2) Since the signal are already blocked, it is safe to lock and release the mutex.
+*               (2) Interrupts of the same priority are run in the order of their triggers: the stack is
+*                   reversed when it is dequeued, see 'CPU_InterruptDequeue()  Note #1'.
 *********************************************************************************************************
 */
 
 static  void  CPU_InterruptQueue (CPU_INTERRUPT  *p_interrupt)
 {
-    CPU_INTERRUPT_NODE  *p_cur_interrupt_node;
-    CPU_INTERRUPT_NODE  *p_prev_interrupt_node;
-    CPU_INTERRUPT_NODE  *p_interrupt_node;
+    CPU_INTERRUPT  *p_head;
+    CPU_INT08U      prio;
 
 
-    p_interrupt_node = (CPU_INTERRUPT_NODE *)malloc(sizeof(CPU_INTERRUPT_NODE));
-    p_interrupt_node->InterruptPtr = p_interrupt;
+    if (__atomic_exchange_n(&p_interrupt->Pend, DEF_YES, __ATOMIC_ACQ_REL) != DEF_NO) {
+        return;                                                 /* Already pending, see Note #1a.                       */
+    }
 
-    pthread_mutex_lock(&CPU_InterruptQueueMutex);
-    if ((CPU_InterruptPendListHeadPtr == DEF_NULL) ||
-        (CPU_InterruptPendListHeadPtr->InterruptPtr->Prio < p_interrupt->Prio)) {
-        p_interrupt_node->NextPtr = CPU_InterruptPendListHeadPtr;
-        CPU_InterruptPendListHeadPtr  = p_interrupt_node;
-    } else {
-        p_cur_interrupt_node = CPU_InterruptPendListHeadPtr;
-        while ((p_cur_interrupt_node != DEF_NULL) &&
-               (p_cur_interrupt_node->InterruptPtr->Prio >= p_interrupt->Prio)) {
-            p_prev_interrupt_node = p_cur_interrupt_node;
-            p_cur_interrupt_node  = p_cur_interrupt_node->NextPtr;
+    prio   = p_interrupt->Prio;
+    p_head = __atomic_load_n(&CPU_InterruptPendTbl[prio], __ATOMIC_RELAXED);
+    do {
+        p_interrupt->PendNextPtr = p_head;
+    } while (__atomic_compare_exchange_n(&CPU_InterruptPendTbl[prio], &p_head, p_interrupt,
+                                         DEF_YES, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) == 0);
+
+    __atomic_fetch_or(&CPU_InterruptPendBitmap[prio / DEF_INT_64_NBR_BITS],
+                      (CPU_INT64U)1u << (prio % DEF_INT_64_NBR_BITS),
+                      __ATOMIC_SEQ_CST);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_InterruptDequeue()
+*
+* Description : Dequeue the highest priority pending interrupt.
+*
+* Argument(s) : prio_min        Lowest priority that may be dequeued.
+*
+* Return(s)   : Pointer to the interrupt,
+*
+*               DEF_NULL, if no interrupt of priority 'prio_min' or higher is pending.
+*
+* Note(s)     : (1) Interrupts MUST be disabled, so there is a single caller at a time.  Producers only push,
+*                   so the caller takes a whole stack at once with an exchange, and reverses it into the
+*                   priority's ready list: the oldest trigger comes first.  The ready list is only refilled
+*                   once it is empty, so the interrupts of a priority are run first in, first out.
+*
+*               (2) The priority's bit is cleared before the stack is checked again, and a producer sets it
+*                   after its push: a stack that is not empty always ends up with its bit set.  The bit is
+*                   only cleared when the ready list is empty as well.
+*
+*               (3) The pending bit is cleared once the interrupt is off the ready list, before its ISR runs.
+*                   The ISR may then trigger the interrupt again.
+*********************************************************************************************************
+*/
+
+static  CPU_INTERRUPT  *CPU_InterruptDequeue (CPU_INT08U  prio_min)
+{
+    CPU_INTERRUPT  *p_interrupt;
+    CPU_INTERRUPT  *p_stk;
+    CPU_INTERRUPT  *p_next;
+    CPU_INT64U      bitmap;
+    CPU_INT64U      bit;
+    CPU_INT32U      ix;
+    CPU_INT08U      prio;
+
+
+    ix = CPU_INT_PEND_TBL_SIZE;
+    while (ix > 0u) {
+        ix--;
+        bitmap = __atomic_load_n(&CPU_InterruptPendBitmap[ix], __ATOMIC_SEQ_CST);
+        while (bitmap != 0u) {
+            prio = (CPU_INT08U)((ix * DEF_INT_64_NBR_BITS) + (DEF_INT_64_NBR_BITS - 1u) - __builtin_clzll(bitmap));
+            if (prio < prio_min) {
+                return (DEF_NULL);
+            }
+            bit  = (CPU_INT64U)1u << (prio % DEF_INT_64_NBR_BITS);
+
+            if (CPU_InterruptRdyTbl[prio] == DEF_NULL) {        /* Refill the ready list from the stack (see Note #1).  */
+                p_stk = __atomic_exchange_n(&CPU_InterruptPendTbl[prio], DEF_NULL, __ATOMIC_ACQ_REL);
+                while (p_stk != DEF_NULL) {
+                    p_next                    = p_stk->PendNextPtr;
+                    p_stk->PendNextPtr        = CPU_InterruptRdyTbl[prio];
+                    CPU_InterruptRdyTbl[prio] = p_stk;
+                    p_stk                     = p_next;
+                }
+            }
+            p_interrupt = CPU_InterruptRdyTbl[prio];
+            if (p_interrupt != DEF_NULL) {
+                CPU_InterruptRdyTbl[prio] = p_interrupt->PendNextPtr;
+                __atomic_store_n(&p_interrupt->Pend, DEF_NO, __ATOMIC_RELEASE);     /* See Note #3.                     */
+                return (p_interrupt);
+            }
+                                                                /* Both empty: clear the bit (see Note #2).             */
+            __atomic_fetch_and(&CPU_InterruptPendBitmap[ix], ~bit, __ATOMIC_SEQ_CST);
+            if (__atomic_load_n(&CPU_InterruptPendTbl[prio], __ATOMIC_SEQ_CST) != DEF_NULL) {
+                __atomic_fetch_or(&CPU_InterruptPendBitmap[ix], bit, __ATOMIC_SEQ_CST);
+            } else {
+                bitmap &= ~bit;
+            }
+        }
+    }
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      CPU_CoreInterruptDequeue()
+*
+* Description : Dequeue a pending interrupt of the calling thread's core.
+*
+* Argument(s) : prio_min        Lowest priority that may be dequeued.
+*
+* Return(s)   : Pointer to the interrupt,
+*
+*               DEF_NULL, if the last interrupt queued for the core is not of priority 'prio_min' or
+*               higher, or if none is pending.
+*
+* Note(s)     : (1) Interrupts MUST be disabled.  The kernel lock makes this the only consumer, see
+*                   'CPU_InterruptDequeue()  Note #1'.
+*
+*               (2) The stack of a core is not sorted by priority.  Its interrupts are meant to be few, e.g.
+*                   one inter-processor interrupt per core.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+static  CPU_INTERRUPT  *CPU_CoreInterruptDequeue (CPU_INT08U  prio_min)
+{
+    CPU_INTERRUPT  *p_interrupt;
+    CPU_INT08U      core;
+
+
+    core        = CPU_CoreIdCur;
+    p_interrupt = __atomic_load_n(&CPU_CoreIntPendTbl[core], __ATOMIC_ACQUIRE);
+    while ((p_interrupt != DEF_NULL) &&
+           (p_interrupt->Prio >= prio_min)) {
+        if (__atomic_compare_exchange_n(&CPU_CoreIntPendTbl[core], &p_interrupt, p_interrupt->PendNextPtr,
+                                        DEF_NO, __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE) != 0) {
+            __atomic_store_n(&p_interrupt->Pend, DEF_NO, __ATOMIC_RELEASE);
+            return (p_interrupt);
+        }
+    }
+
+    return (DEF_NULL);                                          /* See Note #2.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntLockAcquire()
+*
+* Description : Take the kernel lock.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) See 'CPU_CoreIdGet()  Note #3'.  The lock is only read while it is taken, so that the
+*                   waiters do not write to its cache line.
+*********************************************************************************************************
+*/
+
+static  void  CPU_IntLockAcquire (void)
+{
+    CPU_INT32U  spin;
+
+
+    spin = 0u;
+    while (__atomic_exchange_n(&CPU_IntLock, DEF_YES, __ATOMIC_ACQUIRE) != DEF_NO) {
+        while (__atomic_load_n(&CPU_IntLock, __ATOMIC_RELAXED) != DEF_NO) {
+            spin++;
+            if (spin >= CPU_INT_LOCK_SPIN_MAX) {
+                spin = 0u;
+                sched_yield();                                  /* See 'CPU_CoreIdGet()  Note #3a'.                     */
+            }
         }
-        p_prev_interrupt_node->NextPtr = p_interrupt_node;
-        p_interrupt_node->NextPtr      = p_cur_interrupt_node;
     }
-    pthread_mutex_unlock(&CPU_InterruptQueueMutex);
 }
+#endif
 
 
 /*
@@ -815,35 +1678,238 @@ static  void  CPU_InterruptQueue (CPU_INTERRUPT  *p_interrupt)
 *
 * Return(s)   : none.
 *
-* Note(s)     : none.
+* Note(s)     : (1) Only an interrupt of a higher priority than the running one is dequeued.
+*
+*               (2) With CPU_CFG_POSIX_CORE_NBR > 1, the interrupts of the calling thread's core are run
+*                   first, see 'CPU_InterruptTriggerCore()'.
 *
 *********************************************************************************************************
 */
 
 static  void  CPU_ISR_Sched (void)
 {
-    CPU_INTERRUPT_NODE     *p_isr_node;
+    CPU_INTERRUPT  *p_interrupt;
+    CPU_INT32U      prio_min;
 
 
     CPU_INT_DIS();
-    pthread_mutex_lock(&CPU_InterruptQueueMutex);
-    p_isr_node = CPU_InterruptPendListHeadPtr;
-    if ((p_isr_node != DEF_NULL) &&
-        ((CPU_InterruptRunningListHeadPtr == DEF_NULL) ||
-        (p_isr_node->InterruptPtr->Prio > CPU_InterruptRunningListHeadPtr->InterruptPtr->Prio))) {
-        CPU_InterruptPendListHeadPtr = CPU_InterruptPendListHeadPtr->NextPtr;
-        p_isr_node->NextPtr = CPU_InterruptRunningListHeadPtr;
-        CPU_InterruptRunningListHeadPtr = p_isr_node;
-        pthread_mutex_unlock(&CPU_InterruptQueueMutex);
+    if (CPU_InterruptRunStkNbr == 0u) {
+        prio_min = 0u;
+    } else {                                                    /* See Note #1.                                         */
+        prio_min = CPU_InterruptRunStk[CPU_InterruptRunStkNbr - 1u]->Prio + 1u;
+    }
+    if (prio_min < CPU_INT_PRIO_NBR) {
+#if (CPU_CFG_POSIX_CORE_NBR > 1u)
+        p_interrupt = CPU_CoreInterruptDequeue((CPU_INT08U)prio_min);
+        if (p_interrupt == DEF_NULL) {                          /* See Note #2.                                         */
+            p_interrupt = CPU_InterruptDequeue((CPU_INT08U)prio_min);
+        }
+#else
+        p_interrupt = CPU_InterruptDequeue((CPU_INT08U)prio_min);
+#endif
+    } else {
+        p_interrupt = DEF_NULL;
+    }
+    if (p_interrupt != DEF_NULL) {
+        CPU_InterruptRunStk[CPU_InterruptRunStkNbr] = p_interrupt;
+        CPU_InterruptRunStkNbr++;
         CPU_INT_EN();
-        p_isr_node->InterruptPtr->ISR_Fnct();
+        p_interrupt->ISR_Fnct();
     } else {
-        pthread_mutex_unlock(&CPU_InterruptQueueMutex);
         CPU_INT_EN();
     }
 }
 
 
+/*
+*********************************************************************************************************
+*                                     CPU_TmrInterruptPeriodGet()
+*
+* Description : Get the period of a simulated hardware timer.
+*
+* Argument(s) : p_tmr_interrupt     Pointer to a timer interrupt descriptor.
+*
+* Return(s)   : Period, in ns.
+*
+* Note(s)     : none.
+*
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  CPU_TmrInterruptPeriodGet (CPU_TMR_INTERRUPT  *p_tmr_interrupt)
+{
+    return (((CPU_INT64U)p_tmr_interrupt->PeriodSec   * 1000000000u) +
+            ((CPU_INT64U)p_tmr_interrupt->PeriodMuSec *       1000u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                       CPU_TmrInterruptExpAdd()
+*
+* Description : Count expiries of a simulated hardware timer, before triggering its interrupt.
+*
+* Argument(s) : p_tmr_interrupt     Pointer to a timer interrupt descriptor.
+*
+*               nbr                 Number of expiries.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) See 'CPU_TmrInterruptExpGet()  Note #1'.
+*
+*********************************************************************************************************
+*/
+
+static  void  CPU_TmrInterruptExpAdd (CPU_TMR_INTERRUPT  *p_tmr_interrupt,
+                                      CPU_INT64U          nbr)
+{
+    __atomic_add_fetch(&(p_tmr_interrupt->ExpCtr), (CPU_INT32U)nbr, __ATOMIC_SEQ_CST);
+}
+
+
+#if (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                    CPU_TmrInterruptVirtUpdate()
+*
+* Description : Update the earliest deadline of the simulated timers.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) It is kept in 'CPU_VirtDeadline', so that CPU_IntEn() only compares it to the time.
+*
+*********************************************************************************************************
+*/
+
+static  void  CPU_TmrInterruptVirtUpdate (void)
+{
+    CPU_TMR_INTERRUPT  *p_tmr;
+    CPU_INT64U          deadline;
+
+
+    deadline = 0u;
+    for (p_tmr = CPU_VirtTmrListPtr; p_tmr != DEF_NULL; p_tmr = p_tmr->VirtNextPtr) {
+        if ((p_tmr->Deadline != 0u) &&
+            ((deadline == 0u) || (p_tmr->Deadline < deadline))) {
+            deadline = p_tmr->Deadline;
+        }
+    }
+    CPU_VirtDeadline = deadline;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_TmrInterruptVirtExpire()
+*
+* Description : Trigger the simulated timers that are due, after moving the virtual time to the earliest
+*               deadline if asked to.
+*
+* Argument(s) : jump        DEF_YES, to move the virtual time to the earliest deadline first.
+*
+* Return(s)   : DEF_YES, if a timer expired,
+*
+*               DEF_NO,  if no timer is due.
+*
+* Note(s)     : (1) Every timer due at the new time expires.  A periodic timer is re-armed at its first
+*                   deadline after the new time, and counts every period that passed, a one-shot timer or
+*                   a timer without a period is stopped.
+*
+*               (2) The interrupt of an expired timer may be disabled, in which case none is pending.
+*
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  CPU_TmrInterruptVirtExpire (CPU_BOOLEAN  jump)
+{
+    CPU_TMR_INTERRUPT  *p_tmr;
+    CPU_INT64U          period;
+    CPU_INT64U          nbr;
+
+
+    if (CPU_VirtDeadline == 0u) {
+        return (DEF_NO);
+    }
+    if (CPU_VirtDeadline > CPU_VirtTime) {
+        if (jump == DEF_NO) {
+            return (DEF_NO);
+        }
+        __atomic_store_n(&CPU_VirtTime, CPU_VirtDeadline, __ATOMIC_RELAXED);
+    }
+
+    for (p_tmr = CPU_VirtTmrListPtr; p_tmr != DEF_NULL; p_tmr = p_tmr->VirtNextPtr) {
+        if ((p_tmr->Deadline != 0u) &&
+            (p_tmr->Deadline <= CPU_VirtTime)) {                /* See Note #1.                                         */
+            period = CPU_TmrInterruptPeriodGet(p_tmr);
+            if ((p_tmr->OneShot == DEF_YES) ||
+                (period         == 0u)) {
+                nbr              = 1u;
+                p_tmr->Deadline  = 0u;
+            } else {
+                nbr              = ((CPU_VirtTime - p_tmr->Deadline) / period) + 1u;
+                p_tmr->Deadline += nbr * period;
+            }
+            CPU_TmrInterruptExpAdd(p_tmr, nbr);
+            CPU_InterruptTriggerInternal(&(p_tmr->Interrupt));
+        }
+    }
+    CPU_TmrInterruptVirtUpdate();
+
+    return (DEF_YES);
+}
+
+
+#else
+/*
+*********************************************************************************************************
+*                                    CPU_TmrInterruptThreadCreate()
+*
+* Description : Create the thread of a simulated hardware timer.
+*
+* Argument(s) : p_fnct   Thread function.
+*
+*               p_arg    Pointer to a timer interrupt descriptor.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*
+*********************************************************************************************************
+*/
+
+static  void  CPU_TmrInterruptThreadCreate (void  *(*p_fnct)(void  *p_arg),
+                                            void     *p_arg)
+{
+    pthread_t            thread;
+    pthread_attr_t       attr;
+    struct  sched_param  param;
+    int                  res;
+
+
+    res = pthread_attr_init(&attr);
+    if (res != 0u) {
+        raise(SIGABRT);
+    }
+    res = pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    if (res != 0u) {
+        raise(SIGABRT);
+    }
+    param.__sched_priority = CPU_TMR_INT_TASK_PRIO;
+    pthread_attr_setschedpolicy(&attr, SCHED_RR);
+    if (res != 0u) {
+        raise(SIGABRT);
+    }
+    pthread_attr_setschedparam(&attr, &param);
+    if (res != 0u) {
+        raise(SIGABRT);
+    }
+
+    pthread_create(&thread, &attr, p_fnct, p_arg);
+}
+
+
 /*
 *********************************************************************************************************
 *                                        CPU_TmrInterruptTask()
@@ -854,35 +1920,95 @@ static  void  CPU_ISR_Sched (void)
 *
 * Return(s)   : none.
 *
-* Note(s)     : none.
+* Note(s)     : (1) The thread sleeps until an absolute deadline with TIMER_ABSTIME, which moves by exact
+*                   multiples of the period.  Sleeping for a relative period would add the wake-up latency
+*                   of every expiry to the next one, so that the tick slowly drifts from CLOCK_MONOTONIC.
+*
+*               (2) When the host wakes up the thread more than one period late, the periods that passed
+*                   are counted as expiries, the interrupt is triggered once and the deadline is moved to
+*                   the first one still in the future.  See 'CPU_TmrInterruptExpGet()  Note #1'.
+*
+*               (3) The interrupt signal stays blocked in this thread, so the ISR never runs on it.
 *
 *********************************************************************************************************
 */
 
 static  void  *CPU_TmrInterruptTask (void  *p_arg) {
 
-    struct  timespec    tspec, tspec_rem;
+    struct  timespec    tspec;
     int                 res;
     CPU_TMR_INTERRUPT  *p_tmr_int;
     CPU_BOOLEAN         one_shot;
+    CPU_INT64U          period;
+    CPU_INT64U          now;
+    CPU_INT64U          nbr;
 
-    CPU_INT_DIS();
+    pthread_sigmask(SIG_BLOCK, &CPU_IRQ_SigMask, DEF_NULL);     /* See Note #3.                                         */
 
     p_tmr_int = (CPU_TMR_INTERRUPT *)p_arg;
 
-    tspec.tv_nsec = p_tmr_int->PeriodMuSec * 1000u;
-    tspec.tv_sec  = p_tmr_int->PeriodSec;
-
+    period   = CPU_TmrInterruptPeriodGet(p_tmr_int);
     one_shot = p_tmr_int->OneShot;
 
     do {
-        tspec_rem = tspec;
-        do {res = clock_nanosleep(CLOCK_MONOTONIC, 0u, &tspec_rem, &tspec_rem); } while (res == EINTR);
+        tspec.tv_sec  = (time_t)(p_tmr_int->Deadline / 1000000000u);
+        tspec.tv_nsec = (long  )(p_tmr_int->Deadline % 1000000000u);
+        do {res = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &tspec, DEF_NULL); } while (res == EINTR);
         if (res != 0u) { raise(SIGABRT); }
-        CPU_InterruptTriggerInternal(&(p_tmr_int->Interrupt));  /* See Note #2.                                         */
+
+        nbr = 1u;                                               /* See Note #2.                                         */
+        if (period > 0u) {
+            now  = CPU_TmrInterruptTimeGet();
+            nbr += (now - p_tmr_int->Deadline) / period;
+        }
+        p_tmr_int->Deadline += nbr * period;                    /* See Note #1.                                         */
+
+        CPU_TmrInterruptExpAdd(p_tmr_int, nbr);
+        CPU_InterruptTriggerInternal(&(p_tmr_int->Interrupt));
     } while (one_shot != DEF_YES);
 
     pthread_exit(DEF_NULL);
 
     return (NULL);
 }
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_TmrInterruptDeadlineTask()
+*
+* Description : One-shot hardware timer interrupt simulation function.
+*
+* Argument(s) : p_arg    Pointer to a timer interrupt descriptor.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The interrupt signal stays blocked in this thread, so the ISR never runs on it.
+*
+*********************************************************************************************************
+*/
+
+static  void  *CPU_TmrInterruptDeadlineTask (void  *p_arg)
+{
+    CPU_TMR_INTERRUPT  *p_tmr_int;
+    CPU_INT64U          expirations;
+    ssize_t             res;
+
+
+    pthread_sigmask(SIG_BLOCK, &CPU_IRQ_SigMask, DEF_NULL);     /* See Note #1.                                         */
+
+    p_tmr_int = (CPU_TMR_INTERRUPT *)p_arg;
+
+    for (;;) {
+        res = read(p_tmr_int->Fd, &expirations, sizeof(expirations));
+        if (res == (ssize_t)sizeof(expirations)) {
+            CPU_TmrInterruptExpAdd(p_tmr_int, expirations);
+            CPU_InterruptTriggerInternal(&(p_tmr_int->Interrupt));
+        } else if ((res >= 0) || (errno != EINTR)) {
+            raise(SIGABRT);
+        }
+    }
+
+    return (NULL);
+}
+#endif
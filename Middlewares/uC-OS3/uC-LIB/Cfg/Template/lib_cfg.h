@@ -120,6 +120,41 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                    SEGMENT HEAP CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_SEG_HEAP_EN to enable/disable the segment heaps, real-time allocators
+*               with free support created on top of a memory segment (see 'lib_mem.h  SEGMENT HEAP DATA
+*               TYPES').
+*
+*           (2) Configure LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2 with the base-2 logarithm of the largest block
+*               a segment heap can manage.  Each heap holds 16 free list pointers per power of 2.
+*********************************************************************************************************
+*/
+
+                                                                /* Segment heaps.                                       */
+                                                                /* Enable/disable Mem_SegHeap...() functions.           */
+#define  LIB_MEM_CFG_SEG_HEAP_EN         DEF_DISABLED
+
+                                                                /* Largest segment heap block, log2 (in bytes).         */
+#define  LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2        17u          /* 128 KB.                                              */
+
+
+/*
+*********************************************************************************************************
+*                                  LOCK-FREE MEMORY POOLS CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_LOCK_FREE_EN to enable/disable lock-free free lists for the memory
+*               pools.  Requires a CPU port with CPU_CmpXchg() (see 'lib_mem.h  LOCK-FREE MEMORY POOLS
+*               CONFIGURATION').
+*********************************************************************************************************
+*/
+
+                                                                /* Lock-free memory pools.                              */
+#define  LIB_MEM_CFG_LOCK_FREE_EN        DEF_DISABLED
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
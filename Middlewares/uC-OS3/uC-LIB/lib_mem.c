@@ -58,6 +58,35 @@
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)                    /* ------------------ SEG HEAP BLKS ------------------- */
+#define  MEM_SEG_HEAP_BLK_FLAG_FREE                 DEF_BIT_00  /* Blk is free.                                         */
+#define  MEM_SEG_HEAP_BLK_FLAG_PREV_FREE            DEF_BIT_01  /* Prev phys blk is free.                               */
+#define  MEM_SEG_HEAP_BLK_FLAGS                    ((CPU_SIZE_T)(MEM_SEG_HEAP_BLK_FLAG_FREE | MEM_SEG_HEAP_BLK_FLAG_PREV_FREE))
+
+#define  MEM_SEG_HEAP_BLK_HDR_SIZE                  LIB_MEM_SEG_HEAP_ALIGN
+#define  MEM_SEG_HEAP_BLK_SIZE_MIN                  LIB_MEM_SEG_HEAP_ALIGN      /* Room for the free list ptrs.         */
+#define  MEM_SEG_HEAP_BLK_SIZE_MAX    ((CPU_SIZE_T)1u << LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2)
+
+#define  MEM_SEG_HEAP_BLK_SIZE_GET(p_blk)          ((p_blk)->Size & ~MEM_SEG_HEAP_BLK_FLAGS)
+#define  MEM_SEG_HEAP_BLK_IS_FREE(p_blk)           (((p_blk)->Size & MEM_SEG_HEAP_BLK_FLAG_FREE)      != 0u)
+#define  MEM_SEG_HEAP_BLK_IS_PREV_FREE(p_blk)      (((p_blk)->Size & MEM_SEG_HEAP_BLK_FLAG_PREV_FREE) != 0u)
+
+#define  MEM_SEG_HEAP_BLK_NEXT_GET(p_blk)          ((MEM_SEG_HEAP_BLK *)((CPU_INT08U *)(p_blk) + MEM_SEG_HEAP_BLK_HDR_SIZE + MEM_SEG_HEAP_BLK_SIZE_GET(p_blk)))
+#define  MEM_SEG_HEAP_BLK_TO_MEM(p_blk)            ((void *)((CPU_INT08U *)(p_blk) + MEM_SEG_HEAP_BLK_HDR_SIZE))
+#define  MEM_SEG_HEAP_MEM_TO_BLK(p_mem)            ((MEM_SEG_HEAP_BLK *)((CPU_INT08U *)(p_mem) - MEM_SEG_HEAP_BLK_HDR_SIZE))
+#endif
+
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)                   /* ------------- LOCK-FREE FREE LIST TOPS ------------- */
+                                                                /* See 'Mem_PoolBlkGet()  Note #2'.                     */
+#define  MEM_LF_TAG_INC              ((CPU_ADDR)1u << ((CPU_CFG_ADDR_SIZE * DEF_OCTET_NBR_BITS) / 2u))
+#define  MEM_LF_IX_MSK               (MEM_LF_TAG_INC - 1u)      /* Ix + 1 of first free blk, 0 if none.                 */
+#define  MEM_LF_TOP_NEXT(top, ix)  ((((top) & ~MEM_LF_IX_MSK) + MEM_LF_TAG_INC) | ((ix) & MEM_LF_IX_MSK))
+
+                                                                /* Dyn pool blk ix, in ptr-size units of its seg.       */
+#define  MEM_DYN_POOL_BLK_TO_IX(p_pool, p_blk)  (((CPU_ADDR)(p_blk) / sizeof(void *)) - ((p_pool)->PoolSegPtr->AddrBase / sizeof(void *)) + 1u)
+#define  MEM_DYN_POOL_IX_TO_BLK(p_pool, ix)     ((void *)((((p_pool)->PoolSegPtr->AddrBase / sizeof(void *)) + (ix) - 1u) * sizeof(void *)))
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -97,6 +126,11 @@ MEM_SEG      Mem_SegHeap;                                       /* Heap mem seg.
 
 MEM_SEG     *Mem_SegHeadPtr;                                    /* Ptr to head of seg list.                             */
 
+#if ((LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED) && \
+     (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED))
+MEM_SEG_HEAP  *Mem_SegHeapHeadPtr;                              /* Ptr to head of seg heap list.                        */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -154,6 +188,35 @@ static  CPU_BOOLEAN   Mem_PoolBlkIsValidAddr   (       MEM_POOL      *p_pool,
                                                        void          *p_mem);
 #endif
 
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+static  CPU_BOOLEAN   Mem_CntIncAtomic         (       CPU_SIZE_T    *p_cnt,
+                                                       CPU_SIZE_T     cnt_max);
+
+static  CPU_BOOLEAN   Mem_CntDecAtomic         (       CPU_SIZE_T    *p_cnt);
+#endif
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+static  void          Mem_SegHeapMap               (       CPU_SIZE_T          size,
+                                                           CPU_INT32U         *p_fl,
+                                                           CPU_INT32U         *p_sl);
+
+static  void          Mem_SegHeapBlkInsertCritical (       MEM_SEG_HEAP       *p_heap,
+                                                           MEM_SEG_HEAP_BLK   *p_blk);
+
+static  void          Mem_SegHeapBlkRemoveCritical (       MEM_SEG_HEAP       *p_heap,
+                                                           MEM_SEG_HEAP_BLK   *p_blk);
+
+static  void          Mem_SegHeapBlkTrimCritical   (       MEM_SEG_HEAP       *p_heap,
+                                                           MEM_SEG_HEAP_BLK   *p_blk,
+                                                           CPU_SIZE_T          size);
+#endif
+
+#if ((LIB_MEM_CFG_SEG_HEAP_EN    == DEF_ENABLED) && \
+     (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED))
+static  CPU_BOOLEAN   Mem_SegHeapBlkIsValidAddr    (       MEM_SEG_HEAP       *p_heap,
+                                                           void               *p_mem);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1468,6 +1531,13 @@ void  Mem_PoolCreate (MEM_POOL          *p_pool,
         return;
     }
 
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    if (blk_nbr > MEM_LF_IX_MSK) {                              /* Ix + 1 of each blk must fit in 'BlkFreeTop'.         */
+       *p_err = LIB_MEM_ERR_INVALID_BLK_NBR;
+        return;
+    }
+#endif
+
                                                                 /* Alloc mem for pool.                                  */
     p_pool_mem = (void *)Mem_SegAllocInternal("Unnamed static pool",
                                                p_seg,
@@ -1493,11 +1563,18 @@ void  Mem_PoolCreate (MEM_POOL          *p_pool,
     }
 
                                                                 /* ------------------ INIT BLK LIST ------------------- */
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    for (blk_ix = 0; blk_ix < blk_nbr; blk_ix++) {              /* Link each blk to the prev one: same order as a tbl.  */
+        p_pool->BlkFreeTbl[blk_ix] = (void *)(CPU_ADDR)blk_ix;
+    }
+    (void)p_blk;
+#else
     p_blk = (CPU_INT08U *)p_pool_mem;
     for (blk_ix = 0; blk_ix < blk_nbr; blk_ix++) {
         p_pool->BlkFreeTbl[blk_ix]  = p_blk;
         p_blk                      += blk_size_align;
     }
+#endif
 
 
                                                                 /* ------------------ INIT POOL DATA ------------------ */
@@ -1507,6 +1584,9 @@ void  Mem_PoolCreate (MEM_POOL          *p_pool,
     p_pool->BlkNbr        =  blk_nbr;
     p_pool->BlkSize       =  blk_size_align;
     p_pool->BlkFreeTblIx  =  blk_nbr;
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    p_pool->BlkFreeTop    = (CPU_ADDR)blk_nbr;
+#endif
 }
 #endif
 
@@ -1564,6 +1644,9 @@ void  Mem_PoolClr (MEM_POOL  *p_pool,
     p_pool->BlkNbr        = 0u;
     p_pool->BlkFreeTbl    = DEF_NULL;
     p_pool->BlkFreeTblIx  = 0u;
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    p_pool->BlkFreeTop    = 0u;
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -1595,6 +1678,25 @@ void  Mem_PoolClr (MEM_POOL  *p_pool,
 *
 * Note(s)     : (1) This function is DEPRECATED and will be removed in a future version of this product.
 *                   Mem_DynPoolBlkGet() should be used instead.
+*
+*               (2) With LIB_MEM_CFG_LOCK_FREE_EN, the free lists of the static & dynamic memory pools are
+*                   lock-free (Treiber) stacks, as the memory partitions of uC/OS-III with
+*                   OS_CFG_MEM_LOCK_FREE_EN.  They can be used from tasks & ISRs with interrupts enabled :
+*
+*                   (a) 'BlkFreeTop' holds, in one CPU_ADDR, the index + 1 of the first free block in its
+*                       low half, 0 if none, & a tag in its high half.  It is only changed with CPU_CmpXchg()
+*                       & every change increments the tag.  A get that read the link of a block that was
+*                       meanwhile taken & given back then fails its swap, & starts over (the 'ABA' problem).
+*                       With a 32-bit CPU_ADDR, the tag has 16 bits.
+*
+*                   (b) Links are indexes : a static pool block's link is in 'BlkFreeTbl', a dynamic pool
+*                       block's link is in the block, & its index is its offset in the pool's segment, in
+*                       pointer-size units.  Blocks never go back to their segment, so reading a stale link
+*                       is harmless.
+*
+*                   (c) The block counts, 'BlkFreeTblIx' & 'BlkAllocCnt', are updated with their own
+*                       CPU_CmpXchg() loop : a count that limits the operation is reserved before the free
+*                       list is changed (see LIB_MEM_ERR_POOL_FULL), others are updated after.
 *********************************************************************************************************
 */
 
@@ -1604,7 +1706,12 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
                        LIB_ERR     *p_err)
 {
     CPU_INT08U  *p_blk;
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_ADDR     top;
+    CPU_ADDR     ix;
+#else
     CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE MEM POOL GET --------------- */
@@ -1633,6 +1740,22 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
 
                                                                 /* -------------- GET MEM BLK FROM POOL --------------- */
     p_blk = DEF_NULL;
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    do {                                                        /* Pop first free blk (see Note #2).                    */
+        top = p_pool->BlkFreeTop;
+        ix  = top & MEM_LF_IX_MSK;
+        if (ix == 0u) {
+            break;
+        }
+    } while (CPU_CmpXchg(&p_pool->BlkFreeTop,
+                          top,
+                          MEM_LF_TOP_NEXT(top, (CPU_ADDR)p_pool->BlkFreeTbl[ix - 1u])) == DEF_NO);
+
+    if (ix != 0u) {
+        p_blk = (CPU_INT08U *)p_pool->PoolAddrStart + ((ix - 1u) * p_pool->BlkSize);
+        (void)Mem_CntDecAtomic(&p_pool->BlkFreeTblIx);          /* See Note #2c.                                        */
+    }
+#else
     CPU_CRITICAL_ENTER();
     if (p_pool->BlkFreeTblIx > 0u) {
         p_pool->BlkFreeTblIx                     -=  1u;
@@ -1640,6 +1763,7 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
         p_pool->BlkFreeTbl[p_pool->BlkFreeTblIx]  =  DEF_NULL;
     }
     CPU_CRITICAL_EXIT();
+#endif
 
     if (p_blk == DEF_NULL) {
        *p_err = LIB_MEM_ERR_POOL_EMPTY;
@@ -1678,6 +1802,9 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
 *
 * Note(s)     : (1) This function is DEPRECATED and will be removed in a future version of this product.
 *                   Mem_DynPoolBlkFree() should be used instead.
+*
+*               (2) With LIB_MEM_CFG_LOCK_FREE_EN, see 'Mem_PoolBlkGet()  Note #2'.  The check that the block
+*                   is not already free walks the free list with interrupts disabled.
 *********************************************************************************************************
 */
 
@@ -1690,7 +1817,14 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
     CPU_SIZE_T   tbl_ix;
     CPU_BOOLEAN  addr_valid;
 #endif
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_ADDR     top;
+    CPU_ADDR     ix;
+#endif
+#if ((LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
+     (LIB_MEM_CFG_LOCK_FREE_EN   == DEF_DISABLED))
     CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE MEM POOL FREE -------------- */
@@ -1713,7 +1847,26 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
        *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
         return;
     }
+#endif
+
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    ix = (((CPU_ADDR)p_blk - (CPU_ADDR)p_pool->PoolAddrStart) / p_pool->BlkSize) + 1u;
+#endif
 
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_CRITICAL_ENTER();                                       /* Make sure blk isn't already in free list (Note #2).  */
+    top = p_pool->BlkFreeTop & MEM_LF_IX_MSK;
+    for (tbl_ix = 0u; (tbl_ix < p_pool->BlkNbr) && (top != 0u); tbl_ix++) {
+        if (top == ix) {
+            CPU_CRITICAL_EXIT();
+           *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
+            return;
+        }
+        top = (CPU_ADDR)p_pool->BlkFreeTbl[top - 1u];
+    }
+    CPU_CRITICAL_EXIT();
+#else
     CPU_CRITICAL_ENTER();                                       /* Make sure blk isn't already in free list.            */
     for (tbl_ix = 0u; tbl_ix < p_pool->BlkNbr; tbl_ix++) {
         if (p_pool->BlkFreeTbl[tbl_ix] == p_blk) {
@@ -1722,10 +1875,23 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
             return;
         }
     }
-#else                                                           /* Double-free possibility if not in critical section.  */
+#endif
+#elif (LIB_MEM_CFG_LOCK_FREE_EN == DEF_DISABLED)                /* Double-free possibility if not in critical section.  */
     CPU_CRITICAL_ENTER();
 #endif
                                                                 /* --------------- FREE MEM BLK TO POOL --------------- */
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+                                                                /* Reserve a place (see 'Mem_PoolBlkGet()  Note #2c').  */
+    if (Mem_CntIncAtomic(&p_pool->BlkFreeTblIx, p_pool->BlkNbr) != DEF_OK) {
+       *p_err = LIB_MEM_ERR_POOL_FULL;
+        return;
+    }
+
+    do {                                                        /* Push blk (see 'Mem_PoolBlkGet()  Note #2').          */
+        top                          =  p_pool->BlkFreeTop;
+        p_pool->BlkFreeTbl[ix - 1u]  = (void *)(top & MEM_LF_IX_MSK);
+    } while (CPU_CmpXchg(&p_pool->BlkFreeTop, top, MEM_LF_TOP_NEXT(top, ix)) == DEF_NO);
+#else
     if (p_pool->BlkFreeTblIx >= p_pool->BlkNbr) {
         CPU_CRITICAL_EXIT();
        *p_err = LIB_MEM_ERR_POOL_FULL;
@@ -1735,6 +1901,7 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
     p_pool->BlkFreeTbl[p_pool->BlkFreeTblIx]  = p_blk;
     p_pool->BlkFreeTblIx                     += 1u;
     CPU_CRITICAL_EXIT();
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -1971,7 +2138,8 @@ void  Mem_DynPoolCreateHW (const  CPU_CHAR      *p_name,
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) With LIB_MEM_CFG_LOCK_FREE_EN, see 'Mem_PoolBlkGet()  Note #2'.  Interrupts are only
+*                   disabled to allocate a new block from the pool's segment.
 *********************************************************************************************************
 */
 
@@ -1980,7 +2148,12 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
 {
            void      *p_blk;
     const  CPU_CHAR  *p_pool_name;
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+           CPU_ADDR   top;
+           CPU_ADDR   ix;
+#else
     CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -1994,6 +2167,31 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
     }
 #endif
 
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+                                                                /* Ensure pool is not empty if qty is limited.          */
+    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
+        if (Mem_CntIncAtomic(&p_pool->BlkAllocCnt, p_pool->BlkQtyMax) != DEF_OK) {
+           *p_err = LIB_MEM_ERR_POOL_EMPTY;
+            return (DEF_NULL);
+        }
+    }
+
+                                                                /* --------------- ALLOC FROM FREE LIST --------------- */
+    do {                                                        /* Pop first free blk (see Note #1).                    */
+        top = p_pool->BlkFreeTop;
+        ix  = top & MEM_LF_IX_MSK;
+        if (ix == 0u) {
+            break;
+        }
+        p_blk = MEM_DYN_POOL_IX_TO_BLK(p_pool, ix);
+    } while (CPU_CmpXchg(&p_pool->BlkFreeTop, top, MEM_LF_TOP_NEXT(top, *((CPU_ADDR *)p_blk))) == DEF_NO);
+
+    if (ix != 0u) {
+       *p_err = LIB_MEM_ERR_NONE;
+
+        return (p_blk);
+    }
+#else
                                                                 /* Ensure pool is not empty if qty is limited.          */
     if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
         CPU_CRITICAL_ENTER();
@@ -2020,6 +2218,7 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
         return (p_blk);
     }
     CPU_CRITICAL_EXIT();
+#endif
 
                                                                 /* ------------------ ALLOC NEW BLK ------------------- */
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
@@ -2036,7 +2235,11 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
                                  p_err);
     if (*p_err != LIB_MEM_ERR_NONE) {
         if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+            (void)Mem_CntDecAtomic(&p_pool->BlkAllocCnt);
+#else
             p_pool->BlkAllocCnt--;
+#endif
         }
         return (DEF_NULL);
     }
@@ -2065,7 +2268,7 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) With LIB_MEM_CFG_LOCK_FREE_EN, see 'Mem_PoolBlkGet()  Note #2'.
 *********************************************************************************************************
 */
 
@@ -2073,7 +2276,12 @@ void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
                           void          *p_blk,
                           LIB_ERR       *p_err)
 {
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_ADDR  top;
+    CPU_ADDR  ix;
+#else
     CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -2092,6 +2300,20 @@ void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
     }
 #endif
 
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {       /* Ensure pool is not full.                             */
+        if (Mem_CntDecAtomic(&p_pool->BlkAllocCnt) != DEF_OK) {
+           *p_err = LIB_MEM_ERR_POOL_FULL;
+            return;
+        }
+    }
+
+    ix = MEM_DYN_POOL_BLK_TO_IX(p_pool, p_blk);
+    do {                                                        /* Push blk (see Note #1).                              */
+        top                 = p_pool->BlkFreeTop;
+       *((CPU_ADDR *)p_blk) = top & MEM_LF_IX_MSK;
+    } while (CPU_CmpXchg(&p_pool->BlkFreeTop, top, MEM_LF_TOP_NEXT(top, ix)) == DEF_NO);
+#else
     if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {       /* Ensure pool is not full.                             */
         CPU_CRITICAL_ENTER();
         if (p_pool->BlkAllocCnt == 0u) {
@@ -2109,6 +2331,7 @@ void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
    *((void **)p_blk)   = p_pool->BlkFreePtr;
     p_pool->BlkFreePtr = p_blk;
     CPU_CRITICAL_EXIT();
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -2174,39 +2397,57 @@ CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
 
 /*
 *********************************************************************************************************
-*                                           Mem_OutputUsage()
+*                                          Mem_SegHeapCreate()
 *
-* Description : Outputs memory usage report through 'out_fnct'.
+* Description : Creates a segment heap : a general-purpose allocator, with free support, that manages a
+*               block of memory allocated from a memory segment (see 'lib_mem.h  SEGMENT HEAP DATA TYPES').
 *
-* Argument(s) : out_fnct        Pointer to output function.
+* Argument(s) : p_name          Pointer to heap name.
 *
-*               print_details   DEF_YES, if the size of each allocation should be printed.
-*                               DEF_NO,  otherwise.
+*               p_heap          Pointer to heap data.
+*
+*               p_seg           Pointer to segment from which to allocate memory. Will be allocated from
+*                               general-purpose heap if null.
+*
+*               size            Size of memory to allocate from the segment, in bytes. 0 to allocate all the
+*                               memory left in the segment. See Note #1.
 *
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *
 *                                   LIB_MEM_ERR_NONE                Operation was successful.
-*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*                                   LIB_MEM_ERR_NULL_PTR            Heap data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_SEG_SIZE    Invalid size specified.
 *
-*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
-*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
-*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*                                   ----------------------RETURNED BY Mem_SegAllocInternal()-----------------------
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
+*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                                   LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
+*                                   LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
 *
 * Return(s)   : None.
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) 'size' is rounded down to LIB_MEM_SEG_HEAP_ALIGN and limited to the largest block the
+*                   heap can manage (see 'lib_mem.h  SEGMENT HEAP CONFIGURATION  Note #2'), plus the block
+*                   headers.  Two block headers are used by the heap itself.
 *********************************************************************************************************
 */
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
-                      LIB_ERR   *p_err)
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+void  Mem_SegHeapCreate (const  CPU_CHAR      *p_name,
+                                MEM_SEG_HEAP  *p_heap,
+                                MEM_SEG       *p_seg,
+                                CPU_SIZE_T     size,
+                                LIB_ERR       *p_err)
 {
-    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
-    MEM_SEG   *p_seg;
+    MEM_SEG_HEAP_BLK  *p_blk;
+    MEM_SEG_HEAP_BLK  *p_blk_end;
+    CPU_INT32U         fl;
+    CPU_INT32U         sl;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
     CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -2214,79 +2455,82 @@ void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
         CPU_SW_EXCEPTION(;);
     }
 
-    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+    if (p_heap == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
        *p_err = LIB_MEM_ERR_NULL_PTR;
         return;
     }
 #endif
 
-    out_fnct((CPU_CHAR *)"---------------- Memory allocation info ----------------\r\n");
-    out_fnct((CPU_CHAR *)"| Type    | Size       | Free size  | Name\r\n");
-    out_fnct((CPU_CHAR *)"|---------|------------|------------|-------------------\r\n");
-
-    CPU_CRITICAL_ENTER();
-    p_seg = Mem_SegHeadPtr;
-    while (p_seg != DEF_NULL) {
-        CPU_SIZE_T       rem_size;
-        MEM_SEG_INFO     seg_info;
-        MEM_ALLOC_INFO  *p_alloc;
-
+    if (p_seg == DEF_NULL) {                                    /* Alloc from heap if p_seg is null.                    */
+#if (LIB_MEM_CFG_HEAP_SIZE > 0u)
+        p_seg = &Mem_SegHeap;
+#else
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+#endif
+    }
 
-        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
+    if (size == 0u) {                                           /* Take all the mem left in the seg.                    */
+        size = Mem_SegRemSizeGet(p_seg, LIB_MEM_SEG_HEAP_ALIGN, DEF_NULL, p_err);
         if (*p_err != LIB_MEM_ERR_NONE) {
             return;
         }
+    }
+                                                                /* See Note #1.                                         */
+    size &= ~((CPU_SIZE_T)LIB_MEM_SEG_HEAP_ALIGN - 1u);
+    if (size < ((2u * MEM_SEG_HEAP_BLK_HDR_SIZE) + MEM_SEG_HEAP_BLK_SIZE_MIN)) {
+       *p_err = LIB_MEM_ERR_INVALID_SEG_SIZE;
+        return;
+    }
+    if (size > ((2u * MEM_SEG_HEAP_BLK_HDR_SIZE) + MEM_SEG_HEAP_BLK_SIZE_MAX)) {
+        size = (2u * MEM_SEG_HEAP_BLK_HDR_SIZE) + MEM_SEG_HEAP_BLK_SIZE_MAX;
+    }
 
-        out_fnct((CPU_CHAR *)"| Section | ");
-
-        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
-
-        out_fnct(str);
-        out_fnct((CPU_CHAR *)" | ");
-
-        (void)Str_FmtNbr_Int32U(rem_size,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
-
-        out_fnct(str);
-        out_fnct((CPU_CHAR *)" | ");
-        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
-        out_fnct((CPU_CHAR *)"\r\n");
+    p_blk = (MEM_SEG_HEAP_BLK *)Mem_SegAllocInternal(p_name,
+                                                     p_seg,
+                                                     size,
+                                                     LIB_MEM_SEG_HEAP_ALIGN,
+                                                     LIB_MEM_PADDING_ALIGN_NONE,
+                                                     DEF_NULL,
+                                                     p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
 
-        p_alloc = p_seg->AllocInfoHeadPtr;
-        while (p_alloc != DEF_NULL) {
-            out_fnct((CPU_CHAR *)"| -> Obj  | ");
+    for (fl = 0u; fl < LIB_MEM_SEG_HEAP_FL_NBR; fl++) {         /* Init free lists.                                     */
+        for (sl = 0u; sl < LIB_MEM_SEG_HEAP_SL_NBR; sl++) {
+            p_heap->FreeTbl[fl][sl] = DEF_NULL;
+        }
+        p_heap->FreeBitmapSL[fl] = 0u;
+    }
+    p_heap->FreeBitmapFL = 0u;
 
-            (void)Str_FmtNbr_Int32U(p_alloc->Size,
-                                    10u,
-                                    DEF_NBR_BASE_DEC,
-                                    ' ',
-                                    DEF_NO,
-                                    DEF_YES,
-                                   &str[0u]);
+                                                                /* One free blk followed by a used, empty end blk.      */
+    p_blk->PrevPhysPtr   =  DEF_NULL;
+    p_blk->Size          = (size - (2u * MEM_SEG_HEAP_BLK_HDR_SIZE)) | MEM_SEG_HEAP_BLK_FLAG_FREE;
+    p_blk_end            =  MEM_SEG_HEAP_BLK_NEXT_GET(p_blk);
+    p_blk_end->PrevPhysPtr = p_blk;
+    p_blk_end->Size        = MEM_SEG_HEAP_BLK_FLAG_PREV_FREE;
 
-            out_fnct(str);
-            out_fnct((CPU_CHAR *)" |            | ");
+    p_heap->AddrBase     = (CPU_ADDR)p_blk;
+    p_heap->AddrEnd      = (CPU_ADDR)p_blk_end;
+    p_heap->TotalSize    =  size - MEM_SEG_HEAP_BLK_HDR_SIZE;
+    p_heap->UsedSize     =  0u;
+    p_heap->UsedSizeMax  =  0u;
+    p_heap->UsedBlkNbr   =  0u;
+    p_heap->FreeBlkNbr   =  0u;
+    p_heap->AllocFailCtr =  0u;
 
-            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
-            out_fnct((CPU_CHAR *)"\r\n");
+    Mem_SegHeapBlkInsertCritical(p_heap, p_blk);                /* Heap not yet shared, no critical section needed.     */
 
-            p_alloc = p_alloc->NextPtr;
-        }
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_heap->NamePtr = p_name;
 
-        p_seg = p_seg->NextPtr;
-    }
+    CPU_CRITICAL_ENTER();                                       /* Add heap to list, see Mem_OutputUsage().             */
+    p_heap->NextPtr    = Mem_SegHeapHeadPtr;
+    Mem_SegHeapHeadPtr = p_heap;
     CPU_CRITICAL_EXIT();
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -2295,69 +2539,660 @@ void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
-*********************************************************************************************************
-*/
-
-/*
-*********************************************************************************************************
-*                                       Mem_SegCreateCritical()
-*
-* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+*                                          Mem_SegHeapAlloc()
 *
-* Argument(s) : p_name          Pointer to segment name.
+* Description : Allocates a memory block from a segment heap.
 *
-*               p_seg           Pointer to segment data. Must be allocated by caller.
-*               -----           Argument validated by caller.
+* Argument(s) : p_heap  Pointer to heap data.
 *
-*               seg_base_addr   Segment's first byte address.
+*               size    Size of memory block to allocate, in bytes.
 *
-*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
-*                               from this memory segment. MUST be a power of 2.
-*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
-*               -------------   Argument validated by caller.
+*               p_err   Pointer to variable that will receive the return error code from this function :
 *
-*               size            Total size of segment, in bytes.
-*               ----            Argument validated by caller.
+*                           LIB_MEM_ERR_NONE                Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR            Heap data pointer NULL.
+*                           LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                           LIB_MEM_ERR_HEAP_EMPTY          No free block large enough in heap.
 *
-* Return(s)   : Pointer to segment data, if successful.
+* Return(s)   : Pointer to memory block, aligned on LIB_MEM_SEG_HEAP_ALIGN, if successful.
 *
 *               DEF_NULL, otherwise.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegCreate().
+* Caller(s)   : Application,
+*               Mem_SegHeapRealloc().
 *
-* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+* Note(s)     : (1) The request is rounded up to the next second level size class, so that the head of the
+*                   first non-empty list found is always large enough (good-fit).  The search is two bit
+*                   scans, independent of the number of free blocks.
+*
+*               (2) When no larger class has a free block, the head of the request's own class may still be
+*                   large enough, e.g. for a request of the size of the largest free block.
 *********************************************************************************************************
 */
 
-static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
-                                           MEM_SEG     *p_seg,
-                                           CPU_ADDR     seg_base_addr,
-                                           CPU_SIZE_T   padding_align,
-                                           CPU_SIZE_T   size)
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+void  *Mem_SegHeapAlloc (MEM_SEG_HEAP  *p_heap,
+                         CPU_SIZE_T     size,
+                         LIB_ERR       *p_err)
 {
-    p_seg->AddrBase         =  seg_base_addr;
-    p_seg->AddrEnd          = (seg_base_addr + (size - 1u));
-    p_seg->AddrNext         =  seg_base_addr;
-    p_seg->NextPtr          =  Mem_SegHeadPtr;
-    p_seg->PaddingAlign     =  padding_align;
+    MEM_SEG_HEAP_BLK  *p_blk;
+    MEM_SEG_HEAP_BLK  *p_blk_next;
+    CPU_SIZE_T         size_search;
+    CPU_INT32U         fl;
+    CPU_INT32U         sl;
+    CPU_INT32U         map;
+    CPU_SR_ALLOC();
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-    p_seg->NamePtr          = p_name;
-    p_seg->AllocInfoHeadPtr = DEF_NULL;
-#else
-    (void)p_name;
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_heap == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
 #endif
 
-    Mem_SegHeadPtr = p_seg;
-}
+    if ((size < 1u) ||
+        (size > MEM_SEG_HEAP_BLK_SIZE_MAX)) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
 
+    size        = MATH_ROUND_INC_UP_PWR2(size, LIB_MEM_SEG_HEAP_ALIGN);
+    size_search = size;
+    if (size_search >= ((CPU_SIZE_T)1u << LIB_MEM_SEG_HEAP_FL_SHIFT)) {     /* See Note #1.                             */
+        size_search += ((CPU_SIZE_T)1u << ((31u - CPU_CntLeadZeros32((CPU_INT32U)size_search)) - LIB_MEM_SEG_HEAP_SL_LOG2)) - 1u;
+    }
+    Mem_SegHeapMap(size_search, &fl, &sl);
 
-/*
-*********************************************************************************************************
+    CPU_CRITICAL_ENTER();
+    p_blk = DEF_NULL;
+    map   = p_heap->FreeBitmapSL[fl] & (DEF_INT_32U_MAX_VAL << sl);
+    if (map == 0u) {                                            /* No blk in this FL : take the next non-empty FL.      */
+        map = p_heap->FreeBitmapFL & (DEF_INT_32U_MAX_VAL << (fl + 1u));
+        if (map != 0u) {
+            fl  = (CPU_INT32U)CPU_CntTrailZeros32(map);
+            map =  p_heap->FreeBitmapSL[fl];
+        } else {                                                /* See Note #2.                                         */
+            Mem_SegHeapMap(size, &fl, &sl);
+            p_blk = p_heap->FreeTbl[fl][sl];
+            if ((p_blk                              == DEF_NULL) ||
+                (MEM_SEG_HEAP_BLK_SIZE_GET(p_blk) <  size)) {
+                p_heap->AllocFailCtr++;
+                CPU_CRITICAL_EXIT();
+               *p_err = LIB_MEM_ERR_HEAP_EMPTY;
+                return (DEF_NULL);
+            }
+        }
+    }
+    if (p_blk == DEF_NULL) {
+        sl    = (CPU_INT32U)CPU_CntTrailZeros32(map);
+        p_blk =  p_heap->FreeTbl[fl][sl];
+    }
+
+    Mem_SegHeapBlkRemoveCritical(p_heap, p_blk);
+    p_blk->Size &= ~(CPU_SIZE_T)MEM_SEG_HEAP_BLK_FLAG_FREE;
+    Mem_SegHeapBlkTrimCritical(p_heap, p_blk, size);            /* Return the tail of the blk to the heap.              */
+
+    p_blk_next        =  MEM_SEG_HEAP_BLK_NEXT_GET(p_blk);
+    p_blk_next->Size &= ~(CPU_SIZE_T)MEM_SEG_HEAP_BLK_FLAG_PREV_FREE;
+
+    p_heap->UsedSize += MEM_SEG_HEAP_BLK_HDR_SIZE + MEM_SEG_HEAP_BLK_SIZE_GET(p_blk);
+    if (p_heap->UsedSizeMax < p_heap->UsedSize) {
+        p_heap->UsedSizeMax = p_heap->UsedSize;
+    }
+    p_heap->UsedBlkNbr++;
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (MEM_SEG_HEAP_BLK_TO_MEM(p_blk));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_SegHeapFree()
+*
+* Description : Frees a memory block allocated from a segment heap, merging it with its free neighbours.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*
+*               p_mem   Pointer to memory block, as returned by Mem_SegHeapAlloc() or Mem_SegHeapRealloc().
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                        Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                    'p_heap' or 'p_mem' pointer passed is NULL.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR            'p_mem' is not a block of this heap.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL    Block already free.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application,
+*               Mem_SegHeapRealloc().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+void  Mem_SegHeapFree (MEM_SEG_HEAP  *p_heap,
+                       void          *p_mem,
+                       LIB_ERR       *p_err)
+{
+    MEM_SEG_HEAP_BLK  *p_blk;
+    MEM_SEG_HEAP_BLK  *p_blk_prev;
+    MEM_SEG_HEAP_BLK  *p_blk_next;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_heap == DEF_NULL) ||
+        (p_mem  == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (Mem_SegHeapBlkIsValidAddr(p_heap, p_mem) != DEF_YES) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return;
+    }
+#endif
+
+    p_blk = MEM_SEG_HEAP_MEM_TO_BLK(p_mem);
+
+    CPU_CRITICAL_ENTER();
+    if (MEM_SEG_HEAP_BLK_IS_FREE(p_blk)) {                      /* Chk for double free.                                 */
+        CPU_CRITICAL_EXIT();
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
+        return;
+    }
+
+    p_heap->UsedSize -= MEM_SEG_HEAP_BLK_HDR_SIZE + MEM_SEG_HEAP_BLK_SIZE_GET(p_blk);
+    p_heap->UsedBlkNbr--;
+
+    p_blk->Size |= MEM_SEG_HEAP_BLK_FLAG_FREE;
+    if (MEM_SEG_HEAP_BLK_IS_PREV_FREE(p_blk)) {                 /* Merge with prev blk.                                 */
+        p_blk_prev        = p_blk->PrevPhysPtr;
+        Mem_SegHeapBlkRemoveCritical(p_heap, p_blk_prev);
+        p_blk_prev->Size += MEM_SEG_HEAP_BLK_HDR_SIZE + MEM_SEG_HEAP_BLK_SIZE_GET(p_blk);
+        p_blk             = p_blk_prev;
+    }
+
+    p_blk_next = MEM_SEG_HEAP_BLK_NEXT_GET(p_blk);
+    if (MEM_SEG_HEAP_BLK_IS_FREE(p_blk_next)) {                 /* Merge with next blk.                                 */
+        Mem_SegHeapBlkRemoveCritical(p_heap, p_blk_next);
+        p_blk->Size += MEM_SEG_HEAP_BLK_HDR_SIZE + MEM_SEG_HEAP_BLK_SIZE_GET(p_blk_next);
+        p_blk_next   = MEM_SEG_HEAP_BLK_NEXT_GET(p_blk);
+    }
+    p_blk_next->PrevPhysPtr  = p_blk;
+    p_blk_next->Size        |= MEM_SEG_HEAP_BLK_FLAG_PREV_FREE;
+
+    Mem_SegHeapBlkInsertCritical(p_heap, p_blk);
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SegHeapRealloc()
+*
+* Description : Resizes a memory block allocated from a segment heap.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*
+*               p_mem   Pointer to memory block to resize. DEF_NULL to allocate a new block.
+*
+*               size    New size of memory block, in bytes. 0 to free the block.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                        Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                    Heap data pointer NULL.
+*                           LIB_MEM_ERR_INVALID_MEM_SIZE            Invalid memory block size specified.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR            'p_mem' is not a block of this heap.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL    Block is free.
+*
+*                           -----------------------RETURNED BY Mem_SegHeapAlloc()-----------------------
+*                           LIB_MEM_ERR_HEAP_EMPTY                  No free block large enough in heap.
+*
+* Return(s)   : Pointer to resized memory block, if successful. Its content is preserved up to the smaller
+*               of the old and new sizes.
+*
+*               DEF_NULL, otherwise. The original block is left untouched.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The block is resized in place when it shrinks, or when it grows into a free next
+*                   block.  Otherwise, a new block is allocated and the data copied outside of the
+*                   critical section.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+void  *Mem_SegHeapRealloc (MEM_SEG_HEAP  *p_heap,
+                           void          *p_mem,
+                           CPU_SIZE_T     size,
+                           LIB_ERR       *p_err)
+{
+    MEM_SEG_HEAP_BLK  *p_blk;
+    MEM_SEG_HEAP_BLK  *p_blk_next;
+    CPU_SIZE_T         size_cur;
+    void              *p_mem_new;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_heap == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+
+    if ((p_mem                                    != DEF_NULL) &&
+        (Mem_SegHeapBlkIsValidAddr(p_heap, p_mem) != DEF_YES)) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return (DEF_NULL);
+    }
+#endif
+
+    if (p_mem == DEF_NULL) {
+        return (Mem_SegHeapAlloc(p_heap, size, p_err));
+    }
+    if (size == 0u) {
+        Mem_SegHeapFree(p_heap, p_mem, p_err);
+        return (DEF_NULL);
+    }
+    if (size > MEM_SEG_HEAP_BLK_SIZE_MAX) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+
+    size  = MATH_ROUND_INC_UP_PWR2(size, LIB_MEM_SEG_HEAP_ALIGN);
+    p_blk = MEM_SEG_HEAP_MEM_TO_BLK(p_mem);
+
+    CPU_CRITICAL_ENTER();
+    if (MEM_SEG_HEAP_BLK_IS_FREE(p_blk)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
+        return (DEF_NULL);
+    }
+
+    size_cur = MEM_SEG_HEAP_BLK_SIZE_GET(p_blk);
+    if (size > size_cur) {
+        p_blk_next = MEM_SEG_HEAP_BLK_NEXT_GET(p_blk);
+        if ((MEM_SEG_HEAP_BLK_IS_FREE(p_blk_next) == DEF_NO) ||
+            ((size_cur + MEM_SEG_HEAP_BLK_HDR_SIZE + MEM_SEG_HEAP_BLK_SIZE_GET(p_blk_next)) < size)) {
+            CPU_CRITICAL_EXIT();
+                                                                /* Cannot grow in place : move the data (see Note #1).  */
+            p_mem_new = Mem_SegHeapAlloc(p_heap, size, p_err);
+            if (*p_err != LIB_MEM_ERR_NONE) {
+                return (DEF_NULL);
+            }
+            Mem_Copy(p_mem_new, p_mem, size_cur);
+            Mem_SegHeapFree(p_heap, p_mem, p_err);
+
+            return (p_mem_new);
+        }
+                                                                /* Grow into the next blk.                              */
+        Mem_SegHeapBlkRemoveCritical(p_heap, p_blk_next);
+        p_blk->Size      += MEM_SEG_HEAP_BLK_HDR_SIZE + MEM_SEG_HEAP_BLK_SIZE_GET(p_blk_next);
+        p_blk_next        = MEM_SEG_HEAP_BLK_NEXT_GET(p_blk);
+        p_blk_next->PrevPhysPtr = p_blk;
+        p_blk_next->Size &= ~(CPU_SIZE_T)MEM_SEG_HEAP_BLK_FLAG_PREV_FREE;
+    }
+
+    Mem_SegHeapBlkTrimCritical(p_heap, p_blk, size);
+
+    p_heap->UsedSize += MEM_SEG_HEAP_BLK_SIZE_GET(p_blk);
+    p_heap->UsedSize -= size_cur;
+    if (p_heap->UsedSizeMax < p_heap->UsedSize) {
+        p_heap->UsedSizeMax = p_heap->UsedSize;
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_mem);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_SegHeapRemSizeGet()
+*
+* Description : Gets free size and usage statistics of a segment heap.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*
+*               p_info  Pointer to structure that will receive further heap info data (used size, peak used
+*                       size, largest free block, fragmentation). DEF_NULL if none.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR            Heap data pointer NULL.
+*
+* Return(s)   : Free size of the heap, block headers included, in bytes.
+*
+* Caller(s)   : Application,
+*               Mem_OutputUsage().
+*
+* Note(s)     : (1) The largest free block is searched in the highest non-empty free list only, whose
+*                   length is NOT bounded.  Do not call from time critical code.
+*
+*               (2) The fragmentation is the part of the free size that is NOT in the largest free block :
+*                   0% when all the free memory is contiguous.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+CPU_SIZE_T  Mem_SegHeapRemSizeGet (MEM_SEG_HEAP       *p_heap,
+                                   MEM_SEG_HEAP_INFO  *p_info,
+                                   LIB_ERR            *p_err)
+{
+    MEM_SEG_HEAP_BLK  *p_blk;
+    CPU_SIZE_T         rem_size;
+    CPU_SIZE_T         blk_size_max;
+    CPU_INT32U         fl;
+    CPU_INT32U         sl;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(0u);
+    }
+
+    if (p_heap == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    rem_size = p_heap->TotalSize - p_heap->UsedSize;
+
+    if (p_info != DEF_NULL) {
+        blk_size_max = 0u;
+        if (p_heap->FreeBitmapFL != 0u) {                       /* Largest blk is in the highest list (see Note #1).    */
+            fl    = 31u - (CPU_INT32U)CPU_CntLeadZeros32(p_heap->FreeBitmapFL);
+            sl    = 31u - (CPU_INT32U)CPU_CntLeadZeros32(p_heap->FreeBitmapSL[fl]);
+            p_blk = p_heap->FreeTbl[fl][sl];
+            while (p_blk != DEF_NULL) {
+                if (blk_size_max < MEM_SEG_HEAP_BLK_SIZE_GET(p_blk)) {
+                    blk_size_max = MEM_SEG_HEAP_BLK_SIZE_GET(p_blk);
+                }
+                p_blk = p_blk->NextFreePtr;
+            }
+        }
+
+        p_info->TotalSize      = p_heap->TotalSize;
+        p_info->UsedSize       = p_heap->UsedSize;
+        p_info->UsedSizeMax    = p_heap->UsedSizeMax;
+        p_info->FreeBlkSizeMax = blk_size_max;
+        p_info->UsedBlkNbr     = p_heap->UsedBlkNbr;
+        p_info->FreeBlkNbr     = p_heap->FreeBlkNbr;
+        p_info->AllocFailCtr   = p_heap->AllocFailCtr;
+        if (rem_size == 0u) {                                   /* See Note #2.                                         */
+            p_info->FragPct = 0u;
+        } else {
+            p_info->FragPct = (CPU_INT08U)(100u - (((CPU_INT64U)(blk_size_max + MEM_SEG_HEAP_BLK_HDR_SIZE) * 100u) / rem_size));
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (rem_size);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_OutputUsage()
+*
+* Description : Outputs memory usage report through 'out_fnct'.
+*
+* Argument(s) : out_fnct        Pointer to output function.
+*
+*               print_details   DEF_YES, if the size of each allocation should be printed.
+*                               DEF_NO,  otherwise.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*
+*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
+*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Segment heaps follow the segments, each with a second line giving its peak used size,
+*                   its largest free block & its fragmentation (see Mem_SegHeapRemSizeGet()).
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
+                      LIB_ERR   *p_err)
+{
+    CPU_CHAR       str[DEF_INT_32U_NBR_DIG_MAX];
+    MEM_SEG       *p_seg;
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+    MEM_SEG_HEAP  *p_heap;
+#endif
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    out_fnct((CPU_CHAR *)"---------------- Memory allocation info ----------------\r\n");
+    out_fnct((CPU_CHAR *)"| Type    | Size       | Free size  | Name\r\n");
+    out_fnct((CPU_CHAR *)"|---------|------------|------------|-------------------\r\n");
+
+    CPU_CRITICAL_ENTER();
+    p_seg = Mem_SegHeadPtr;
+    while (p_seg != DEF_NULL) {
+        CPU_SIZE_T       rem_size;
+        MEM_SEG_INFO     seg_info;
+        MEM_ALLOC_INFO  *p_alloc;
+
+
+        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+
+        out_fnct((CPU_CHAR *)"| Section | ");
+
+        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+
+        (void)Str_FmtNbr_Int32U(rem_size,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct((CPU_CHAR *)"\r\n");
+
+        p_alloc = p_seg->AllocInfoHeadPtr;
+        while (p_alloc != DEF_NULL) {
+            out_fnct((CPU_CHAR *)"| -> Obj  | ");
+
+            (void)Str_FmtNbr_Int32U(p_alloc->Size,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)" |            | ");
+
+            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
+            out_fnct((CPU_CHAR *)"\r\n");
+
+            p_alloc = p_alloc->NextPtr;
+        }
+
+        p_seg = p_seg->NextPtr;
+    }
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)                    /* Seg heaps : size, free size, peak & frag.            */
+    p_heap = Mem_SegHeapHeadPtr;
+    while (p_heap != DEF_NULL) {
+        CPU_SIZE_T         rem_size;
+        MEM_SEG_HEAP_INFO  heap_info;
+
+
+        rem_size = Mem_SegHeapRemSizeGet(p_heap, &heap_info, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+
+        out_fnct((CPU_CHAR *)"| Heap    | ");
+        (void)Str_FmtNbr_Int32U(heap_info.TotalSize, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        (void)Str_FmtNbr_Int32U(rem_size,            10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        out_fnct((p_heap->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_heap->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct((CPU_CHAR *)"\r\n");
+
+        out_fnct((CPU_CHAR *)"| -> Peak | ");                  /* Peak used size, largest free blk & frag.             */
+        (void)Str_FmtNbr_Int32U(heap_info.UsedSizeMax,    10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        (void)Str_FmtNbr_Int32U(heap_info.FreeBlkSizeMax, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | Largest free blk, ");
+        (void)Str_FmtNbr_Int32U(heap_info.FragPct,         3u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)"% fragmented\r\n");
+
+        p_heap = p_heap->NextPtr;
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       Mem_SegCreateCritical()
+*
+* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+*
+* Argument(s) : p_name          Pointer to segment name.
+*
+*               p_seg           Pointer to segment data. Must be allocated by caller.
+*               -----           Argument validated by caller.
+*
+*               seg_base_addr   Segment's first byte address.
+*
+*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
+*                               from this memory segment. MUST be a power of 2.
+*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
+*               -------------   Argument validated by caller.
+*
+*               size            Total size of segment, in bytes.
+*               ----            Argument validated by caller.
+*
+* Return(s)   : Pointer to segment data, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegCreate().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
+                                           MEM_SEG     *p_seg,
+                                           CPU_ADDR     seg_base_addr,
+                                           CPU_SIZE_T   padding_align,
+                                           CPU_SIZE_T   size)
+{
+    p_seg->AddrBase         =  seg_base_addr;
+    p_seg->AddrEnd          = (seg_base_addr + (size - 1u));
+    p_seg->AddrNext         =  seg_base_addr;
+    p_seg->NextPtr          =  Mem_SegHeadPtr;
+    p_seg->PaddingAlign     =  padding_align;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_seg->NamePtr          = p_name;
+    p_seg->AllocInfoHeadPtr = DEF_NULL;
+#else
+    (void)p_name;
+#endif
+
+    Mem_SegHeadPtr = p_seg;
+}
+
+
+/*
+*********************************************************************************************************
 *                                      Mem_SegOverlapChkCritical()
 *
 * Description : Checks if existing memory segment exists or overlaps with specified memory area.
@@ -2714,6 +3549,10 @@ static  void  Mem_SegAllocTrackCritical (const  CPU_CHAR    *p_name,
 *
 * Note(s)     : (1) 'blk_size' must be big enough to fit a pointer since the pointer to the next free
 *                   block is stored in the block itself (only when free/unused).
+*
+*               (2) With LIB_MEM_CFG_LOCK_FREE_EN, blocks are aligned on at least a pointer, and the
+*                   segment must be small enough for the index of each of its pointers to fit in the low
+*                   half of a CPU_ADDR (see 'Mem_PoolBlkGet()  Note #2b').
 *********************************************************************************************************
 */
 
@@ -2731,6 +3570,9 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
     CPU_SIZE_T   seg_size;
     CPU_SIZE_T   blk_size_align;
     CPU_SIZE_T   blk_align_worst = DEF_MAX(blk_align, blk_padding_align);
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    MEM_SEG     *p_seg_pool;
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -2760,6 +3602,27 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
     }
 #endif
 
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+#if (LIB_MEM_CFG_HEAP_SIZE > 0u)
+    p_seg_pool = ((p_seg != DEF_NULL) ? p_seg : &Mem_SegHeap);
+#else
+    p_seg_pool =   p_seg;
+#endif
+    if (p_seg_pool == DEF_NULL) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+                                                                /* Chk that every blk ix fits (see Note #2).            */
+    if (((p_seg_pool->AddrEnd / sizeof(void *)) - (p_seg_pool->AddrBase / sizeof(void *)) + 1u) > MEM_LF_IX_MSK) {
+       *p_err = LIB_MEM_ERR_INVALID_SEG_SIZE;
+        return;
+    }
+
+    blk_align_worst    = DEF_MAX(blk_align_worst, sizeof(void *));
+    blk_size           = DEF_MAX(blk_size,        sizeof(void *));
+    p_pool->PoolSegPtr = p_seg_pool;                            /* Needed by MEM_DYN_POOL_BLK_TO_IX().                  */
+#endif
+
                                                                 /* Calc blk size with align.                            */
     if (blk_size < sizeof(void *)) {                            /* If size if smaller than ptr ...                      */
                                                                 /* ... inc size to ptr size.                            */
@@ -2790,6 +3653,17 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
         }
 
                                                                 /* ----------------- CREATE POOL DATA ----------------- */
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)                   /* Init free list, linked by ix.                        */
+        p_pool->BlkFreeTop = MEM_DYN_POOL_BLK_TO_IX(p_pool, p_blks);
+        for (i = 0u; i < blk_qty_init - 1u; i++) {
+           *((CPU_ADDR *)p_blks)  = MEM_DYN_POOL_BLK_TO_IX(p_pool, p_blks + blk_size_align);
+            p_blks               += blk_size_align;
+        }
+       *((CPU_ADDR *)p_blks) = 0u;
+    } else {
+        p_pool->BlkFreeTop = 0u;
+    }
+#else
                                                                 /* Init free list.                                      */
         p_pool->BlkFreePtr = (void *)p_blks;
         for (i = 0u; i < blk_qty_init - 1u; i++) {
@@ -2800,6 +3674,7 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
     } else {
         p_pool->BlkFreePtr = DEF_NULL;
     }
+#endif
 
 #if (LIB_MEM_CFG_HEAP_SIZE > 0u)
     p_pool->PoolSegPtr      = ((p_seg != DEF_NULL) ? p_seg : &Mem_SegHeap);
@@ -2863,3 +3738,339 @@ static  CPU_BOOLEAN  Mem_PoolBlkIsValidAddr (MEM_POOL  *p_pool,
     }
 }
 #endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_SegHeapMap()
+*
+* Description : Calculates the first & second level indexes of the free list of a segment heap block size.
+*
+* Argument(s) : size    Block size, in bytes. MUST be a multiple of LIB_MEM_SEG_HEAP_ALIGN & NOT exceed
+*                       MEM_SEG_HEAP_BLK_SIZE_MAX.
+*
+*               p_fl    Pointer to variable that will receive the first  level index.
+*
+*               p_sl    Pointer to variable that will receive the second level index.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_SegHeapAlloc(),
+*               Mem_SegHeapBlkInsertCritical(),
+*               Mem_SegHeapBlkRemoveCritical().
+*
+* Note(s)     : (1) Blocks smaller than (1 << LIB_MEM_SEG_HEAP_FL_SHIFT) are all in first level 0, in second
+*                   level lists of LIB_MEM_SEG_HEAP_ALIGN octets each.  Larger blocks are in the first level of
+*                   their most significant bit, and in the second level given by the next
+*                   LIB_MEM_SEG_HEAP_SL_LOG2 bits.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+static  void  Mem_SegHeapMap (CPU_SIZE_T   size,
+                              CPU_INT32U  *p_fl,
+                              CPU_INT32U  *p_sl)
+{
+    CPU_INT32U  size_32;
+    CPU_INT32U  msb;
+
+
+    size_32 = (CPU_INT32U)size;
+    if (size_32 < (1u << LIB_MEM_SEG_HEAP_FL_SHIFT)) {         /* See Note #1.                                         */
+       *p_fl = 0u;
+       *p_sl = size_32 >> LIB_MEM_SEG_HEAP_ALIGN_LOG2;
+    } else {
+        msb   =  31u - (CPU_INT32U)CPU_CntLeadZeros32(size_32);
+       *p_fl  =  msb - (LIB_MEM_SEG_HEAP_FL_SHIFT - 1u);
+       *p_sl  = (size_32 >> (msb - LIB_MEM_SEG_HEAP_SL_LOG2)) - LIB_MEM_SEG_HEAP_SL_NBR;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    Mem_SegHeapBlkInsertCritical()
+*
+* Description : Inserts a free block at the head of its segment heap free list.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to free block.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_SegHeapCreate(),
+*               Mem_SegHeapFree(),
+*               Mem_SegHeapBlkTrimCritical().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+static  void  Mem_SegHeapBlkInsertCritical (MEM_SEG_HEAP      *p_heap,
+                                            MEM_SEG_HEAP_BLK  *p_blk)
+{
+    MEM_SEG_HEAP_BLK  *p_blk_head;
+    CPU_INT32U         fl;
+    CPU_INT32U         sl;
+
+
+    Mem_SegHeapMap(MEM_SEG_HEAP_BLK_SIZE_GET(p_blk), &fl, &sl);
+
+    p_blk_head         = p_heap->FreeTbl[fl][sl];
+    p_blk->NextFreePtr = p_blk_head;
+    p_blk->PrevFreePtr = DEF_NULL;
+    if (p_blk_head != DEF_NULL) {
+        p_blk_head->PrevFreePtr = p_blk;
+    }
+    p_heap->FreeTbl[fl][sl] = p_blk;
+
+    DEF_BIT_SET(p_heap->FreeBitmapFL,     DEF_BIT32(fl));
+    DEF_BIT_SET(p_heap->FreeBitmapSL[fl], DEF_BIT32(sl));
+    p_heap->FreeBlkNbr++;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    Mem_SegHeapBlkRemoveCritical()
+*
+* Description : Removes a free block from its segment heap free list.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to free block.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_SegHeapAlloc(),
+*               Mem_SegHeapFree(),
+*               Mem_SegHeapRealloc(),
+*               Mem_SegHeapBlkTrimCritical().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+static  void  Mem_SegHeapBlkRemoveCritical (MEM_SEG_HEAP      *p_heap,
+                                            MEM_SEG_HEAP_BLK  *p_blk)
+{
+    CPU_INT32U  fl;
+    CPU_INT32U  sl;
+
+
+    if (p_blk->NextFreePtr != DEF_NULL) {
+        p_blk->NextFreePtr->PrevFreePtr = p_blk->PrevFreePtr;
+    }
+
+    if (p_blk->PrevFreePtr != DEF_NULL) {
+        p_blk->PrevFreePtr->NextFreePtr = p_blk->NextFreePtr;
+    } else {                                                    /* Blk is the head of its list.                         */
+        Mem_SegHeapMap(MEM_SEG_HEAP_BLK_SIZE_GET(p_blk), &fl, &sl);
+        p_heap->FreeTbl[fl][sl] = p_blk->NextFreePtr;
+        if (p_blk->NextFreePtr == DEF_NULL) {                   /* List now empty : clr its bitmap bits.                */
+            DEF_BIT_CLR(p_heap->FreeBitmapSL[fl], DEF_BIT32(sl));
+            if (p_heap->FreeBitmapSL[fl] == 0u) {
+                DEF_BIT_CLR(p_heap->FreeBitmapFL, DEF_BIT32(fl));
+            }
+        }
+    }
+    p_heap->FreeBlkNbr--;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_SegHeapBlkTrimCritical()
+*
+* Description : Returns the tail of a used segment heap block beyond 'size' to the heap, if large enough to
+*               make a block.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to used block.
+*               -----   Argument validated by caller.
+*
+*               size    Size to keep, in bytes. MUST be a multiple of LIB_MEM_SEG_HEAP_ALIGN.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_SegHeapAlloc(),
+*               Mem_SegHeapRealloc().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*
+*               (2) The tail is merged with the next block if that one is free, so that no two free blocks
+*                   are ever adjacent.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+static  void  Mem_SegHeapBlkTrimCritical (MEM_SEG_HEAP      *p_heap,
+                                          MEM_SEG_HEAP_BLK  *p_blk,
+                                          CPU_SIZE_T         size)
+{
+    MEM_SEG_HEAP_BLK  *p_blk_rem;
+    MEM_SEG_HEAP_BLK  *p_blk_next;
+    CPU_SIZE_T         size_rem;
+
+
+    size_rem = MEM_SEG_HEAP_BLK_SIZE_GET(p_blk) - size;
+    if (size_rem < (MEM_SEG_HEAP_BLK_HDR_SIZE + MEM_SEG_HEAP_BLK_SIZE_MIN)) {
+        return;                                                 /* Tail too small, keep it in the blk.                  */
+    }
+
+    p_blk->Size            = size | (p_blk->Size & MEM_SEG_HEAP_BLK_FLAGS);
+    p_blk_rem              = MEM_SEG_HEAP_BLK_NEXT_GET(p_blk);
+    p_blk_rem->PrevPhysPtr = p_blk;
+    p_blk_rem->Size        = (size_rem - MEM_SEG_HEAP_BLK_HDR_SIZE) | MEM_SEG_HEAP_BLK_FLAG_FREE;
+
+    p_blk_next = MEM_SEG_HEAP_BLK_NEXT_GET(p_blk_rem);
+    if (MEM_SEG_HEAP_BLK_IS_FREE(p_blk_next)) {                 /* See Note #2.                                         */
+        Mem_SegHeapBlkRemoveCritical(p_heap, p_blk_next);
+        p_blk_rem->Size += MEM_SEG_HEAP_BLK_HDR_SIZE + MEM_SEG_HEAP_BLK_SIZE_GET(p_blk_next);
+        p_blk_next       = MEM_SEG_HEAP_BLK_NEXT_GET(p_blk_rem);
+    }
+    p_blk_next->PrevPhysPtr  = p_blk_rem;
+    p_blk_next->Size        |= MEM_SEG_HEAP_BLK_FLAG_PREV_FREE;
+
+    Mem_SegHeapBlkInsertCritical(p_heap, p_blk_rem);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_SegHeapBlkIsValidAddr()
+*
+* Description : Calculates if a given memory block address may be a block of the segment heap.
+*
+* Argument(s) : p_heap   Pointer to heap data.
+*               ------   Argument validated by caller.
+*
+*               p_mem    Pointer to memory block address to validate.
+*               -----    Argument validated by caller.
+*
+* Return(s)   : DEF_YES, if address is aligned & within the heap.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Mem_SegHeapFree(),
+*               Mem_SegHeapRealloc().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SEG_HEAP_EN    == DEF_ENABLED) && \
+     (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED))
+static  CPU_BOOLEAN  Mem_SegHeapBlkIsValidAddr (MEM_SEG_HEAP  *p_heap,
+                                                void          *p_mem)
+{
+    CPU_ADDR  blk_addr;
+
+
+    blk_addr = (CPU_ADDR)p_mem - MEM_SEG_HEAP_BLK_HDR_SIZE;
+    if (((CPU_ADDR)p_mem <  MEM_SEG_HEAP_BLK_HDR_SIZE) ||
+        (blk_addr        <  p_heap->AddrBase)         ||
+        (blk_addr        >= p_heap->AddrEnd)) {
+        return (DEF_NO);
+    }
+
+    if ((blk_addr & (LIB_MEM_SEG_HEAP_ALIGN - 1u)) != 0u) {
+        return (DEF_NO);
+    }
+
+    return (DEF_YES);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_CntIncAtomic()
+*
+* Description : Increments a block count, unless it has reached its maximum, without disabling interrupts.
+*
+* Argument(s) : p_cnt      Pointer to count to increment.
+*               -----      Argument validated by caller.
+*
+*               cnt_max    Maximum value of the count.
+*
+* Return(s)   : DEF_OK,   if the count was incremented.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Mem_PoolBlkFree(),
+*               Mem_DynPoolBlkGet().
+*
+* Note(s)     : (1) See 'Mem_PoolBlkGet()  Note #2c'.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  Mem_CntIncAtomic (CPU_SIZE_T  *p_cnt,
+                                       CPU_SIZE_T   cnt_max)
+{
+    CPU_SIZE_T  cnt;
+
+
+    do {
+        cnt = *p_cnt;
+        if (cnt >= cnt_max) {
+            return (DEF_FAIL);
+        }
+    } while (CPU_CmpXchg((CPU_ADDR *)p_cnt, (CPU_ADDR)cnt, (CPU_ADDR)(cnt + 1u)) == DEF_NO);
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_CntDecAtomic()
+*
+* Description : Decrements a block count, unless it is null, without disabling interrupts.
+*
+* Argument(s) : p_cnt      Pointer to count to decrement.
+*               -----      Argument validated by caller.
+*
+* Return(s)   : DEF_OK,   if the count was decremented.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Mem_PoolBlkGet(),
+*               Mem_DynPoolBlkGet(),
+*               Mem_DynPoolBlkFree().
+*
+* Note(s)     : (1) See 'Mem_PoolBlkGet()  Note #2c'.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  Mem_CntDecAtomic (CPU_SIZE_T  *p_cnt)
+{
+    CPU_SIZE_T  cnt;
+
+
+    do {
+        cnt = *p_cnt;
+        if (cnt == 0u) {
+            return (DEF_FAIL);
+        }
+    } while (CPU_CmpXchg((CPU_ADDR *)p_cnt, (CPU_ADDR)cnt, (CPU_ADDR)(cnt - 1u)) == DEF_NO);
+
+    return (DEF_OK);
+}
+#endif
@@ -199,6 +199,47 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                    SEGMENT HEAP CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_SEG_HEAP_EN to enable/disable the segment heaps : general-purpose
+*               allocators, with free support, created on top of a memory segment (see 'SEGMENT HEAP
+*               DATA TYPES').
+*
+*           (2) Configure LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2 with the base-2 logarithm of the largest block
+*               a segment heap can manage, in octets.  Each segment heap holds a table of
+*               (LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2 - LIB_MEM_SEG_HEAP_FL_SHIFT + 2) * 16 free list pointers.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_SEG_HEAP_EN
+#define  LIB_MEM_CFG_SEG_HEAP_EN         DEF_DISABLED
+#endif
+
+#ifndef  LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2
+#define  LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2        20u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  LOCK-FREE MEMORY POOLS CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_LOCK_FREE_EN to enable/disable lock-free free lists for the static
+*               and dynamic memory pools : Mem_PoolBlkGet()/Mem_PoolBlkFree() and
+*               Mem_DynPoolBlkGet()/Mem_DynPoolBlkFree() then no longer disable interrupts, except to
+*               grow a dynamic pool from its segment.  See 'lib_mem.c  Mem_PoolBlkGet()  Note #2'.
+*
+*           (2) Requires CPU_CmpXchg(), see CPU_CFG_CMP_XCHG_PRESENT in 'cpu.h'.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_LOCK_FREE_EN
+#define  LIB_MEM_CFG_LOCK_FREE_EN        DEF_DISABLED
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             DATA TYPES
@@ -305,6 +346,9 @@ typedef  struct  mem_seg_info {                                 /* -------------
 *                    |        |<-------- (Next block to be freed.)
 *                    \--------/
 *
+*           (2) With LIB_MEM_CFG_LOCK_FREE_EN, 'BlkFreeTbl' holds, for each block, the index + 1 of the next
+*               free block, 0 if none, and 'BlkFreeTop' the index + 1 of the first one with a tag.
+*               'BlkFreeTblIx' is the number of free blocks.  See 'lib_mem.c  Mem_PoolBlkGet()  Note #2'.
 *********************************************************************************************************
 */
 
@@ -316,6 +360,9 @@ typedef  struct  mem_pool {
     CPU_SIZE_T          BlkSize;                                /* Size  of mem pool   blks (in octets).                */
     void              **BlkFreeTbl;                             /* Tbl of free mem pool blks.                           */
     CPU_SIZE_T          BlkFreeTblIx;                           /* Ix of next free blk free tbl entry.                  */
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_ADDR            BlkFreeTop;                             /* Tag & ix + 1 of first free blk (see Note #2).        */
+#endif
 } MEM_POOL;
 
 
@@ -339,6 +386,9 @@ typedef  struct  mem_pool {
 *                    |          |      |          |       |          |   |          |
 *                    \----------/      \----------/       \----------/   \----------/
 *
+*           (3) With LIB_MEM_CFG_LOCK_FREE_EN, free blocks hold the index + 1 of the next free block in the
+*               pool's segment, in pointer-size units, instead of its address, and 'BlkFreeTop' replaces
+*               'BlkFreePtr'.  See 'lib_mem.c  Mem_PoolBlkGet()  Note #2'.
 *********************************************************************************************************
 */
 
@@ -347,7 +397,11 @@ typedef  struct  mem_dyn_pool {                                 /* -------------
            CPU_SIZE_T   BlkSize;                                /* Size of pool blks, in octets.                        */
            CPU_SIZE_T   BlkAlign;                               /* Align req'd for blks, in octets.                     */
            CPU_SIZE_T   BlkPaddingAlign;                        /* Padding alignment in bytes for this mem seg.         */
+#if (LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED)
+           CPU_ADDR     BlkFreeTop;                             /* Tag & ix + 1 of first free blk (see Note #3).        */
+#else
            void        *BlkFreePtr;                             /* Ptr to first free blk.                               */
+#endif
 
            CPU_SIZE_T   BlkQtyMax;                              /* Max qty of blk in dyn mem pool. 0 = unlimited.       */
            CPU_SIZE_T   BlkAllocCnt;                            /* Cnt of alloc blk.                                    */
@@ -358,6 +412,96 @@ typedef  struct  mem_dyn_pool {                                 /* -------------
 } MEM_DYN_POOL;
 
 
+/*
+*********************************************************************************************************
+*                                      SEGMENT HEAP DATA TYPES
+*
+* Note(s) : (1) A segment heap is a Two-Level Segregated Fit (TLSF) allocator : free blocks are kept in
+*               segregated lists indexed by a first level (power of 2 of the block size) and a second
+*               level (LIB_MEM_SEG_HEAP_SL_NBR linear subdivisions of that power of 2).  One bitmap per
+*               level tells which lists are non-empty, so a free block of a sufficient size is found with
+*               two bit scans, whatever the number of blocks :
+*
+*                   FreeBitmapFL    0 0 1 0 1 ... 1          First level, one bit per power of 2.
+*                                       |   |
+*                   FreeBitmapSL[] /----/   \----\          Second level, one bit per subdivision.
+*                                  v              v
+*                   FreeTbl[][]   [ ][ ][x][ ]   [x][ ][ ]   Heads of the free lists.
+*
+*               Allocation and free are O(1) : blocks are split on allocation and merged with their free
+*               physical neighbours on free, in constant time.
+*
+*           (2) Each block starts with a header of LIB_MEM_SEG_HEAP_ALIGN octets that holds a pointer to
+*               the previous physical block and the block size.  The free list pointers of a free block
+*               are stored in its payload.  Blocks, and the memory returned to the application, are
+*               aligned on LIB_MEM_SEG_HEAP_ALIGN octets.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_ADDR_SIZE == CPU_WORD_SIZE_64)
+#define  LIB_MEM_SEG_HEAP_ALIGN_LOG2                      4u    /* Blk hdr : 2 ptrs (see Note #2).                      */
+#else
+#define  LIB_MEM_SEG_HEAP_ALIGN_LOG2                      3u
+#endif
+#define  LIB_MEM_SEG_HEAP_ALIGN                 (1u << LIB_MEM_SEG_HEAP_ALIGN_LOG2)
+
+#define  LIB_MEM_SEG_HEAP_SL_LOG2                         4u
+#define  LIB_MEM_SEG_HEAP_SL_NBR                (1u << LIB_MEM_SEG_HEAP_SL_LOG2)
+
+                                                                /* Blks smaller than 1 << FL_SHIFT are all in FL 0.     */
+#define  LIB_MEM_SEG_HEAP_FL_SHIFT              (LIB_MEM_SEG_HEAP_SL_LOG2 + LIB_MEM_SEG_HEAP_ALIGN_LOG2)
+#define  LIB_MEM_SEG_HEAP_FL_NBR                (LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2 - LIB_MEM_SEG_HEAP_FL_SHIFT + 2u)
+
+
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+typedef  struct  mem_seg_heap_blk  MEM_SEG_HEAP_BLK;
+
+struct  mem_seg_heap_blk {                                      /* ------------------ SEG HEAP BLK -------------------- */
+    MEM_SEG_HEAP_BLK  *PrevPhysPtr;                             /* Ptr to prev blk in mem.                              */
+    CPU_SIZE_T         Size;                                    /* Payload size, in octets, and blk flags in 2 LSBs.    */
+
+    MEM_SEG_HEAP_BLK  *NextFreePtr;                             /* Ptr to next free blk in list (free blks only).       */
+    MEM_SEG_HEAP_BLK  *PrevFreePtr;                             /* Ptr to prev free blk in list (free blks only).       */
+};
+
+typedef  struct  mem_seg_heap  MEM_SEG_HEAP;
+
+struct  mem_seg_heap {                                          /* --------------------- SEG HEAP --------------------- */
+                                                                /* Heads of the free lists, per FL & SL.                */
+           MEM_SEG_HEAP_BLK  *FreeTbl[LIB_MEM_SEG_HEAP_FL_NBR][LIB_MEM_SEG_HEAP_SL_NBR];
+           CPU_INT32U         FreeBitmapFL;                     /* Non-empty first  level lists.                        */
+                                                                /* Non-empty second level lists, per FL.                */
+           CPU_INT32U         FreeBitmapSL[LIB_MEM_SEG_HEAP_FL_NBR];
+
+           CPU_ADDR           AddrBase;                         /* First blk addr.                                      */
+           CPU_ADDR           AddrEnd;                          /* End blk (sentinel) addr.                             */
+
+           CPU_SIZE_T         TotalSize;                        /* Size managed by the heap, hdrs included.             */
+           CPU_SIZE_T         UsedSize;                         /* Size of alloc'd blks, hdrs included.                 */
+           CPU_SIZE_T         UsedSizeMax;                      /* Peak of UsedSize.                                    */
+           CPU_SIZE_T         UsedBlkNbr;                       /* Nbr of alloc'd blks.                                 */
+           CPU_SIZE_T         FreeBlkNbr;                       /* Nbr of free    blks.                                 */
+           CPU_SIZE_T         AllocFailCtr;                     /* Nbr of failed allocs.                                */
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    const  CPU_CHAR          *NamePtr;                          /* Ptr to heap name.                                    */
+           MEM_SEG_HEAP      *NextPtr;                          /* Ptr to next heap, see Mem_OutputUsage().             */
+#endif
+};
+
+typedef  struct  mem_seg_heap_info {                            /* ------------------- SEG HEAP INFO ------------------ */
+    CPU_SIZE_T  TotalSize;                                      /* Size managed by the heap, in octets.                 */
+    CPU_SIZE_T  UsedSize;                                       /* Size of alloc'd blks, hdrs included.                 */
+    CPU_SIZE_T  UsedSizeMax;                                    /* Peak of UsedSize since heap creation.                */
+    CPU_SIZE_T  FreeBlkSizeMax;                                 /* Largest free blk, in octets.                         */
+    CPU_SIZE_T  UsedBlkNbr;                                     /* Nbr of alloc'd blks.                                 */
+    CPU_SIZE_T  FreeBlkNbr;                                     /* Nbr of free    blks.                                 */
+    CPU_SIZE_T  AllocFailCtr;                                   /* Nbr of failed allocs.                                */
+    CPU_INT08U  FragPct;                                        /* Free size NOT in the largest free blk, in %.         */
+} MEM_SEG_HEAP_INFO;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -1409,6 +1553,32 @@ void               Mem_DynPoolBlkFree       (       MEM_DYN_POOL      *p_pool,
 CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
                                                     LIB_ERR           *p_err);
 
+                                                                /* ------------------ SEG HEAP FNCTS ------------------ */
+#if (LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED)
+void               Mem_SegHeapCreate        (const  CPU_CHAR          *p_name,
+                                                    MEM_SEG_HEAP      *p_heap,
+                                                    MEM_SEG           *p_seg,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_SegHeapAlloc         (       MEM_SEG_HEAP      *p_heap,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_SegHeapFree          (       MEM_SEG_HEAP      *p_heap,
+                                                    void              *p_mem,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_SegHeapRealloc       (       MEM_SEG_HEAP      *p_heap,
+                                                    void              *p_mem,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+CPU_SIZE_T         Mem_SegHeapRemSizeGet    (       MEM_SEG_HEAP      *p_heap,
+                                                    MEM_SEG_HEAP_INFO *p_info,
+                                                    LIB_ERR           *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1470,6 +1640,38 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_SEG_HEAP_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_SEG_HEAP_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_SEG_HEAP_EN illegally defined in 'lib_cfg.h'"
+#error  "                        [MUST be  DEF_DISABLED]         "
+#error  "                        [     ||  DEF_ENABLED ]         "
+
+#elif  ((LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2 < (LIB_MEM_SEG_HEAP_FL_SHIFT + 1u)) || \
+        (LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2 > 30u))
+#error  "LIB_MEM_CFG_SEG_HEAP_SIZE_MAX_LOG2 illegally defined in 'lib_cfg.h'"
+#error  "                                   [MUST be  >  FL_SHIFT]          "
+#error  "                                   [     &&  <= 30      ]          "
+
+#elif  ((LIB_MEM_CFG_SEG_HEAP_EN == DEF_ENABLED) && \
+        (CPU_CFG_ADDR_SIZE       <  CPU_WORD_SIZE_32))
+#error  "LIB_MEM_CFG_SEG_HEAP_EN illegally defined in 'lib_cfg.h'"
+#error  "                        [MUST be  DEF_DISABLED on 8/16-bit CPUs]"
+#endif
+
+
+#if    ((LIB_MEM_CFG_LOCK_FREE_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_LOCK_FREE_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_LOCK_FREE_EN illegally defined in 'lib_cfg.h'"
+#error  "                         [MUST be  DEF_DISABLED]         "
+#error  "                         [     ||  DEF_ENABLED ]         "
+
+#elif  ((LIB_MEM_CFG_LOCK_FREE_EN == DEF_ENABLED) && \
+        (!defined(CPU_CFG_CMP_XCHG_PRESENT)))
+#error  "LIB_MEM_CFG_LOCK_FREE_EN illegally defined in 'lib_cfg.h'"
+#error  "                         [MUST be  DEF_DISABLED without CPU_CmpXchg()]"
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    LIBRARY CONFIGURATION ERRORS
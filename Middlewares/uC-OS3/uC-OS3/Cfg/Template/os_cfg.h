@@ -34,6 +34,8 @@
 #define OS_CFG_DBG_EN                              1u           /* Enable (1) or Disable (0) debug code/variables                        */
 #define OS_CFG_TICK_EN                             1u           /* Enable (1) or Disable (0) the kernel tick                             */
 #define OS_CFG_DYN_TICK_EN                         0u           /* Enable (1) or Disable (0) the Dynamic Tick                            */
+#define OS_CFG_TICK_WHEEL_EN                       0u           /* Enable (1) or Disable (0) the hashed tick wheel for delays/timeouts   */
+#define OS_CFG_PEND_LIST_PRIO_TBL_EN               0u           /* Enable (1) or Disable (0) O(1) priority tables in the pend lists      */
 #define OS_CFG_INVALID_OS_CALLS_CHK_EN             1u           /* Enable (1) or Disable (0) checks for invalid kernel calls             */
 #define OS_CFG_OBJ_TYPE_CHK_EN                     1u           /* Enable (1) or Disable (0) object type checking                        */
 #define OS_CFG_OBJ_CREATED_CHK_EN                  1u           /* Enable (1) or Disable (0) object created checks                       */
@@ -43,6 +45,7 @@
 
 #define OS_CFG_SCHED_LOCK_TIME_MEAS_EN             0u           /* Include code to measure scheduler lock time                           */
 #define OS_CFG_SCHED_ROUND_ROBIN_EN                1u           /* Include code for Round-Robin scheduling                               */
+#define OS_CFG_SMP_CORE_NBR                        1u           /* Number of cores running tasks (> 1: experimental POSIX port SMP mode) */
 
 #define OS_CFG_STK_SIZE_MIN                       64u           /* Minimum allowable task stack size                                     */
 
@@ -56,12 +59,20 @@
 
                                                                 /* ------------------------ MEMORY MANAGEMENT -------------------------  */
 #define OS_CFG_MEM_EN                              1u           /* Enable (1) or Disable (0) code generation for the MEMORY MANAGER      */
+#define OS_CFG_MEM_CLASS_NBR                       8u           /*     Size classes of OSMemAlloc(), 0 disables OSMemAlloc()/OSMemFree() */
+#define OS_CFG_MEM_CLASS_SIZE_MIN_LOG2             4u           /*     Log2 of the block size of the smallest size class                 */
+#define OS_CFG_MEM_MAG_SIZE                        0u           /*     Blocks cached per task and size class, 0 disables the magazines   */
+#define OS_CFG_MEM_LOCK_FREE_EN                    0u           /*     OSMemGet()/OSMemPut() with compare and swap, interrupts enabled   */
+#define OS_CFG_BUF_EN                              1u           /*     Reference counted buffer chains, OSBufAlloc() and OSQPostBuf()    */
 
 
                                                                 /* ------------------- MUTUAL EXCLUSION SEMAPHORES --------------------  */
 #define OS_CFG_MUTEX_EN                            1u           /* Enable (1) or Disable (0) code generation for MUTEX                   */
 #define OS_CFG_MUTEX_DEL_EN                        1u           /*     Include code for OSMutexDel()                                     */
 #define OS_CFG_MUTEX_PEND_ABORT_EN                 1u           /*     Include code for OSMutexPendAbort()                               */
+#define OS_CFG_MUTEX_FAST_EN                       1u           /*     Uncontended OSMutexPend()/OSMutexPost() without critical section  */
+#define OS_CFG_COND_EN                             1u           /* Enable (1) or Disable (0) code generation for CONDITION VARIABLES     */
+#define OS_CFG_COND_DEL_EN                         1u           /*     Include code for OSCondDel()                                      */
 
 
                                                                 /* -------------------------- MESSAGE QUEUES --------------------------  */
@@ -69,6 +80,8 @@
 #define OS_CFG_Q_DEL_EN                            1u           /*     Include code for OSQDel()                                         */
 #define OS_CFG_Q_FLUSH_EN                          1u           /*     Include code for OSQFlush()                                       */
 #define OS_CFG_Q_PEND_ABORT_EN                     1u           /*     Include code for OSQPendAbort()                                   */
+#define OS_CFG_Q_MULTI_EN                          1u           /*     Include code for OSQPostMulti() and OSQPendMulti()                */
+#define OS_CFG_MSG_POOL_PRIV_EN                    1u           /*     OSMsgPoolCreate(), OSQPoolSet() and OSTaskQPoolSet()              */
 #define OS_CFG_ISR_POST_EN                         1u           /* жķϢܣؼ */
 
 
@@ -79,6 +92,11 @@
 #define OS_CFG_SEM_SET_EN                          1u           /*     Include code for OSSemSet()                                       */
 
 
+                                                                /* -------------------------- STREAM BUFFERS --------------------------  */
+#define OS_CFG_STREAM_EN                           1u           /* Enable (1) or Disable (0) code generation for STREAM BUFFERS          */
+#define OS_CFG_STREAM_DEL_EN                       1u           /*     Include code for OSStreamDel()                                    */
+
+
                                                                 /* -------------------------- TASK MANAGEMENT -------------------------- */
 #define OS_CFG_STAT_TASK_EN                        1u           /* Enable (1) or Disable (0) the statistics task                         */
 #define OS_CFG_STAT_TASK_STK_CHK_EN                1u           /*     Check task stacks from the statistic task                         */
@@ -89,6 +107,7 @@
 #define OS_CFG_TASK_PROFILE_EN                     1u           /* Include variables in OS_TCB for profiling                             */
 #define OS_CFG_TASK_Q_EN                           1u           /* Include code for OSTaskQXXXX()                                        */
 #define OS_CFG_TASK_Q_PEND_ABORT_EN                1u           /* Include code for OSTaskQPendAbort()                                   */
+#define OS_CFG_TASK_Q_MULTI_EN                     1u           /* Include code for OSTaskQPostMulti()                                   */
 #define OS_CFG_TASK_REG_TBL_SIZE                   0u           /* Number of task specific registers                                     */
 
 #define OS_CFG_TASK_STK_REDZONE_EN                 1u           /* Enable (1) or Disable (0) stack redzone                               */
@@ -110,6 +129,7 @@
                                                                 /* ------------------------- TIMER MANAGEMENT -------------------------- */
 #define OS_CFG_TMR_EN                              1u           /* Enable (1) or Disable (0) code generation for TIMERS                  */
 #define OS_CFG_TMR_DEL_EN                          1u           /* Enable (1) or Disable (0) code generation for OSTmrDel()              */
+#define OS_CFG_TMR_WHEEL_EN                        0u           /*     Use a hierarchical timer wheel instead of the sorted timer list   */
 
 
                                                                 /* ------------------------- TRACE RECORDER ---------------------------- */
@@ -46,6 +46,13 @@
 #define  OS_CFG_IDLE_TASK_STK_SIZE                        64u
 
 
+                                                                /* ----------------- ISR HANDLER TASK ----------------- */
+                                                                /* Size of the deferred post queue (number of entries)  */
+#define  OS_CFG_INT_Q_SIZE                                10u
+                                                                /* Stack size (number of CPU_STK elements)              */
+#define  OS_CFG_INT_Q_TASK_STK_SIZE                      128u
+
+
                                                                 /* ------------------ STATISTIC TASK ------------------ */
                                                                 /* Priority                                             */
 #define  OS_CFG_STAT_TASK_PRIO  ((OS_PRIO)(OS_CFG_PRIO_MAX-2u))
@@ -58,6 +65,8 @@
                                                                 /* ---------------------- TICKS ----------------------- */
                                                                 /* Tick rate in Hertz (10 to 1000 Hz)                   */
 #define  OS_CFG_TICK_RATE_HZ                            1000u
+                                                                /* Number of spokes in the tick wheel (SHOULD be prime) */
+#define  OS_CFG_TICK_WHEEL_SIZE                           17u
 
 
                                                                 /* --------------------- TIMERS ----------------------- */
@@ -65,6 +74,10 @@
 #define  OS_CFG_TMR_TASK_PRIO   ((OS_PRIO)(OS_CFG_PRIO_MAX-3u))
                                                                 /* Stack size (number of CPU_STK elements)              */
 #define  OS_CFG_TMR_TASK_STK_SIZE                        128u
+                                                                /* Spokes per timer wheel level (as a power of 2)       */
+#define  OS_CFG_TMR_WHEEL_BITS                             6u
+                                                                /* Number of timer wheel levels                         */
+#define  OS_CFG_TMR_WHEEL_LEVELS                           4u
 
                                                                 /* DEPRECATED - Rate for timers (10 Hz Typ.)            */
                                                                 /* The timer task now calculates its timeouts based     */
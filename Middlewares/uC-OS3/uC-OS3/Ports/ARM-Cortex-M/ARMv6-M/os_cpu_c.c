@@ -506,6 +506,48 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
     CPU_REG_SYST_CSR   |= CPU_REG_SYST_CSR_TICKINT;             /* Enable timer interrupt.                              */
 }
 
+
+/*
+*********************************************************************************************************
+*                                        ATOMIC COMPARE AND SWAP
+*
+* Description: Store 'val' in '*p_dst' if '*p_dst' holds 'cmp'.
+*
+* Arguments  : p_dst        Pointer to the word to update.
+*
+*              cmp          Expected value.
+*
+*              val          New value.
+*
+* Returns    : DEF_YES if 'val' was stored, DEF_NO otherwise.
+*
+* Note(s)    : 1) ARMv6-M has no exclusive access instructions, so interrupts are disabled instead.  The
+*                 mutex fast path then only saves the bookkeeping of the slow path.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+CPU_BOOLEAN  OS_CPU_CmpXchg (void  **p_dst,
+                             void   *cmp,
+                             void   *val)
+{
+    CPU_BOOLEAN  stored;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (*p_dst == cmp) {
+       *p_dst  = val;
+        stored = DEF_YES;
+    } else {
+        stored = DEF_NO;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (stored);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
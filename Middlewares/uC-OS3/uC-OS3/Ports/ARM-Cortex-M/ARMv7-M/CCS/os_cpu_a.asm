@@ -58,6 +58,7 @@ OS_KA_BASEPRI_BoundaryAddr:  .word  OS_KA_BASEPRI_Boundary
     .global  OSCtxSw
     .global  OSIntCtxSw
     .global  OS_CPU_PendSVHandler
+    .global  OS_CPU_CmpXchg
 
 
 ;********************************************************************************************************
@@ -166,6 +167,36 @@ OSIntCtxSw:
     .endasmfunc
 
 
+;********************************************************************************************************
+;                                       ATOMIC COMPARE AND SWAP
+;                     CPU_BOOLEAN OS_CPU_CmpXchg(void **p_dst, void *cmp, void *val)
+;
+; Note(s) : 1) Stores 'val' in '*p_dst' and returns 1 if '*p_dst' holds 'cmp', else returns 0.  It is used
+;              by the mutex fast path (see OSMutexPend()) and by the lock-free memory partitions (see
+;              OSMemGet()).
+;
+;           2) The exclusive monitor is cleared on exception entry and return, so STREX fails if the task
+;              was preempted since LDREX.  The sequence is then started over.
+;********************************************************************************************************
+
+    .asmfunc
+OS_CPU_CmpXchg:
+    LDREX   R3, [R0]                                            ; Load '*p_dst' with exclusive access
+    CMP     R3, R1                                              ; Does it hold 'cmp'?
+    BNE     OS_CPU_CmpXchgFail
+    STREX   R3, R2, [R0]                                        ; Yes, try to store 'val'
+    CMP     R3, #0
+    BNE     OS_CPU_CmpXchg                                      ; Preempted, see Note #2
+    MOVS    R0, #1
+    BX      LR
+
+OS_CPU_CmpXchgFail:
+    CLREX                                                       ; No, release the exclusive access
+    MOVS    R0, #0
+    BX      LR
+    .endasmfunc
+
+
 ;********************************************************************************************************
 ;                                       HANDLE PendSV EXCEPTION
 ;                                   void OS_CPU_PendSVHandler(void)
@@ -74,6 +74,41 @@ CPU_INT32U  OS_KA_BASEPRI_Boundary;                             /* Base Priority
 #define  CPU_REG_FPCCR_LAZY_STK                        0xC0000000uL
 
 
+/*
+*********************************************************************************************************
+*                                          DYNAMIC TICK DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#define  CPU_REG_DWT_CR                (*((CPU_REG32 *)0xE0001000uL))   /* DWT Control Reg.                            */
+#define  CPU_REG_DWT_CYCCNT            (*((CPU_REG32 *)0xE0001004uL))   /* DWT Cycle Count Reg.                        */
+
+#define  CPU_REG_DWT_CR_CYCCNTENA                      0x00000001uL
+#define  CPU_REG_DEMCR_TRCENA                          0x01000000uL
+
+#define  OS_CPU_SYST_CNTS_MAX                          0x00FFFFFFuL     /* SysTick is a 24-bit down counter.           */
+#define  OS_CPU_SYST_CNTS_MIN                                 64uL      /* Shortest one-shot, for overdue deadlines.   */
+
+
+/*
+*********************************************************************************************************
+*                                          DYNAMIC TICK VARIABLES
+*
+* Note(s) : (1) The DWT cycle counter runs from the same clock as the SysTick and is used as the time base.
+*               'OS_CPU_DynTickRef' is the cycle count of the last tick accounted for in OSTickCtr.
+*
+*           (2) 'OS_CPU_DynTickElapsed' is the last value returned by OS_DynTickGet().  The kernel adds that
+*               value to OSTickCtr before it calls OS_DynTickSet(), which moves the reference accordingly.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCnts;                         /* Cycles per OS tick, 0 until the SysTick is started.  */
+static  CPU_INT32U  OS_CPU_DynTickRef;                          /* See Note #1.                                         */
+static  OS_TICK     OS_CPU_DynTickElapsed;                      /* See Note #2.                                         */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           IDLE TASK HOOK
@@ -94,6 +129,10 @@ void  OSIdleTaskHook (void)
         (*OS_AppIdleTaskHookPtr)();
     }
 #endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_WaitForInt();                                           /* Sleep until the next deadline or device interrupt.   */
+#endif
 }
 
 
@@ -577,19 +616,37 @@ void  OSTimeTickHook (void)
 * Arguments  : None.
 *
 * Note(s)    : 1) This function MUST be placed on entry 15 of the Cortex-M vector table.
+*
+*              2) With the dynamic tick, the SysTick is a one-shot programmed by OS_DynTickSet().  The handler
+*                 reports the whole ticks elapsed since the reference point to the kernel.  An early or stale
+*                 interrupt reports nothing and the SysTick keeps counting with the same reload value.
 *********************************************************************************************************
 */
 
 void  OS_CPU_SysTickHandler  (void)
 {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  ticks;
+#endif
     CPU_SR_ALLOC();
 
 
     CPU_CRITICAL_ENTER();
     OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    ticks                  = (OS_TICK)((CPU_REG_DWT_CYCCNT - OS_CPU_DynTickRef) / OS_CPU_DynTickCnts);
+    OS_CPU_DynTickRef     += (CPU_INT32U)ticks * OS_CPU_DynTickCnts;
+    OS_CPU_DynTickElapsed  = 0u;
+#endif
     CPU_CRITICAL_EXIT();
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if (ticks > 0u) {                                           /* See Note #2.                                         */
+        OSTimeDynTick(ticks);
+    }
+#else
     OSTimeTick();                                               /* Call uC/OS-III's OSTimeTick()                        */
+#endif
 
     OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
 }
@@ -635,6 +692,9 @@ void  OS_CPU_SysTickInitFreq (CPU_INT32U  cpu_freq)
 * Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
 *
 *              2) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*
+*              3) With the dynamic tick, the SysTick MUST be clocked by the CPU clock, which also drives the
+*                 DWT cycle counter.  The SysTick is then programmed for the first deadline of the kernel.
 *********************************************************************************************************
 */
 
@@ -643,6 +703,9 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 #if (OS_CFG_TICK_EN > 0u)
     CPU_INT32U  prio;
     CPU_INT32U  basepri;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
 
 
                                                                 /* Set BASEPRI boundary from the configuration.         */
@@ -656,16 +719,110 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 
     CPU_REG_SCB_SHPRI3  = prio;
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_REG_DEMCR      |= CPU_REG_DEMCR_TRCENA;                 /* Start the DWT cycle counter (see Note #3).           */
+    CPU_REG_DWT_CR     |= CPU_REG_DWT_CR_CYCCNTENA;
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts    = cnts;
+    OS_CPU_DynTickRef     = CPU_REG_DWT_CYCCNT;
+    OS_CPU_DynTickElapsed = 0u;
+    CPU_REG_SYST_CSR     |= CPU_REG_SYST_CSR_CLKSOURCE |        /* Timer is enabled by OS_DynTickSet().                 */
+                            CPU_REG_SYST_CSR_TICKINT;
+    (void)OS_DynTickSet(OSTickCtrStep);
+    CPU_CRITICAL_EXIT();
+#else
                                                                 /* Enable timer.                                        */
     CPU_REG_SYST_CSR   |= CPU_REG_SYST_CSR_CLKSOURCE |
                           CPU_REG_SYST_CSR_ENABLE;
 
     CPU_REG_SYST_CSR   |= CPU_REG_SYST_CSR_TICKINT;             /* Enable timer interrupt.                              */
+#endif
 #else
     (void)cnts;
 #endif
 }
 
+
+/*
+*********************************************************************************************************
+*                                        GET ELAPSED DYNAMIC TICKS
+*
+* Description: Return the number of whole ticks elapsed since the last tick accounted for in OSTickCtr.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed ticks, 0 until the SysTick is started.
+*
+* Note(s)    : 1) This function is called by uC/OS-III with interrupts disabled.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    if (OS_CPU_DynTickCnts == 0u) {
+        return (0u);
+    }
+
+    OS_CPU_DynTickElapsed = (OS_TICK)((CPU_REG_DWT_CYCCNT - OS_CPU_DynTickRef) / OS_CPU_DynTickCnts);
+
+    return (OS_CPU_DynTickElapsed);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SET NEXT DYNAMIC TICK
+*
+* Description: Program the SysTick as a one-shot that expires 'ticks' ticks after the last tick accounted
+*              for in OSTickCtr.
+*
+* Arguments  : ticks        Number of ticks to the next deadline, 0 if the kernel has none.
+*
+* Returns    : The number of ticks actually programmed.
+*
+* Note(s)    : 1) This function is called by uC/OS-III with interrupts disabled, after it added the value
+*                 last returned by OS_DynTickGet() to OSTickCtr.
+*
+*              2) A deadline beyond the 24-bit range of the SysTick (or no deadline) is programmed as the
+*                 longest one-shot.  The kernel then programs the rest from the tick interrupt.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    CPU_INT32U  cnts;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {
+        return (ticks);
+    }
+                                                                /* Move the reference to OSTickCtr (see Note #1).       */
+    OS_CPU_DynTickRef     += (CPU_INT32U)OS_CPU_DynTickElapsed * OS_CPU_DynTickCnts;
+    OS_CPU_DynTickElapsed  = 0u;
+
+    if ((ticks == 0u) ||                                        /* See Note #2.                                         */
+        (ticks  > (OS_CPU_SYST_CNTS_MAX / OS_CPU_DynTickCnts))) {
+        ticks = (OS_TICK)(OS_CPU_SYST_CNTS_MAX / OS_CPU_DynTickCnts);
+        cnts  =  OS_CPU_SYST_CNTS_MAX;
+    } else {
+        cnts  = (OS_CPU_DynTickRef + ((CPU_INT32U)ticks * OS_CPU_DynTickCnts)) - CPU_REG_DWT_CYCCNT;
+        if ((CPU_INT32S)cnts < (CPU_INT32S)OS_CPU_SYST_CNTS_MIN) {
+            cnts = OS_CPU_SYST_CNTS_MIN;                        /* Deadline already passed, interrupt right away.       */
+        }
+    }
+
+    CPU_REG_SYST_CSR  &= ~CPU_REG_SYST_CSR_ENABLE;
+    CPU_REG_SYST_RVR   =  cnts - 1u;
+    CPU_REG_SYST_CVR   =  0u;                                   /* Reload from RVR when the timer is enabled.           */
+    CPU_REG_SCB_ICSR   =  CPU_REG_SCB_ICSR_PENDSTCLR;           /* Drop an interrupt of the previous one-shot.          */
+    CPU_REG_SYST_CSR  |=  CPU_REG_SYST_CSR_ENABLE;
+
+    return (ticks);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
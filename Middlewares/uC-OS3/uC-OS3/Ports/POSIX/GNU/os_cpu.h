@@ -39,6 +39,34 @@
 extern  "C" {
 #endif
 
+/*
+*********************************************************************************************************
+*                                          PORT CONFIGURATION
+*
+* Note(s) : (1) Configure OS_CPU_POSIX_UCONTEXT_EN with the way tasks run on the host :
+*
+*               (a) 0   Every task runs in its own host thread.  A context switch posts the semaphore of
+*                       the new task's thread and waits on the old one's.
+*
+*               (b) 1   Every task runs on the host thread that called OSStart(), on its own CPU_STK
+*                       array.  A context switch only swaps the stack pointer and the callee-saved
+*                       registers (x86-64), or calls swapcontext() (other hosts).  It requires
+*                       CPU_CFG_POSIX_INT_SAFE_PT_EN in 'cpu_cfg.h' and stacks of at least
+*                       OS_CPU_UCTX_STK_SIZE_MIN elements, see 'os_cpu_c.c  OSTaskStkInit()  Note #1'.
+*
+*           (2) OS_CFG_SMP_CORE_NBR > 1 (experimental) runs the tasks on that many simulated cores, with
+*               OS_CPU_POSIX_UCONTEXT_EN == 0 only.  CPU_CFG_POSIX_CORE_NBR must be set to the same value in
+*               'cpu_cfg.h', see 'os_cpu_c.c  OS_CPU_CoreSchedReq()'.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_POSIX_UCONTEXT_EN
+#define  OS_CPU_POSIX_UCONTEXT_EN                0u
+#endif
+
+#define  OS_CPU_UCTX_STK_SIZE_MIN             1024u             /* Min stack size with OS_CPU_POSIX_UCONTEXT_EN.        */
+
+
 /*
 *********************************************************************************************************
 *                                               MACROS
@@ -47,6 +75,8 @@ extern  "C" {
 
 #define  OS_TASK_SW()               OSCtxSw()
 
+#define  OS_CPU_CORE_ID_GET()       CPU_CoreIdGet()             /* Core of the calling thread, see 'os.h'.              */
+
 /*
 *********************************************************************************************************
 *                                       TIMESTAMP CONFIGURATION
@@ -72,6 +102,16 @@ extern  "C" {
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+OS_CPU_EXT  CPU_INT32U  OS_CPU_TickIntCtr;                      /* Number of tick interrupts serviced.                  */
+OS_CPU_EXT  CPU_INT32U  OS_CPU_TickMissedCtr;                   /* Ticks accounted for by a late tick interrupt.        */
+
+
 /*
 *********************************************************************************************************
 *                                         FUNCTION PROTOTYPES
@@ -85,6 +125,8 @@ void         OSStartHighRdy     (void);
 
 void         OS_CPU_SysTickInit (void);
 
+CPU_INT64S   OS_CPU_TickDriftGet(void);
+
 
 
 #ifdef __cplusplus
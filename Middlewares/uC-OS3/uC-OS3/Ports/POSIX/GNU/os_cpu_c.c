@@ -57,6 +57,9 @@ const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
 #include  <sys/syscall.h>
 #include  <sys/resource.h>
 #include  <errno.h>
+#if ((OS_CPU_POSIX_UCONTEXT_EN > 0u) && !defined(__x86_64__))
+#include  <ucontext.h>
+#endif
 
 
 #ifdef __cplusplus
@@ -72,6 +75,23 @@ extern  "C" {
 
 #define  THREAD_CREATE_PRIO       50u                           /* Tasks underlying posix threads prio.                 */
 
+#if ((OS_CPU_POSIX_UCONTEXT_EN > 0u) && defined(__x86_64__))
+#define  OS_CPU_UCTX_ASM_EN       1u                            /* Switch stacks with OS_CPU_CtxSwitch().               */
+#else
+#define  OS_CPU_UCTX_ASM_EN       0u
+#endif
+
+#define  OS_CPU_UCTX_FPU_CTRL_INIT  (0x1F80u | (0x037Full << 32u))  /* Default MXCSR and x87 control word.             */
+
+#define  OS_CPU_TICK_NS          (1000000000u / OS_CFG_TICK_RATE_HZ)    /* Length of one tick, in ns.                   */
+
+#if (defined(CPU_CFG_POSIX_VIRT_TIME_EN) && (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED) && \
+     (OS_CFG_DYN_TICK_EN == 0u) && (OS_CFG_TICK_WHEEL_EN == 0u))
+#define  OS_CPU_TICK_SKIP_EN      1u                            /* See 'OS_CPU_TickSkip()  Note #1'.                    */
+#else
+#define  OS_CPU_TICK_SKIP_EN      0u
+#endif
+
                                                                 /* Err handling convenience macro.                      */
 #define  ERR_CHK(func)            do {int res = func; \
                                       if (res != 0u) { \
@@ -87,6 +107,7 @@ extern  "C" {
 *********************************************************************************************************
 */
 
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
 typedef  struct  os_tcb_ext_posix {
     pthread_t  Thread;
     pid_t      ProcessId;
@@ -94,6 +115,18 @@ typedef  struct  os_tcb_ext_posix {
     sem_t      Sem;
 } OS_TCB_EXT_POSIX;
 
+typedef  struct  os_cpu_task_frame {                            /* Top of a task's stack, pointed to by '.StkPtr'.      */
+    OS_TASK_PTR   TaskPtr;
+    void         *ArgPtr;
+} OS_CPU_TASK_FRAME;
+#elif (OS_CPU_UCTX_ASM_EN == 0u)
+typedef  struct  os_cpu_uctx_frame {                            /* Top of a task's stack, pointed to by '.StkPtr'.      */
+    ucontext_t   *CtxPtr;
+    OS_TASK_PTR   TaskPtr;
+    void         *ArgPtr;
+} OS_CPU_UCTX_FRAME;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -101,6 +134,7 @@ typedef  struct  os_tcb_ext_posix {
 *********************************************************************************************************
 */
 
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
 static  void       *OSTaskPosix           (void       *p_arg);
 
 static  void        OSTaskTerminate       (OS_TCB     *p_tcb);
@@ -109,9 +143,29 @@ static  void        OSThreadCreate        (pthread_t  *p_thread,
                                            void       *p_task,
                                            void       *p_arg,
                                            int         prio);
+#else
+static  void        OS_CPU_TaskRun        (OS_TASK_PTR  p_task,
+                                           void        *p_arg);
+#if (OS_CPU_UCTX_ASM_EN > 0u)
+void                OS_CPU_CtxSwitch      (CPU_STK    **p_stk_ptr_save,
+                                           CPU_STK     *p_stk_ptr_restore);
+
+void                OS_CPU_TaskStub       (void);
+#else
+static  void        OS_CPU_TaskStart      (void);
+#endif
+#endif
 
 static  void        OSTimeTickHandler     (void);
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+static  void        OS_CPU_CoreSchedHandler (void);
+#endif
+
+#if (OS_CPU_TICK_SKIP_EN > 0u)
+static  void        OS_CPU_TickSkip       (void);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -120,6 +174,19 @@ static  void        OSTimeTickHandler     (void);
 */
 
                                                                                             /* Tick timer cfg.          */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tmr interrupt",
+                                                  .Interrupt.Prio     =  10u,
+                                                  .Interrupt.TraceEn  =  0u,
+                                                  .Interrupt.ISR_Fnct =  OSTimeTickHandler,
+                                                  .Interrupt.En       =  1u,
+                                                  .OneShot            =  1u
+                                                };
+
+                                                                /* Time of the last tick accounted for in OSTickCtr.    */
+static  CPU_INT64U         OSDynTickRef;                        /* 0 until the tick timer is started.                   */
+static  OS_TICK            OSDynTickElapsed;                    /* Last value returned by OS_DynTickGet().              */
+#else
 static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tmr interrupt",
                                                   .Interrupt.Prio     =  10u,
                                                   .Interrupt.TraceEn  =  0u,
@@ -129,6 +196,18 @@ static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tm
                                                   .PeriodSec          =  0u,
                                                   .PeriodMuSec        = (1000000u / OS_CFG_TICK_RATE_HZ)
                                                 };
+#endif
+
+static  CPU_INT64U         OS_CPU_TickRefTime;                  /* Time the tick timer was started, 0 until then.       */
+static  OS_TICK            OS_CPU_TickRefCtr;                   /* OSTickCtr when the tick timer was started.           */
+
+#if (OS_CPU_UCTX_ASM_EN > 0u)
+static  CPU_STK           *OS_CPU_MainStkPtr;                   /* Stack pointer of main(), never restored.             */
+#endif
+
+#if (OS_CFG_SMP_CORE_NBR > 1u)                                  /* Reschedule request of each core.                     */
+static  CPU_INTERRUPT      OS_CPU_CoreSchedInt[OS_CFG_SMP_CORE_NBR];
+#endif
 
 
 /*
@@ -141,6 +220,41 @@ static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tm
 #warning "Time accuracy cannot be maintained with OS_CFG_TICK_RATE_HZ > 100u.\n\n",
 #endif
 
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+#if (!defined(CPU_CFG_POSIX_INT_SAFE_PT_EN) || (CPU_CFG_POSIX_INT_SAFE_PT_EN != DEF_ENABLED))
+#error  "CPU_CFG_POSIX_INT_SAFE_PT_EN   must be DEF_ENABLED in 'cpu_cfg.h' with OS_CPU_POSIX_UCONTEXT_EN"
+#endif
+
+#if (((OS_CFG_TASK_IDLE_EN > 0u) && (OS_CFG_IDLE_TASK_STK_SIZE < OS_CPU_UCTX_STK_SIZE_MIN)) || \
+     ((OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_STAT_TASK_STK_SIZE < OS_CPU_UCTX_STK_SIZE_MIN)) || \
+     ((OS_CFG_TMR_EN       > 0u) && (OS_CFG_TMR_TASK_STK_SIZE  < OS_CPU_UCTX_STK_SIZE_MIN)) || \
+     ((OS_CFG_ISR_POST_EN  > 0u) && (OS_CFG_INT_Q_TASK_STK_SIZE < OS_CPU_UCTX_STK_SIZE_MIN)))
+#error  "OS_CFG_xxx_TASK_STK_SIZE       must be >= OS_CPU_UCTX_STK_SIZE_MIN with OS_CPU_POSIX_UCONTEXT_EN"
+#endif
+
+#if ((OS_CFG_TASK_IDLE_EN > 0u) && (OS_CFG_DBG_EN      == 0u) && (OS_CFG_STAT_TASK_EN == 0u) && \
+     (OS_CFG_APP_HOOKS_EN == 0u) && (OS_CFG_DYN_TICK_EN == 0u))
+#error  "OS_CFG_TASK_IDLE_EN            idle task never enables interrupts, see 'OSIdleTaskHook()  Note #1'"
+#endif
+
+#if (defined(CPU_CFG_POSIX_VIRT_TIME_EN) && (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED) && \
+     (OS_CFG_TASK_IDLE_EN > 0u) && (OS_CFG_APP_HOOKS_EN == 0u) && (OS_CFG_DYN_TICK_EN == 0u))
+#error  "CPU_CFG_POSIX_VIRT_TIME_EN     requires OS_CFG_APP_HOOKS_EN or OS_CFG_DYN_TICK_EN, see 'OSIdleTaskHook()  Note #2'"
+#endif
+#elif (defined(CPU_CFG_POSIX_VIRT_TIME_EN) && (CPU_CFG_POSIX_VIRT_TIME_EN == DEF_ENABLED))
+#error  "CPU_CFG_POSIX_VIRT_TIME_EN     requires OS_CPU_POSIX_UCONTEXT_EN, see 'OSIdleTaskHook()  Note #2'"
+#endif
+
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+#error  "OS_CFG_SMP_CORE_NBR > 1        requires OS_CPU_POSIX_UCONTEXT_EN == 0, see 'OS_CPU_CoreSchedReq()  Note #1'"
+#endif
+
+#if (!defined(CPU_CFG_POSIX_CORE_NBR) || (CPU_CFG_POSIX_CORE_NBR != OS_CFG_SMP_CORE_NBR))
+#error  "CPU_CFG_POSIX_CORE_NBR         must be equal to OS_CFG_SMP_CORE_NBR in 'cpu_cfg.h'"
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -151,7 +265,13 @@ static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tm
 *
 * Arguments  : None.
 *
-* Note(s)    : None.
+* Note(s)    : 1) With OS_CPU_POSIX_UCONTEXT_EN, interrupts only run where they are enabled.  The idle task
+*                 must therefore call this hook, or enter critical sections, for the tick to keep running.
+*
+*              2) With CPU_CFG_POSIX_VIRT_TIME_EN, the virtual time only jumps to the next deadline when the
+*                 idle task waits for an interrupt here.  The kernel only calls this hook with
+*                 OS_CFG_APP_HOOKS_EN or OS_CFG_DYN_TICK_EN.  The ticks without a deadline are skipped
+*                 first, see 'OS_CPU_TickSkip()'.
 *********************************************************************************************************
 */
 
@@ -163,7 +283,14 @@ void  OSIdleTaskHook (void)
     }
 #endif
 
+#if (OS_CPU_TICK_SKIP_EN > 0u)
+    OS_CPU_TickSkip();                                          /* See Note #2.                                         */
+#endif
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    CPU_WaitForInt();                                           /* Sleep until the next interrupt (see Note #1).        */
+#else
     sleep(1u);                                                  /* Reduce CPU utilization.                              */
+#endif
 }
 
 
@@ -183,6 +310,12 @@ void  OSIdleTaskHook (void)
 void  OSInitHook (void)
 {
     struct  rlimit  rtprio_limits;
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    struct  sched_param  param;
+#endif
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    CPU_INT08U      core;
+#endif
 
 
     ERR_CHK(getrlimit(RLIMIT_RTPRIO, &rtprio_limits));
@@ -191,7 +324,22 @@ void  OSInitHook (void)
         exit(-1);
     }
 
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)                             /* All tasks run in this thread, as task threads would. */
+    param.sched_priority = THREAD_CREATE_PRIO;
+    ERR_CHK(pthread_setschedparam(pthread_self(), SCHED_RR, &param));
+#endif
+
     CPU_IntInit();                                              /* Initialize critical section objects.                 */
+
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    for (core = 0u; core < OS_CFG_SMP_CORE_NBR; core++) {       /* See 'OS_CPU_CoreSchedReq()  Note #2'.                */
+        OS_CPU_CoreSchedInt[core].NamePtr  = "Core sched interrupt";
+        OS_CPU_CoreSchedInt[core].Prio     =  20u;
+        OS_CPU_CoreSchedInt[core].TraceEn  =  0u;
+        OS_CPU_CoreSchedInt[core].ISR_Fnct =  OS_CPU_CoreSchedHandler;
+        OS_CPU_CoreSchedInt[core].En       =  1u;
+    }
+#endif
 }
 
 
@@ -232,8 +380,10 @@ void  OSStatTaskHook (void)
 
 void  OSTaskCreateHook (OS_TCB  *p_tcb)
 {
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
     OS_TCB_EXT_POSIX  *p_tcb_ext;
     int                ret;
+#endif
 
 
 #if OS_CFG_APP_HOOKS_EN > 0u
@@ -242,6 +392,9 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
     }
 #endif
 
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    (void)p_tcb;                                                /* The context is built by OSTaskStkInit().             */
+#else
     p_tcb_ext = malloc(sizeof(OS_TCB_EXT_POSIX));
     p_tcb->ExtPtr = p_tcb_ext;
 
@@ -256,6 +409,7 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
             raise(SIGABRT);
         }
     } while (ret != 0);
+#endif
 }
 
 
@@ -273,9 +427,11 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
 
 void  OSTaskDelHook (OS_TCB  *p_tcb)
 {
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
     OS_TCB_EXT_POSIX  *p_tcb_ext = (OS_TCB_EXT_POSIX *)p_tcb->ExtPtr;
     pthread_t          self;
     CPU_BOOLEAN        same;
+#endif
 
 
 #if OS_CFG_APP_HOOKS_EN > 0u
@@ -284,6 +440,11 @@ void  OSTaskDelHook (OS_TCB  *p_tcb)
     }
 #endif
 
+#if (OS_CPU_UCTX_ASM_EN > 0u)
+    (void)p_tcb;                                                /* Nothing outside of the task's stack.                 */
+#elif (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    free(((OS_CPU_UCTX_FRAME *)p_tcb->StkPtr)->CtxPtr);         /* See 'OSCtxSw()  Note #3'.                            */
+#else
      self = pthread_self();
      same = (pthread_equal(self, p_tcb_ext->Thread) != 0u);
      if (same != 1u) {
@@ -291,6 +452,7 @@ void  OSTaskDelHook (OS_TCB  *p_tcb)
      }
 
      OSTaskTerminate(p_tcb);
+#endif
 }
 
 
@@ -340,6 +502,23 @@ void  OSTaskReturnHook (OS_TCB  *p_tcb)
 *
 * Returns    : Always returns the location of the new top-of-stack' once the processor registers have
 *              been placed on the stack in the proper order.
+*
+* Note(s)    : 1) With OS_CPU_POSIX_UCONTEXT_EN, the task really runs on this stack, and so do the host C
+*                 library calls it makes and the interrupts run at its safe points.  Give every task at
+*                 least OS_CPU_UCTX_STK_SIZE_MIN elements.  Without it, the stack is not used.
+*
+*              2) x86-64 frame, as OS_CPU_CtxSwitch() pops it, from the returned top-of-stack up :
+*
+*                     MXCSR and x87 control word, r15, r14, r13 = OS_CPU_TaskRun(), r12 = p_arg,
+*                     rbx = p_task, rbp, return address = OS_CPU_TaskStub(), 0
+*
+*                 The top is 16-byte aligned, so OS_CPU_TaskRun() is entered as if it had been called.
+*
+*              3) On other hosts, the frame holds a ucontext made with makecontext() on the rest of the
+*                 stack, and the task entry point and argument read by OS_CPU_TaskStart().
+*
+*              4) Without OS_CPU_POSIX_UCONTEXT_EN, the frame only holds the task entry point and argument,
+*                 read by OSTaskPosix().  The TCB keeps them only with OS_CFG_DBG_EN.
 *********************************************************************************************************
 */
 
@@ -350,7 +529,61 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
                          CPU_STK_SIZE   stk_size,
                          OS_OPT         opt)
 {
-    return (p_stk_base);
+#if (OS_CPU_UCTX_ASM_EN > 0u)
+    CPU_INT64U  *p_frame;
+
+
+    (void)p_stk_limit;
+    (void)opt;
+                                                                /* See Note #2.                                         */
+    p_frame    = (CPU_INT64U *)((CPU_ADDR)(p_stk_base + stk_size) & ~(CPU_ADDR)15u);
+   *--p_frame  = 0u;
+   *--p_frame  = (CPU_INT64U)(CPU_ADDR)OS_CPU_TaskStub;
+   *--p_frame  = 0u;                                            /* rbp                                                  */
+   *--p_frame  = (CPU_INT64U)(CPU_ADDR)p_task;                  /* rbx                                                  */
+   *--p_frame  = (CPU_INT64U)(CPU_ADDR)p_arg;                   /* r12                                                  */
+   *--p_frame  = (CPU_INT64U)(CPU_ADDR)OS_CPU_TaskRun;          /* r13                                                  */
+   *--p_frame  = 0u;                                            /* r14                                                  */
+   *--p_frame  = 0u;                                            /* r15                                                  */
+   *--p_frame  = OS_CPU_UCTX_FPU_CTRL_INIT;
+
+    return ((CPU_STK *)p_frame);
+#elif (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    OS_CPU_UCTX_FRAME  *p_frame;
+
+
+    (void)p_stk_limit;
+    (void)opt;
+                                                                /* See Note #3.                                         */
+    p_frame          = (OS_CPU_UCTX_FRAME *)(((CPU_ADDR)(p_stk_base + stk_size) - sizeof(OS_CPU_UCTX_FRAME)) &
+                                             ~(CPU_ADDR)15u);
+    p_frame->CtxPtr  = (ucontext_t *)malloc(sizeof(ucontext_t));
+    p_frame->TaskPtr = p_task;
+    p_frame->ArgPtr  = p_arg;
+    if ((p_frame->CtxPtr == (ucontext_t *)0) ||
+        (getcontext(p_frame->CtxPtr) != 0)) {
+        raise(SIGABRT);
+    }
+    p_frame->CtxPtr->uc_stack.ss_sp   = p_stk_base;
+    p_frame->CtxPtr->uc_stack.ss_size = (size_t)((CPU_INT08U *)p_frame - (CPU_INT08U *)p_stk_base);
+    p_frame->CtxPtr->uc_link          = (ucontext_t *)0;
+    makecontext(p_frame->CtxPtr, OS_CPU_TaskStart, 0);
+
+    return ((CPU_STK *)p_frame);
+#else
+    OS_CPU_TASK_FRAME  *p_frame;
+
+
+    (void)p_stk_limit;
+    (void)opt;
+                                                                /* See Note #4.                                         */
+    p_frame          = (OS_CPU_TASK_FRAME *)(((CPU_ADDR)(p_stk_base + stk_size) - sizeof(OS_CPU_TASK_FRAME)) &
+                                             ~(CPU_ADDR)15u);
+    p_frame->TaskPtr = p_task;
+    p_frame->ArgPtr  = p_arg;
+
+    return ((CPU_STK *)p_frame);
+#endif
 }
 
 
@@ -367,6 +600,11 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
 *              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
 *                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
 *                 to the task being switched out (i.e. the preempted task).
+*
+*              3) The per-task interrupts disabled time is read and cleared directly, since interrupts are
+*                 already disabled: CPU_IntDisMeasMaxCurReset() re-enables them, which runs the pending
+*                 interrupts in the middle of the context switch with CPU_CFG_POSIX_INT_FLAG_EN.  The
+*                 value is not corrected by the measurement overhead.
 *********************************************************************************************************
 */
 
@@ -397,7 +635,8 @@ void  OSTaskSwHook (void)
 #endif
 
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
-    int_dis_time = CPU_IntDisMeasMaxCurReset();             /* Keep track of per-task interrupt disable time          */
+    int_dis_time = (CPU_TS)CPU_IntDisMeasMaxCur_cnts;       /* Keep track of per-task interrupt disable time          */
+    CPU_IntDisMeasMaxCur_cnts = 0u;                         /* See Note #3.                                           */
     if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
         OSTCBCurPtr->IntDisTimeMax = int_dis_time;
     }
@@ -447,27 +686,61 @@ void  OSTimeTickHook (void)
 * Note(s)    : 1) OSStartHighRdy() MUST:
 *                      a) Call OSTaskSwHook() then,
 *                      b) Switch to the highest priority task.
+*
+*              2) With OS_CFG_SMP_CORE_NBR > 1, the first task of every core is started, the last core
+*                 first.  Each one is handed the kernel lock and releases it, so it is taken again for the
+*                 next one.  See 'cpu_c.c  CPU_CoreIdGet()  Note #3c'.  This thread takes the priority of the
+*                 task threads meanwhile: the first cores may already run tasks that never block.
 *********************************************************************************************************
 */
 
 void  OSStartHighRdy (void)
 {
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    OSTaskSwHook();
+
+    CPU_INT_DIS();                                              /* Enabled by OS_CPU_TaskRun().                         */
+
+#if (OS_CPU_UCTX_ASM_EN > 0u)
+    OS_CPU_CtxSwitch(&OS_CPU_MainStkPtr, OSTCBHighRdyPtr->StkPtr);
+#else
+    setcontext(((OS_CPU_UCTX_FRAME *)OSTCBHighRdyPtr->StkPtr)->CtxPtr);
+#endif
+#else
     OS_TCB_EXT_POSIX  *p_tcb_ext;
     sigset_t           sig_set;
     int                signo;
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    struct  sched_param  param;
+    CPU_INT08U         core;
+#endif
 
 
     OSTaskSwHook();
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    param.sched_priority = THREAD_CREATE_PRIO;                  /* See Note #2.                                         */
+    ERR_CHK(pthread_setschedparam(pthread_self(), SCHED_RR, &param));
+
+    for (core = OS_CFG_SMP_CORE_NBR; core > 0u; core--) {       /* See Note #2.                                         */
+        p_tcb_ext = (OS_TCB_EXT_POSIX *)OSTCBCurPtrTbl[core - 1u]->ExtPtr;
+
+        CPU_INT_DIS();
+
+        ERR_CHK(sem_post(&p_tcb_ext->Sem));
+    }
+#else
     p_tcb_ext = (OS_TCB_EXT_POSIX *)OSTCBCurPtr->ExtPtr;
 
     CPU_INT_DIS();
 
     ERR_CHK(sem_post(&p_tcb_ext->Sem));
+#endif
 
     ERR_CHK(sigemptyset(&sig_set));
     ERR_CHK(sigaddset(&sig_set, SIGTERM));
     ERR_CHK(sigwait(&sig_set, &signo));
+#endif
 }
 
 
@@ -505,19 +778,52 @@ void  OSStartHighRdy (void)
 *
 *                               Restore processor registers from (OSTCBHighRdy->OSTCBStkPtr);
 *                           }
+*
+*              3) With OS_CPU_POSIX_UCONTEXT_EN, the old task's context is saved on its own stack (x86-64)
+*                 or in the ucontext pointed to by its stack frame.  A task that deleted itself is never
+*                 restored, and with swapcontext() is not saved: its ucontext was freed by OSTaskDelHook().
+*
+*              4) With OS_CFG_SMP_CORE_NBR > 1, the old task may be resumed by any core.  Its thread takes
+*                 the core that resumed it, from '.CoreCur', see 'os_core.c  OS_SMP_Sched()'.
 *********************************************************************************************************
 */
 
 void  OSCtxSw (void)
 {
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    OS_TCB  *p_tcb_old;
+
+
+    OSTaskSwHook();
+
+    p_tcb_old   = OSTCBCurPtr;
+    OSTCBCurPtr = OSTCBHighRdyPtr;
+    OSPrioCur   = OSPrioHighRdy;
+
+#if (OS_CPU_UCTX_ASM_EN > 0u)                                   /* See Note #3.                                         */
+    OS_CPU_CtxSwitch(&p_tcb_old->StkPtr, OSTCBHighRdyPtr->StkPtr);
+#else
+    if (p_tcb_old->TaskState == OS_TASK_STATE_DEL) {
+        setcontext(((OS_CPU_UCTX_FRAME *)OSTCBHighRdyPtr->StkPtr)->CtxPtr);
+    }
+    swapcontext(((OS_CPU_UCTX_FRAME *)p_tcb_old->StkPtr)->CtxPtr,
+                ((OS_CPU_UCTX_FRAME *)OSTCBHighRdyPtr->StkPtr)->CtxPtr);
+#endif
+#else
     OS_TCB_EXT_POSIX  *p_tcb_ext_old;
     OS_TCB_EXT_POSIX  *p_tcb_ext_new;
     int                ret;
     CPU_BOOLEAN        detach = 0u;
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    OS_TCB            *p_tcb_old;
+#endif
 
 
     OSTaskSwHook();
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    p_tcb_old     = OSTCBCurPtr;
+#endif
     p_tcb_ext_new = (OS_TCB_EXT_POSIX *)OSTCBHighRdyPtr->ExtPtr;
     p_tcb_ext_old = (OS_TCB_EXT_POSIX *)OSTCBCurPtr->ExtPtr;
 
@@ -537,7 +843,11 @@ void  OSCtxSw (void)
                 raise(SIGABRT);
             }
         } while (ret != 0);
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+        CPU_CoreIdSet(p_tcb_old->CoreCur);                      /* See Note #4.                                         */
+#endif
     }
+#endif
 }
 
 
@@ -578,15 +888,216 @@ void  OSIntCtxSw (void)
 * Arguments  : none.
 *
 * Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) With the dynamic tick, the tick timer is a one-shot on CLOCK_MONOTONIC, or on the virtual
+*                 clock with CPU_CFG_POSIX_VIRT_TIME_EN.  It is armed for the first deadline of the kernel.
+*
+*              3) The start of the tick timer is the reference point of OS_CPU_TickDriftGet().
 *********************************************************************************************************
 */
 
 void  OS_CPU_SysTickInit (void)
 {
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_TmrInterruptDeadlineCreate(&OSTickTmrInterrupt);
+
+    CPU_CRITICAL_ENTER();
+    OSDynTickRef       = CPU_TmrInterruptTimeGet();
+    OSDynTickElapsed   = 0u;
+    OS_CPU_TickRefTime = OSDynTickRef;                          /* See Note #3.                                         */
+    OS_CPU_TickRefCtr  = OSTickCtr;
+    (void)OS_DynTickSet(OSTickCtrStep);
+    CPU_CRITICAL_EXIT();
+#else
+    CPU_CRITICAL_ENTER();
+    OS_CPU_TickRefTime = CPU_TmrInterruptTimeGet();             /* See Note #3.                                         */
+    OS_CPU_TickRefCtr  = OSTickCtr;
+    CPU_CRITICAL_EXIT();
+
     CPU_TmrInterruptCreate(&OSTickTmrInterrupt);
+#endif
 }
 
 
+/*
+*********************************************************************************************************
+*                                            GET TICK DRIFT
+*
+* Description: Return how far OSTickCtr is behind the time base of the tick timer.
+*
+* Arguments  : none.
+*
+* Returns    : The time elapsed since the tick timer was started, minus the ticks accounted for since then,
+*              in ns.  0 until the tick timer is started.
+*
+* Note(s)    : 1) Ticks are generated at absolute deadlines and the ticks of a late tick interrupt are all
+*                 accounted for, see 'OSTimeTickHandler()  Note #2', so the drift stays within one tick plus
+*                 the latency of the tick interrupt.  A drift that keeps growing means lost ticks.
+*
+*              2) With the dynamic tick, the whole ticks elapsed since the last one accounted for are not in
+*                 OSTickCtr until the kernel asks for them, they are counted here.
+*
+*              3) The time base is the virtual time with CPU_CFG_POSIX_VIRT_TIME_EN.
+*********************************************************************************************************
+*/
+
+CPU_INT64S  OS_CPU_TickDriftGet (void)
+{
+    CPU_INT64U  elapsed;
+    CPU_INT64U  ticks;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OS_CPU_TickRefTime == 0u) {
+        CPU_CRITICAL_EXIT();
+        return (0);
+    }
+    elapsed = CPU_TmrInterruptTimeGet() - OS_CPU_TickRefTime;
+    ticks   = (OS_TICK)(OSTickCtr - OS_CPU_TickRefCtr);
+#if (OS_CFG_DYN_TICK_EN > 0u)                                   /* See Note #2.                                         */
+    ticks  += (CPU_TmrInterruptTimeGet() - OSDynTickRef) / OS_CPU_TICK_NS;
+#endif
+    CPU_CRITICAL_EXIT();
+
+    return ((CPU_INT64S)elapsed - (CPU_INT64S)(ticks * OS_CPU_TICK_NS));
+}
+
+
+/*
+*********************************************************************************************************
+*                                        GET ELAPSED DYNAMIC TICKS
+*
+* Description: Return the number of whole ticks elapsed since the last tick accounted for in OSTickCtr.
+*
+* Arguments  : none.
+*
+* Returns    : The number of elapsed ticks, 0 until the tick timer is started.
+*
+* Note(s)    : 1) This function is called by uC/OS-III with interrupts disabled.
+*
+*              2) The kernel adds the value returned here to OSTickCtr before it calls OS_DynTickSet().  The
+*                 value is kept so that OS_DynTickSet() can move the reference point by the same amount.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    if (OSDynTickRef == 0u) {
+        return (0u);
+    }
+
+    OSDynTickElapsed = (OS_TICK)((CPU_TmrInterruptTimeGet() - OSDynTickRef) / OS_CPU_TICK_NS);
+
+    return (OSDynTickElapsed);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SET NEXT DYNAMIC TICK
+*
+* Description: Arm the tick timer to expire 'ticks' ticks after the last tick accounted for in OSTickCtr.
+*
+* Arguments  : ticks        Number of ticks to the next deadline, 0 if the kernel has none.
+*
+* Returns    : The number of ticks programmed.
+*
+* Note(s)    : 1) This function is called by uC/OS-III with interrupts disabled.
+*
+*              2) The deadline is absolute, so the time spent in the kernel since the reference point does
+*                 not delay it.  Without a deadline the timer is stopped.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    CPU_INT64U  deadline;
+
+
+    if (OSDynTickRef == 0u) {
+        return (ticks);
+    }
+
+    OSDynTickRef     += (CPU_INT64U)OSDynTickElapsed * OS_CPU_TICK_NS;
+    OSDynTickElapsed  = 0u;
+
+    if (ticks == 0u) {                                          /* See Note #2.                                         */
+        deadline = 0u;
+    } else {
+        deadline = OSDynTickRef + ((CPU_INT64U)ticks * OS_CPU_TICK_NS);
+    }
+    CPU_TmrInterruptDeadlineSet(&OSTickTmrInterrupt, deadline);
+
+    return (ticks);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        ATOMIC COMPARE AND SWAP
+*
+* Description: Store 'val' in '*p_dst' if '*p_dst' holds 'cmp'.
+*
+* Arguments  : p_dst        Pointer to the word to update.
+*
+*              cmp          Expected value.
+*
+*              val          New value.
+*
+* Returns    : DEF_YES if 'val' was stored, DEF_NO otherwise.
+*
+* Note(s)    : 1) Uses the GCC '__atomic' built-ins, which follow the C11 memory model, since the kernel
+*                 objects can not be declared '_Atomic'.
+*********************************************************************************************************
+*/
+
+#if ((OS_CFG_MUTEX_FAST_EN > 0u) || ((OS_CFG_MEM_EN > 0u) && (OS_CFG_MEM_LOCK_FREE_EN > 0u)))
+CPU_BOOLEAN  OS_CPU_CmpXchg (void  **p_dst,
+                             void   *cmp,
+                             void   *val)
+{
+    if (__atomic_compare_exchange_n(p_dst, &cmp, val, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return (DEF_YES);
+    }
+
+    return (DEF_NO);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       CORE RESCHEDULE REQUEST
+*
+* Description: Make a core run the scheduler, as an inter-processor interrupt would.
+*
+* Arguments  : core         Core that must reschedule.
+*
+* Note(s)    : 1) With OS_CFG_SMP_CORE_NBR > 1, each core is a task thread, see 'cpu_c.c  CPU_CoreIdGet()'.
+*                 Up to OS_CFG_SMP_CORE_NBR tasks run at once, which requires one host thread per task.
+*
+*              2) Each core has its own interrupt, triggered on that core only.  Its ISR does nothing but
+*                 go through OSIntExit(), which picks the core's next task.  A request to a core that has
+*                 one pending already is merged with it.
+*
+*              3) Called by the kernel with interrupts disabled, see 'os_core.c  OS_SMP_Sched()  Note #3'.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+void  OS_CPU_CoreSchedReq (CPU_INT08U  core)
+{
+    CPU_InterruptTriggerCore(&OS_CPU_CoreSchedInt[core], core); /* See Note #2.                                         */
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -595,15 +1106,245 @@ void  OS_CPU_SysTickInit (void)
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                          OSTimeTickHandler()
+*
+* Description: Tick timer interrupt handler.
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) With the dynamic tick, the whole ticks elapsed since the reference point are reported to
+*                 the kernel.  A stale interrupt of a replaced deadline reports nothing.  The ticks past the
+*                 programmed deadline were missed by a late interrupt.
+*
+*              2) With the periodic tick, the tick timer counts its expiries, and the host may run this
+*                 handler once for several of them.  The late ticks are accounted for at once, which readies
+*                 the tasks they expire as OSTimeDynTick() would, before the current one goes through
+*                 OSTimeTick() as usual.  OSTimeTickHook() and round-robin do not see the late ticks.
+*********************************************************************************************************
+*/
+
 static  void  OSTimeTickHandler (void)
 {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  ticks;
+    OS_TICK  step;
+    CPU_SR_ALLOC();
+
+
     OSIntEnter();
-    OSTimeTick();
+    CPU_CRITICAL_ENTER();
+    ticks             = (OS_TICK)((CPU_TmrInterruptTimeGet() - OSDynTickRef) / OS_CPU_TICK_NS);
+    OSDynTickRef     += (CPU_INT64U)ticks * OS_CPU_TICK_NS;
+    OSDynTickElapsed  = 0u;
+    step              = OSTickCtrStep;
+    CPU_CRITICAL_EXIT();
+    if (ticks > 0u) {                                           /* See Note #1.                                         */
+        if ((step > 0u) && (ticks > step)) {
+            OS_CPU_TickMissedCtr += ticks - step;
+        }
+        OSTimeDynTick(ticks);
+    }
+#else
+    CPU_INT32U  ticks;
+
+
+    OSIntEnter();
+    ticks = CPU_TmrInterruptExpGet(&OSTickTmrInterrupt);
+    if (ticks > 1u) {                                           /* See Note #2.                                         */
+        OS_TickUpdate((OS_TICK)(ticks - 1u));
+        OS_CPU_TickMissedCtr += ticks - 1u;
+    }
+    if (ticks > 0u) {
+        OSTimeTick();
+    }
+#endif
+    OS_CPU_TickIntCtr++;
     CPU_ISR_End();
     OSIntExit();
 }
 
 
+/*
+*********************************************************************************************************
+*                                      OS_CPU_CoreSchedHandler()
+*
+* Description: Core reschedule interrupt handler.
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) See 'OS_CPU_CoreSchedReq()  Note #2'.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+static  void  OS_CPU_CoreSchedHandler (void)
+{
+    OSIntEnter();
+    CPU_ISR_End();
+    OSIntExit();                                                /* See Note #1.                                         */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_TickSkip()
+*
+* Description: Move the virtual time to the tick before the next deadline of the tick list.
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) With CPU_CFG_POSIX_VIRT_TIME_EN and the periodic tick, an idle system would still take one
+*                 tick interrupt per tick of virtual time.  The ticks that expire no delay or timeout are
+*                 skipped instead, and added to OSTickCtr at once.  The last tick before the deadline is
+*                 left to the tick interrupt, which readies the task through OSTimeTick() as usual.  The
+*                 dynamic tick does not need this, its timer is armed for the next deadline.
+*
+*              2) The head of the tick list is the next delay or timeout to expire.  The timer task waits
+*                 there for the first timer of 'OSTmrListPtr', so timers are covered as well.  With the tick
+*                 wheel, there is no cheap next deadline and ticks are not skipped.
+*
+*              3) OS_TickUpdate() is given fewer ticks than the head's remaining ones, so it readies no task.
+*                 OSTimeTickHook() and round-robin do not see the skipped ticks, no task but idle was ready.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_TICK_SKIP_EN > 0u)
+static  void  OS_CPU_TickSkip (void)
+{
+    OS_TICK  ticks;
+    CPU_SR_ALLOC();
+
+
+    ticks = 0u;
+    CPU_CRITICAL_ENTER();
+    if (OSTickList.TCB_Ptr != (OS_TCB *)0) {                    /* See Note #2.                                         */
+        ticks = OSTickList.TCB_Ptr->TickRemain;
+        if (ticks > 1u) {
+            ticks = (OS_TICK)CPU_TmrInterruptSkip(&OSTickTmrInterrupt, ticks - 1u);
+        } else {
+            ticks = 0u;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (ticks > 0u) {
+        OS_TickUpdate(ticks);                                   /* See Note #3.                                         */
+    }
+}
+#endif
+
+
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+/*
+*********************************************************************************************************
+*                                          OS_CPU_TaskRun()
+*
+* Description: Runs a task on its own stack, in the single host thread.
+*
+* Arguments  : p_task       Pointer to the task's code.
+*
+*              p_arg        Argument passed to the task.
+*
+* Note(s)    : 1) Interrupts were disabled by the OSCtxSw() or OSStartHighRdy() that switched to the task.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TaskRun (OS_TASK_PTR   p_task,
+                              void         *p_arg)
+{
+    CPU_INT_EN();                                               /* See Note #1.                                         */
+
+    p_task(p_arg);
+
+    OS_TaskReturn();
+}
+
+
+#if (OS_CPU_UCTX_ASM_EN > 0u)
+/*
+*********************************************************************************************************
+*                                         OS_CPU_CtxSwitch()
+*                                          OS_CPU_TaskStub()
+*
+* Description: OS_CPU_CtxSwitch() saves the callee-saved registers, MXCSR and the x87 control word on the
+*              current stack, stores the stack pointer in '*p_stk_ptr_save', then loads 'p_stk_ptr_restore'
+*              and restores the same registers from it.
+*
+*              OS_CPU_TaskStub() is where the first switch to a task returns to.  It calls
+*              OS_CPU_TaskRun() with the task and its argument, left in RBX and R12 by OSTaskStkInit().
+*
+* Note(s)    : 1) Caller-saved registers need no saving: OS_CPU_CtxSwitch() is an ordinary function call
+*                 for the compiler.
+*
+*              2) The frame layout must match OSTaskStkInit().
+*********************************************************************************************************
+*/
+
+__asm__ (
+    "    .text                                  \n"
+    "    .globl   OS_CPU_CtxSwitch              \n"
+    "    .hidden  OS_CPU_CtxSwitch              \n"
+    "    .type    OS_CPU_CtxSwitch, @function   \n"
+    "OS_CPU_CtxSwitch:                          \n"
+    "    pushq    %rbp                          \n"
+    "    pushq    %rbx                          \n"
+    "    pushq    %r12                          \n"
+    "    pushq    %r13                          \n"
+    "    pushq    %r14                          \n"
+    "    pushq    %r15                          \n"
+    "    subq     $8, %rsp                      \n"
+    "    stmxcsr  (%rsp)                        \n"
+    "    fnstcw   4(%rsp)                       \n"
+    "    movq     %rsp, (%rdi)                  \n"
+    "    movq     %rsi, %rsp                    \n"
+    "    ldmxcsr  (%rsp)                        \n"
+    "    fldcw    4(%rsp)                       \n"
+    "    addq     $8, %rsp                      \n"
+    "    popq     %r15                          \n"
+    "    popq     %r14                          \n"
+    "    popq     %r13                          \n"
+    "    popq     %r12                          \n"
+    "    popq     %rbx                          \n"
+    "    popq     %rbp                          \n"
+    "    ret                                    \n"
+    "    .size    OS_CPU_CtxSwitch, .-OS_CPU_CtxSwitch\n"
+    "                                           \n"
+    "    .globl   OS_CPU_TaskStub               \n"
+    "    .hidden  OS_CPU_TaskStub               \n"
+    "    .type    OS_CPU_TaskStub, @function    \n"
+    "OS_CPU_TaskStub:                           \n"
+    "    movq     %rbx, %rdi                    \n"
+    "    movq     %r12, %rsi                    \n"
+    "    jmp      *%r13                         \n"
+    "    .size    OS_CPU_TaskStub, .-OS_CPU_TaskStub\n"
+);
+
+#else
+/*
+*********************************************************************************************************
+*                                         OS_CPU_TaskStart()
+*
+* Description: Entry point given to makecontext(), which cannot portably pass pointers.  The task and its
+*              argument are read back from the frame built by OSTaskStkInit().
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TaskStart (void)
+{
+    OS_CPU_UCTX_FRAME  *p_frame;
+
+
+    p_frame = (OS_CPU_UCTX_FRAME *)OSTCBCurPtr->StkPtr;
+
+    OS_CPU_TaskRun(p_frame->TaskPtr, p_frame->ArgPtr);
+}
+#endif
+
+
+#else
 /*
 *********************************************************************************************************
 *                                      OSTaskPosix()
@@ -618,9 +1359,10 @@ static  void  OSTimeTickHandler (void)
 
 static void  *OSTaskPosix (void  *p_arg)
 {
-    OS_TCB_EXT_POSIX  *p_tcb_ext;
-    OS_TCB            *p_tcb;
-    OS_ERR             err;
+    OS_TCB_EXT_POSIX   *p_tcb_ext;
+    OS_CPU_TASK_FRAME  *p_frame;
+    OS_TCB             *p_tcb;
+    OS_ERR              err;
 
 
     p_tcb     = (OS_TCB           *)p_arg;
@@ -635,7 +1377,7 @@ static void  *OSTaskPosix (void  *p_arg)
     }
 #endif
 
-    CPU_INT_DIS();
+    CPU_IntDisLocal();                                          /* Handed the kernel lock by the first CTX SW.          */
     {
         int ret = -1u;
         while (ret != 0u) {
@@ -645,9 +1387,13 @@ static void  *OSTaskPosix (void  *p_arg)
             }
         }
     }
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    CPU_CoreIdSet(p_tcb->CoreCur);                              /* See 'OSCtxSw()  Note #4'.                            */
+#endif
     CPU_INT_EN();
 
-    ((void (*)(void *))p_tcb->TaskEntryAddr)(p_tcb->TaskEntryArg);
+    p_frame = (OS_CPU_TASK_FRAME *)p_tcb->StkPtr;               /* See 'OSTaskStkInit()  Note #4'.                      */
+    p_frame->TaskPtr(p_frame->ArgPtr);
 
     OSTaskDel(p_tcb, &err);                                     /* Thread may exit at OSCtxSw().                        */
 
@@ -723,6 +1469,7 @@ static  void  OSThreadCreate (pthread_t  *p_thread,
     ERR_CHK(pthread_attr_setschedparam(&attr, &param));
     ERR_CHK(pthread_create(p_thread, &attr, p_task, p_arg));
 }
+#endif
 
 
 #ifdef __cplusplus
@@ -73,6 +73,78 @@ extern "C" {
 #define  OS_CFG_INVALID_OS_CALLS_CHK_EN  0u
 #endif
 
+#ifndef OS_CFG_TICK_WHEEL_EN
+#define  OS_CFG_TICK_WHEEL_EN            0u
+#endif
+
+#ifndef OS_CFG_TMR_WHEEL_EN
+#define  OS_CFG_TMR_WHEEL_EN             0u
+#endif
+
+#ifndef OS_CFG_ISR_POST_EN
+#define  OS_CFG_ISR_POST_EN              0u
+#endif
+
+#ifndef OS_CFG_PEND_LIST_PRIO_TBL_EN
+#define  OS_CFG_PEND_LIST_PRIO_TBL_EN    0u
+#endif
+
+#ifndef OS_CFG_STREAM_EN
+#define  OS_CFG_STREAM_EN                0u
+#endif
+
+#ifndef OS_CFG_STREAM_DEL_EN
+#define  OS_CFG_STREAM_DEL_EN            0u
+#endif
+
+#ifndef OS_CFG_Q_MULTI_EN
+#define  OS_CFG_Q_MULTI_EN               0u
+#endif
+
+#ifndef OS_CFG_TASK_Q_MULTI_EN
+#define  OS_CFG_TASK_Q_MULTI_EN          0u
+#endif
+
+#ifndef OS_CFG_MUTEX_FAST_EN
+#define  OS_CFG_MUTEX_FAST_EN            0u
+#endif
+
+#ifndef OS_CFG_COND_EN
+#define  OS_CFG_COND_EN                  0u
+#endif
+
+#ifndef OS_CFG_COND_DEL_EN
+#define  OS_CFG_COND_DEL_EN              0u
+#endif
+
+#ifndef OS_CFG_SMP_CORE_NBR
+#define  OS_CFG_SMP_CORE_NBR             1u
+#endif
+
+#ifndef OS_CFG_MEM_CLASS_NBR
+#define  OS_CFG_MEM_CLASS_NBR            0u
+#endif
+
+#ifndef OS_CFG_MEM_CLASS_SIZE_MIN_LOG2
+#define  OS_CFG_MEM_CLASS_SIZE_MIN_LOG2  4u
+#endif
+
+#ifndef OS_CFG_MEM_MAG_SIZE
+#define  OS_CFG_MEM_MAG_SIZE             0u
+#endif
+
+#ifndef OS_CFG_MEM_LOCK_FREE_EN
+#define  OS_CFG_MEM_LOCK_FREE_EN         0u
+#endif
+
+#ifndef OS_CFG_BUF_EN
+#define  OS_CFG_BUF_EN                   0u
+#endif
+
+#ifndef OS_CFG_MSG_POOL_PRIV_EN
+#define  OS_CFG_MSG_POOL_PRIV_EN         0u
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -121,6 +193,11 @@ extern "C" {
 
 #define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN > 0u) || (OS_CFG_OBJ_TYPE_CHK_EN > 0u)) ? 1u : 0u)
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+#define  OS_TMR_WHEEL_SIZE          (1u << OS_CFG_TMR_WHEEL_BITS)                       /* Nbr of spokes per wheel level */
+#define  OS_TMR_WHEEL_MASK          (OS_TMR_WHEEL_SIZE - 1u)
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -171,6 +248,7 @@ extern "C" {
 #define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
+#define  OS_TASK_PEND_ON_STREAM               (OS_STATE)(  8u)  /* Pending on data in a stream buffer                 */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -195,13 +273,17 @@ extern "C" {
 */
 
 #define  OS_OBJ_TYPE_NONE                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('N', 'O', 'N', 'E')
+#define  OS_OBJ_TYPE_BUF                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('B', 'U', 'F', ' ')
 #define  OS_OBJ_TYPE_FLAG                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('F', 'L', 'A', 'G')
 #define  OS_OBJ_TYPE_MEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'E', 'M', ' ')
 #define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
 #define  OS_OBJ_TYPE_COND                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('C', 'O', 'N', 'D')
 #define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
 #define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
+#define  OS_OBJ_TYPE_STREAM                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'T', 'R', 'M')
 #define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
+#define  OS_OBJ_TYPE_TASK_MSG                (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'S', 'G')
+#define  OS_OBJ_TYPE_TASK_SIGNAL             (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'S', 'I', 'G')
 
 /*
 ========================================================================================================================
@@ -219,6 +301,7 @@ extern "C" {
 
 #define  OS_OPT_DEL_NO_PEND                  (OS_OPT)(0x0000u)
 #define  OS_OPT_DEL_ALWAYS                   (OS_OPT)(0x0001u)
+#define  OS_OPT_DEL_BUF                      (OS_OPT)(0x0002u)  /* OSQDel(): release the buffers still in the queue    */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -284,6 +367,10 @@ extern "C" {
 #define  OS_OPT_TASK_STK_CLR                 (OS_OPT)(0x0002u)  /* Clear the stack when the task is create            */
 #define  OS_OPT_TASK_SAVE_FP                 (OS_OPT)(0x0004u)  /* Save the contents of any floating-point registers  */
 #define  OS_OPT_TASK_NO_TLS                  (OS_OPT)(0x0008u)  /* Specifies the task DOES NOT require TLS support    */
+#define  OS_OPT_TASK_CORE(core)  (OS_OPT)(0x0100u << (core))    /* Task may run on 'core', none = any core (SMP)     */
+#define  OS_OPT_TASK_CORE_MASK               (OS_OPT)(0xFF00u)  /* All the OS_OPT_TASK_CORE() bits                   */
+
+#define  OS_CORE_NONE                    (CPU_INT08U)(0xFFu)    /* Task is not running on any core (SMP)             */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -375,6 +462,12 @@ typedef  enum  os_err {
     OS_ERR_ACCEPT_ISR                = 10001u,
 
     OS_ERR_B                         = 11000u,
+    OS_ERR_BUF_HEADROOM              = 11001u,
+    OS_ERR_BUF_INVALID_P_BUF         = 11002u,
+    OS_ERR_BUF_INVALID_P_POOL        = 11003u,
+    OS_ERR_BUF_INVALID_SIZE          = 11004u,
+    OS_ERR_BUF_NO_FREE_BUFS          = 11005u,
+    OS_ERR_BUF_SHARED                = 11006u,
 
     OS_ERR_C                         = 12000u,
     OS_ERR_CREATE_ISR                = 12001u,
@@ -398,7 +491,11 @@ typedef  enum  os_err {
 
     OS_ERR_I                         = 18000u,
     OS_ERR_ILLEGAL_CREATE_RUN_TIME   = 18001u,
-
+    OS_ERR_INT_Q                     = 18002u,
+    OS_ERR_INT_Q_FULL                = 18003u,
+    OS_ERR_INT_Q_SIZE                = 18004u,
+    OS_ERR_INT_Q_STK_INVALID         = 18005u,
+    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,
     OS_ERR_ILLEGAL_DEL_RUN_TIME      = 18007u,
 
     OS_ERR_J                         = 19000u,
@@ -470,6 +567,7 @@ typedef  enum  os_err {
     OS_ERR_Q_EMPTY                   = 26002u,
     OS_ERR_Q_MAX                     = 26003u,
     OS_ERR_Q_SIZE                    = 26004u,
+    OS_ERR_Q_NOT_EMPTY               = 26005u,
 
     OS_ERR_R                         = 27000u,
     OS_ERR_REG_ID_INVALID            = 27001u,
@@ -497,6 +595,11 @@ typedef  enum  os_err {
     OS_ERR_STK_LIMIT_INVALID         = 28209u,
     OS_ERR_STK_OVF                   = 28210u,
 
+    OS_ERR_STREAM_COMMIT_INVALID     = 28301u,
+    OS_ERR_STREAM_FULL               = 28302u,
+    OS_ERR_STREAM_SIZE_INVALID       = 28303u,
+    OS_ERR_STREAM_TRIGGER_INVALID    = 28304u,
+
     OS_ERR_T                         = 29000u,
     OS_ERR_TASK_CHANGE_PRIO_ISR      = 29001u,
     OS_ERR_TASK_CREATE_ISR           = 29002u,
@@ -588,11 +691,17 @@ typedef  enum  os_err {
 ************************************************************************************************************************
 */
 
+typedef  struct  os_buf              OS_BUF;
+typedef  struct  os_buf_pool         OS_BUF_POOL;
+
 typedef  struct  os_flag_grp         OS_FLAG_GRP;
 
+typedef  struct  os_int_q            OS_INT_Q;
+
 typedef  struct  os_mem              OS_MEM;
 
 typedef  struct  os_msg              OS_MSG;
+typedef  struct  os_msg_info         OS_MSG_INFO;
 typedef  struct  os_msg_pool         OS_MSG_POOL;
 typedef  struct  os_msg_q            OS_MSG_Q;
 
@@ -604,6 +713,8 @@ typedef  struct  os_q                OS_Q;
 
 typedef  struct  os_sem              OS_SEM;
 
+typedef  struct  os_stream           OS_STREAM;
+
 typedef  void                      (*OS_TASK_PTR)(void *p_arg);
 
 typedef  struct  os_tcb              OS_TCB;
@@ -621,9 +732,11 @@ typedef  void                      (*OS_TLS_DESTRUCT_PTR)(OS_TCB    *p_tcb,
 typedef  struct  os_rdy_list         OS_RDY_LIST;
 
 typedef  struct  os_tick_list        OS_TICK_LIST;
+typedef  struct  os_tick_spoke       OS_TICK_SPOKE;
 
 typedef  void                      (*OS_TMR_CALLBACK_PTR)(void *p_tmr, void *p_arg);
 typedef  struct  os_tmr              OS_TMR;
+typedef  struct  os_tmr_spoke        OS_TMR_SPOKE;
 
 typedef  struct  os_pend_list        OS_PEND_LIST;
 typedef  struct  os_pend_obj         OS_PEND_OBJ;
@@ -669,6 +782,10 @@ struct  os_pend_list {
 #if (OS_CFG_DBG_EN > 0u)
     OS_OBJ_QTY           NbrEntries;
 #endif
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+    CPU_DATA             PrioTbl[OS_PRIO_TBL_SIZE];         /* Bitmap of the priorities with at least one waiter      */
+    OS_TCB              *PrioHeadPtr[OS_CFG_PRIO_MAX];      /* First (oldest) waiter at each priority                 */
+#endif
 };
 
 
@@ -677,9 +794,9 @@ struct  os_pend_list {
 *                                                       PEND OBJ
 *
 * Note(s) : (1) The 'os_pend_obj' structure data type is a template/subset for specific kernel objects' data types:
-*               'os_flag_grp', 'os_mutex', 'os_q', and 'os_sem'.  Each specific kernel object data type MUST define
-*               ALL generic OS pend object parameters, synchronized in both the sequential order & data type of each
-*               parameter.
+*               'os_flag_grp', 'os_mutex', 'os_q', 'os_sem' and 'os_stream'.  Each specific kernel object data type
+*               MUST define ALL generic OS pend object parameters, synchronized in both the sequential order & data
+*               type of each parameter.
 *
 *               Thus, ANY modification to the sequential order or data types of OS pend object parameters MUST be
 *               appropriately synchronized between the generic OS pend object data type & ALL specific kernel objects'
@@ -752,11 +869,26 @@ struct os_mem {                                             /* MEMORY CONTROL BL
     CPU_CHAR            *NamePtr;
 #endif
     void                *AddrPtr;                           /* Pointer to beginning of memory partition               */
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    CPU_ADDR             FreeListTop;                       /* Tag and index + 1 of the first free block, 0 if none   */
+#else
     void                *FreeListPtr;                       /* Pointer to list of free memory blocks                  */
+#endif
     OS_MEM_SIZE          BlkSize;                           /* Size (in bytes) of each block of memory                */
     OS_MEM_QTY           NbrMax;                            /* Total number of blocks in this partition               */
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    CPU_ADDR             NbrFree;                           /* Number of memory blocks remaining, updated atomically  */
+#else
     OS_MEM_QTY           NbrFree;                           /* Number of memory blocks remaining in this partition    */
+#endif
 #if (OS_CFG_DBG_EN > 0u)
+    OS_MEM_QTY           NbrUsedMax;                        /* Peak number of blocks taken from this partition        */
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+    OS_CTR               MissCtr;                           /* OSMemAlloc() of this size class found it empty         */
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+    OS_CTR               MagMissCtr;                        /* Task magazine refills and flushes from/to partition    */
+#endif
+#endif
     OS_MEM              *DbgPrevPtr;
     OS_MEM              *DbgNextPtr;
 #endif
@@ -766,6 +898,42 @@ struct os_mem {                                             /* MEMORY CONTROL BL
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                       BUFFERS
+*
+* Note(s) : (1) A buffer is a block of the memory partition of its pool: the OS_BUF header followed by its data.  See
+*               'os_buf.c  Note #1'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+
+struct  os_buf {                                            /* REFERENCE COUNTED BUFFER                               */
+    OS_BUF              *NextPtr;                           /* Next buffer of the chain                               */
+    OS_BUF_POOL         *PoolPtr;                           /* Pool the buffer returns to                             */
+    OS_BUF              *RefPtr;                            /* Clone: buffer holding the data, else 0                 */
+    CPU_INT08U          *PayloadPtr;                        /* First byte of data                                     */
+    OS_MSG_SIZE          Len;                               /* Bytes of data in this buffer                           */
+    OS_MSG_SIZE          TotLen;                            /* Bytes of data in this buffer and the rest of the chain */
+    OS_OBJ_QTY           RefCtr;                            /* References to this buffer, see os_buf.c  Note #2       */
+};
+
+
+struct  os_buf_pool {                                       /* BUFFER POOL                                            */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_BUF                       */
+#endif
+    OS_MEM               Mem;                               /* Partition holding the buffers                          */
+    OS_MSG_SIZE          DataSize;                          /* Bytes of data per buffer, after the header             */
+    OS_MSG_SIZE          Headroom;                          /* Bytes kept in front of the data of a new chain         */
+    OS_MEM_QTY           NbrUsed;                           /* Buffers taken from the pool                            */
+    OS_MEM_QTY           NbrUsedMax;                        /* Peak number of buffers taken from the pool             */
+    OS_CTR               AllocCtr;                          /* Buffers taken, clone headers included                  */
+    OS_CTR               FreeCtr;                           /* Buffers returned                                       */
+    OS_CTR               FailCtr;                           /* OSBufAlloc()/OSBufClone() that found the pool empty    */
+};
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                       MESSAGES
@@ -783,13 +951,26 @@ struct  os_msg {                                            /* MESSAGE CONTROL B
 
 
 
+struct  os_msg_info {                                       /* MESSAGE OF A MULTIPLE POST OR PEND                     */
+    void                *MsgPtr;                            /* Actual message                                         */
+    OS_MSG_SIZE          MsgSize;                           /* Size of the message (in # bytes)                       */
+};
+
+
+
 
 struct  os_msg_pool {                                       /* OS_MSG POOL                                            */
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+    OS_MSG_POOL         *DbgPrevPtr;
+    OS_MSG_POOL         *DbgNextPtr;
+#endif
     OS_MSG              *NextPtr;                           /* Pointer to next message                                */
     OS_MSG_QTY           NbrFree;                           /* Number of messages available from this pool            */
     OS_MSG_QTY           NbrUsed;                           /* Current number of messages used                        */
 #if (OS_CFG_DBG_EN > 0u)
     OS_MSG_QTY           NbrUsedMax;                        /* Peak number of messages used                           */
+    OS_CTR               EmptyCtr;                          /* Posts refused with OS_ERR_MSG_POOL_EMPTY               */
 #endif
 };
 
@@ -803,6 +984,9 @@ struct  os_msg_q {                                          /* OS_MSG_Q
 #if (OS_CFG_DBG_EN > 0u)
     OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
 #endif
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+    OS_MSG_POOL         *PoolPtr;                           /* Pool the OS_MSGs are taken from, see os_msg.c Note #1  */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
     CPU_INT16U           MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -835,6 +1019,13 @@ struct  os_mutex {                                          /* Mutual Exclusion
     OS_MUTEX            *MutexGrpNextPtr;
     OS_TCB              *OwnerTCBPtr;
     OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    void                *FastLockPtr;                       /* Fast path owner, NULL or the mutex itself (os_mutex.c) */
+    OS_CTR               FastCtr;                           /* Number of pends and posts done on the fast path        */
+    OS_CTR               SlowCtr;                           /* Number of pends and posts done on the slow path        */
+    OS_MUTEX            *FastPrevPtr;                       /* Links of the list of created mutexes (OSTaskDel())     */
+    OS_MUTEX            *FastNextPtr;
+#endif
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS               TS;
 #endif
@@ -858,12 +1049,12 @@ struct  os_cond {                                           /* Condition Variabl
     OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_COND                      */
 #endif
 #if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;                           /* Pointer to Mutex Name (NUL terminated ASCII)           */
+    CPU_CHAR            *NamePtr;                           /* Pointer to Cond. Var. Name (NUL terminated ASCII)      */
 #endif
     OS_PEND_LIST         PendList;                          /* List of tasks waiting on condition variable            */
 #if (OS_CFG_DBG_EN > 0u)
-    void                *DbgPrevPtr;
-    void                *DbgNextPtr;
+    OS_COND             *DbgPrevPtr;
+    OS_COND             *DbgNextPtr;
     CPU_CHAR            *DbgNamePtr;
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
@@ -931,6 +1122,52 @@ struct  os_sem {                                            /* Semaphore
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    STREAM BUFFERS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) A stream buffer is a byte ring with a single writer and a single reader.  '.In' is only written by the
+*               writer and '.Out' only by the reader.  Both run freely and are masked with '.Size - 1' to index the
+*               ring, so '.In - .Out' is the number of bytes in the ring.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_stream {                                         /* Stream Buffer                                          */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_STREAM                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Stream Buffer Name (NUL terminated ASCII)   */
+#endif
+    OS_PEND_LIST         PendList;                          /* Reader waiting on the stream buffer                    */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_STREAM           *DbgPrevPtr;
+    OS_STREAM           *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    CPU_INT08U          *BufPtr;                            /* Pointer to the storage of the ring                     */
+    OS_MSG_SIZE          Size;                              /* Size of the ring in bytes, a power of 2                */
+    OS_MSG_SIZE          TriggerLevel;                      /* Number of bytes that wakes up the reader               */
+    OS_MSG_SIZE          PendLevel;                         /* Number of bytes the waiting reader needs               */
+    volatile  OS_MSG_SIZE  In;                              /* Write index, only written by the writer                */
+    volatile  OS_MSG_SIZE  Out;                             /* Read  index, only written by the reader                */
+#if (OS_CFG_ISR_POST_EN > 0u)
+    CPU_BOOLEAN          PostPend;                          /* A wake-up is waiting in the ISR queue                  */
+#endif
+    OS_CTR               OvfCtr;                            /* Number of bytes dropped because the ring was full      */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MSG_SIZE          NbrBytesMax;                       /* Peak number of bytes in the ring                       */
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;                                /* Timestamp of the last wake-up of the reader            */
+#endif
+};
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                  TASK CONTROL BLOCK
@@ -954,6 +1191,9 @@ struct os_tcb {
 #if (OS_CFG_TICK_EN > 0u)
     OS_TCB              *TickNextPtr;
     OS_TCB              *TickPrevPtr;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TICK_SPOKE       *TickSpokePtr;                      /* Pointer to tick spoke if task is in the tick wheel     */
+#endif
 #endif
 
 #if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) || (OS_CFG_TASK_STK_REDZONE_EN > 0u))
@@ -972,6 +1212,9 @@ struct os_tcb {
     OS_TCB              *PendNextPtr;                       /* Pointer to next     TCB in pend list.                  */
     OS_TCB              *PendPrevPtr;                       /* Pointer to previous TCB in pend list.                  */
     OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+    OS_PRIO              PendPrio;                          /* Priority the task is queued at in the pend list        */
+#endif
     OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
     OS_STATUS            PendStatus;                        /* Pend status                                            */
 
@@ -986,6 +1229,10 @@ struct os_tcb {
     CPU_STK_SIZE         StkSize;                           /* Size of task stack (in number of stack elements)       */
 #endif
     OS_OPT               Opt;                               /* Task options as passed by OSTaskCreate()               */
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    CPU_INT08U           CoreCur;                           /* Core running the task, OS_CORE_NONE if none            */
+    CPU_INT08U           CoreMask;                          /* Cores the task may run on, one bit per core            */
+#endif
 
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS               TS;                                /* Timestamp                                              */
@@ -999,6 +1246,9 @@ struct os_tcb {
 #if (OS_CFG_TICK_EN > 0u)
     OS_TICK              TickRemain;                        /* Number of ticks remaining                              */
     OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TICK              TickCtrMatch;                      /* Absolute wheel count at which the delay expires        */
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
@@ -1058,6 +1308,11 @@ struct os_tcb {
     CPU_TS               SchedLockTimeMax;                  /* Maximum scheduler lock time                            */
 #endif
 
+#if ((OS_CFG_MEM_EN > 0u) && (OS_CFG_MEM_CLASS_NBR > 0u) && (OS_CFG_MEM_MAG_SIZE > 0u))
+    void                *MemMagTbl[OS_CFG_MEM_CLASS_NBR];  /* Per size class list of blocks cached by OSMemFree()   */
+    OS_MEM_QTY           MemMagCtr[OS_CFG_MEM_CLASS_NBR];  /* Number of blocks in each list                          */
+#endif
+
 #if (OS_CFG_DBG_EN > 0u)
     OS_TCB              *DbgPrevPtr;
     OS_TCB              *DbgNextPtr;
@@ -1077,13 +1332,53 @@ struct os_tcb {
 
 struct  os_tick_list {
     OS_TCB              *TCB_Ptr;                           /* Pointer to list of tasks in tick list                 */
-#if (OS_CFG_DBG_EN > 0u)
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TICK_SPOKE       *SpokePtr;                          /* Pointer to the spokes of the tick wheel               */
+    OS_TICK              SpokeSize;                         /* Number of spokes in the tick wheel                    */
+    OS_TICK              Ctr;                               /* Number of ticks processed by the tick wheel           */
+#endif
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_TICK_WHEEL_EN > 0u))
     OS_OBJ_QTY           NbrEntries;                        /* Current number of entries in the tick list            */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
     OS_OBJ_QTY           NbrUpdated;                        /* Number of entries updated                             */
 #endif
 };
 
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+struct  os_tick_spoke {
+    OS_TCB              *FirstPtr;                          /* Pointer to list of tasks in tick spoke                */
+    OS_OBJ_QTY           NbrEntries;                        /* Current number of entries in the tick spoke           */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY           NbrEntriesMax;                     /* Peak number of entries in the tick spoke              */
+#endif
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 DEFERRED ISR POST ENTRY
+*
+* Note(s) : (1) Each entry records one post issued from an ISR.  The ISR handler task replays the entries, in order,
+*               through OS_QPost(), OS_SemPost(), OS_FlagPost(), OS_TaskQPost(), OS_TaskSemPost() or OS_StreamPost().
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+struct  os_int_q {
+    OS_OBJ_TYPE          Type;                              /* Type of object the post is for                         */
+    void                *ObjPtr;                            /* Pointer to object (or TCB) posted to                   */
+    void                *MsgPtr;                            /* Pointer to message if posting to a message queue       */
+    OS_MSG_SIZE          MsgSize;                           /* Message Size       if posting to a message queue       */
+    OS_FLAGS             Flags;                             /* Value of flags if posting to an event flag group       */
+    OS_OPT               Opt;                               /* Post options                                           */
+    CPU_TS               TS;                                /* Timestamp of the post, taken in the ISR                */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                   TIMER DATA TYPES
@@ -1106,6 +1401,10 @@ struct  os_tmr {
     OS_TICK              Period;                            /* Period to repeat timer                                 */
     OS_OPT               Opt;                               /* Options (see OS_OPT_TMR_xxx)                           */
     OS_STATE             State;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    OS_TMR_SPOKE        *SpokePtr;                          /* Pointer to timer wheel spoke if timer is linked        */
+    OS_TICK              Match;                             /* Absolute tick at which the timer expires               */
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     OS_TMR              *DbgPrevPtr;
     OS_TMR              *DbgNextPtr;
@@ -1113,6 +1412,17 @@ struct  os_tmr {
 };
 
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+struct  os_tmr_spoke {
+    OS_TMR              *FirstPtr;                          /* Pointer to list of timers in spoke                     */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY           NbrEntries;                        /* Current number of entries in the spoke                 */
+    OS_OBJ_QTY           NbrEntriesMax;                     /* Peak number of entries in the spoke                    */
+#endif
+};
+#endif
+
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -1141,10 +1451,23 @@ OS_EXT            OS_IDLE_CTR               OSIdleTaskCtr;
 #endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
 OS_EXT            OS_TCB                    OSIdleTaskTCB;
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+OS_EXT            OS_TCB                    OSIdleTaskCoreTCB[OS_CFG_SMP_CORE_NBR - 1u];    /* Idle tasks of cores 1..N-1 */
+#define  OS_TASK_IS_IDLE(p_tcb)            (((p_tcb) == &OSIdleTaskTCB) || \
+                                            (((p_tcb) >= &OSIdleTaskCoreTCB[0]) && \
+                                             ((p_tcb) <= &OSIdleTaskCoreTCB[OS_CFG_SMP_CORE_NBR - 2u])))
+#else
+#define  OS_TASK_IS_IDLE(p_tcb)             ((p_tcb) == &OSIdleTaskTCB)
+#endif
 #endif
 
                                                                         /* MISCELLANEOUS ---------------------------- */
+#if (OS_CFG_SMP_CORE_NBR > 1u)                                          /* See 'os_core.c  OS_SMP_Sched()  Note #1'.  */
+OS_EXT            OS_NESTING_CTR            OSIntNestingCtrTbl[OS_CFG_SMP_CORE_NBR];
+#define           OSIntNestingCtr           OSIntNestingCtrTbl[OS_CPU_CORE_ID_GET()]
+#else
 OS_EXT            OS_NESTING_CTR            OSIntNestingCtr;            /* Interrupt nesting level                    */
+#endif
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
 #if (OS_CFG_TS_EN > 0u)
 OS_EXT            CPU_TS                    OSIntDisTimeMax;            /* Overall interrupt disable time             */
@@ -1157,6 +1480,31 @@ OS_EXT            OS_STATE                  OSInitialized;              /* Flag
 #if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
 OS_EXT            CPU_INT32U                OSISRStkFree;               /* Number of free ISR stack entries           */
 OS_EXT            CPU_INT32U                OSISRStkUsed;               /* Number of used ISR stack entries           */
+#endif
+
+                                                                        /* ISR HANDLER TASK ------------------------- */
+#if (OS_CFG_ISR_POST_EN > 0u)
+OS_EXT            OS_INT_Q                 *OSIntQInPtr;                /* Next entry to fill (written by ISRs)       */
+OS_EXT            OS_INT_Q                 *OSIntQOutPtr;               /* Next entry to replay (read by the task)    */
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntries;           /* Number of entries waiting to be replayed   */
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntriesMax;        /* Peak number of entries (high-water mark)   */
+OS_EXT            OS_OBJ_QTY                OSIntQOvfCtr;               /* Number of posts lost because Q was full    */
+OS_EXT            OS_OBJ_QTY                OSIntQRePostFailCtr;        /* Number of posts that failed when replayed  */
+OS_EXT            OS_TCB                    OSIntQTaskTCB;
+#if (OS_CFG_TS_EN > 0u)
+OS_EXT            CPU_TS                    OSIntQLatency;              /* Post-to-replay latency of the last entry   */
+OS_EXT            CPU_TS                    OSIntQLatencyMax;           /* Peak post-to-replay latency                */
+OS_EXT            CPU_TS                    OSIntQTaskTime;             /* Time to replay the last batch              */
+OS_EXT            CPU_TS                    OSIntQTaskTimeMax;
+#endif
+#endif
+
+                                                                        /* CONDITION VARIABLES ---------------------- */
+#if (OS_CFG_COND_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_COND                  *OSCondDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSCondQty;                  /* Number of condition variables created      */
+#endif
 #endif
 
                                                                         /* FLAGS ------------------------------------ */
@@ -1173,11 +1521,18 @@ OS_EXT            OS_OBJ_QTY                OSFlagQty;
 OS_EXT            OS_MEM                   *OSMemDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSMemQty;                   /* Number of memory partitions created        */
 #endif
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+OS_EXT            OS_MEM                   *OSMemClassTbl[OS_CFG_MEM_CLASS_NBR];    /* Partition of each size class   */
+#endif
 #endif
 
                                                                         /* OS_MSG POOL ------------------------------ */
 #if (OS_MSG_EN > 0u)
 OS_EXT            OS_MSG_POOL               OSMsgPool;                  /* Pool of OS_MSG                             */
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_MSG_POOL              *OSMsgPoolDbgListPtr;        /* Pools made by OSMsgPoolCreate()            */
+OS_EXT            OS_OBJ_QTY                OSMsgPoolQty;
+#endif
 #endif
 
                                                                         /* MUTEX MANAGEMENT ------------------------- */
@@ -1186,12 +1541,25 @@ OS_EXT            OS_MSG_POOL               OSMsgPool;                  /* Pool
 OS_EXT            OS_MUTEX                 *OSMutexDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Number of mutexes created                  */
 #endif
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+OS_EXT            OS_MUTEX                 *OSMutexFastListPtr;         /* Mutexes that may be held on the fast path  */
+#endif
 #endif
 
                                                                         /* PRIORITIES ------------------------------- */
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+OS_EXT            OS_PRIO                   OSPrioCurTbl[OS_CFG_SMP_CORE_NBR];
+OS_EXT            OS_PRIO                   OSPrioHighRdyTbl[OS_CFG_SMP_CORE_NBR];
+#define           OSPrioCur                 OSPrioCurTbl[OS_CPU_CORE_ID_GET()]
+#define           OSPrioHighRdy             OSPrioHighRdyTbl[OS_CPU_CORE_ID_GET()]
+#else
 OS_EXT            OS_PRIO                   OSPrioCur;                  /* Priority of current task                   */
 OS_EXT            OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
+#endif
 OS_EXT            CPU_DATA                  OSPrioTbl[OS_PRIO_TBL_SIZE];
+#if (OS_CFG_PRIO_MAX > (2u * (CPU_CFG_DATA_SIZE * 8u)))
+OS_EXT            CPU_DATA                  OSPrioGrp;                  /* One bit per non-empty entry of OSPrioTbl[] */
+#endif
 
                                                                         /* QUEUES ----------------------------------- */
 #if (OS_CFG_Q_EN > 0u)
@@ -1217,7 +1585,12 @@ OS_EXT            CPU_TS_TMR                OSSchedLockTimeMax;
 OS_EXT            CPU_TS_TMR                OSSchedLockTimeMaxCur;
 #endif
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+OS_EXT            OS_NESTING_CTR            OSSchedLockNestingCtrTbl[OS_CFG_SMP_CORE_NBR];
+#define           OSSchedLockNestingCtr     OSSchedLockNestingCtrTbl[OS_CPU_CORE_ID_GET()]
+#else
 OS_EXT            OS_NESTING_CTR            OSSchedLockNestingCtr;      /* Lock nesting level                         */
+#endif
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
 OS_EXT            OS_TICK                   OSSchedRoundRobinDfltTimeQuanta;
 OS_EXT            CPU_BOOLEAN               OSSchedRoundRobinEn;        /* Enable/Disable round-robin scheduling      */
@@ -1228,6 +1601,14 @@ OS_EXT            CPU_BOOLEAN               OSSchedRoundRobinEn;        /* Enabl
 OS_EXT            OS_SEM                   *OSSemDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSSemQty;                   /* Number of semaphores created               */
 #endif
+#endif
+
+                                                                        /* STREAM BUFFERS --------------------------- */
+#if (OS_CFG_STREAM_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_STREAM                *OSStreamDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSStreamQty;                /* Number of stream buffers created           */
+#endif
 #endif
 
                                                                         /* STATISTICS ------------------------------- */
@@ -1278,9 +1659,17 @@ OS_EXT            CPU_TS                    OSTickTimeMax;
 #if (OS_CFG_TMR_EN > 0u)                                                /* TIMERS ----------------------------------- */
 #if (OS_CFG_DBG_EN > 0u)
 OS_EXT            OS_TMR                   *OSTmrDbgListPtr;
+#endif
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_TMR_WHEEL_EN > 0u))
 OS_EXT            OS_OBJ_QTY                OSTmrListEntries;           /* Doubly-linked list of timers               */
 #endif
 OS_EXT            OS_TMR                   *OSTmrListPtr;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+OS_EXT            OS_TMR_SPOKE              OSTmrWheelExpired;          /* Timers being processed by the timer task   */
+OS_EXT            OS_TICK                   OSTmrWheelCtr;              /* Next tick to be processed by the wheel     */
+OS_EXT            OS_TICK                   OSTmrWheelWake;             /* Tick at which the timer task will wake up  */
+OS_EXT            OS_OBJ_QTY                OSTmrWheelNearEntries;      /* Nbr of timers in the lowest wheel level    */
+#endif
 OS_EXT            OS_COND                   OSTmrCond;
 OS_EXT            OS_MUTEX                  OSTmrMutex;
 
@@ -1300,8 +1689,15 @@ OS_EXT            OS_TICK                   OSTmrToTicksMult;           /* Conve
 
 
                                                                         /* TCBs ------------------------------------- */
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+OS_EXT            OS_TCB                   *OSTCBCurPtrTbl[OS_CFG_SMP_CORE_NBR];
+OS_EXT            OS_TCB                   *OSTCBHighRdyPtrTbl[OS_CFG_SMP_CORE_NBR];
+#define           OSTCBCurPtr               OSTCBCurPtrTbl[OS_CPU_CORE_ID_GET()]
+#define           OSTCBHighRdyPtr           OSTCBHighRdyPtrTbl[OS_CPU_CORE_ID_GET()]
+#else
 OS_EXT            OS_TCB                   *OSTCBCurPtr;                /* Pointer to currently running TCB           */
 OS_EXT            OS_TCB                   *OSTCBHighRdyPtr;            /* Pointer to highest priority  TCB           */
+#endif
 
 
 /*
@@ -1317,6 +1713,14 @@ extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkLimit;
 extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkSize;
 extern  CPU_INT32U    const OSCfg_IdleTaskStkSizeRAM;
 
+extern  OS_INT_Q    * const OSCfg_IntQBasePtr;
+extern  OS_OBJ_QTY    const OSCfg_IntQSize;
+extern  CPU_INT32U    const OSCfg_IntQSizeRAM;
+extern  CPU_STK     * const OSCfg_IntQTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkSize;
+extern  CPU_INT32U    const OSCfg_IntQTaskStkSizeRAM;
+
 extern  CPU_STK     * const OSCfg_ISRStkBasePtr;
 extern  CPU_STK_SIZE  const OSCfg_ISRStkSize;
 extern  CPU_INT32U    const OSCfg_ISRStkSizeRAM;
@@ -1335,6 +1739,10 @@ extern  CPU_INT32U    const OSCfg_StatTaskStkSizeRAM;
 extern  CPU_STK_SIZE  const OSCfg_StkSizeMin;
 
 extern  OS_RATE_HZ    const OSCfg_TickRate_Hz;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+extern  OS_TICK       const OSCfg_TickWheelSize;
+extern  CPU_INT32U    const OSCfg_TickWheelSizeRAM;
+#endif
 
 extern  OS_PRIO       const OSCfg_TmrTaskPrio;
 extern  OS_RATE_HZ    const OSCfg_TmrTaskRate_Hz;
@@ -1342,12 +1750,25 @@ extern  CPU_STK     * const OSCfg_TmrTaskStkBasePtr;
 extern  CPU_STK_SIZE  const OSCfg_TmrTaskStkLimit;
 extern  CPU_STK_SIZE  const OSCfg_TmrTaskStkSize;
 extern  CPU_INT32U    const OSCfg_TmrTaskStkSizeRAM;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+extern  OS_OBJ_QTY    const OSCfg_TmrWheelSize;
+extern  CPU_INT32U    const OSCfg_TmrWheelSizeRAM;
+#endif
 
 extern  CPU_INT32U    const OSCfg_DataSizeRAM;
 
 #if (OS_CFG_TASK_IDLE_EN > 0u)
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+extern  CPU_STK        OSCfg_IdleTaskStk[OS_CFG_SMP_CORE_NBR][OS_CFG_IDLE_TASK_STK_SIZE];
+#else
 extern  CPU_STK        OSCfg_IdleTaskStk[OS_CFG_IDLE_TASK_STK_SIZE];
 #endif
+#endif
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+extern  OS_INT_Q       OSCfg_IntQ[OS_CFG_INT_Q_SIZE];
+extern  CPU_STK        OSCfg_IntQTaskStk[OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
 
 #if (OS_CFG_ISR_STK_SIZE > 0u)
 extern  CPU_STK        OSCfg_ISRStk[OS_CFG_ISR_STK_SIZE];
@@ -1361,10 +1782,18 @@ extern  OS_MSG         OSCfg_MsgPool[OS_CFG_MSG_POOL_SIZE];
 extern  CPU_STK        OSCfg_StatTaskStk[OS_CFG_STAT_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+extern  OS_TICK_SPOKE  OSCfg_TickWheel[OS_CFG_TICK_WHEEL_SIZE];
+#endif
+
 #if (OS_CFG_TMR_EN > 0u)
 extern  CPU_STK        OSCfg_TmrTaskStk[OS_CFG_TMR_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+extern  OS_TMR_SPOKE   OSCfg_TmrWheel[OS_CFG_TMR_WHEEL_LEVELS * OS_TMR_WHEEL_SIZE];
+#endif
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -1373,6 +1802,53 @@ extern  CPU_STK        OSCfg_TmrTaskStk[OS_CFG_TMR_TASK_STK_SIZE];
 ************************************************************************************************************************
 */
 
+/* ================================================================================================================== */
+/*                                                CONDITION VARIABLES                                                 */
+/* ================================================================================================================== */
+
+#if (OS_CFG_COND_EN > 0u)
+
+void          OSCondBroadcast           (OS_COND               *p_cond,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSCondCreate              (OS_COND               *p_cond,
+                                         CPU_CHAR              *p_name,
+                                         OS_MUTEX              *p_mutex,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_COND_DEL_EN > 0u)
+OS_OBJ_QTY    OSCondDel                 (OS_COND               *p_cond,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSCondSignal              (OS_COND               *p_cond,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSCondTimedWait           (OS_COND               *p_cond,
+                                         OS_TICK                timeout,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSCondWait                (OS_COND               *p_cond,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_CondClr                (OS_COND               *p_cond);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_CondDbgListAdd         (OS_COND               *p_cond);
+
+void          OS_CondDbgListRemove      (OS_COND               *p_cond);
+#endif
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                    EVENT FLAGS                                                     */
 /* ================================================================================================================== */
@@ -1425,6 +1901,12 @@ void          OS_FlagDbgListAdd         (OS_FLAG_GRP           *p_grp);
 void          OS_FlagDbgListRemove      (OS_FLAG_GRP           *p_grp);
 #endif
 
+OS_FLAGS      OS_FlagPost               (OS_FLAG_GRP           *p_grp,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
 void          OS_FlagTaskRdy            (OS_TCB                *p_tcb,
                                          OS_FLAGS               flags_rdy,
                                          CPU_TS                 ts);
@@ -1451,17 +1933,96 @@ void          OSMemPut                  (OS_MEM                *p_mem,
                                          void                  *p_blk,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+void          OSMemClassAdd             (OS_MEM                *p_mem,
+                                         OS_ERR                *p_err);
+
+void         *OSMemAlloc                (OS_MEM_SIZE            size,
+                                         OS_ERR                *p_err);
+
+void          OSMemFree                 (void                  *p_blk,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+void          OSMemMagFlush             (OS_ERR                *p_err);
+#endif
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 #if (OS_CFG_DBG_EN > 0u)
 void          OS_MemDbgListAdd          (OS_MEM                *p_mem);
 #endif
 
+#if ((OS_CFG_MEM_CLASS_NBR > 0u) && (OS_CFG_MEM_MAG_SIZE > 0u))
+void          OS_MemMagFlush            (OS_TCB                *p_tcb);
+#endif
+
 void          OS_MemInit                (OS_ERR                *p_err);
 
 #endif
 
 
+/* ================================================================================================================== */
+/*                                              REFERENCE COUNTED BUFFERS                                             */
+/* ================================================================================================================== */
+
+#if (OS_CFG_BUF_EN > 0u)
+
+OS_BUF       *OSBufAlloc                (OS_BUF_POOL           *p_pool,
+                                         OS_MSG_SIZE            len,
+                                         OS_ERR                *p_err);
+
+void          OSBufCat                  (OS_BUF                *p_head,
+                                         OS_BUF                *p_tail,
+                                         OS_ERR                *p_err);
+
+OS_BUF       *OSBufClone                (OS_BUF                *p_buf,
+                                         OS_BUF_POOL           *p_pool,
+                                         OS_ERR                *p_err);
+
+void          OSBufFree                 (OS_BUF                *p_buf,
+                                         OS_ERR                *p_err);
+
+CPU_INT08U   *OSBufHdrPop               (OS_BUF                *p_buf,
+                                         OS_MSG_SIZE            len,
+                                         OS_ERR                *p_err);
+
+CPU_INT08U   *OSBufHdrPush              (OS_BUF                *p_buf,
+                                         OS_MSG_SIZE            len,
+                                         OS_ERR                *p_err);
+
+void          OSBufPoolCreate           (OS_BUF_POOL           *p_pool,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_addr,
+                                         OS_MEM_QTY             n_bufs,
+                                         OS_MEM_SIZE            buf_size,
+                                         OS_MSG_SIZE            headroom,
+                                         OS_ERR                *p_err);
+
+void          OSBufRef                  (OS_BUF                *p_buf,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_BufRelease             (OS_BUF                *p_buf);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                   MESSAGE POOLS                                                    */
+/* ================================================================================================================== */
+
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u) && (OS_MSG_EN > 0u)
+void          OSMsgPoolCreate           (OS_MSG_POOL           *p_pool,
+                                         CPU_CHAR              *p_name,
+                                         OS_MSG                *p_msg_tbl,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_ERR                *p_err);
+#endif
+
+
 /* ================================================================================================================== */
 /*                                             MUTUAL EXCLUSION SEMAPHORES                                            */
 /* ================================================================================================================== */
@@ -1514,6 +2075,22 @@ void          OS_MutexGrpRemove         (OS_TCB                *p_tcb,
 OS_PRIO       OS_MutexGrpPrioFindHighest(OS_TCB                *p_tcb);
 
 void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
+
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+void          OS_MutexFastInflate       (OS_MUTEX              *p_mutex);
+
+void          OS_MutexFastInflateAll    (OS_TCB                *p_tcb);
+
+void          OS_MutexFastListAdd       (OS_MUTEX              *p_mutex);
+
+void          OS_MutexFastListRemove    (OS_MUTEX              *p_mutex);
+
+#define  OS_MUTEX_FAST_INFLATE(p_mutex)         OS_MutexFastInflate(p_mutex)
+#define  OS_MUTEX_FAST_DEFLATE(p_mutex)         (p_mutex)->FastLockPtr = (void *)0
+#else
+#define  OS_MUTEX_FAST_INFLATE(p_mutex)
+#define  OS_MUTEX_FAST_DEFLATE(p_mutex)
+#endif
 #endif
 
 
@@ -1537,6 +2114,11 @@ OS_OBJ_QTY    OSQDel                    (OS_Q                  *p_q,
 #if (OS_CFG_Q_FLUSH_EN > 0u)
 OS_MSG_QTY    OSQFlush                  (OS_Q                  *p_q,
                                          OS_ERR                *p_err);
+
+#if (OS_CFG_BUF_EN > 0u)
+OS_MSG_QTY    OSQFlushBuf               (OS_Q                  *p_q,
+                                         OS_ERR                *p_err);
+#endif
 #endif
 
 void         *OSQPend                   (OS_Q                  *p_q,
@@ -1552,14 +2134,60 @@ OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_BUF_EN > 0u)
+OS_BUF       *OSQPendBuf                (OS_Q                  *p_q,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY    OSQPendMulti              (OS_Q                  *p_q,
+                                         OS_MSG_INFO           *p_msgs,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+void          OSQPoolSet                (OS_Q                  *p_q,
+                                         OS_MSG_POOL           *p_pool,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OSQPost                   (OS_Q                  *p_q,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_BUF_EN > 0u)
+void          OSQPostBuf                (OS_Q                  *p_q,
+                                         OS_BUF                *p_buf,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY    OSQPostMulti              (OS_Q                  *p_q,
+                                         OS_MSG_INFO           *p_msgs,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
+#if (OS_CFG_BUF_EN > 0u)
+void          OS_QBufDetach             (OS_Q                  *p_q,
+                                         OS_MSG_Q              *p_msg_q);
+
+OS_MSG_QTY    OS_QBufRelease            (OS_MSG_Q              *p_msg_q);
+#endif
+
 void          OS_QClr                   (OS_Q                  *p_q);
 
 #if (OS_CFG_DBG_EN > 0u)
@@ -1568,6 +2196,22 @@ void          OS_QDbgListAdd            (OS_Q                  *p_q);
 void          OS_QDbgListRemove         (OS_Q                  *p_q);
 #endif
 
+void          OS_QPost                  (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY    OS_QPostMulti             (OS_Q                  *p_q,
+                                         OS_MSG_INFO           *p_msgs,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+#endif
+
 #endif
 
 
@@ -1620,6 +2264,82 @@ void          OS_SemDbgListAdd          (OS_SEM                *p_sem);
 void          OS_SemDbgListRemove       (OS_SEM                *p_sem);
 #endif
 
+OS_SEM_CTR    OS_SemPost                (OS_SEM                *p_sem,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                   STREAM BUFFERS                                                   */
+/* ================================================================================================================== */
+
+#if (OS_CFG_STREAM_EN > 0u)
+
+void          OSStreamCreate            (OS_STREAM             *p_stream,
+                                         CPU_CHAR              *p_name,
+                                         CPU_INT08U            *p_buf,
+                                         OS_MSG_SIZE            size,
+                                         OS_MSG_SIZE            trigger_level,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_STREAM_DEL_EN > 0u)
+OS_OBJ_QTY    OSStreamDel               (OS_STREAM             *p_stream,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+OS_MSG_SIZE   OSStreamRead              (OS_STREAM             *p_stream,
+                                         CPU_INT08U            *p_data,
+                                         OS_MSG_SIZE            len,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSStreamReadCommit        (OS_STREAM             *p_stream,
+                                         OS_MSG_SIZE            len,
+                                         OS_ERR                *p_err);
+
+CPU_INT08U   *OSStreamReadReserve       (OS_STREAM             *p_stream,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_MSG_SIZE           *p_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+OS_MSG_SIZE   OSStreamWrite             (OS_STREAM             *p_stream,
+                                         CPU_INT08U            *p_data,
+                                         OS_MSG_SIZE            len,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSStreamWriteCommit       (OS_STREAM             *p_stream,
+                                         OS_MSG_SIZE            len,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+CPU_INT08U   *OSStreamWriteReserve      (OS_STREAM             *p_stream,
+                                         OS_MSG_SIZE           *p_size,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_StreamClr              (OS_STREAM             *p_stream);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_StreamDbgListAdd       (OS_STREAM             *p_stream);
+
+void          OS_StreamDbgListRemove    (OS_STREAM             *p_stream);
+#endif
+
+void          OS_StreamPost             (OS_STREAM             *p_stream,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
 #endif
 
 
@@ -1666,12 +2386,26 @@ CPU_BOOLEAN   OSTaskQPendAbort          (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+void          OSTaskQPoolSet            (OS_TCB                *p_tcb,
+                                         OS_MSG_POOL           *p_pool,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OSTaskQPost               (OS_TCB                *p_tcb,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TASK_Q_MULTI_EN > 0u)
+OS_MSG_QTY    OSTaskQPostMulti          (OS_TCB                *p_tcb,
+                                         OS_MSG_INFO           *p_msgs,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -1750,8 +2484,31 @@ void          OS_TaskInit               (OS_ERR                *p_err);
 
 void          OS_TaskInitTCB            (OS_TCB                *p_tcb);
 
+#if (OS_CFG_TASK_Q_EN > 0u)
+void          OS_TaskQPost              (OS_TCB                *p_tcb,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_TASK_Q_MULTI_EN > 0u)
+OS_MSG_QTY    OS_TaskQPostMulti         (OS_TCB                *p_tcb,
+                                         OS_MSG_INFO           *p_msgs,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+#endif
+#endif
+
 void          OS_TaskReturn             (void);
 
+OS_SEM_CTR    OS_TaskSemPost            (OS_TCB                *p_tcb,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
 #if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
 CPU_BOOLEAN   OS_TaskStkRedzoneChk      (CPU_STK               *p_base,
                                          CPU_STK_SIZE           stk_size);
@@ -1928,6 +2685,21 @@ void          OS_IdleTask               (void                  *p_arg);
 
 void          OS_IdleTaskInit           (OS_ERR                *p_err);
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+void          OS_IntQTask               (void                  *p_arg);
+
+void          OS_IntQTaskInit           (OS_ERR                *p_err);
+
+void          OS_IntQPost               (OS_OBJ_TYPE            type,
+                                         void                  *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
 void          OS_StatTask               (void                  *p_arg);
 #endif
@@ -1972,6 +2744,17 @@ void          OSTaskSwHook              (void);
 
 void          OSTimeTickHook            (void);
 
+#if ((OS_CFG_MUTEX_FAST_EN > 0u) || ((OS_CFG_MEM_EN > 0u) && (OS_CFG_MEM_LOCK_FREE_EN > 0u)))
+                                                                /* Atomic compare and swap, implemented in the port.    */
+CPU_BOOLEAN   OS_CPU_CmpXchg            (void                 **p_dst,
+                                         void                  *cmp,
+                                         void                  *val);
+#endif
+
+#if (OS_CFG_SMP_CORE_NBR > 1u)                                  /* Make a core run OSIntExit(), implemented in the port.*/
+void          OS_CPU_CoreSchedReq       (CPU_INT08U             core);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -1990,6 +2773,10 @@ void          OS_Dbg_Init               (void);
 
 /* ----------------------------------------------- MESSAGE MANAGEMENT ----------------------------------------------- */
 
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+void          OS_MsgPoolDbgListAdd      (OS_MSG_POOL           *p_pool);
+#endif
+
 void          OS_MsgPoolInit            (OS_ERR                *p_err);
 
 OS_MSG_QTY    OS_MsgQFreeAll            (OS_MSG_Q              *p_msg_q);
@@ -1999,6 +2786,13 @@ void         *OS_MsgQGet                (OS_MSG_Q              *p_msg_q,
                                          CPU_TS                *p_ts,
                                          OS_ERR                *p_err);
 
+#if ((OS_CFG_Q_EN > 0u) && (OS_CFG_Q_MULTI_EN > 0u))
+OS_MSG_QTY    OS_MsgQGetMulti           (OS_MSG_Q              *p_msg_q,
+                                         OS_MSG_INFO           *p_msgs,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         CPU_TS                *p_ts);
+#endif
+
 void          OS_MsgQInit               (OS_MSG_Q              *p_msg_q,
                                          OS_MSG_QTY             size);
 
@@ -2038,6 +2832,12 @@ OS_PRIO       OS_PrioGetHighest         (void);
 
 /* --------------------------------------------------- SCHEDULING --------------------------------------------------- */
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+OS_TCB       *OS_SMP_Sched              (void);
+
+OS_TCB       *OS_SMP_HighRdyGet         (CPU_INT08U             core);
+#endif
+
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
 void          OS_SchedLockTimeMeasStart (void);
 void          OS_SchedLockTimeMeasStop  (void);
@@ -2157,6 +2957,10 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, OS_CFG_PRIO_MAX must be >= 8"
 #endif
 
+#if     OS_CFG_PRIO_MAX > ((CPU_CFG_DATA_SIZE * 8u) * (CPU_CFG_DATA_SIZE * 8u))
+#error  "OS_CFG.H, OS_CFG_PRIO_MAX must be <= the square of the number of bits in CPU_DATA"
+#endif
+
 
 #ifndef OS_CFG_SCHED_LOCK_TIME_MEAS_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_LOCK_TIME_MEAS_EN: Include code to measure scheduler lock time"
@@ -2220,6 +3024,18 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 
 #ifndef OS_CFG_MEM_EN
 #error  "OS_CFG.H, Missing OS_CFG_MEM_EN: Enable (1) or Disable (0) code generation for MEMORY MANAGER"
+#else
+    #if ((OS_CFG_MEM_CLASS_NBR > 0u) && ((OS_CFG_MEM_CLASS_SIZE_MIN_LOG2 + OS_CFG_MEM_CLASS_NBR) > 16u))
+    #error  "OS_CFG.H, OS_CFG_MEM_CLASS_SIZE_MIN_LOG2 + OS_CFG_MEM_CLASS_NBR must be <= 16: the largest class must fit in OS_MEM_SIZE"
+    #endif
+
+    #if ((OS_CFG_MEM_CLASS_NBR == 0u) && (OS_CFG_MEM_MAG_SIZE > 0u))
+    #error  "OS_CFG.H, OS_CFG_MEM_MAG_SIZE must be 0 when OS_CFG_MEM_CLASS_NBR is 0: magazines cache size class blocks"
+    #endif
+#endif
+
+#if ((OS_CFG_BUF_EN > 0u) && (OS_CFG_MEM_EN == 0u))
+#error  "OS_CFG.H, OS_CFG_MEM_EN must be Enabled (1) to use buffers"
 #endif
 
 /*
@@ -2240,6 +3056,10 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #endif
 #endif
 
+#if ((OS_CFG_COND_EN > 0u) && (OS_CFG_MUTEX_EN == 0u))
+#error  "OS_CFG.H, OS_CFG_MUTEX_EN must be Enabled (1) to use condition variables"
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                    MESSAGE QUEUES
@@ -2327,6 +3147,16 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TASK_REG_TBL_SIZE: Include support for task specific registers"
 #endif
 
+#if    (OS_CFG_SMP_CORE_NBR == 0u) || (OS_CFG_SMP_CORE_NBR > 8u)
+#error  "OS_CFG.H, OS_CFG_SMP_CORE_NBR must be between 1 and 8 (one OS_OPT_TASK_CORE() bit per core)"
+#elif  (OS_CFG_SMP_CORE_NBR  > 1u)
+    #if    (OS_CFG_TASK_IDLE_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TASK_IDLE_EN must be Enabled (1) with OS_CFG_SMP_CORE_NBR > 1: every core runs an idle task"
+    #elif  !defined(OS_CPU_CORE_ID_GET)
+    #error  "OS_CPU.H, OS_CPU_CORE_ID_GET() must be defined by the port to use OS_CFG_SMP_CORE_NBR > 1"
+    #endif
+#endif
+
 #ifndef OS_CFG_TASK_SEM_PEND_ABORT_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_SEM_PEND_ABORT_EN: Include code for OSTaskSemPendAbort()"
 #endif
@@ -2351,6 +3181,20 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #if ((OS_CFG_TICK_EN == 0u) && (OS_CFG_DYN_TICK_EN > 0u))
     #error "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use the dynamic tick feature"
     #endif
+
+    #if ((OS_CFG_TICK_EN == 0u) && (OS_CFG_TICK_WHEEL_EN > 0u))
+    #error "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use the tick wheel"
+    #endif
+
+    #if (OS_CFG_TICK_WHEEL_EN > 0u)
+        #ifndef OS_CFG_TICK_WHEEL_SIZE
+        #error  "OS_CFG_APP.H, Missing OS_CFG_TICK_WHEEL_SIZE: Number of spokes in the tick wheel"
+        #else
+            #if (OS_CFG_TICK_WHEEL_SIZE < 2u)
+            #error  "OS_CFG_APP.H, OS_CFG_TICK_WHEEL_SIZE must be >= 2"
+            #endif
+        #endif
+    #endif
 #endif
 
 /*
@@ -2396,7 +3240,35 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #ifndef OS_CFG_TMR_DEL_EN
     #error  "OS_CFG.H, Missing OS_CFG_TMR_DEL_EN: Enables (1) or Disables (0) code for OSTmrDel()"
     #endif
+
+    #if (OS_CFG_TMR_WHEEL_EN > 0u)
+        #if (!defined(OS_CFG_TMR_WHEEL_BITS) || !defined(OS_CFG_TMR_WHEEL_LEVELS))
+        #error  "OS_CFG_APP.H, Missing OS_CFG_TMR_WHEEL_BITS/OS_CFG_TMR_WHEEL_LEVELS: Geometry of the timer wheel"
+        #else
+            #if ((OS_CFG_TMR_WHEEL_BITS < 1u) || (OS_CFG_TMR_WHEEL_BITS > 8u))
+            #error  "OS_CFG_APP.H, OS_CFG_TMR_WHEEL_BITS must be between 1 and 8"
+            #endif
+
+            #if ((OS_CFG_TMR_WHEEL_LEVELS < 2u) || ((OS_CFG_TMR_WHEEL_BITS * OS_CFG_TMR_WHEEL_LEVELS) > 32u))
+            #error  "OS_CFG_APP.H, OS_CFG_TMR_WHEEL_LEVELS must be >= 2 and cover at most 32 bits of OS_TICK"
+            #endif
+        #endif
+    #endif
+#endif
 #endif
+
+/*
+************************************************************************************************************************
+*                                                  ISR HANDLER TASK
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+    #if (!defined(OS_CFG_INT_Q_SIZE) || !defined(OS_CFG_INT_Q_TASK_STK_SIZE))
+    #error  "OS_CFG_APP.H, Missing OS_CFG_INT_Q_SIZE/OS_CFG_INT_Q_TASK_STK_SIZE: Deferred ISR post queue and its task"
+    #elif (OS_CFG_INT_Q_SIZE == 0u)
+    #error  "OS_CFG_APP.H, OS_CFG_INT_Q_SIZE must be > 0"
+    #endif
 #endif
 
 /*
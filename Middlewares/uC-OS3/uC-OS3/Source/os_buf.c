@@ -0,0 +1,784 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      REFERENCE COUNTED BUFFERS
+*
+* File    : os_buf.c
+* Version : V3.08.01
+*********************************************************************************************************
+* Note(s) : (1) A buffer is a block of the OS_MEM partition of its pool: an OS_BUF header followed by '.DataSize'
+*               octets of data.  Data larger than one buffer is held by a chain linked through '.NextPtr'.  '.Len'
+*               is the data in one buffer and '.TotLen' the data in that buffer and the rest of its chain, so the
+*               head of a chain gives the size of the whole packet.  The first buffer of a chain keeps '.Headroom'
+*               octets in front of its data for the headers added by OSBufHdrPush().
+*
+*           (2) '.RefCtr' counts the references to a buffer: the owner of the chain for its head, the previous
+*               buffer for the others, plus one per OSBufRef() and per clone of its data.  Dropping the last
+*               reference returns the buffer to its pool and drops its reference to the next buffer.
+*
+*           (3) OSBufClone() copies the headers of a chain, not its data.  Each clone header points into the data
+*               of the original buffer and holds a reference to it through '.RefPtr'.  '.PayloadPtr' and '.Len'
+*               of a clone are its own, so headers can be removed from a clone without changing the original.
+*               The data itself is shared and MUST NOT be written through either of them.
+*
+*           (4) OSQPostBuf() hands the poster's reference to the task that gets the buffer from OSQPendBuf().  A
+*               post that fails, including a post from an ISR replayed by the ISR handler task, releases the
+*               buffer.  The buffers still in a queue are released by OSQFlushBuf() and by OSQDel() with
+*               OS_OPT_DEL_BUF.  OSQFlush() and OSQDel() without that option drop them with the OS_MSGs, and
+*               they never return to their pool.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_buf__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_BUF_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL FUNCTIONS
+************************************************************************************************************************
+*/
+
+static  OS_BUF      *OS_BufGet    (OS_BUF_POOL  *p_pool);
+
+static  OS_OBJ_QTY   OS_BufRefDec (OS_BUF       *p_buf);
+
+
+/*
+************************************************************************************************************************
+*                                                CREATE A BUFFER POOL
+*
+* Description: This function is called by your application to create a pool of buffers.  Each buffer is a block of
+*              'buf_size' bytes: an OS_BUF header followed by its data.
+*
+* Arguments  : p_pool     is a pointer to the buffer pool
+*
+*              p_name     is a pointer to an ASCII string that will be used to name the pool's memory partition
+*
+*              p_addr     is the starting address of the storage of the buffers, see OSMemCreate()
+*
+*              n_bufs     is the number of buffers in the pool (at least 2)
+*
+*              buf_size   is the size of each buffer in bytes, header included.  It must be a multiple of the size
+*                         of a pointer.  A pool of buffers of 'sizeof(OS_BUF)' bytes has no data and only provides the
+*                         headers of clones, see OSBufClone().
+*
+*              headroom   is the number of bytes kept in front of the data of the first buffer of a chain allocated
+*                         by OSBufAlloc(), for OSBufHdrPush().  It cannot be larger than the data of a buffer.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the pool was created
+*                             OS_ERR_BUF_INVALID_P_POOL      If you passed a NULL pointer for 'p_pool'
+*                             OS_ERR_BUF_INVALID_SIZE        If 'buf_size' cannot hold the header and 'headroom'
+*                             OS_ERR_MEM_...                 Any error returned by OSMemCreate()
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSBufPoolCreate (OS_BUF_POOL  *p_pool,
+                       CPU_CHAR     *p_name,
+                       void         *p_addr,
+                       OS_MEM_QTY    n_bufs,
+                       OS_MEM_SIZE   buf_size,
+                       OS_MSG_SIZE   headroom,
+                       OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pool == (OS_BUF_POOL *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_BUF_INVALID_P_POOL;
+        return;
+    }
+    if ((buf_size < sizeof(OS_BUF)) ||
+        ((buf_size - sizeof(OS_BUF)) < headroom)) {
+       *p_err = OS_ERR_BUF_INVALID_SIZE;
+        return;
+    }
+#endif
+
+    OSMemCreate(&p_pool->Mem,                                   /* Checks the context and the storage                   */
+                 p_name,
+                 p_addr,
+                 n_bufs,
+                 buf_size,
+                 p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    p_pool->DataSize   = (OS_MSG_SIZE)(buf_size - sizeof(OS_BUF));
+    p_pool->Headroom   = headroom;
+    p_pool->NbrUsed    = 0u;
+    p_pool->NbrUsedMax = 0u;
+    p_pool->AllocCtr   = 0u;
+    p_pool->FreeCtr    = 0u;
+    p_pool->FailCtr    = 0u;
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_pool->Type       = OS_OBJ_TYPE_BUF;                       /* Mark the data structure as a buffer pool             */
+#endif
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 ALLOCATE A BUFFER
+*
+* Description: This function takes a chain of buffers from a pool, large enough for 'len' bytes of data.
+*
+* Arguments  : p_pool     is a pointer to the buffer pool
+*
+*              len        is the number of bytes of data.  The first buffer keeps the headroom of the pool in front
+*                         of its data, and the data continues in as many buffers as needed.  With 0, one buffer is
+*                         allocated with no data, for instance to build headers to put in front of another chain.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the chain was allocated
+*                             OS_ERR_BUF_INVALID_P_POOL      If you passed a NULL pointer for 'p_pool'
+*                             OS_ERR_BUF_INVALID_SIZE        If 'len' is not 0 and the pool's buffers have no data
+*                             OS_ERR_BUF_NO_FREE_BUFS        If the pool does not have enough free buffers
+*                             OS_ERR_OBJ_TYPE                If 'p_pool' is not a buffer pool
+*
+* Returns    : A pointer to the first buffer of the chain, with one reference owned by the caller, or a NULL pointer
+*              if an error is detected.
+*
+* Note(s)    : 1) This function may be called from an ISR.
+*
+*              2) When the pool runs out of buffers part way through the chain, the buffers already taken are
+*                 returned to the pool.
+************************************************************************************************************************
+*/
+
+OS_BUF  *OSBufAlloc (OS_BUF_POOL  *p_pool,
+                     OS_MSG_SIZE   len,
+                     OS_ERR       *p_err)
+{
+    OS_BUF       *p_head;
+    OS_BUF       *p_tail;
+    OS_BUF       *p_buf;
+    OS_MSG_SIZE   offset;
+    OS_MSG_SIZE   room;
+    OS_MSG_SIZE   remain;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_BUF *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pool == (OS_BUF_POOL *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_BUF_INVALID_P_POOL;
+        return ((OS_BUF *)0);
+    }
+    if ((len > 0u) && (p_pool->DataSize == 0u)) {
+       *p_err = OS_ERR_BUF_INVALID_SIZE;
+        return ((OS_BUF *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_pool->Type != OS_OBJ_TYPE_BUF) {                      /* Make sure the buffer pool was created                */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((OS_BUF *)0);
+    }
+#endif
+
+    p_head = (OS_BUF *)0;
+    p_tail = (OS_BUF *)0;
+    offset = p_pool->Headroom;                                  /* Headroom in the first buffer only                    */
+    remain = len;
+    do {
+        p_buf = OS_BufGet(p_pool);
+        if (p_buf == (OS_BUF *)0) {
+            if (p_head != (OS_BUF *)0) {                        /* See Note #2                                          */
+                OS_BufRelease(p_head);
+            }
+           *p_err = OS_ERR_BUF_NO_FREE_BUFS;
+            return ((OS_BUF *)0);
+        }
+        room = (OS_MSG_SIZE)(p_pool->DataSize - offset);
+        if (room > remain) {
+            room = remain;
+        }
+        p_buf->NextPtr    = (OS_BUF *)0;
+        p_buf->PoolPtr    =  p_pool;
+        p_buf->RefPtr     = (OS_BUF *)0;
+        p_buf->PayloadPtr = (CPU_INT08U *)(p_buf + 1) + offset; /* Data follows the header                              */
+        p_buf->Len        =  room;
+        p_buf->TotLen     =  remain;
+        p_buf->RefCtr     =  1u;                                /* Owner's reference, or link from the previous buffer  */
+
+        if (p_tail == (OS_BUF *)0) {
+            p_head = p_buf;
+        } else {
+            p_tail->NextPtr = p_buf;
+        }
+        p_tail = p_buf;
+        remain = (OS_MSG_SIZE)(remain - room);
+        offset = 0u;
+    } while (remain > 0u);
+
+   *p_err = OS_ERR_NONE;
+    return (p_head);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              APPEND A CHAIN TO A CHAIN
+*
+* Description: This function links a chain of buffers after the last buffer of another chain.
+*
+* Arguments  : p_head     is a pointer to the first buffer of the chain to extend
+*
+*              p_tail     is a pointer to the first buffer of the chain to append
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the chains were joined
+*                             OS_ERR_BUF_INVALID_P_BUF       If you passed a NULL pointer for 'p_head' or 'p_tail'
+*                             OS_ERR_BUF_INVALID_SIZE        If the total length would not fit in an OS_MSG_SIZE
+*
+* Returns    : none
+*
+* Note(s)    : 1) The caller's reference to 'p_tail' becomes the link from the last buffer of 'p_head': the caller
+*                 MUST NOT release 'p_tail' any more, releasing 'p_head' releases both.
+*
+*              2) '.TotLen' is updated in every buffer of 'p_head', which MUST NOT be shared with another task.
+************************************************************************************************************************
+*/
+
+void  OSBufCat (OS_BUF  *p_head,
+                OS_BUF  *p_tail,
+                OS_ERR  *p_err)
+{
+    OS_BUF  *p_buf;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_head == (OS_BUF *)0) ||                              /* Validate arguments                                   */
+        (p_tail == (OS_BUF *)0)) {
+       *p_err = OS_ERR_BUF_INVALID_P_BUF;
+        return;
+    }
+#endif
+
+    if ((OS_MSG_SIZE)(p_head->TotLen + p_tail->TotLen) < p_head->TotLen) {
+       *p_err = OS_ERR_BUF_INVALID_SIZE;
+        return;
+    }
+
+    p_buf = p_head;
+    for (;;) {
+        p_buf->TotLen = (OS_MSG_SIZE)(p_buf->TotLen + p_tail->TotLen);
+        if (p_buf->NextPtr == (OS_BUF *)0) {
+            break;
+        }
+        p_buf = p_buf->NextPtr;
+    }
+    p_buf->NextPtr = p_tail;                                    /* See Note #1                                          */
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                CLONE A BUFFER CHAIN
+*
+* Description: This function makes a new chain of buffer headers that refer to the data of an existing chain, without
+*              copying the data.
+*
+* Arguments  : p_buf      is a pointer to the first buffer of the chain to clone
+*
+*              p_pool     is a pointer to the pool the headers of the clone are taken from.  Its buffers may have no
+*                         data.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the chain was cloned
+*                             OS_ERR_BUF_INVALID_P_BUF       If you passed a NULL pointer for 'p_buf'
+*                             OS_ERR_BUF_INVALID_P_POOL      If you passed a NULL pointer for 'p_pool'
+*                             OS_ERR_BUF_NO_FREE_BUFS        If 'p_pool' does not have enough free buffers
+*                             OS_ERR_OBJ_TYPE                If 'p_pool' is not a buffer pool
+*
+* Returns    : A pointer to the first header of the clone, with one reference owned by the caller, or a NULL pointer
+*              if an error is detected.
+*
+* Note(s)    : 1) The clone has one header per buffer of 'p_buf', each holding a reference to the buffer that has the
+*                 data, see 'os_buf.c  Note #3'.  The caller keeps its reference to 'p_buf'.
+*
+*              2) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+OS_BUF  *OSBufClone (OS_BUF       *p_buf,
+                     OS_BUF_POOL  *p_pool,
+                     OS_ERR       *p_err)
+{
+    OS_BUF  *p_head;
+    OS_BUF  *p_tail;
+    OS_BUF  *p_clone;
+    OS_BUF  *p_data;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_BUF *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_BUF *)0) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_BUF_INVALID_P_BUF;
+        return ((OS_BUF *)0);
+    }
+    if (p_pool == (OS_BUF_POOL *)0) {
+       *p_err = OS_ERR_BUF_INVALID_P_POOL;
+        return ((OS_BUF *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_pool->Type != OS_OBJ_TYPE_BUF) {                      /* Make sure the buffer pool was created                */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((OS_BUF *)0);
+    }
+#endif
+
+    p_head = (OS_BUF *)0;
+    p_tail = (OS_BUF *)0;
+    while (p_buf != (OS_BUF *)0) {
+        p_clone = OS_BufGet(p_pool);
+        if (p_clone == (OS_BUF *)0) {
+            if (p_head != (OS_BUF *)0) {                        /* Drops the references taken so far                    */
+                OS_BufRelease(p_head);
+            }
+           *p_err = OS_ERR_BUF_NO_FREE_BUFS;
+            return ((OS_BUF *)0);
+        }
+
+        p_data = p_buf->RefPtr;                                 /* The buffer holding the data ...                      */
+        if (p_data == (OS_BUF *)0) {
+            p_data = p_buf;                                     /* ... which is never a clone                           */
+        }
+        CPU_CRITICAL_ENTER();
+        p_data->RefCtr++;
+        CPU_CRITICAL_EXIT();
+
+        p_clone->NextPtr    = (OS_BUF *)0;
+        p_clone->PoolPtr    =  p_pool;
+        p_clone->RefPtr     =  p_data;
+        p_clone->PayloadPtr =  p_buf->PayloadPtr;
+        p_clone->Len        =  p_buf->Len;
+        p_clone->TotLen     =  p_buf->TotLen;
+        p_clone->RefCtr     =  1u;
+
+        if (p_tail == (OS_BUF *)0) {
+            p_head = p_clone;
+        } else {
+            p_tail->NextPtr = p_clone;
+        }
+        p_tail = p_clone;
+        p_buf  = p_buf->NextPtr;
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (p_head);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              RELEASE A BUFFER CHAIN
+*
+* Description: This function drops a reference to a chain of buffers.  Buffers left without references are returned
+*              to their pool.
+*
+* Arguments  : p_buf      is a pointer to the first buffer of the chain
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the reference was dropped
+*                             OS_ERR_BUF_INVALID_P_BUF       If you passed a NULL pointer for 'p_buf'
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSBufFree (OS_BUF  *p_buf,
+                 OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_BUF *)0) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_BUF_INVALID_P_BUF;
+        return;
+    }
+#endif
+
+    OS_BufRelease(p_buf);
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           REMOVE A HEADER FROM A BUFFER
+*
+* Description: This function removes 'len' bytes from the front of the data of the first buffer of a chain.
+*
+* Arguments  : p_buf      is a pointer to the first buffer of the chain
+*
+*              len        is the number of bytes to remove, at most the data of the first buffer ('.Len')
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the header was removed
+*                             OS_ERR_BUF_INVALID_P_BUF       If you passed a NULL pointer for 'p_buf'
+*                             OS_ERR_BUF_INVALID_SIZE        If 'len' is larger than the data of the first buffer
+*                             OS_ERR_BUF_SHARED              If the buffer has more than one reference
+*
+* Returns    : A pointer to the new start of the data, or a NULL pointer if an error is detected.
+*
+* Note(s)    : 1) A buffer referenced more than once is seen by other tasks, which would see its data move.  Use a
+*                 clone instead, see OSBufClone().
+************************************************************************************************************************
+*/
+
+CPU_INT08U  *OSBufHdrPop (OS_BUF       *p_buf,
+                          OS_MSG_SIZE   len,
+                          OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_BUF *)0) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_BUF_INVALID_P_BUF;
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+    if (p_buf->RefCtr > 1u) {                                   /* See Note #1                                          */
+       *p_err = OS_ERR_BUF_SHARED;
+        return ((CPU_INT08U *)0);
+    }
+    if (len > p_buf->Len) {
+       *p_err = OS_ERR_BUF_INVALID_SIZE;
+        return ((CPU_INT08U *)0);
+    }
+
+    p_buf->PayloadPtr += len;
+    p_buf->Len         = (OS_MSG_SIZE)(p_buf->Len    - len);
+    p_buf->TotLen      = (OS_MSG_SIZE)(p_buf->TotLen - len);
+   *p_err              =  OS_ERR_NONE;
+    return (p_buf->PayloadPtr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                             ADD A HEADER TO A BUFFER
+*
+* Description: This function extends the data of the first buffer of a chain by 'len' bytes at the front, into the
+*              headroom of the buffer.
+*
+* Arguments  : p_buf      is a pointer to the first buffer of the chain
+*
+*              len        is the number of bytes to add
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the header was added
+*                             OS_ERR_BUF_HEADROOM            If the buffer has less than 'len' bytes of headroom
+*                             OS_ERR_BUF_INVALID_P_BUF       If you passed a NULL pointer for 'p_buf'
+*                             OS_ERR_BUF_INVALID_SIZE        If the total length would not fit in an OS_MSG_SIZE
+*                             OS_ERR_BUF_SHARED              If the buffer is a clone or has more than one reference
+*
+* Returns    : A pointer to the new start of the data, where the caller writes the header, or a NULL pointer if an
+*              error is detected.
+*
+* Note(s)    : 1) The data of a clone belongs to another buffer, and a buffer referenced more than once is seen by
+*                 other tasks: neither can be written.  To add a header in front of shared data, allocate a buffer
+*                 for the header with OSBufAlloc() and append a clone of the data to it with OSBufCat().
+************************************************************************************************************************
+*/
+
+CPU_INT08U  *OSBufHdrPush (OS_BUF       *p_buf,
+                           OS_MSG_SIZE   len,
+                           OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_BUF *)0) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_BUF_INVALID_P_BUF;
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+    if ((p_buf->RefPtr != (OS_BUF *)0) ||                       /* See Note #1                                          */
+        (p_buf->RefCtr  > 1u)) {
+       *p_err = OS_ERR_BUF_SHARED;
+        return ((CPU_INT08U *)0);
+    }
+    if ((CPU_ADDR)(p_buf->PayloadPtr - (CPU_INT08U *)(p_buf + 1)) < len) {
+       *p_err = OS_ERR_BUF_HEADROOM;
+        return ((CPU_INT08U *)0);
+    }
+    if ((OS_MSG_SIZE)(p_buf->TotLen + len) < p_buf->TotLen) {
+       *p_err = OS_ERR_BUF_INVALID_SIZE;
+        return ((CPU_INT08U *)0);
+    }
+
+    p_buf->PayloadPtr -= len;
+    p_buf->Len         = (OS_MSG_SIZE)(p_buf->Len    + len);
+    p_buf->TotLen      = (OS_MSG_SIZE)(p_buf->TotLen + len);
+   *p_err              =  OS_ERR_NONE;
+    return (p_buf->PayloadPtr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            ADD A REFERENCE TO A BUFFER
+*
+* Description: This function adds a reference to a chain of buffers, for instance before posting the same chain to a
+*              second queue.  Each reference is released with OSBufFree().
+*
+* Arguments  : p_buf      is a pointer to the first buffer of the chain
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the reference was added
+*                             OS_ERR_BUF_INVALID_P_BUF       If you passed a NULL pointer for 'p_buf'
+*
+* Returns    : none
+*
+* Note(s)    : 1) The holders of the references share the same buffers, including '.PayloadPtr' and '.Len', so none
+*                 of them can change the chain.  Use OSBufClone() to give each one its own view of the data.
+*
+*              2) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSBufRef (OS_BUF  *p_buf,
+                OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_BUF *)0) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_BUF_INVALID_P_BUF;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_buf->RefCtr++;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                         TAKE A BUFFER FROM A BUFFER POOL
+*
+* Description: This function takes one buffer from the partition of a pool and updates the pool's statistics.
+*
+* Arguments  : p_pool     is a pointer to the buffer pool
+*
+* Returns    : A pointer to the buffer, whose header is not initialized, or a NULL pointer if the pool is empty.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  OS_BUF  *OS_BufGet (OS_BUF_POOL  *p_pool)
+{
+    OS_BUF  *p_buf;
+    OS_ERR   err;
+    CPU_SR_ALLOC();
+
+
+    p_buf = (OS_BUF *)OSMemGet(&p_pool->Mem, &err);
+
+    CPU_CRITICAL_ENTER();
+    if (p_buf == (OS_BUF *)0) {
+        p_pool->FailCtr++;
+    } else {
+        p_pool->AllocCtr++;
+        p_pool->NbrUsed++;
+        if (p_pool->NbrUsedMax < p_pool->NbrUsed) {
+            p_pool->NbrUsedMax = p_pool->NbrUsed;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_buf);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        DROP ONE REFERENCE TO ONE BUFFER
+*
+* Description: This function decrements the reference count of a buffer.  When it reaches 0, the buffer is counted as
+*              free in its pool's statistics, and the caller returns it to the partition.
+*
+* Arguments  : p_buf      is a pointer to the buffer
+*
+* Returns    : The number of references left.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_BufRefDec (OS_BUF  *p_buf)
+{
+    OS_BUF_POOL  *p_pool;
+    OS_OBJ_QTY    ref_ctr;
+    CPU_SR_ALLOC();
+
+
+    p_pool = p_buf->PoolPtr;
+    CPU_CRITICAL_ENTER();
+    p_buf->RefCtr--;
+    ref_ctr = p_buf->RefCtr;
+    if (ref_ctr == 0u) {
+        p_pool->FreeCtr++;
+        p_pool->NbrUsed--;
+    }
+    CPU_CRITICAL_EXIT();
+    return (ref_ctr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                       DROP A REFERENCE TO A BUFFER CHAIN
+*
+* Description: This function drops a reference to the first buffer of a chain and returns to their pools the buffers
+*              that no longer have references.
+*
+* Arguments  : p_buf      is a pointer to the first buffer of the chain
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) A freed buffer drops its link to the next buffer and, for a clone, its reference to the buffer
+*                 holding its data, which may in turn be freed along with the rest of ITS chain.  Instead of
+*                 recursing, a freed clone is kept on a local stack, linked through '.RefPtr', until the chain of its
+*                 data buffer has been walked.  Its own '.NextPtr' is then resumed and the clone returned to its pool.
+************************************************************************************************************************
+*/
+
+void  OS_BufRelease (OS_BUF  *p_buf)
+{
+    OS_BUF  *p_stack;
+    OS_BUF  *p_next;
+    OS_ERR   err;
+
+
+    p_stack = (OS_BUF *)0;
+    for (;;) {
+        if (p_buf == (OS_BUF *)0) {
+            if (p_stack == (OS_BUF *)0) {                       /* Nothing left to walk                                 */
+                break;
+            }
+            p_next  = p_stack;                                  /* Resume the chain of the last freed clone             */
+            p_stack = p_next->RefPtr;
+            p_buf   = p_next->NextPtr;
+            OSMemPut(&p_next->PoolPtr->Mem, p_next, &err);
+            continue;
+        }
+
+        if (OS_BufRefDec(p_buf) > 0u) {                         /* Still referenced: so is the rest of its chain        */
+            p_buf = (OS_BUF *)0;
+            continue;
+        }
+
+        if (p_buf->RefPtr == (OS_BUF *)0) {
+            p_next = p_buf->NextPtr;
+            OSMemPut(&p_buf->PoolPtr->Mem, p_buf, &err);
+            p_buf  = p_next;
+        } else {
+            p_next         = p_buf->RefPtr;                     /* Clone: release its data buffer first, see Note #2    */
+            p_buf->RefPtr  = p_stack;
+            p_stack        = p_buf;
+            p_buf          = p_next;
+        }
+    }
+}
+
+#endif
@@ -37,6 +37,10 @@ const  CPU_CHAR  *os_cfg_app__c = "$Id: $";
 #define  OS_CFG_IDLE_TASK_STK_LIMIT      ((OS_CFG_IDLE_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #endif
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+#define  OS_CFG_INT_Q_TASK_STK_LIMIT     ((OS_CFG_INT_Q_TASK_STK_SIZE * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
 #define  OS_CFG_STAT_TASK_STK_LIMIT      ((OS_CFG_STAT_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #endif
@@ -52,8 +56,17 @@ const  CPU_CHAR  *os_cfg_app__c = "$Id: $";
 */
 
 #if (OS_CFG_TASK_IDLE_EN > 0u)
+#if (OS_CFG_SMP_CORE_NBR > 1u)                                  /* One idle task per core                               */
+CPU_STK        OSCfg_IdleTaskStk   [OS_CFG_SMP_CORE_NBR][OS_CFG_IDLE_TASK_STK_SIZE];
+#else
 CPU_STK        OSCfg_IdleTaskStk   [OS_CFG_IDLE_TASK_STK_SIZE];
 #endif
+#endif
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+OS_INT_Q       OSCfg_IntQ          [OS_CFG_INT_Q_SIZE];
+CPU_STK        OSCfg_IntQTaskStk   [OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
 
 #if (OS_CFG_ISR_STK_SIZE > 0u)
 CPU_STK        OSCfg_ISRStk        [OS_CFG_ISR_STK_SIZE];
@@ -67,10 +80,18 @@ OS_MSG         OSCfg_MsgPool       [OS_CFG_MSG_POOL_SIZE];
 CPU_STK        OSCfg_StatTaskStk   [OS_CFG_STAT_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+OS_TICK_SPOKE  OSCfg_TickWheel     [OS_CFG_TICK_WHEEL_SIZE];
+#endif
+
 #if (OS_CFG_TMR_EN > 0u)
 CPU_STK        OSCfg_TmrTaskStk    [OS_CFG_TMR_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+OS_TMR_SPOKE   OSCfg_TmrWheel      [OS_CFG_TMR_WHEEL_LEVELS * OS_TMR_WHEEL_SIZE];
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                      CONSTANTS
@@ -78,7 +99,11 @@ CPU_STK        OSCfg_TmrTaskStk    [OS_CFG_TMR_TASK_STK_SIZE];
 */
 
 #if (OS_CFG_TASK_IDLE_EN > 0u)
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+CPU_STK      * const  OSCfg_IdleTaskStkBasePtr   = &OSCfg_IdleTaskStk[0][0];
+#else
 CPU_STK      * const  OSCfg_IdleTaskStkBasePtr   = &OSCfg_IdleTaskStk[0];
+#endif
 CPU_STK_SIZE   const  OSCfg_IdleTaskStkLimit     =  OS_CFG_IDLE_TASK_STK_LIMIT;
 CPU_STK_SIZE   const  OSCfg_IdleTaskStkSize      =  OS_CFG_IDLE_TASK_STK_SIZE;
 CPU_INT32U     const  OSCfg_IdleTaskStkSizeRAM   =  sizeof(OSCfg_IdleTaskStk);
@@ -89,6 +114,24 @@ CPU_STK_SIZE   const  OSCfg_IdleTaskStkSize      =            0u;
 CPU_INT32U     const  OSCfg_IdleTaskStkSizeRAM   =            0u;
 #endif
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+OS_INT_Q     * const  OSCfg_IntQBasePtr          = &OSCfg_IntQ[0];
+OS_OBJ_QTY     const  OSCfg_IntQSize             =  OS_CFG_INT_Q_SIZE;
+CPU_INT32U     const  OSCfg_IntQSizeRAM          =  sizeof(OSCfg_IntQ);
+CPU_STK      * const  OSCfg_IntQTaskStkBasePtr   = &OSCfg_IntQTaskStk[0];
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkLimit     =  OS_CFG_INT_Q_TASK_STK_LIMIT;
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkSize      =  OS_CFG_INT_Q_TASK_STK_SIZE;
+CPU_INT32U     const  OSCfg_IntQTaskStkSizeRAM   =  sizeof(OSCfg_IntQTaskStk);
+#else
+OS_INT_Q     * const  OSCfg_IntQBasePtr          = (OS_INT_Q *)0;
+OS_OBJ_QTY     const  OSCfg_IntQSize             =            0u;
+CPU_INT32U     const  OSCfg_IntQSizeRAM          =            0u;
+CPU_STK      * const  OSCfg_IntQTaskStkBasePtr   = (CPU_STK  *)0;
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkLimit     =            0u;
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkSize      =            0u;
+CPU_INT32U     const  OSCfg_IntQTaskStkSizeRAM   =            0u;
+#endif
+
 #if (OS_CFG_ISR_STK_SIZE > 0u)
 CPU_STK      * const  OSCfg_ISRStkBasePtr        = &OSCfg_ISRStk[0];
 CPU_STK_SIZE   const  OSCfg_ISRStkSize           =  OS_CFG_ISR_STK_SIZE;
@@ -137,6 +180,11 @@ OS_RATE_HZ     const  OSCfg_TickRate_Hz          =  OS_CFG_TICK_RATE_HZ;
 OS_RATE_HZ     const  OSCfg_TickRate_Hz          =  0u;
 #endif
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+OS_TICK        const  OSCfg_TickWheelSize        =  OS_CFG_TICK_WHEEL_SIZE;
+CPU_INT32U     const  OSCfg_TickWheelSizeRAM     =  sizeof(OSCfg_TickWheel);
+#endif
+
 
 #if (OS_CFG_TMR_EN > 0u)
 OS_PRIO        const  OSCfg_TmrTaskPrio          =  OS_CFG_TMR_TASK_PRIO;
@@ -154,6 +202,11 @@ CPU_STK_SIZE   const  OSCfg_TmrTaskStkSize       =             0u;
 CPU_INT32U     const  OSCfg_TmrTaskStkSizeRAM    =             0u;
 #endif
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+OS_OBJ_QTY     const  OSCfg_TmrWheelSize         =  OS_CFG_TMR_WHEEL_LEVELS * OS_TMR_WHEEL_SIZE;
+CPU_INT32U     const  OSCfg_TmrWheelSizeRAM      =  sizeof(OSCfg_TmrWheel);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -167,6 +220,11 @@ CPU_INT32U     const  OSCfg_DataSizeRAM          = 0u
                                                  + sizeof(OSCfg_IdleTaskStk)
 #endif
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+                                                 + sizeof(OSCfg_IntQ)
+                                                 + sizeof(OSCfg_IntQTaskStk)
+#endif
+
 #if (OS_MSG_EN > 0u)
                                                  + sizeof(OSCfg_MsgPool)
 #endif
@@ -175,10 +233,18 @@ CPU_INT32U     const  OSCfg_DataSizeRAM          = 0u
                                                  + sizeof(OSCfg_StatTaskStk)
 #endif
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+                                                 + sizeof(OSCfg_TickWheel)
+#endif
+
 #if (OS_CFG_TMR_EN > 0u)
                                                  + sizeof(OSCfg_TmrTaskStk)
 #endif
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+                                                 + sizeof(OSCfg_TmrWheel)
+#endif
+
 #if (OS_CFG_ISR_STK_SIZE > 0u)
                                                  + sizeof(OSCfg_ISRStk)
 #endif
@@ -217,6 +283,16 @@ void  OSCfg_Init (void)
     (void)OSCfg_IdleTaskStkSizeRAM;
 #endif
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+    (void)OSCfg_IntQBasePtr;
+    (void)OSCfg_IntQSize;
+    (void)OSCfg_IntQSizeRAM;
+    (void)OSCfg_IntQTaskStkBasePtr;
+    (void)OSCfg_IntQTaskStkLimit;
+    (void)OSCfg_IntQTaskStkSize;
+    (void)OSCfg_IntQTaskStkSizeRAM;
+#endif
+
     (void)OSCfg_ISRStkBasePtr;
     (void)OSCfg_ISRStkSize;
     (void)OSCfg_ISRStkSizeRAM;
@@ -242,6 +318,11 @@ void  OSCfg_Init (void)
     (void)OSCfg_TickRate_Hz;
 #endif
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    (void)OSCfg_TickWheelSize;
+    (void)OSCfg_TickWheelSizeRAM;
+#endif
+
 #if (OS_CFG_TMR_EN > 0u)
     (void)OSCfg_TmrTaskPrio;
     (void)OSCfg_TmrTaskRate_Hz;
@@ -250,4 +331,9 @@ void  OSCfg_Init (void)
     (void)OSCfg_TmrTaskStkSize;
     (void)OSCfg_TmrTaskStkSizeRAM;
 #endif
+
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    (void)OSCfg_TmrWheelSize;
+    (void)OSCfg_TmrWheelSizeRAM;
+#endif
 }
@@ -0,0 +1,972 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     CONDITION VARIABLE MANAGEMENT
+*
+* File    : os_cond.c
+* Version : V3.08.01
+*********************************************************************************************************
+* Note(s) : (1) A condition variable is bound to a mutex when it is created.  A task waits on the condition
+*               variable while it owns the mutex: the mutex is released and the task placed in the pend list
+*               of the condition variable in one critical section, so a signal sent once the waiter has
+*               released the mutex can not be lost.  The waiter owns the mutex again when the wait returns.
+*
+*           (2) Signaled tasks are not made ready while the mutex is owned.  They are moved from the pend list
+*               of the condition variable to the pend list of the mutex, and the owner inherits their priority.
+*               Each of them is made ready when the mutex is handed to it, so a broadcast readies at most one
+*               task instead of readying every waiter only for all but one to block again on the mutex.
+*
+*           (3) Condition variables MUST NOT be used from an ISR.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_cond__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_COND_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL FUNCTIONS
+************************************************************************************************************************
+*/
+
+static  void  OS_CondMove   (OS_COND   *p_cond,
+                             OS_TCB    *p_tcb,
+                             CPU_TS     ts);
+
+static  void  OS_CondPost   (OS_COND   *p_cond,
+                             OS_OPT     opt,
+                             OS_OPT     opt_post,
+                             OS_ERR    *p_err);
+
+static  void  OS_CondWait   (OS_COND   *p_cond,
+                             OS_TICK    timeout,
+                             CPU_TS    *p_ts,
+                             OS_ERR    *p_err);
+
+
+/*
+************************************************************************************************************************
+*                                             CREATE A CONDITION VARIABLE
+*
+* Description: This function creates a condition variable and binds it to a mutex.
+*
+* Arguments  : p_cond        is a pointer to the condition variable to initialize.  Your application is responsible for
+*                            allocating storage for the condition variable.
+*
+*              p_name        is a pointer to the name you would like to give the condition variable.
+*
+*              p_mutex       is a pointer to the mutex that guards the condition.  It must already be created.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the condition variable after
+*                                                                 you called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_cond' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the condition variable was already created
+*                                OS_ERR_OBJ_TYPE                If 'p_mutex' is not pointing at a mutex
+*                                OS_ERR_PTR_INVALID             If 'p_mutex' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) The mutex MUST NOT be deleted while condition variables are bound to it.
+************************************************************************************************************************
+*/
+
+void  OSCondCreate (OS_COND   *p_cond,
+                    CPU_CHAR  *p_name,
+                    OS_MUTEX  *p_mutex,
+                    OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_cond == (OS_COND *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_mutex == (OS_MUTEX *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mutex->Type != OS_OBJ_TYPE_MUTEX) {                   /* Make sure mutex was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_cond->Type == OS_OBJ_TYPE_COND) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_cond->Type    = OS_OBJ_TYPE_COND;                         /* Mark the data structure as a condition variable      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_cond->NamePtr = p_name;
+#else
+    (void)p_name;
+#endif
+    p_cond->Mutex   = p_mutex;                                  /* Bind the mutex to the condition variable             */
+    OS_PendListInit(&p_cond->PendList);                         /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_CondDbgListAdd(p_cond);
+    OSCondQty++;
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             DELETE A CONDITION VARIABLE
+*
+* Description: This function deletes a condition variable and readies all tasks waiting on it.
+*
+* Arguments  : p_cond        is a pointer to the condition variable to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the condition variable ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the condition variable even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the condition variable was
+*                                                               deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete it from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the condition variable after
+*                                                                 you called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_cond' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_cond' is not pointing at a condition variable
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the condition variable
+*
+* Returns    : == 0          if no tasks were waiting on the condition variable, or upon error.
+*              >  0          if one or more tasks waiting on the condition variable are now readied and informed.
+*
+* Note(s)    : 1) The readied tasks get OS_ERR_OBJ_DEL once they own the mutex again.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_COND_DEL_EN > 0u)
+OS_OBJ_QTY  OSCondDel (OS_COND  *p_cond,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a condition var. from an ISR   */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_cond == (OS_COND *)0) {                               /* Validate 'p_cond'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_cond->Type != OS_OBJ_TYPE_COND) {                     /* Make sure condition variable was created             */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_cond->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete condition variable only if no task waiting    */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_CondDbgListRemove(p_cond);
+                 OSCondQty--;
+#endif
+                 OS_CondClr(p_cond);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the condition variable                 */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_CondDbgListRemove(p_cond);
+             OSCondQty--;
+#endif
+             OS_CondClr(p_cond);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            WAIT ON A CONDITION VARIABLE
+*
+* Description: This function releases the mutex bound to the condition variable and waits until the condition variable
+*              is signaled.  The mutex is owned again when the function returns.
+*
+* Arguments  : p_cond        is a pointer to the condition variable
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the task was readied.
+*                            Passing a NULL pointer is valid and indicates that you don't need the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The condition variable was signaled
+*                                OS_ERR_MUTEX_NOT_OWNER    If the calling task does not own the mutex
+*                                OS_ERR_OBJ_DEL            If 'p_cond' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_cond' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_cond' is not pointing at a condition variable
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the wait was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*
+* Returns    : none
+*
+* Note(s)    : 1) As with any condition variable, the caller MUST test its condition again when the wait returns.
+*
+*              2) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+void  OSCondWait (OS_COND  *p_cond,
+                  CPU_TS   *p_ts,
+                  OS_ERR   *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_CondWait(p_cond, 0u, p_ts, p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                     WAIT ON A CONDITION VARIABLE WITH A TIMEOUT
+*
+* Description: This function is OSCondWait() with a limit on the time spent waiting for the signal.
+*
+* Arguments  : p_cond        is a pointer to the condition variable
+*
+*              timeout       is the number of ticks to wait for the signal.  0 waits forever, as OSCondWait() does.
+*                            The time spent getting the mutex back is not limited.
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the task was readied.
+*                            Passing a NULL pointer is valid and indicates that you don't need the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            The condition variable was not signaled within the timeout
+*
+*                            and the codes returned by OSCondWait().
+*
+* Returns    : none
+*
+* Note(s)    : 1) The mutex is owned again when the function returns, including with OS_ERR_TIMEOUT.
+*
+*              2) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+void  OSCondTimedWait (OS_COND  *p_cond,
+                       OS_TICK   timeout,
+                       CPU_TS   *p_ts,
+                       OS_ERR   *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+    OS_CondWait(p_cond, timeout, p_ts, p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           SIGNAL A CONDITION VARIABLE
+*
+* Description: This function wakes up the highest priority task waiting on a condition variable.
+*
+* Arguments  : p_cond        is a pointer to the condition variable
+*
+*              opt           is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                                OS_OPT_POST_NONE        No special option selected
+*                                OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful, or no task was waiting
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_cond' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_cond' is not pointing at a condition variable
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR           If you attempted to post from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The caller should own the mutex, so that the signal can not be sent between the test of the condition
+*                 by a waiter and its call to OSCondWait().  If the mutex is free, the signaled task gets it and is
+*                 made ready.
+************************************************************************************************************************
+*/
+
+void  OSCondSignal (OS_COND  *p_cond,
+                    OS_OPT    opt,
+                    OS_ERR   *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_CondPost(p_cond, opt, OS_OPT_POST_1, p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          BROADCAST TO A CONDITION VARIABLE
+*
+* Description: This function wakes up all the tasks waiting on a condition variable.
+*
+* Arguments  : p_cond        is a pointer to the condition variable
+*
+*              opt           is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                                OS_OPT_POST_NONE        No special option selected
+*                                OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful, or no task was waiting
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_cond' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_cond' is not pointing at a condition variable
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR           If you attempted to post from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The waiters are moved to the pend list of the mutex in one critical section (see Note #2 at the top of
+*                 this file).  They get the mutex one at a time, in priority order.
+************************************************************************************************************************
+*/
+
+void  OSCondBroadcast (OS_COND  *p_cond,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_CondPost(p_cond, opt, OS_OPT_POST_ALL, p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                      CLEAR THE CONTENTS OF A CONDITION VARIABLE
+*
+* Description: This function is called by OSCondDel() to clear the contents of a condition variable
+*
+* Argument(s): p_cond     is a pointer to the condition variable to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_CondClr (OS_COND  *p_cond)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_cond->Type    =  OS_OBJ_TYPE_NONE;                        /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_cond->NamePtr = (CPU_CHAR *)((void *)"?COND");
+#endif
+    p_cond->Mutex   = (OS_MUTEX *)0;
+    OS_PendListInit(&p_cond->PendList);                         /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                  ADD/REMOVE CONDITION VARIABLE TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a condition variable to/from the debug list.
+*
+* Arguments  : p_cond       is a pointer to the condition variable to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_CondDbgListAdd (OS_COND  *p_cond)
+{
+    p_cond->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_cond->DbgPrevPtr               = (OS_COND *)0;
+    if (OSCondDbgListPtr == (OS_COND *)0) {
+        p_cond->DbgNextPtr           = (OS_COND *)0;
+    } else {
+        p_cond->DbgNextPtr           =  OSCondDbgListPtr;
+        OSCondDbgListPtr->DbgPrevPtr =  p_cond;
+    }
+    OSCondDbgListPtr                 =  p_cond;
+}
+
+
+void  OS_CondDbgListRemove (OS_COND  *p_cond)
+{
+    OS_COND  *p_cond_next;
+    OS_COND  *p_cond_prev;
+
+
+    p_cond_prev = p_cond->DbgPrevPtr;
+    p_cond_next = p_cond->DbgNextPtr;
+
+    if (p_cond_prev == (OS_COND *)0) {
+        OSCondDbgListPtr = p_cond_next;
+        if (p_cond_next != (OS_COND *)0) {
+            p_cond_next->DbgPrevPtr = (OS_COND *)0;
+        }
+        p_cond->DbgNextPtr = (OS_COND *)0;
+
+    } else if (p_cond_next == (OS_COND *)0) {
+        p_cond_prev->DbgNextPtr = (OS_COND *)0;
+        p_cond->DbgPrevPtr      = (OS_COND *)0;
+
+    } else {
+        p_cond_prev->DbgNextPtr =  p_cond_next;
+        p_cond_next->DbgPrevPtr =  p_cond_prev;
+        p_cond->DbgNextPtr      = (OS_COND *)0;
+        p_cond->DbgPrevPtr      = (OS_COND *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                 MOVE A SIGNALED TASK FROM THE CONDITION TO THE MUTEX
+*
+* Description: This function hands the mutex to a task waiting on a condition variable if the mutex is free, or else
+*              moves the task to the pend list of the mutex.
+*
+* Arguments  : p_cond       is a pointer to the condition variable
+*              ------
+*
+*              p_tcb        is a pointer to the TCB of the signaled task
+*              -----
+*
+*              ts           is the timestamp of the signal
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A moved task waits for the mutex without a timeout.  The timeout of OSCondTimedWait() only applies to
+*                 the wait for the signal.
+************************************************************************************************************************
+*/
+
+static  void  OS_CondMove (OS_COND  *p_cond,
+                           OS_TCB   *p_tcb,
+                           CPU_TS    ts)
+{
+    OS_MUTEX  *p_mutex;
+    OS_TCB    *p_tcb_owner;
+
+
+    p_mutex = p_cond->Mutex;
+    OS_MUTEX_FAST_INFLATE(p_mutex);                             /* The signaler may hold the mutex on the fast path     */
+    if (p_mutex->OwnerTCBPtr == (OS_TCB *)0) {                  /* Is the mutex free?                                   */
+        p_mutex->OwnerTCBPtr     = p_tcb;                       /* Yes, give it to the signaled task and ready it       */
+        p_mutex->OwnerNestingCtr = 1u;
+        OS_MutexGrpAdd(p_tcb, p_mutex);
+        OS_Post((OS_PEND_OBJ *)((void *)p_cond),
+                                        p_tcb,
+                                (void *)0,
+                                        0u,
+                                        ts);
+        return;
+    }
+
+    OS_PendListRemove(p_tcb);                                   /* No, leave the condition variable ...                 */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_PendDbgNameRemove((OS_PEND_OBJ *)((void *)p_cond),
+                         p_tcb);
+#endif
+#if (OS_CFG_TICK_EN > 0u)
+    switch (p_tcb->TaskState) {                                 /* ... cancel the timeout (see Note #2) ...             */
+        case OS_TASK_STATE_PEND_TIMEOUT:
+             OS_TickListRemove(p_tcb);
+             p_tcb->TaskState = OS_TASK_STATE_PEND;
+             break;
+
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             OS_TickListRemove(p_tcb);
+             p_tcb->TaskState = OS_TASK_STATE_PEND_SUSPENDED;
+             break;
+
+        default:
+             break;
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    p_tcb->TS         = ts;
+#endif
+    p_tcb->PendOn     = OS_TASK_PEND_ON_MUTEX;                  /* ... and wait for the mutex                           */
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)((void *)p_mutex);
+    OS_PendListInsertPrio(&p_mutex->PendList,
+                           p_tcb);
+#if (OS_CFG_DBG_EN > 0u)
+    OS_PendDbgNameAdd((OS_PEND_OBJ *)((void *)p_mutex),
+                      p_tcb);
+#endif
+
+    p_tcb_owner = p_mutex->OwnerTCBPtr;
+    if (p_tcb_owner->Prio > p_tcb->Prio) {                      /* See if mutex owner has a lower priority              */
+        OS_TaskChangePrio(p_tcb_owner, p_tcb->Prio);
+        OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb_owner, p_tcb_owner->Prio);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                        SIGNAL OR BROADCAST TO A CONDITION VARIABLE
+*
+* Description: This function is common to OSCondSignal() and OSCondBroadcast().
+*
+* Arguments  : p_cond       is a pointer to the condition variable
+*              ------
+*
+*              opt          is the option passed by the caller, see OSCondSignal()
+*
+*              opt_post     determines the tasks that are signaled:
+*
+*                               OS_OPT_POST_1           The highest priority task waiting
+*                               OS_OPT_POST_ALL         All the tasks waiting
+*
+*              p_err        is a pointer to a variable that will contain an error code, see OSCondSignal()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_CondPost (OS_COND  *p_cond,
+                           OS_OPT    opt,
+                           OS_OPT    opt_post,
+                           OS_ERR   *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_cond == (OS_COND *)0) {                               /* Validate 'p_cond'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_cond->Type != OS_OBJ_TYPE_COND) {                     /* Make sure condition variable was created             */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_cond->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on the condition variable?          */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
+        OS_CondMove(p_cond, p_pend_list->HeadPtr, ts);
+        if (opt_post != OS_OPT_POST_ALL) {                      /* Signal all tasks waiting?                            */
+            break;                                              /* No                                                   */
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            WAIT ON A CONDITION VARIABLE
+*
+* Description: This function is common to OSCondWait() and OSCondTimedWait().
+*
+* Arguments  : p_cond       is a pointer to the condition variable
+*              ------
+*
+*              timeout      is the timeout of the wait for the signal, 0 to wait forever
+*
+*              p_ts         is a pointer to a variable that will receive a timestamp, see OSCondWait()
+*
+*              p_err        is a pointer to a variable that will contain an error code, see OSCondWait()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The mutex is released the way OSMutexPost() releases it, with the nesting counter saved.  A task that
+*                 was moved to the pend list of the mutex by a signal wakes up as its owner.  A task whose wait timed
+*                 out, was aborted or whose condition variable was deleted waits for the mutex before it returns.
+*                 The nesting counter is restored in both cases.
+************************************************************************************************************************
+*/
+
+static  void  OS_CondWait (OS_COND  *p_cond,
+                           OS_TICK   timeout,
+                           CPU_TS   *p_ts,
+                           OS_ERR   *p_err)
+{
+    OS_MUTEX        *p_mutex;
+    OS_PEND_LIST    *p_pend_list;
+    OS_TCB          *p_tcb;
+    OS_NESTING_CTR   nesting_ctr;
+    OS_STATUS        pend_status;
+    OS_PRIO          prio_new;
+    CPU_TS           ts;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_cond == (OS_COND *)0) {                               /* Validate 'p_cond'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_cond->Type != OS_OBJ_TYPE_COND) {                     /* Make sure condition variable was created             */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+    p_mutex = p_cond->Mutex;
+    CPU_CRITICAL_ENTER();
+    OS_MUTEX_FAST_INFLATE(p_mutex);                             /* The caller may hold the mutex on the fast path       */
+    if (OSTCBCurPtr != p_mutex->OwnerTCBPtr) {                  /* The caller must own the mutex                        */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_NOT_OWNER;
+        return;
+    }
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't pend when the scheduler is locked              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    OS_TRACE_MUTEX_POST(p_mutex);
+#if (OS_CFG_TS_EN > 0u)
+    ts          = OS_TS_GET();                                  /* Get timestamp                                        */
+    p_mutex->TS = ts;
+#else
+    ts          = 0u;
+#endif
+    nesting_ctr = p_mutex->OwnerNestingCtr;                     /* Release the mutex (see Note #2)                      */
+    OS_MutexGrpRemove(OSTCBCurPtr, p_mutex);
+    p_pend_list = &p_mutex->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
+        p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
+        p_mutex->OwnerNestingCtr =           0u;
+        OS_MUTEX_FAST_DEFLATE(p_mutex);
+    } else {
+        if (OSTCBCurPtr->Prio != OSTCBCurPtr->BasePrio) {       /* Has owner inherited a priority?                      */
+            prio_new = OS_MutexGrpPrioFindHighest(OSTCBCurPtr); /* Yes, find highest priority pending                   */
+            prio_new = (prio_new > OSTCBCurPtr->BasePrio) ? OSTCBCurPtr->BasePrio : prio_new;
+            if (prio_new > OSTCBCurPtr->Prio) {
+                OS_RdyListRemove(OSTCBCurPtr);
+                OSTCBCurPtr->Prio = prio_new;                   /* Lower owner's priority back to its original one      */
+                OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(OSTCBCurPtr, prio_new);
+                OS_PrioInsert(prio_new);
+                OS_RdyListInsertTail(OSTCBCurPtr);              /* Insert owner in ready list at new priority           */
+                OSPrioCur         = prio_new;
+            }
+        }
+        p_tcb                    = p_pend_list->HeadPtr;        /* Give mutex to the highest priority waiter            */
+        p_mutex->OwnerTCBPtr     = p_tcb;
+        p_mutex->OwnerNestingCtr = 1u;
+        OS_MutexGrpAdd(p_tcb, p_mutex);
+        OS_Post((OS_PEND_OBJ *)((void *)p_mutex),
+                               p_tcb,
+                               (void *)0,
+                               0u,
+                               ts);
+    }
+
+    OS_Pend((OS_PEND_OBJ *)((void *)p_cond),                    /* Block task pending on the condition variable         */
+             OSTCBCurPtr,
+             OS_TASK_PEND_ON_COND,
+             timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    pend_status = OSTCBCurPtr->PendStatus;                      /* How the wait on the condition variable ended         */
+#if (OS_CFG_TS_EN > 0u)
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = (pend_status == OS_STATUS_PEND_TIMEOUT) ? 0u : OSTCBCurPtr->TS;
+    }
+#endif
+
+    OS_MUTEX_FAST_INFLATE(p_mutex);                             /* Another task may hold the mutex on the fast path     */
+    while (p_mutex->OwnerTCBPtr != OSTCBCurPtr) {               /* Get the mutex back if it was not handed to us        */
+        if (p_mutex->OwnerTCBPtr == (OS_TCB *)0) {
+            p_mutex->OwnerTCBPtr = OSTCBCurPtr;
+            OS_MutexGrpAdd(OSTCBCurPtr, p_mutex);
+            break;
+        }
+        p_tcb = p_mutex->OwnerTCBPtr;
+        if (p_tcb->Prio > OSTCBCurPtr->Prio) {                  /* See if mutex owner has a lower priority than current */
+            OS_TaskChangePrio(p_tcb, OSTCBCurPtr->Prio);
+            OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
+        }
+        OS_Pend((OS_PEND_OBJ *)((void *)p_mutex),
+                 OSTCBCurPtr,
+                 OS_TASK_PEND_ON_MUTEX,
+                 0u);
+        CPU_CRITICAL_EXIT();
+        OSSched();
+        CPU_CRITICAL_ENTER();
+        if (OSTCBCurPtr->PendStatus == OS_STATUS_PEND_DEL) {    /* The mutex was deleted, nothing to get back           */
+            pend_status = OS_STATUS_PEND_DEL;
+            break;
+        }
+        OS_MUTEX_FAST_INFLATE(p_mutex);                         /* The pend may have been aborted: another task may ... */
+    }                                                           /* ... have taken the mutex on the fast path since      */
+    if (p_mutex->OwnerTCBPtr == OSTCBCurPtr) {
+        p_mutex->OwnerNestingCtr = nesting_ctr;                 /* Restore the nesting of the caller                    */
+        OS_TRACE_MUTEX_PEND(p_mutex);
+    }
+    CPU_CRITICAL_EXIT();
+
+    switch (pend_status) {
+        case OS_STATUS_PEND_OK:                                 /* We were signaled                                     */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we were not signaled within timeout    */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+}
+
+#endif /* OS_CFG_COND_EN */
@@ -30,6 +30,18 @@
 const  CPU_CHAR  *os_core__c = "$Id: $";
 #endif
 
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+static  OS_TCB  *OS_PendListPrioNextGet (OS_PEND_LIST  *p_pend_list,
+                                         OS_PRIO        prio);
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                    INITIALIZATION
@@ -51,6 +63,9 @@ void  OSInit (OS_ERR  *p_err)
     CPU_STK      *p_stk;
     CPU_STK_SIZE  size;
 #endif
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    CPU_INT08U    core;
+#endif
 
 
 
@@ -75,6 +90,17 @@ void  OSInit (OS_ERR  *p_err)
     OSPrioCur             =           0u;                       /* Initialize priority variables to a known state       */
     OSPrioHighRdy         =           0u;
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    for (core = 0u; core < OS_CFG_SMP_CORE_NBR; core++) {       /* Same for every core (see OS_SMP_Sched())             */
+        OSIntNestingCtrTbl[core]       =           0u;
+        OSSchedLockNestingCtrTbl[core] =           0u;
+        OSTCBCurPtrTbl[core]           = (OS_TCB *)0;
+        OSTCBHighRdyPtrTbl[core]       = (OS_TCB *)0;
+        OSPrioCurTbl[core]             =           0u;
+        OSPrioHighRdyTbl[core]         =           0u;
+    }
+#endif
+
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
     OSSchedLockTimeBegin  =           0u;
     OSSchedLockTimeMax    =           0u;
@@ -156,6 +182,17 @@ void  OSInit (OS_ERR  *p_err)
     OSMutexDbgListPtr = (OS_MUTEX *)0;
     OSMutexQty        =             0u;
 #endif
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    OSMutexFastListPtr = (OS_MUTEX *)0;
+#endif
+#endif
+
+
+#if (OS_CFG_COND_EN > 0u)                                       /* Initialize the Condition Variable Manager module     */
+#if (OS_CFG_DBG_EN > 0u)
+    OSCondDbgListPtr = (OS_COND *)0;
+    OSCondQty        =            0u;
+#endif
 #endif
 
 
@@ -175,6 +212,14 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_STREAM_EN > 0u)                                     /* Initialize the Stream Buffer Manager module          */
+#if (OS_CFG_DBG_EN > 0u)
+    OSStreamDbgListPtr = (OS_STREAM *)0;
+    OSStreamQty        =              0u;
+#endif
+#endif
+
+
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     OS_TLS_Init(p_err);                                         /* Initialize Task Local Storage, before creating tasks */
     if (*p_err != OS_ERR_NONE) {
@@ -189,6 +234,14 @@ void  OSInit (OS_ERR  *p_err)
     }
 
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+    OS_IntQTaskInit(p_err);                                     /* Initialize the ISR queue and its handler task        */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
 #if (OS_CFG_TASK_IDLE_EN > 0u)
     OS_IdleTaskInit(p_err);                                     /* Initialize the Idle Task                             */
     if (*p_err != OS_ERR_NONE) {
@@ -339,9 +392,16 @@ void  OSIntExit (void)
 #endif
 #endif
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    OSTCBHighRdyPtr = OS_SMP_Sched();                           /* Get the task this core runs next                     */
+    OSPrioHighRdy   = OSTCBHighRdyPtr->Prio;
+#else
     OSPrioHighRdy   = OS_PrioGetHighest();                      /* Find highest priority                                */
+#endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
+#if (OS_CFG_SMP_CORE_NBR == 1u)
     OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;         /* Get highest priority task ready-to-run               */
+#endif
     if (OSTCBHighRdyPtr == OSTCBCurPtr) {                       /* Current task still the highest priority?             */
                                                                 /* Yes                                                  */
 #if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
@@ -447,9 +507,16 @@ void  OSSched (void)
     }
 
     CPU_INT_DIS();
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    OSTCBHighRdyPtr = OS_SMP_Sched();                           /* Get the task this core runs next                     */
+    OSPrioHighRdy   = OSTCBHighRdyPtr->Prio;
+#else
     OSPrioHighRdy   = OS_PrioGetHighest();                      /* Find the highest priority ready                      */
+#endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
+#if (OS_CFG_SMP_CORE_NBR == 1u)
     OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;         /* Get highest priority task ready-to-run               */
+#endif
     if (OSTCBHighRdyPtr == OSTCBCurPtr) {                       /* Current task still the highest priority?             */
         CPU_INT_EN();                                           /* Yes                                                  */
         return;
@@ -500,7 +567,7 @@ void  OSSched (void)
             CPU_CRITICAL_EXIT();
 #endif
 
-#if (OS_CFG_APP_HOOKS_EN > 0u)
+#if ((OS_CFG_APP_HOOKS_EN > 0u) || (OS_CFG_DYN_TICK_EN > 0u))
             OSIdleTaskHook();                                   /* Call user definable HOOK                             */
 #endif
             if ((*((volatile OS_PRIO *)&OSPrioHighRdy) != (OS_CFG_PRIO_MAX - 1u))) {
@@ -761,7 +828,12 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
         return;
     }
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    OS_RdyListRemove(OSTCBCurPtr);                              /* Move current OS_TCB to the end of the list (it may   */
+    OS_RdyListInsertTail(OSTCBCurPtr);                          /* ... not be the head, see OS_SMP_Sched())             */
+#else
     OS_RdyListMoveHeadToTail(p_rdy_list);                       /* Move current OS_TCB to the end of the list           */
+#endif
     p_tcb = p_rdy_list->HeadPtr;                                /* Point to new OS_TCB at head of the list              */
     if (p_tcb->TimeQuanta == 0u) {                              /* See if we need to use the default time slice         */
         p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
@@ -806,6 +878,10 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
 void  OSStart (OS_ERR  *p_err)
 {
     OS_OBJ_QTY  kernel_task_cnt;
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    OS_TCB     *p_tcb;
+    CPU_INT08U  core;
+#endif
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -828,7 +904,7 @@ void  OSStart (OS_ERR  *p_err)
     kernel_task_cnt++;
 #endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
-    kernel_task_cnt++;
+    kernel_task_cnt += OS_CFG_SMP_CORE_NBR;                     /* One idle task per core                               */
 #endif
 
     if (OSTaskQty <= kernel_task_cnt) {                         /* No application task created                          */
@@ -837,10 +913,21 @@ void  OSStart (OS_ERR  *p_err)
     }
 
     if (OSRunning == OS_STATE_OS_STOPPED) {
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+        for (core = 0u; core < OS_CFG_SMP_CORE_NBR; core++) {   /* Find the first task of every core                    */
+            p_tcb                    = OS_SMP_HighRdyGet(core);
+            p_tcb->CoreCur           = core;
+            OSPrioHighRdyTbl[core]   = p_tcb->Prio;
+            OSPrioCurTbl[core]       = p_tcb->Prio;
+            OSTCBHighRdyPtrTbl[core] = p_tcb;
+            OSTCBCurPtrTbl[core]     = p_tcb;
+        }
+#else
         OSPrioHighRdy   = OS_PrioGetHighest();                  /* Find the highest priority                            */
         OSPrioCur       = OSPrioHighRdy;
         OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;
         OSTCBCurPtr     = OSTCBHighRdyPtr;
+#endif
         OSRunning       = OS_STATE_OS_RUNNING;
         OSStartHighRdy();                                       /* Execute target specific code to start task           */
        *p_err           = OS_ERR_FATAL_RETURN;                  /* OSStart() is not supposed to return                  */
@@ -901,6 +988,10 @@ CPU_INT16U  OSVersion (OS_ERR  *p_err)
 *                 uC/OS-III would thus never recognize interrupts.
 *
 *              3) This hook has been added to allow you to do such things as STOP the CPU to conserve power.
+*
+*              4) With the dynamic tick, the hook is always called so that the port can sleep until the next deadline.
+*
+*              5) With OS_CFG_SMP_CORE_NBR > 1, every core runs its own idle task, see OS_IdleTaskInit().
 ************************************************************************************************************************
 */
 #if (OS_CFG_TASK_IDLE_EN > 0u)
@@ -925,8 +1016,8 @@ void  OS_IdleTask (void  *p_arg)
         CPU_CRITICAL_EXIT();
 #endif
 
-#if (OS_CFG_APP_HOOKS_EN > 0u)
-        OSIdleTaskHook();                                       /* Call user definable HOOK                             */
+#if ((OS_CFG_APP_HOOKS_EN > 0u) || (OS_CFG_DYN_TICK_EN > 0u))
+        OSIdleTaskHook();                                       /* Call user definable HOOK (see Note #4)               */
 #endif
     }
 }
@@ -943,14 +1034,52 @@ void  OS_IdleTask (void  *p_arg)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_SMP_CORE_NBR > 1, one idle task is created per core, pinned to it.  Core 0 runs
+*                 OSIdleTaskTCB, the others OSIdleTaskCoreTCB[], each on its own row of OSCfg_IdleTaskStk[].
 ************************************************************************************************************************
 */
 #if (OS_CFG_TASK_IDLE_EN > 0u)
 void  OS_IdleTaskInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    OS_TCB      *p_tcb;
+    CPU_INT08U   core;
+#endif
+
+
 #if (OS_CFG_DBG_EN > 0u)
     OSIdleTaskCtr = 0u;
 #endif
+#if (OS_CFG_SMP_CORE_NBR > 1u)                                  /* ------------ CREATE THE IDLE TASKS (SMP) ----------- */
+    for (core = 0u; core < OS_CFG_SMP_CORE_NBR; core++) {       /* See Note #2                                          */
+        if (core == 0u) {
+            p_tcb = &OSIdleTaskTCB;
+        } else {
+            p_tcb = &OSIdleTaskCoreTCB[core - 1u];
+        }
+        OSTaskCreate(p_tcb,
+#if  (OS_CFG_DBG_EN == 0u)
+                     (CPU_CHAR   *)0,
+#else
+                     (CPU_CHAR   *)"uC/OS-III Idle Task",
+#endif
+                      OS_IdleTask,
+                     (void       *)0,
+                     (OS_PRIO     )(OS_CFG_PRIO_MAX - 1u),
+                     &OSCfg_IdleTaskStk[core][0],
+                      OSCfg_IdleTaskStkLimit,
+                      OSCfg_IdleTaskStkSize,
+                      0u,
+                      0u,
+                     (void       *)0,
+                     (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS) | OS_OPT_TASK_CORE(core)),
+                      p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#else
                                                                 /* --------------- CREATE THE IDLE TASK --------------- */
     OSTaskCreate(&OSIdleTaskTCB,
 #if  (OS_CFG_DBG_EN == 0u)
@@ -969,6 +1098,7 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
                  (void       *)0,
                  (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
                   p_err);
+#endif
 }
 #endif
 
@@ -992,6 +1122,7 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 *                                 OS_TASK_PEND_ON_COND
 *                                 OS_TASK_PEND_ON_Q
 *                                 OS_TASK_PEND_ON_SEM
+*                                 OS_TASK_PEND_ON_STREAM
 *                                 OS_TASK_PEND_ON_TASK_SEM   <- No object (pending on a signal sent to the task)
 *
 *              timeout        Is the amount of time the task will wait for the event to occur.
@@ -1202,6 +1333,9 @@ void  OS_PendDbgNameRemove (OS_PEND_OBJ  *p_obj,
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
 *
 *              2) It's assumed that the TCB contains the NEW priority in its .Prio field.
+*
+*              3) With OS_CFG_PEND_LIST_PRIO_TBL_EN, a lone waiter is also moved so that the priority table of the
+*                 pend list follows its new priority.
 ************************************************************************************************************************
 */
 
@@ -1213,12 +1347,16 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
     p_obj       =  p_tcb->PendObjPtr;                           /* Get pointer to pend list                             */
     p_pend_list = &p_obj->PendList;
 
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == 0u)
     if (p_pend_list->HeadPtr->PendNextPtr != (OS_TCB *)0) {     /* Only move if multiple entries in the list            */
+#endif
             OS_PendListRemove(p_tcb);                           /* Remove entry from current position                   */
             p_tcb->PendObjPtr = p_obj;
             OS_PendListInsertPrio(p_pend_list,                  /* INSERT it back in the list                           */
                                   p_tcb);
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == 0u)
     }
+#endif
 }
 
 
@@ -1239,11 +1377,24 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
 
 void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 {
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+    CPU_INT32U  i;
+
+
+#endif
     p_pend_list->HeadPtr    = (OS_TCB *)0;
     p_pend_list->TailPtr    = (OS_TCB *)0;
 #if (OS_CFG_DBG_EN > 0u)
     p_pend_list->NbrEntries =           0u;
 #endif
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
+        p_pend_list->PrioTbl[i]     =           0u;
+    }
+    for (i = 0u; i < OS_CFG_PRIO_MAX; i++) {
+        p_pend_list->PrioHeadPtr[i] = (OS_TCB *)0;
+    }
+#endif
 }
 
 
@@ -1307,6 +1458,11 @@ void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_PEND_LIST_PRIO_TBL_EN, the list is not walked.  The pend list keeps a bitmap of the
+*                 priorities that have waiters and the first waiter at each of them.  The TCB is linked in front of
+*                 the first waiter of the next lower priority, found with CPU_CntLeadZeros() like
+*                 OS_PrioGetHighest() does, or at the tail when there is none.  Tasks of equal priority stay FIFO.
 ************************************************************************************************************************
 */
 
@@ -1315,10 +1471,44 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
 {
     OS_PRIO   prio;
     OS_TCB   *p_tcb_next;
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+    OS_TCB   *p_tcb_prev;
+    CPU_DATA  bit_nbr;
+    OS_PRIO   ix;
+#endif
 
 
     prio  = p_tcb->Prio;                                        /* Obtain the priority of the task to insert            */
 
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+    p_pend_list->NbrEntries++;                                  /* One more OS_TCB in the list                          */
+#endif
+    p_tcb->PendPrio = prio;
+    p_tcb_next      = OS_PendListPrioNextGet(p_pend_list,       /* Insert BEFORE the first waiter of lower priority     */
+                                             prio);
+    if (p_pend_list->PrioHeadPtr[prio] == (OS_TCB *)0) {        /* First waiter at this priority?                       */
+        ix                             = (OS_PRIO)(prio / (CPU_CFG_DATA_SIZE * 8u));
+        bit_nbr                        = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+        p_pend_list->PrioTbl[ix]      |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr);
+        p_pend_list->PrioHeadPtr[prio] = p_tcb;
+    }
+
+    if (p_tcb_next == (OS_TCB *)0) {                            /* No waiter of lower priority, insert at the tail      */
+        p_tcb_prev              = p_pend_list->TailPtr;
+        p_pend_list->TailPtr    = p_tcb;
+    } else {
+        p_tcb_prev              = p_tcb_next->PendPrevPtr;
+        p_tcb_next->PendPrevPtr = p_tcb;
+    }
+    p_tcb->PendNextPtr = p_tcb_next;
+    p_tcb->PendPrevPtr = p_tcb_prev;
+    if (p_tcb_prev == (OS_TCB *)0) {                            /* Is new TCB the new head of the list?                 */
+        p_pend_list->HeadPtr    = p_tcb;
+    } else {
+        p_tcb_prev->PendNextPtr = p_tcb;
+    }
+#else
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN > 0u)
         p_pend_list->NbrEntries = 1u;                           /* This is the first entry                              */
@@ -1358,7 +1548,54 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
             }
         }
     }
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                 FIND THE FIRST WAITER OF LOWER PRIORITY IN A PEND LIST
+*
+* Description: This function returns the first task of the pend list whose priority is lower than (numerically
+*              greater than) 'prio'.
+*
+* Arguments  : p_pend_list    is a pointer to the OS_PEND_LIST to search
+*              -----------
+*
+*              prio           is the priority of reference
+*
+* Returns    : A pointer to the OS_TCB of that task, or a NULL pointer if there is none.
+*
+* Note(s)    : 1) The search visits at most OS_PRIO_TBL_SIZE entries of the priority bitmap, whatever the number of
+*                 waiters.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+static  OS_TCB  *OS_PendListPrioNextGet (OS_PEND_LIST  *p_pend_list,
+                                         OS_PRIO        prio)
+{
+    CPU_DATA  bits;
+    CPU_DATA  bit_nbr;
+    OS_PRIO   ix;
+
+
+    ix      = (OS_PRIO)(prio / (CPU_CFG_DATA_SIZE * 8u));
+    bit_nbr = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+    bits    =  p_pend_list->PrioTbl[ix]                         /* Keep the priorities after 'prio' in its entry        */
+            & (((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr)) - 1u);
+    while (bits == 0u) {                                        /* Search the following entries of the bitmap           */
+        ix++;
+        if (ix >= OS_PRIO_TBL_SIZE) {
+            return ((OS_TCB *)0);                               /* No waiter of lower priority                          */
+        }
+        bits = p_pend_list->PrioTbl[ix];
+    }
+    prio = (OS_PRIO)((ix * (CPU_CFG_DATA_SIZE * 8u)) + CPU_CntLeadZeros(bits));
+
+    return (p_pend_list->PrioHeadPtr[prio]);
 }
+#endif
 
 
 /*
@@ -1414,11 +1651,31 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_next;
     OS_TCB        *p_prev;
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+    OS_PRIO        prio;
+    CPU_DATA       bit_nbr;
+    OS_PRIO        ix;
+#endif
 
 
     if (p_tcb->PendObjPtr != (OS_PEND_OBJ *)0) {                /* Only remove if object has a pend list.               */
         p_pend_list = &p_tcb->PendObjPtr->PendList;             /* Get pointer to pend list                             */
 
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+        prio = p_tcb->PendPrio;                                 /* Priority the TCB was queued at                       */
+        if (p_pend_list->PrioHeadPtr[prio] == p_tcb) {          /* Is it the first waiter at that priority?             */
+            p_next = p_tcb->PendNextPtr;
+            if ((p_next != (OS_TCB *)0) && (p_next->PendPrio == prio)) {
+                p_pend_list->PrioHeadPtr[prio] =  p_next;       /* Yes, the next waiter takes its place                 */
+            } else {
+                p_pend_list->PrioHeadPtr[prio] = (OS_TCB *)0;   /* Yes, and no other waiter at that priority            */
+                ix                             = (OS_PRIO)(prio / (CPU_CFG_DATA_SIZE * 8u));
+                bit_nbr                        = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+                p_pend_list->PrioTbl[ix]      &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr));
+            }
+        }
+#endif
+
                                                                 /* Remove TCB from the pend list.                       */
         if (p_pend_list->HeadPtr->PendNextPtr == (OS_TCB *)0) {
             p_pend_list->HeadPtr = (OS_TCB *)0;                 /* Only one entry in the pend list                      */
@@ -2056,13 +2313,20 @@ void  OS_SchedLockTimeMeasStop (void)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_SMP_CORE_NBR > 1, 'p_rdy_list' is not used: the task of every core is time sliced.  The
+*                 task that used up its quanta is moved to the end of its list and its core is asked to reschedule.
+*                 Its time slice counter is reloaded for the next time it runs.
 ************************************************************************************************************************
 */
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
 void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 {
-    OS_TCB  *p_tcb;
+    OS_TCB      *p_tcb;
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    CPU_INT08U   core;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -2070,6 +2334,38 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
         return;
     }
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)                                  /* See Note #2                                          */
+    (void)p_rdy_list;
+    CPU_CRITICAL_ENTER();
+    for (core = 0u; core < OS_CFG_SMP_CORE_NBR; core++) {
+        p_tcb = OSTCBCurPtrTbl[core];
+        if ((p_tcb->TaskState          != OS_TASK_STATE_RDY) ||  /* Skip blocked, idle and sched. locked tasks          */
+            (p_tcb->Prio               == (OS_CFG_PRIO_MAX - 1u)) ||
+            (OSSchedLockNestingCtrTbl[core] > 0u)) {
+            continue;
+        }
+        if (p_tcb->TimeQuantaCtr > 0u) {
+            p_tcb->TimeQuantaCtr--;
+        }
+        if (p_tcb->TimeQuantaCtr > 0u) {                        /* Task not done with its time quanta                   */
+            continue;
+        }
+        if (OSRdyList[p_tcb->Prio].HeadPtr == OSRdyList[p_tcb->Prio].TailPtr) {
+            continue;                                           /* ... only if multiple tasks at same priority          */
+        }
+        OS_RdyListRemove(p_tcb);                                /* Move the core's OS_TCB to the end of the list        */
+        OS_RdyListInsertTail(p_tcb);
+        if (p_tcb->TimeQuanta == 0u) {                          /* Reload its time slice for its next turn              */
+            p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
+        } else {
+            p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;
+        }
+        if (core != OS_CPU_CORE_ID_GET()) {                     /* This core reschedules in OSIntExit()                 */
+            OS_CPU_CoreSchedReq(core);
+        }
+    }
+    CPU_CRITICAL_EXIT();
+#else
     CPU_CRITICAL_ENTER();
     p_tcb = p_rdy_list->HeadPtr;                                /* Decrement time quanta counter                        */
 
@@ -2112,6 +2408,141 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
         p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;               /* Load time slice counter with new time                */
     }
     CPU_CRITICAL_EXIT();
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                       PICK THE NEXT TASK OF THE CALLING CORE (SMP)
+*
+* Description: This function is called by the scheduler, with interrupts disabled, when OS_CFG_SMP_CORE_NBR > 1.  It
+*              picks the task the calling core runs next, then asks the other cores to reschedule when they should run
+*              another task.
+*
+* Arguments  : none
+*
+* Returns    : A pointer to the OS_TCB of the task to run on the calling core.
+*
+* Note(s)    : 1) With OS_CFG_SMP_CORE_NBR > 1, OSTCBCurPtr, OSTCBHighRdyPtr, OSPrioCur, OSPrioHighRdy, OSIntNestingCtr
+*                 and OSSchedLockNestingCtr are per core: they index a table with OS_CPU_CORE_ID_GET().  The ready
+*                 list, the priority table and the kernel objects are shared.  The port makes CPU_CRITICAL_ENTER() take
+*                 a lock shared by all the cores.
+*
+*              2) A task runs on one core at most.  Its .CoreCur is the core that runs it, or OS_CORE_NONE.  Its
+*                 .CoreMask holds the cores it may run on, see OS_OPT_TASK_CORE().  Each core has its own idle task.
+*
+*              3) Another core is asked to reschedule, with OS_CPU_CoreSchedReq(), when:
+*
+*                 a) Its task is no longer ready, e.g. it was suspended by the calling core.
+*
+*                 b) A ready task that no core runs has a higher priority than the core's task.  Of the cores the task
+*                    may run on, the one with the lowest priority task is picked.  Each core is asked once per call.
+*
+*              4) OSSchedLock() only locks the scheduler of the calling core.  ISRs of different cores may run at the
+*                 same time, but never inside a critical section of another core.
+*
+*              5) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+OS_TCB  *OS_SMP_Sched (void)
+{
+    OS_TCB      *p_tcb;
+    OS_TCB      *p_tcb_cur;
+    OS_TCB      *p_tcb_wait;
+    OS_PRIO      prio;
+    OS_PRIO      prio_low;
+    CPU_INT08U   core;
+    CPU_INT08U   core_cur;
+    CPU_INT08U   core_low;
+    CPU_INT08U   core_req;                                      /* Cores asked to reschedule, one bit per core          */
+
+
+    core_cur  = OS_CPU_CORE_ID_GET();
+    p_tcb_cur = OSTCBCurPtr;
+    p_tcb     = OS_SMP_HighRdyGet(core_cur);
+    if (p_tcb != p_tcb_cur) {                                   /* The current task may now run on other cores          */
+        p_tcb_cur->CoreCur = OS_CORE_NONE;
+        p_tcb->CoreCur     = core_cur;
+    }
+
+    core_req = (CPU_INT08U)(1u << core_cur);
+    for (core = 0u; core < OS_CFG_SMP_CORE_NBR; core++) {       /* See Note #3a                                         */
+        if ((core                          != core_cur) &&
+            (OSTCBCurPtrTbl[core]->TaskState != OS_TASK_STATE_RDY)) {
+            core_req |= (CPU_INT08U)(1u << core);
+            OS_CPU_CoreSchedReq(core);
+        }
+    }
+                                                                /* See Note #3b                                         */
+    for (prio = OS_PrioGetHighest(); prio < (OS_CFG_PRIO_MAX - 1u); prio++) {
+        p_tcb_wait = OSRdyList[prio].HeadPtr;
+        while (p_tcb_wait != (OS_TCB *)0) {
+            if (p_tcb_wait->CoreCur == OS_CORE_NONE) {
+                prio_low = prio;
+                core_low = OS_CORE_NONE;
+                for (core = 0u; core < OS_CFG_SMP_CORE_NBR; core++) {
+                    if (((core_req             & (1u << core)) == 0u) &&
+                        ((p_tcb_wait->CoreMask & (1u << core)) != 0u) &&
+                        (OSTCBCurPtrTbl[core]->Prio > prio_low)) {
+                        prio_low = OSTCBCurPtrTbl[core]->Prio;
+                        core_low = core;
+                    }
+                }
+                if (core_low != OS_CORE_NONE) {
+                    core_req |= (CPU_INT08U)(1u << core_low);
+                    OS_CPU_CoreSchedReq(core_low);
+                }
+            }
+            if (core_req == (CPU_INT08U)((1u << OS_CFG_SMP_CORE_NBR) - 1u)) {
+                return (p_tcb);                                 /* Every core reschedules                               */
+            }
+            p_tcb_wait = p_tcb_wait->NextPtr;
+        }
+    }
+
+    return (p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                      GET THE HIGHEST PRIORITY TASK OF A CORE (SMP)
+*
+* Description: This function finds the highest priority ready task that a core may run: one that no other core runs and
+*              that the core is in the .CoreMask of.
+*
+* Arguments  : core      is the core to find a task for.
+*
+* Returns    : A pointer to the OS_TCB of the task, the core's idle task if no other is ready.
+*
+* Note(s)    : 1) Tasks of the same priority are taken in the order of the ready list, as with a single core.
+*
+*              2) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_TCB  *OS_SMP_HighRdyGet (CPU_INT08U  core)
+{
+    OS_TCB   *p_tcb;
+    OS_PRIO   prio;
+
+
+    for (prio = OS_PrioGetHighest(); prio < OS_CFG_PRIO_MAX; prio++) {
+        p_tcb = OSRdyList[prio].HeadPtr;
+        while (p_tcb != (OS_TCB *)0) {
+            if (((p_tcb->CoreCur == OS_CORE_NONE) || (p_tcb->CoreCur == core)) &&
+                ((p_tcb->CoreMask & (1u << core)) != 0u)) {
+                return (p_tcb);
+            }
+            p_tcb = p_tcb->NextPtr;
+        }
+    }
+
+    return ((OS_TCB *)0);                                       /* Not reached: every core has an idle task             */
 }
 #endif
 
@@ -55,6 +55,13 @@ CPU_INT32U  const  OSDbg_EndiannessTest        = 0x12345678LU;                 /
 
 CPU_INT08U  const  OSDbg_CalledFromISRChkEn    = OS_CFG_CALLED_FROM_ISR_CHK_EN;
 
+CPU_INT08U  const  OSDbg_ISRPostEn             = OS_CFG_ISR_POST_EN;
+#if (OS_CFG_ISR_POST_EN > 0u)
+CPU_INT16U  const  OSDbg_IntQSize              = sizeof(OS_INT_Q);             /* Size in Bytes of OS_INT_Q           */
+#else
+CPU_INT16U  const  OSDbg_IntQSize              = 0u;
+#endif
+
 CPU_INT08U  const  OSDbg_FlagEn                = OS_CFG_FLAG_EN;
 OS_FLAG_GRP const  OSDbg_FlagGrp               = { 0u };
 #if (OS_CFG_FLAG_EN > 0u)
@@ -75,8 +82,25 @@ OS_MEM      const  OSDbg_Mem                   = { 0u };
 CPU_INT08U  const  OSDbg_MemEn                 = OS_CFG_MEM_EN;
 #if OS_CFG_MEM_EN > 0u
 CPU_INT16U  const  OSDbg_MemSize               = sizeof(OS_MEM);               /* Mem. Partition header size (bytes)  */
+CPU_INT08U  const  OSDbg_MemClassNbr           = OS_CFG_MEM_CLASS_NBR;
+CPU_INT08U  const  OSDbg_MemClassSizeMinLog2   = OS_CFG_MEM_CLASS_SIZE_MIN_LOG2;
+CPU_INT16U  const  OSDbg_MemMagSize            = OS_CFG_MEM_MAG_SIZE;
+CPU_INT08U  const  OSDbg_MemLockFreeEn         = OS_CFG_MEM_LOCK_FREE_EN;
 #else
 CPU_INT16U  const  OSDbg_MemSize               = 0u;
+CPU_INT08U  const  OSDbg_MemClassNbr           = 0u;
+CPU_INT08U  const  OSDbg_MemClassSizeMinLog2   = 0u;
+CPU_INT16U  const  OSDbg_MemMagSize            = 0u;
+CPU_INT08U  const  OSDbg_MemLockFreeEn         = 0u;
+#endif
+
+CPU_INT08U  const  OSDbg_BufEn                 = OS_CFG_BUF_EN;
+#if (OS_CFG_BUF_EN > 0u)
+CPU_INT16U  const  OSDbg_BufSize               = sizeof(OS_BUF);               /* Buffer header size (bytes)          */
+CPU_INT16U  const  OSDbg_BufPoolSize           = sizeof(OS_BUF_POOL);          /* Buffer pool size (bytes)            */
+#else
+CPU_INT16U  const  OSDbg_BufSize               = 0u;
+CPU_INT16U  const  OSDbg_BufPoolSize           = 0u;
 #endif
 
 
@@ -85,11 +109,13 @@ CPU_INT08U  const  OSDbg_MsgEn                 = 1u;
 CPU_INT16U  const  OSDbg_MsgSize               = sizeof(OS_MSG);               /* OS_MSG size                         */
 CPU_INT16U  const  OSDbg_MsgPoolSize           = sizeof(OS_MSG_POOL);
 CPU_INT16U  const  OSDbg_MsgQSize              = sizeof(OS_MSG_Q);
+CPU_INT08U  const  OSDbg_MsgPoolPrivEn         = OS_CFG_MSG_POOL_PRIV_EN;
 #else
 CPU_INT08U  const  OSDbg_MsgEn                 = 0u;
 CPU_INT16U  const  OSDbg_MsgSize               = 0u;
 CPU_INT16U  const  OSDbg_MsgPoolSize           = 0u;
 CPU_INT16U  const  OSDbg_MsgQSize              = 0u;
+CPU_INT08U  const  OSDbg_MsgPoolPrivEn         = 0u;
 #endif
 
 
@@ -98,17 +124,29 @@ CPU_INT08U  const  OSDbg_MutexEn               = OS_CFG_MUTEX_EN;
 #if (OS_CFG_MUTEX_EN > 0u)
 CPU_INT08U  const  OSDbg_MutexDelEn            = OS_CFG_MUTEX_DEL_EN;
 CPU_INT08U  const  OSDbg_MutexPendAbortEn      = OS_CFG_MUTEX_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_MutexFastEn           = OS_CFG_MUTEX_FAST_EN;
 CPU_INT16U  const  OSDbg_MutexSize             = sizeof(OS_MUTEX);             /* Size in bytes of OS_MUTEX           */
 #else
 CPU_INT08U  const  OSDbg_MutexDelEn            = 0u;
 CPU_INT08U  const  OSDbg_MutexPendAbortEn      = 0u;
+CPU_INT08U  const  OSDbg_MutexFastEn           = 0u;
 CPU_INT16U  const  OSDbg_MutexSize             = 0u;
 #endif
 
+CPU_INT08U  const  OSDbg_CondEn                = OS_CFG_COND_EN;
+#if (OS_CFG_COND_EN > 0u)
+CPU_INT08U  const  OSDbg_CondDelEn             = OS_CFG_COND_DEL_EN;
+CPU_INT16U  const  OSDbg_CondSize              = sizeof(OS_COND);              /* Size in bytes of OS_COND            */
+#else
+CPU_INT08U  const  OSDbg_CondDelEn             = 0u;
+CPU_INT16U  const  OSDbg_CondSize              = 0u;
+#endif
+
 CPU_INT08U  const  OSDbg_ObjTypeChkEn          = OS_CFG_OBJ_TYPE_CHK_EN;
 CPU_INT08U  const  OSDbg_ObjCreatedChkEn       = OS_CFG_OBJ_CREATED_CHK_EN;
 
 
+CPU_INT08U  const  OSDbg_PendListPrioTblEn     = OS_CFG_PEND_LIST_PRIO_TBL_EN;
 CPU_INT16U  const  OSDbg_PendListSize          = sizeof(OS_PEND_LIST);
 CPU_INT16U  const  OSDbg_PendObjSize           = sizeof(OS_PEND_OBJ);
 
@@ -125,11 +163,13 @@ CPU_INT08U  const  OSDbg_QEn                   = OS_CFG_Q_EN;
 CPU_INT08U  const  OSDbg_QDelEn                = OS_CFG_Q_DEL_EN;
 CPU_INT08U  const  OSDbg_QFlushEn              = OS_CFG_Q_FLUSH_EN;
 CPU_INT08U  const  OSDbg_QPendAbortEn          = OS_CFG_Q_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_QMultiEn              = OS_CFG_Q_MULTI_EN;
 CPU_INT16U  const  OSDbg_QSize                 = sizeof(OS_Q);                 /* Size in bytes of OS_Q structure     */
 #else
 CPU_INT08U  const  OSDbg_QDelEn                = 0u;
 CPU_INT08U  const  OSDbg_QFlushEn              = 0u;
 CPU_INT08U  const  OSDbg_QPendAbortEn          = 0u;
+CPU_INT08U  const  OSDbg_QMultiEn              = 0u;
 CPU_INT16U  const  OSDbg_QSize                 = 0u;
 #endif
 
@@ -152,6 +192,16 @@ CPU_INT16U  const  OSDbg_SemSize               = 0u;
 #endif
 
 
+CPU_INT08U  const  OSDbg_StreamEn              = OS_CFG_STREAM_EN;
+#if (OS_CFG_STREAM_EN > 0u)
+CPU_INT08U  const  OSDbg_StreamDelEn           = OS_CFG_STREAM_DEL_EN;
+CPU_INT16U  const  OSDbg_StreamSize            = sizeof(OS_STREAM);            /* Size in bytes of OS_STREAM          */
+#else
+CPU_INT08U  const  OSDbg_StreamDelEn           = 0u;
+CPU_INT16U  const  OSDbg_StreamSize            = 0u;
+#endif
+
+
 CPU_INT16U  const  OSDbg_RdyList               = sizeof(OS_RDY_LIST);
 CPU_INT32U  const  OSDbg_RdyListSize           = sizeof(OSRdyList);            /* Number of bytes in the ready table  */
 
@@ -164,6 +214,7 @@ CPU_INT08U  const  OSDbg_TaskChangePrioEn      = OS_CFG_TASK_CHANGE_PRIO_EN;
 CPU_INT08U  const  OSDbg_TaskDelEn             = OS_CFG_TASK_DEL_EN;
 CPU_INT08U  const  OSDbg_TaskQEn               = OS_CFG_TASK_Q_EN;
 CPU_INT08U  const  OSDbg_TaskQPendAbortEn      = OS_CFG_TASK_Q_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_TaskQMultiEn          = OS_CFG_TASK_Q_MULTI_EN;
 CPU_INT08U  const  OSDbg_TaskProfileEn         = OS_CFG_TASK_PROFILE_EN;
 CPU_INT16U  const  OSDbg_TaskRegTblSize        = OS_CFG_TASK_REG_TBL_SIZE;
 CPU_INT08U  const  OSDbg_TaskSemPendAbortEn    = OS_CFG_TASK_SEM_PEND_ABORT_EN;
@@ -173,6 +224,11 @@ CPU_INT08U  const  OSDbg_TaskSuspendEn         = OS_CFG_TASK_SUSPEND_EN;
 CPU_INT16U  const  OSDbg_TCBSize               = sizeof(OS_TCB);               /* Size in Bytes of OS_TCB             */
 
 CPU_INT16U  const  OSDbg_TickListSize          = sizeof(OS_TICK_LIST);
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+CPU_INT16U  const  OSDbg_TickSpokeSize         = sizeof(OS_TICK_SPOKE);        /* Size in Bytes of OS_TICK_SPOKE      */
+#else
+CPU_INT16U  const  OSDbg_TickSpokeSize         = 0u;
+#endif
 
 CPU_INT08U  const  OSDbg_TimeDlyHMSMEn         = OS_CFG_TIME_DLY_HMSM_EN;
 CPU_INT08U  const  OSDbg_TimeDlyResumeEn       = OS_CFG_TIME_DLY_RESUME_EN;
@@ -189,9 +245,15 @@ CPU_INT08U  const  OSDbg_TmrEn                 = OS_CFG_TMR_EN;
 #if (OS_CFG_TMR_EN > 0u)
 CPU_INT08U  const  OSDbg_TmrDelEn              = OS_CFG_TMR_DEL_EN;
 CPU_INT16U  const  OSDbg_TmrSize               = sizeof(OS_TMR);
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+CPU_INT16U  const  OSDbg_TmrSpokeSize          = sizeof(OS_TMR_SPOKE);         /* Size in Bytes of OS_TMR_SPOKE       */
+#else
+CPU_INT16U  const  OSDbg_TmrSpokeSize          = 0u;
+#endif
 #else
 CPU_INT08U  const  OSDbg_TmrDelEn              = 0u;
 CPU_INT16U  const  OSDbg_TmrSize               = 0u;
+CPU_INT16U  const  OSDbg_TmrSpokeSize          = 0u;
 #endif
 
 CPU_INT16U  const  OSDbg_VersionNbr            = OS_VERSION;
@@ -246,6 +308,24 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + OS_CFG_IDLE_TASK_STK_SIZE * sizeof(CPU_STK)
 #endif
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+                                  + OS_CFG_INT_Q_TASK_STK_SIZE * sizeof(CPU_STK)
+                                  + OS_CFG_INT_Q_SIZE          * sizeof(OS_INT_Q)
+                                  + sizeof(OSIntQInPtr)
+                                  + sizeof(OSIntQOutPtr)
+                                  + sizeof(OSIntQNbrEntries)
+                                  + sizeof(OSIntQNbrEntriesMax)
+                                  + sizeof(OSIntQOvfCtr)
+                                  + sizeof(OSIntQRePostFailCtr)
+                                  + sizeof(OSIntQTaskTCB)
+#if (OS_CFG_TS_EN > 0u)
+                                  + sizeof(OSIntQLatency)
+                                  + sizeof(OSIntQLatencyMax)
+                                  + sizeof(OSIntQTaskTime)
+                                  + sizeof(OSIntQTaskTimeMax)
+#endif
+#endif
+
 #if (OS_CFG_TASK_STAT_EN > 0u)
                                   + OS_CFG_STAT_TASK_STK_SIZE * sizeof(CPU_STK)
 #endif
@@ -273,10 +353,17 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSMemDbgListPtr)
                                   + sizeof(OSMemQty)
 #endif
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+                                  + sizeof(OSMemClassTbl)
+#endif
 #endif
 
 #if (OS_MSG_EN > 0u)
                                   + sizeof(OSMsgPool)
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSMsgPoolDbgListPtr)
+                                  + sizeof(OSMsgPoolQty)
+#endif
 #endif
 
 #if (OS_CFG_MUTEX_EN > 0u)
@@ -284,11 +371,24 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSMutexDbgListPtr)
                                   + sizeof(OSMutexQty)
 #endif
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+                                  + sizeof(OSMutexFastListPtr)
+#endif
+#endif
+
+#if (OS_CFG_COND_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSCondDbgListPtr)
+                                  + sizeof(OSCondQty)
+#endif
 #endif
 
                                   + sizeof(OSPrioCur)
                                   + sizeof(OSPrioHighRdy)
                                   + sizeof(OSPrioTbl)
+#if (OS_CFG_PRIO_MAX > (2u * (CPU_CFG_DATA_SIZE * 8u)))
+                                  + sizeof(OSPrioGrp)
+#endif
 
 #if (OS_CFG_Q_EN > 0u)
 #if (OS_CFG_DBG_EN > 0u)
@@ -318,6 +418,13 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #endif
                                   + sizeof(OSSemQty)
 #endif
+
+#if (OS_CFG_STREAM_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSStreamDbgListPtr)
+                                  + sizeof(OSStreamQty)
+#endif
+#endif
 #if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
                                   + sizeof(OSTaskCtxSwCtr)
 #if (OS_CFG_DBG_EN > 0u)
@@ -359,6 +466,12 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSTmrListEntries)
 #endif
                                   + sizeof(OSTmrListPtr)
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+                                  + sizeof(OSTmrWheelExpired)
+                                  + sizeof(OSTmrWheelCtr)
+                                  + sizeof(OSTmrWheelWake)
+                                  + sizeof(OSTmrWheelNearEntries)
+#endif
                                   + sizeof(OSTmrMutex)
                                   + sizeof(OSTmrCond)
 #if (OS_CFG_DBG_EN > 0u)
@@ -418,6 +531,9 @@ void  OS_Dbg_Init (void)
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_CalledFromISRChkEn;
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ISRPostEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_IntQSize;
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_FlagGrp;
     p_temp08 = (CPU_INT08U const *)&OSDbg_FlagEn;
 #if (OS_CFG_FLAG_EN > 0u)
@@ -433,6 +549,14 @@ void  OS_Dbg_Init (void)
 #if (OS_CFG_MEM_EN > 0u)
     p_temp16 = (CPU_INT16U const *)&OSDbg_MemSize;
 #endif
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemClassNbr;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemClassSizeMinLog2;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_MemMagSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemLockFreeEn;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_BufEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_BufSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_BufPoolSize;
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_MsgEn;
 #if (OS_MSG_EN > 0u)
@@ -440,18 +564,25 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_MsgPoolSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_MsgQSize;
 #endif
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MsgPoolPrivEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_Mutex;
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexEn;
 #if (OS_CFG_MUTEX_EN > 0u)
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MutexFastEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_MutexSize;
 #endif
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_CondEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_CondDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_CondSize;
+
     p_temp08 = (CPU_INT08U const *)&OSDbg_ObjTypeChkEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_ObjCreatedChkEn;
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PendListPrioTblEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendListSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendObjSize;
 
@@ -466,6 +597,7 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_QDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_QFlushEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_QPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QMultiEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_QSize;
 #endif
 
@@ -480,6 +612,10 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_SemSize;
 #endif
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_StreamEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_StreamDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_StreamSize;
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_RdyList;
     p_temp32 = (CPU_INT32U const *)&OSDbg_RdyListSize;
 
@@ -492,6 +628,7 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQMultiEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskProfileEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_TaskRegTblSize;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskSemPendAbortEn;
@@ -500,6 +637,7 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_TCBSize;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_TickListSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TickSpokeSize;
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_TimeDlyHMSMEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TimeDlyResumeEn;
@@ -511,6 +649,7 @@ void  OS_Dbg_Init (void)
 #if (OS_CFG_TMR_EN > 0u)
     p_temp08 = (CPU_INT08U const *)&OSDbg_TmrDelEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_TmrSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TmrSpokeSize;
 #endif
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_VersionNbr;
@@ -932,10 +932,14 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (OS_ERR  *p_err)
 *                                OS_ERR_OBJ_TYPE            You are not pointing to an event flag group
 *                                OS_ERR_OPT_INVALID         You specified an invalid option
 *                                OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                                OS_ERR_INT_Q_FULL          If called from an ISR and the ISR queue is full
 *
-* Returns    : the new value of the event flags bits that are still set.
+* Returns    : the new value of the event flags bits that are still set, or 0 if called from an ISR.
 *
 * Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group.
+*
+*              2) When OS_CFG_ISR_POST_EN is enabled, a post made from an ISR is only recorded in the ISR queue; the ISR
+*                 handler task performs it later.
 ************************************************************************************************************************
 */
 
@@ -944,15 +948,8 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
                       OS_OPT        opt,
                       OS_ERR       *p_err)
 {
-
-    OS_FLAGS       flags_cur;
-    OS_FLAGS       flags_rdy;
-    OS_OPT         mode;
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
-    CPU_TS         ts;
-    CPU_SR_ALLOC();
+    OS_FLAGS  flags_cur;
+    CPU_TS    ts;
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -998,97 +995,38 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 
     OS_TRACE_FLAG_POST(p_grp);
 
-    switch (opt) {
-        case OS_OPT_POST_FLAG_SET:
-        case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
-             CPU_CRITICAL_ENTER();
-             p_grp->Flags |=  flags;                            /* Set   the flags specified in the group               */
-             break;
-
-        case OS_OPT_POST_FLAG_CLR:
-        case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
-             CPU_CRITICAL_ENTER();
-             p_grp->Flags &= ~flags;                            /* Clear the flags specified in the group               */
-             break;
-
-        default:
-            *p_err = OS_ERR_OPT_INVALID;                        /* INVALID option                                       */
-             OS_TRACE_FLAG_POST_EXIT(*p_err);
-             return (0u);
-    }
-#if (OS_CFG_TS_EN > 0u)
-    p_grp->TS   = ts;
-#endif
-    p_pend_list = &p_grp->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on event flag group?                */
-        CPU_CRITICAL_EXIT();                                    /* No                                                   */
-       *p_err = OS_ERR_NONE;
-        OS_TRACE_FLAG_POST_EXIT(*p_err);
-        return (p_grp->Flags);
-    }
-
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting on event flag(s)        */
-        p_tcb_next = p_tcb->PendNextPtr;
-        mode       = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
-        switch (mode) {
-            case OS_OPT_PEND_FLAG_SET_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR ...                        */
+        switch (opt) {                                          /* Validate 'opt' now, the post is replayed later       */
+            case OS_OPT_POST_FLAG_SET:
+            case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
+            case OS_OPT_POST_FLAG_CLR:
+            case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
                  break;
 
-            case OS_OPT_PEND_FLAG_SET_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
-            case OS_OPT_PEND_FLAG_CLR_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-            case OS_OPT_PEND_FLAG_CLR_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-#endif
             default:
-                 CPU_CRITICAL_EXIT();
-                *p_err = OS_ERR_FLAG_PEND_OPT;
+                *p_err = OS_ERR_OPT_INVALID;
                  OS_TRACE_FLAG_POST_EXIT(*p_err);
                  return (0u);
         }
-                                                                /* Point to next task waiting for event flag(s)         */
-        p_tcb = p_tcb_next;
-    }
-    CPU_CRITICAL_EXIT();
-
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();
+        OS_IntQPost(OS_OBJ_TYPE_FLAG,                           /* ... defer the post to the ISR handler task           */
+                    p_grp,
+                    (void *)0,
+                    0u,
+                    flags,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (0u);
     }
+#endif
 
-    CPU_CRITICAL_ENTER();
-    flags_cur = p_grp->Flags;
-    CPU_CRITICAL_EXIT();
-   *p_err     = OS_ERR_NONE;
-
+    flags_cur = OS_FlagPost(p_grp,
+                            flags,
+                            opt,
+                            ts,
+                            p_err);
     OS_TRACE_FLAG_POST_EXIT(*p_err);
     return (flags_cur);
 }
@@ -1236,6 +1174,139 @@ void  OS_FlagDbgListRemove (OS_FLAG_GRP  *p_grp)
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                                POST EVENT FLAG BIT(S)
+*
+* Description: This function sets or clears some bits in an event flag group.  It is called by OSFlagPost() and by the
+*              ISR handler task when it replays a post deferred by an ISR.
+*
+* Arguments  : p_grp         is a pointer to the desired event flag group.
+*              -----
+*
+*              flags         is the bit mask of the flags to set or clear (see OSFlagPost())
+*
+*              opt           indicates whether the flags will be set or cleared (see OSFlagPost())
+*
+*              ts            is the timestamp of the post
+*
+*              p_err         is a pointer to an error code and can be:
+*
+*                                OS_ERR_NONE                The call was successful
+*                                OS_ERR_OPT_INVALID         You specified an invalid option
+*
+* Returns    : the new value of the event flags bits that are still set.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
+                       OS_FLAGS      flags,
+                       OS_OPT        opt,
+                       CPU_TS        ts,
+                       OS_ERR       *p_err)
+{
+    OS_FLAGS       flags_cur;
+    OS_FLAGS       flags_rdy;
+    OS_OPT         mode;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_next;
+    CPU_SR_ALLOC();
+
+
+    switch (opt) {
+        case OS_OPT_POST_FLAG_SET:
+        case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
+             CPU_CRITICAL_ENTER();
+             p_grp->Flags |=  flags;                            /* Set   the flags specified in the group               */
+             break;
+
+        case OS_OPT_POST_FLAG_CLR:
+        case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
+             CPU_CRITICAL_ENTER();
+             p_grp->Flags &= ~flags;                            /* Clear the flags specified in the group               */
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;                        /* INVALID option                                       */
+             return (0u);
+    }
+#if (OS_CFG_TS_EN > 0u)
+    p_grp->TS   = ts;
+#endif
+    p_pend_list = &p_grp->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on event flag group?                */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_NONE;
+        return (p_grp->Flags);
+    }
+
+    p_tcb = p_pend_list->HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting on event flag(s)        */
+        p_tcb_next = p_tcb->PendNextPtr;
+        mode       = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
+        switch (mode) {
+            case OS_OPT_PEND_FLAG_SET_ALL:                      /* See if all req. flags are set for current node       */
+                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+                 if (flags_rdy == p_tcb->FlagsPend) {
+                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
+                                    flags_rdy,
+                                    ts);
+                 }
+                 break;
+
+            case OS_OPT_PEND_FLAG_SET_ANY:                      /* See if any flag set                                  */
+                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+                 if (flags_rdy != 0u) {
+                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
+                                    flags_rdy,
+                                    ts);
+                 }
+                 break;
+
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+            case OS_OPT_PEND_FLAG_CLR_ALL:                      /* See if all req. flags are set for current node       */
+                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+                 if (flags_rdy == p_tcb->FlagsPend) {
+                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
+                                    flags_rdy,
+                                    ts);
+                 }
+                 break;
+
+            case OS_OPT_PEND_FLAG_CLR_ANY:                      /* See if any flag set                                  */
+                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+                 if (flags_rdy != 0u) {
+                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
+                                    flags_rdy,
+                                    ts);
+                 }
+                 break;
+#endif
+            default:
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_FLAG_PEND_OPT;
+                 return (0u);
+        }
+                                                                /* Point to next task waiting for event flag(s)         */
+        p_tcb = p_tcb_next;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();
+    }
+
+    CPU_CRITICAL_ENTER();
+    flags_cur = p_grp->Flags;
+    CPU_CRITICAL_EXIT();
+   *p_err     = OS_ERR_NONE;
+    return (flags_cur);
+}
+
+
 /*
 ************************************************************************************************************************
 *                                        MAKE TASK READY-TO-RUN, EVENT(s) OCCURRED
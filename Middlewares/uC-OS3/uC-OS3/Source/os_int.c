@@ -0,0 +1,417 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        ISR QUEUE MANAGEMENT
+*
+* File    : os_int.c
+* Version : V3.08.01
+*********************************************************************************************************
+* Note(s) : (1) When OS_CFG_ISR_POST_EN is enabled, OSQPost(), OSSemPost(), OSFlagPost(), OSTaskQPost(),
+*               OSTaskSemPost() and the stream buffer writes called from an ISR do not touch pend lists or the ready
+*               list.  They record the post in the ISR queue, a ring of OS_INT_Q entries, and make the ISR handler
+*               task ready.  Interrupts are then only disabled for the copy of one entry, whatever the number of
+*               tasks waiting.
+*
+*           (2) The ISR handler task runs at priority 0, which is reserved for it.  It replays the entries in the
+*               order the ISRs posted them, with the scheduler call deferred until the queue is empty.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_int__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL FUNCTIONS
+************************************************************************************************************************
+*/
+
+static  void  OS_IntQRePost (OS_INT_Q  *p_entry);
+
+
+/*
+************************************************************************************************************************
+*                                                  POST FROM AN ISR
+*
+* Description: This function places the contents of a post made from an ISR in the ISR queue and makes the ISR handler
+*              task ready-to-run.
+*
+* Arguments  : type        is the type of object the post is for:
+*
+*                              OS_OBJ_TYPE_BUF           If the post is for a message queue, from OSQPostBuf()
+*                              OS_OBJ_TYPE_FLAG          If the post is for an event flag group
+*                              OS_OBJ_TYPE_Q             If the post is for a message queue
+*                              OS_OBJ_TYPE_SEM           If the post is for a semaphore
+*                              OS_OBJ_TYPE_STREAM        If the post wakes up the reader of a stream buffer
+*                              OS_OBJ_TYPE_TASK_MSG      If the post is for a task's message queue
+*                              OS_OBJ_TYPE_TASK_SIGNAL   If the post is for a task's semaphore
+*
+*              p_obj       is a pointer to the object (or OS_TCB) posted to
+*
+*              p_void      is a pointer to the message if posting to a message queue
+*
+*              msg_size    is the size of the message if posting to a message queue
+*
+*              flags       is the value of the flags if posting to an event flag group
+*
+*              opt         are the post options
+*
+*              ts          is the timestamp of the post
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE               If the post was queued
+*                              OS_ERR_INT_Q_FULL         If the ISR queue is full
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The entry is filled in a critical section rather than reserved with a compare and swap.  The ISR handler
+*                 task must be inserted in the ready list in the same critical section as the entry is counted, see
+*                 OS_IntQTask() Note #2, and the ready list is also changed by task level code.  A lock-free reservation
+*                 would therefore not remove the critical section, only add atomic operations to it.
+************************************************************************************************************************
+*/
+
+void  OS_IntQPost (OS_OBJ_TYPE   type,
+                   void         *p_obj,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_FLAGS      flags,
+                   OS_OPT        opt,
+                   CPU_TS        ts,
+                   OS_ERR       *p_err)
+{
+    OS_INT_Q  *p_entry;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OSIntQNbrEntries >= OSCfg_IntQSize) {                   /* Is the ISR queue full?                               */
+        OSIntQOvfCtr++;                                         /* Yes, the post is lost                                */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_INT_Q_FULL;
+        return;
+    }
+
+    p_entry          = OSIntQInPtr;                             /* Fill the next free entry                             */
+    p_entry->Type    = type;
+    p_entry->ObjPtr  = p_obj;
+    p_entry->MsgPtr  = p_void;
+    p_entry->MsgSize = msg_size;
+    p_entry->Flags   = flags;
+    p_entry->Opt     = opt;
+    p_entry->TS      = ts;
+
+    p_entry++;                                                  /* Advance the input pointer, wrapping around           */
+    if (p_entry == &OSCfg_IntQBasePtr[OSCfg_IntQSize]) {
+        p_entry = OSCfg_IntQBasePtr;
+    }
+    OSIntQInPtr = p_entry;
+
+    OSIntQNbrEntries++;
+    if (OSIntQNbrEntriesMax < OSIntQNbrEntries) {               /* Update the high-water mark                           */
+        OSIntQNbrEntriesMax = OSIntQNbrEntries;
+    }
+
+    if (OSRdyList[0].HeadPtr == (OS_TCB *)0) {                  /* Make the ISR handler task ready-to-run               */
+        OS_RdyListInsert(&OSIntQTaskTCB);
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  ISR HANDLER TASK
+*
+* Description: This task is readied by OS_IntQPost() and replays, in batches, the posts recorded in the ISR queue.
+*
+* Arguments  : p_arg     is an argument passed to the task when the task is created (unused).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The task removes itself from the ready list when the ISR queue is empty.  The emptiness check and the
+*                 removal share one critical section, and OS_IntQPost() fills an entry and re-inserts the task in one
+*                 critical section too, so no post can be missed.
+*
+*              3) Each entry is copied out of the queue before it is replayed, so ISRs can keep posting while the task
+*                 works through the batch.  The tasks made ready by the batch run once the queue is empty.
+*
+*              4) OSIntQLatency measures the time between the post in the ISR and its replay, OSIntQTaskTime the time
+*                 taken by a whole batch.  Both are in CPU_TS units.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTask (void  *p_arg)
+{
+    OS_INT_Q     entry;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS       ts_start;
+    CPU_TS       ts_end;
+#endif
+    CPU_BOOLEAN  done;
+    CPU_SR_ALLOC();
+
+
+
+    (void)p_arg;                                                /* Not using 'p_arg', prevent compiler warning          */
+
+    for (;;) {
+        CPU_CRITICAL_ENTER();
+        if (OSIntQNbrEntries == 0u) {                           /* Anything to replay?                                  */
+            OS_RdyListRemove(&OSIntQTaskTCB);                   /* No,  wait for the next post from an ISR              */
+            CPU_CRITICAL_EXIT();
+            OSSched();
+            continue;
+        }
+        CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_TS_EN > 0u)
+        ts_start = OS_TS_GET();
+#endif
+        done = OS_FALSE;
+        while (done == OS_FALSE) {
+            CPU_CRITICAL_ENTER();
+            if (OSIntQNbrEntries == 0u) {                       /* Batch complete?                                      */
+                done = OS_TRUE;
+                CPU_CRITICAL_EXIT();
+            } else {
+                entry = *OSIntQOutPtr;                          /* Copy the oldest entry and release it                 */
+                OSIntQOutPtr++;
+                if (OSIntQOutPtr == &OSCfg_IntQBasePtr[OSCfg_IntQSize]) {
+                    OSIntQOutPtr = OSCfg_IntQBasePtr;
+                }
+                OSIntQNbrEntries--;
+                CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_TS_EN > 0u)
+                OSIntQLatency = OS_TS_GET() - entry.TS;
+                if (OSIntQLatencyMax < OSIntQLatency) {
+                    OSIntQLatencyMax = OSIntQLatency;
+                }
+#endif
+                OS_IntQRePost(&entry);
+            }
+        }
+#if (OS_CFG_TS_EN > 0u)
+        ts_end = OS_TS_GET() - ts_start;                        /* Measure execution time of the batch                  */
+        OSIntQTaskTime = ts_end;
+        if (OSIntQTaskTimeMax < ts_end) {
+            OSIntQTaskTimeMax = ts_end;
+        }
+#endif
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                              INITIALIZE THE ISR QUEUE
+*
+* Description: This function is called by OSInit() to initialize the ISR queue and to create the ISR handler task.
+*
+* Arguments  : p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_INT_Q                   If the ISR queue storage is missing
+*                            OS_ERR_INT_Q_SIZE              If the ISR queue has no entries
+*                            OS_ERR_INT_Q_STK_INVALID       If the ISR handler task has no stack
+*                            OS_ERR_INT_Q_STK_SIZE_INVALID  If the ISR handler task stack is too small
+*
+*                        or one of the errors returned by OSTaskCreate().
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTaskInit (OS_ERR  *p_err)
+{
+    OSIntQInPtr         = OSCfg_IntQBasePtr;
+    OSIntQOutPtr        = OSCfg_IntQBasePtr;
+    OSIntQNbrEntries    = 0u;
+    OSIntQNbrEntriesMax = 0u;
+    OSIntQOvfCtr        = 0u;
+    OSIntQRePostFailCtr = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    OSIntQLatency       = 0u;
+    OSIntQLatencyMax    = 0u;
+    OSIntQTaskTime      = 0u;
+    OSIntQTaskTimeMax   = 0u;
+#endif
+
+    if (OSCfg_IntQBasePtr == (OS_INT_Q *)0) {
+       *p_err = OS_ERR_INT_Q;
+        return;
+    }
+
+    if (OSCfg_IntQSize == 0u) {
+       *p_err = OS_ERR_INT_Q_SIZE;
+        return;
+    }
+                                                                /* ----------- CREATE THE ISR HANDLER TASK ------------ */
+    if (OSCfg_IntQTaskStkBasePtr == (CPU_STK *)0) {
+       *p_err = OS_ERR_INT_Q_STK_INVALID;
+        return;
+    }
+
+    if (OSCfg_IntQTaskStkSize < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_INT_Q_STK_SIZE_INVALID;
+        return;
+    }
+
+    OSTaskCreate(&OSIntQTaskTCB,
+#if  (OS_CFG_DBG_EN == 0u)
+                 (CPU_CHAR *)0,
+#else
+                 (CPU_CHAR *)"uC/OS-III ISR Queue Task",
+#endif
+                  OS_IntQTask,
+                 (void     *)0,
+                  0u,                                           /* Priority 0 is reserved for this task                 */
+                  OSCfg_IntQTaskStkBasePtr,
+                  OSCfg_IntQTaskStkLimit,
+                  OSCfg_IntQTaskStkSize,
+                  0u,
+                  0u,
+                 (void     *)0,
+                 (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              REPLAY A POST FROM AN ISR
+*
+* Description: This function performs the post recorded in an ISR queue entry.
+*
+* Arguments  : p_entry   is a pointer to a copy of the entry
+*
+* Returns    : none
+*
+* Note(s)    : 1) The scheduler is not called; OS_IntQTask() calls it once the ISR queue is empty.
+*
+*              2) The ISR was given OS_ERR_NONE when the post was queued, so an error from the replay (e.g. OS_ERR_Q_MAX,
+*                 OS_ERR_MSG_POOL_EMPTY or a task deleted since the post) cannot be returned to it.  Such posts are
+*                 counted in OSIntQRePostFailCtr.  A buffer that cannot be posted is released, see OSQPostBuf().
+************************************************************************************************************************
+*/
+
+static  void  OS_IntQRePost (OS_INT_Q  *p_entry)
+{
+    OS_OPT  opt;
+    OS_ERR  err;
+
+
+    err = OS_ERR_NONE;
+    opt = (OS_OPT)(p_entry->Opt | OS_OPT_POST_NO_SCHED);
+    switch (p_entry->Type) {
+#if (OS_CFG_FLAG_EN > 0u)
+        case OS_OBJ_TYPE_FLAG:
+             (void)OS_FlagPost((OS_FLAG_GRP *)p_entry->ObjPtr,
+                               p_entry->Flags,
+                               opt,
+                               p_entry->TS,
+                              &err);
+             break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+        case OS_OBJ_TYPE_Q:
+             OS_QPost((OS_Q *)p_entry->ObjPtr,
+                      p_entry->MsgPtr,
+                      p_entry->MsgSize,
+                      opt,
+                      p_entry->TS,
+                     &err);
+             break;
+
+#if (OS_CFG_BUF_EN > 0u)
+        case OS_OBJ_TYPE_BUF:
+             OS_QPost((OS_Q *)p_entry->ObjPtr,
+                      p_entry->MsgPtr,
+                      p_entry->MsgSize,
+                      opt,
+                      p_entry->TS,
+                     &err);
+             if (err != OS_ERR_NONE) {
+                 OS_BufRelease((OS_BUF *)p_entry->MsgPtr);      /* See Note #2                                          */
+             }
+             break;
+#endif
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+        case OS_OBJ_TYPE_SEM:
+             (void)OS_SemPost((OS_SEM *)p_entry->ObjPtr,
+                              opt,
+                              p_entry->TS,
+                             &err);
+             break;
+#endif
+
+#if (OS_CFG_STREAM_EN > 0u)
+        case OS_OBJ_TYPE_STREAM:
+             OS_StreamPost((OS_STREAM *)p_entry->ObjPtr,
+                           opt,
+                           p_entry->TS,
+                          &err);
+             break;
+#endif
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+        case OS_OBJ_TYPE_TASK_MSG:
+             OS_TaskQPost((OS_TCB *)p_entry->ObjPtr,
+                          p_entry->MsgPtr,
+                          p_entry->MsgSize,
+                          opt,
+                          p_entry->TS,
+                         &err);
+             break;
+#endif
+
+        case OS_OBJ_TYPE_TASK_SIGNAL:
+             (void)OS_TaskSemPost((OS_TCB *)p_entry->ObjPtr,
+                                  opt,
+                                  p_entry->TS,
+                                 &err);
+             break;
+
+        default:
+             err = OS_ERR_OBJ_TYPE;
+             break;
+    }
+
+    if (err != OS_ERR_NONE) {                                   /* See Note #2                                          */
+        OSIntQRePostFailCtr++;
+    }
+}
+#endif
@@ -32,6 +32,47 @@ const  CPU_CHAR  *os_mem__c = "$Id: $";
 
 
 #if (OS_CFG_MEM_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_MEM_CLASS_NBR > 0u) && (OS_CFG_MEM_MAG_SIZE > 0u))
+#define  OS_MEM_MAG_XFER_NBR      ((OS_CFG_MEM_MAG_SIZE + 1u) / 2u) /* Blocks moved per magazine refill/flush         */
+#endif
+
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)                              /* '.FreeListTop' fields, see OS_MemBlkGet() Note #3    */
+#define  OS_MEM_LF_TAG_INC        ((CPU_ADDR)1u << (sizeof(OS_MEM_QTY) * DEF_OCTET_NBR_BITS))
+#define  OS_MEM_LF_IX_MSK         (OS_MEM_LF_TAG_INC - 1u)      /* Index + 1 of the first free block, 0 if none         */
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL FUNCTIONS
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_MEM_CLASS_NBR > 0u) || (OS_CFG_MEM_LOCK_FREE_EN > 0u))
+static  void        *OS_MemBlkGet       (OS_MEM       *p_mem);
+
+static  CPU_BOOLEAN  OS_MemBlkPut       (OS_MEM       *p_mem,
+                                         void         *p_blk);
+#endif
+
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+static  CPU_DATA     OS_MemClassIxGet   (OS_MEM_SIZE   size);
+
+static  CPU_DATA     OS_MemClassIxFind  (void         *p_blk);
+
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+static  OS_TCB      *OS_MemMagTCBGet    (void);
+#endif
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               CREATE A MEMORY PARTITION
@@ -65,7 +106,8 @@ const  CPU_CHAR  *os_mem__c = "$Id: $";
 *                            OS_ERR_OBJ_CREATED             If the memory partition was already created
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_MEM_LOCK_FREE_EN, the free blocks are linked by index instead of by address (see
+*                 OS_MemBlkGet()).
 ************************************************************************************************************************
 */
 
@@ -82,7 +124,11 @@ void  OSMemCreate (OS_MEM       *p_mem,
     OS_MEM_QTY     i;
     OS_MEM_QTY     loops;
     CPU_INT08U    *p_blk;
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    CPU_ADDR      *p_link;
+#else
     void         **p_link;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -134,6 +180,17 @@ void  OSMemCreate (OS_MEM       *p_mem,
     }
 #endif
 
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    p_link = (CPU_ADDR *)p_addr;                                /* Create linked list of free memory blocks (Note #1)   */
+    p_blk  = (CPU_INT08U *)p_addr;
+    loops  = n_blks - 1u;
+    for (i = 0u; i < loops; i++) {
+        p_blk +=  blk_size;
+       *p_link = (CPU_ADDR)i + 2u;                              /* Save index + 1 of NEXT block in CURRENT block        */
+        p_link = (CPU_ADDR *)(void *)p_blk;                     /* Position     to NEXT block                           */
+    }
+   *p_link             = 0u;                                    /* Last memory block points to none                     */
+#else
     p_link = (void **)p_addr;                                   /* Create linked list of free memory blocks             */
     p_blk  = (CPU_INT08U *)p_addr;
     loops  = n_blks - 1u;
@@ -143,6 +200,7 @@ void  OSMemCreate (OS_MEM       *p_mem,
         p_link = (void **)(void *)p_blk;                        /* Position     to NEXT block                           */
     }
    *p_link             = (void *)0;                             /* Last memory block points to NULL                     */
+#endif
 
     CPU_CRITICAL_ENTER();
 #if (OS_OBJ_TYPE_REQ > 0u)
@@ -161,12 +219,23 @@ void  OSMemCreate (OS_MEM       *p_mem,
     (void)p_name;
 #endif
     p_mem->AddrPtr     = p_addr;                                /* Store start address of memory partition              */
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    p_mem->FreeListTop = 1u;                                    /* First block, generation tag 0                        */
+#else
     p_mem->FreeListPtr = p_addr;                                /* Initialize pointer to pool of free blocks            */
+#endif
     p_mem->NbrFree     = n_blks;                                /* Store number of free blocks in MCB                   */
     p_mem->NbrMax      = n_blks;
     p_mem->BlkSize     = blk_size;                              /* Store block size of each memory blocks               */
 
 #if (OS_CFG_DBG_EN > 0u)
+    p_mem->NbrUsedMax  = 0u;
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+    p_mem->MissCtr     = 0u;
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+    p_mem->MagMissCtr  = 0u;
+#endif
+#endif
     OS_MemDbgListAdd(p_mem);
     OSMemQty++;
 #endif
@@ -196,7 +265,8 @@ void  OSMemCreate (OS_MEM       *p_mem,
 * Returns    : A pointer to a memory block if no error is detected
 *              A pointer to NULL if an error is detected
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_MEM_LOCK_FREE_EN, the block is popped with an atomic compare and swap and interrupts
+*                 stay enabled (see OS_MemBlkGet()).
 ************************************************************************************************************************
 */
 
@@ -204,7 +274,9 @@ void  *OSMemGet (OS_MEM  *p_mem,
                  OS_ERR  *p_err)
 {
     void    *p_blk;
+#if (OS_CFG_MEM_LOCK_FREE_EN == 0u)
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -234,7 +306,15 @@ void  *OSMemGet (OS_MEM  *p_mem,
     }
 #endif
 
-
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    p_blk = OS_MemBlkGet(p_mem);                                /* See Note #1                                          */
+    if (p_blk == (void *)0) {
+        OS_TRACE_MEM_GET_FAILED(p_mem);
+        OS_TRACE_MEM_GET_EXIT(OS_ERR_MEM_NO_FREE_BLKS);
+       *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+        return ((void *)0);
+    }
+#else
     CPU_CRITICAL_ENTER();
     if (p_mem->NbrFree == 0u) {                                 /* See if there are any free memory blocks              */
         CPU_CRITICAL_EXIT();
@@ -246,7 +326,13 @@ void  *OSMemGet (OS_MEM  *p_mem,
     p_blk              = p_mem->FreeListPtr;                    /* Yes, point to next free memory block                 */
     p_mem->FreeListPtr = *(void **)p_blk;                       /* Adjust pointer to new free list                      */
     p_mem->NbrFree--;                                           /* One less memory block in this partition              */
+#if (OS_CFG_DBG_EN > 0u)
+    if ((p_mem->NbrMax - p_mem->NbrFree) > p_mem->NbrUsedMax) {
+        p_mem->NbrUsedMax = p_mem->NbrMax - p_mem->NbrFree;
+    }
+#endif
     CPU_CRITICAL_EXIT();
+#endif
     OS_TRACE_MEM_GET(p_mem);
     OS_TRACE_MEM_GET_EXIT(OS_ERR_NONE);
    *p_err = OS_ERR_NONE;                                        /* No error                                             */
@@ -275,7 +361,8 @@ void  *OSMemGet (OS_MEM  *p_mem,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_MEM_LOCK_FREE_EN, the block is pushed with an atomic compare and swap and interrupts
+*                 stay enabled (see OS_MemBlkPut()).
 ************************************************************************************************************************
 */
 
@@ -283,7 +370,9 @@ void  OSMemPut (OS_MEM  *p_mem,
                 void    *p_blk,
                 OS_ERR  *p_err)
 {
+#if (OS_CFG_MEM_LOCK_FREE_EN == 0u)
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -319,7 +408,14 @@ void  OSMemPut (OS_MEM  *p_mem,
     }
 #endif
 
-
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    if (OS_MemBlkPut(p_mem, p_blk) == DEF_FAIL) {               /* See Note #1                                          */
+        OS_TRACE_MEM_PUT_FAILED(p_mem);
+        OS_TRACE_MEM_PUT_EXIT(OS_ERR_MEM_FULL);
+       *p_err = OS_ERR_MEM_FULL;
+        return;
+    }
+#else
     CPU_CRITICAL_ENTER();
     if (p_mem->NbrFree >= p_mem->NbrMax) {                      /* Make sure all blocks not already returned            */
         CPU_CRITICAL_EXIT();
@@ -332,12 +428,380 @@ void  OSMemPut (OS_MEM  *p_mem,
     p_mem->FreeListPtr = p_blk;
     p_mem->NbrFree++;                                           /* One more memory block in this partition              */
     CPU_CRITICAL_EXIT();
+#endif
     OS_TRACE_MEM_PUT(p_mem);
     OS_TRACE_MEM_PUT_EXIT(OS_ERR_NONE);
    *p_err              = OS_ERR_NONE;                           /* Notify caller that memory block was released         */
 }
 
 
+/*
+************************************************************************************************************************
+*                                      ADD A MEMORY PARTITION TO THE SIZE CLASSES
+*
+* Description : Makes a memory partition serve one size class of OSMemAlloc().  Size class 'n' holds blocks of
+*               (1 << (OS_CFG_MEM_CLASS_SIZE_MIN_LOG2 + n)) bytes.
+*
+* Arguments   : p_mem    is a pointer to a memory partition created by OSMemCreate().  Its block size must be one of
+*                        the size classes.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                If the partition now serves its size class
+*                            OS_ERR_MEM_CREATE_ISR      If you called this function from an ISR
+*                            OS_ERR_MEM_INVALID_P_MEM   If you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_MEM_INVALID_SIZE    If the block size of the partition is not a size class
+*                            OS_ERR_MEM_INVALID_PART    If another partition already serves this size class
+*                            OS_ERR_OBJ_TYPE            If 'p_mem' is not pointing at a memory partition
+*
+* Returns    : none
+*
+* Note(s)    : 1) The blocks of the partition can still be obtained with OSMemGet() and returned with OSMemPut().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+void  OSMemClassAdd (OS_MEM  *p_mem,
+                     OS_ERR  *p_err)
+{
+    CPU_DATA  ix;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_MEM_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mem == (OS_MEM *)0) {                                 /* Must point to a valid memory partition               */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory partition was created           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    ix = OS_MemClassIxGet(p_mem->BlkSize);
+    if ((ix >= OS_CFG_MEM_CLASS_NBR) ||                         /* Block size must be exactly one of the classes        */
+        (((CPU_DATA)1u << (ix + OS_CFG_MEM_CLASS_SIZE_MIN_LOG2)) != p_mem->BlkSize)) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (OSMemClassTbl[ix] != (OS_MEM *)0) {                     /* One partition per size class                         */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_INVALID_PART;
+        return;
+    }
+    OSMemClassTbl[ix] = p_mem;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            ALLOCATE A BLOCK OF A GIVEN SIZE
+*
+* Description : Get a memory block of at least 'size' bytes from the partition of the smallest size class that holds
+*               it (see OSMemClassAdd()).
+*
+* Arguments   : size     is the number of bytes needed.
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If a block was allocated
+*                            OS_ERR_MEM_INVALID_SIZE   If 'size' is 0 or larger than the largest size class
+*                            OS_ERR_MEM_NO_FREE_BLKS   If the size class and all the larger ones are empty
+*
+* Returns    : A pointer to a memory block if no error is detected
+*              A pointer to NULL if an error is detected
+*
+* Note(s)    : 1) When the partition of the size class is empty, or when the class has no partition, the block comes
+*                 from the next larger class that has a free block.  The miss is counted in '.MissCtr' of the empty
+*                 partition.
+*
+*              2) With OS_CFG_MEM_MAG_SIZE > 0, each task keeps up to OS_CFG_MEM_MAG_SIZE freed blocks per size class
+*                 in its OS_TCB (a 'magazine').  A task level call takes a block from the calling task's magazine
+*                 without a critical section.  When the magazine is empty, OS_MEM_MAG_XFER_NBR blocks are taken from
+*                 the partition in one critical section, and the miss is counted in '.MagMissCtr'.  ISRs, and calls
+*                 made before OSStart(), use the partitions directly.
+*
+*              3) Blocks in a magazine are counted as used by their partition (see '.NbrFree').  A task returns them
+*                 with OSMemMagFlush(), and OSTaskDel() returns those of the deleted task.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+void  *OSMemAlloc (OS_MEM_SIZE   size,
+                   OS_ERR       *p_err)
+{
+    OS_MEM      *p_mem;
+    void        *p_blk;
+    CPU_DATA     ix;
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+    OS_TCB      *p_tcb;
+    void        *p_blk_mag;
+    OS_MEM_QTY   nbr;
+#endif
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+    if (size == 0u) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return ((void *)0);
+    }
+    ix = OS_MemClassIxGet(size);
+    if (ix >= OS_CFG_MEM_CLASS_NBR) {                           /* Larger than the largest size class                   */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return ((void *)0);
+    }
+
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+    p_tcb = OS_MemMagTCBGet();
+    if (p_tcb != (OS_TCB *)0) {                                 /* Try the task's magazine first (see Note #2)          */
+        p_blk = p_tcb->MemMagTbl[ix];
+        if (p_blk != (void *)0) {
+            p_tcb->MemMagTbl[ix] = *(void **)p_blk;
+            p_tcb->MemMagCtr[ix]--;
+           *p_err = OS_ERR_NONE;
+            return (p_blk);
+        }
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_mem = OSMemClassTbl[ix];
+    p_blk = (void *)0;
+    if (p_mem != (OS_MEM *)0) {
+        p_blk = OS_MemBlkGet(p_mem);
+    }
+    if (p_blk == (void *)0) {                                   /* Size class empty (see Note #1)                       */
+#if (OS_CFG_DBG_EN > 0u)
+        if (p_mem != (OS_MEM *)0) {
+            p_mem->MissCtr++;
+        }
+#endif
+        do {
+            ix++;
+            if (ix >= OS_CFG_MEM_CLASS_NBR) {
+                CPU_CRITICAL_EXIT();
+               *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+                return ((void *)0);
+            }
+            p_mem = OSMemClassTbl[ix];
+            if (p_mem != (OS_MEM *)0) {
+                p_blk = OS_MemBlkGet(p_mem);
+            }
+        } while (p_blk == (void *)0);
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return (p_blk);
+    }
+
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+    if (p_tcb != (OS_TCB *)0) {                                 /* Refill the magazine in the same critical section     */
+        nbr = 1u;
+        while (nbr < OS_MEM_MAG_XFER_NBR) {
+            p_blk_mag                = OS_MemBlkGet(p_mem);
+            if (p_blk_mag == (void *)0) {
+                break;
+            }
+           *(void **)p_blk_mag       = p_tcb->MemMagTbl[ix];
+            p_tcb->MemMagTbl[ix]     = p_blk_mag;
+            p_tcb->MemMagCtr[ix]++;
+            nbr++;
+        }
+#if (OS_CFG_DBG_EN > 0u)
+        p_mem->MagMissCtr++;
+#endif
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (p_blk);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             FREE A BLOCK OF A SIZE CLASS
+*
+* Description : Returns a memory block obtained from OSMemAlloc() to its size class.
+*
+* Arguments   : p_blk    is a pointer to the memory block being released.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the memory block was released
+*                            OS_ERR_MEM_FULL           If the partition of the block is already full
+*                            OS_ERR_MEM_INVALID_P_BLK  If 'p_blk' is NULL or not a block of a size class partition
+*
+* Returns    : none
+*
+* Note(s)    : 1) The partition is found from the address of the block, so OSMemFree() also accepts blocks obtained
+*                 with OSMemGet() from a size class partition.
+*
+*              2) A task level call puts the block in the calling task's magazine (see OSMemAlloc() Note #2).  When
+*                 the magazine is full, OS_MEM_MAG_XFER_NBR blocks go back to the partition in one critical section.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+void  OSMemFree (void    *p_blk,
+                 OS_ERR  *p_err)
+{
+    OS_MEM      *p_mem;
+    CPU_DATA     ix;
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+    OS_TCB      *p_tcb;
+    void        *p_blk_mag;
+    OS_MEM_QTY   nbr;
+#endif
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_blk == (void *)0) {                                   /* Must release a valid block                           */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+    ix = OS_MemClassIxFind(p_blk);                              /* See Note #1                                          */
+    if (ix >= OS_CFG_MEM_CLASS_NBR) {
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+    p_mem = OSMemClassTbl[ix];
+
+#if (OS_CFG_MEM_MAG_SIZE > 0u)
+    p_tcb = OS_MemMagTCBGet();
+    if (p_tcb != (OS_TCB *)0) {                                 /* See Note #2                                          */
+        if (p_tcb->MemMagCtr[ix] >= OS_CFG_MEM_MAG_SIZE) {      /* Magazine full: flush part of it                      */
+            CPU_CRITICAL_ENTER();
+            for (nbr = 0u; nbr < OS_MEM_MAG_XFER_NBR; nbr++) {
+                p_blk_mag            = p_tcb->MemMagTbl[ix];
+                p_tcb->MemMagTbl[ix] = *(void **)p_blk_mag;
+                (void)OS_MemBlkPut(p_mem, p_blk_mag);
+            }
+            p_tcb->MemMagCtr[ix] -= OS_MEM_MAG_XFER_NBR;
+#if (OS_CFG_DBG_EN > 0u)
+            p_mem->MagMissCtr++;
+#endif
+            CPU_CRITICAL_EXIT();
+        }
+       *(void **)p_blk       = p_tcb->MemMagTbl[ix];
+        p_tcb->MemMagTbl[ix] = p_blk;
+        p_tcb->MemMagCtr[ix]++;
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OS_MemBlkPut(p_mem, p_blk) == DEF_FAIL) {               /* Make sure all blocks not already returned            */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_FULL;
+        return;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            FLUSH THE CALLING TASK's MAGAZINES
+*
+* Description : Returns the blocks cached in the calling task's magazines to their partitions, e.g. before a task goes
+*               idle for a long time.
+*
+* Arguments   : p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the magazines were flushed
+*                            OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                            OS_ERR_FLUSH_ISR          If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_MEM_CLASS_NBR > 0u) && (OS_CFG_MEM_MAG_SIZE > 0u))
+void  OSMemMagFlush (OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't flush a magazine from an ISR                   */
+       *p_err = OS_ERR_FLUSH_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OS_MemMagFlush(OSTCBCurPtr);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                           ADD MEMORY PARTITION TO DEBUG LIST
@@ -384,10 +848,285 @@ void  OS_MemDbgListAdd (OS_MEM  *p_mem)
 
 void  OS_MemInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+    CPU_DATA  ix;
+
+
+    for (ix = 0u; ix < OS_CFG_MEM_CLASS_NBR; ix++) {
+        OSMemClassTbl[ix] = (OS_MEM *)0;
+    }
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     OSMemDbgListPtr = (OS_MEM *)0;
     OSMemQty        = 0u;
 #endif
    *p_err           = OS_ERR_NONE;
 }
+
+
+/*
+************************************************************************************************************************
+*                                             FLUSH A TASK's MAGAZINES
+*
+* Description : This function is called by OSMemMagFlush() and OSTaskDel() to return the blocks cached in the
+*               magazines of a task to their partitions.
+*
+* Arguments   : p_tcb    is a pointer to the task's OS_TCB
+*
+* Returns     : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) The magazines of a task are changed by that task without a critical section.  A task MUST NOT be
+*                 deleted while it is inside OSMemAlloc() or OSMemFree().
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_MEM_CLASS_NBR > 0u) && (OS_CFG_MEM_MAG_SIZE > 0u))
+void  OS_MemMagFlush (OS_TCB  *p_tcb)
+{
+    void      *p_blk;
+    CPU_DATA   ix;
+
+
+    for (ix = 0u; ix < OS_CFG_MEM_CLASS_NBR; ix++) {
+        p_blk = p_tcb->MemMagTbl[ix];
+        while (p_blk != (void *)0) {
+            p_tcb->MemMagTbl[ix] = *(void **)p_blk;
+            (void)OS_MemBlkPut(OSMemClassTbl[ix], p_blk);
+            p_blk = p_tcb->MemMagTbl[ix];
+        }
+        p_tcb->MemMagCtr[ix] = 0u;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               SIZE CLASS OF A SIZE
+*
+* Description : Returns the index of the smallest size class whose blocks hold 'size' bytes.
+*
+* Arguments   : size     is a number of bytes, > 0
+*
+* Returns     : The size class index, >= OS_CFG_MEM_CLASS_NBR if 'size' is larger than the largest class
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+static  CPU_DATA  OS_MemClassIxGet (OS_MEM_SIZE  size)
+{
+    CPU_DATA  size_log2;
+
+
+    if (size <= (1u << OS_CFG_MEM_CLASS_SIZE_MIN_LOG2)) {
+        return (0u);
+    }
+                                                                /* Round up to the next power of 2                      */
+    size_log2 = (CPU_CFG_DATA_SIZE * DEF_OCTET_NBR_BITS) - CPU_CntLeadZeros((CPU_DATA)size - 1u);
+    return (size_log2 - OS_CFG_MEM_CLASS_SIZE_MIN_LOG2);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              SIZE CLASS OF A BLOCK
+*
+* Description : Returns the index of the size class whose partition holds a block.
+*
+* Arguments   : p_blk    is a pointer to the memory block
+*
+* Returns     : The size class index, OS_CFG_MEM_CLASS_NBR if the block is not in a size class partition
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The partitions never change once added, so no critical section is needed.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_CLASS_NBR > 0u)
+static  CPU_DATA  OS_MemClassIxFind (void  *p_blk)
+{
+    OS_MEM    *p_mem;
+    CPU_ADDR   offset;
+    CPU_DATA   ix;
+
+
+    for (ix = 0u; ix < OS_CFG_MEM_CLASS_NBR; ix++) {
+        p_mem = OSMemClassTbl[ix];
+        if (p_mem != (OS_MEM *)0) {
+            offset = (CPU_ADDR)p_blk - (CPU_ADDR)p_mem->AddrPtr;  /* Wraps around if below the partition              */
+            if (offset < ((CPU_ADDR)p_mem->NbrMax * p_mem->BlkSize)) {
+#if (OS_CFG_ARG_CHK_EN > 0u)
+                if ((offset & ((CPU_ADDR)p_mem->BlkSize - 1u)) != 0u) {
+                    break;                                      /* Not the start of a block                             */
+                }
+#endif
+                return (ix);
+            }
+        }
+    }
+    return (OS_CFG_MEM_CLASS_NBR);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          GET/PUT A BLOCK OF A MEMORY PARTITION
+*
+* Description : Pop a block from, or push a block on, the free list of a partition.  Used by OSMemAlloc()/OSMemFree()
+*               and, with OS_CFG_MEM_LOCK_FREE_EN, by OSMemGet()/OSMemPut().
+*
+* Arguments   : p_mem    is a pointer to the memory partition
+*
+*               p_blk    is a pointer to the memory block to put
+*
+* Returns     : OS_MemBlkGet() returns the block, or a pointer to NULL if the partition is empty.
+*
+*               OS_MemBlkPut() returns DEF_OK, or DEF_FAIL if the partition is already full.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.
+*
+*              2) Without OS_CFG_MEM_LOCK_FREE_EN, these functions MUST be called with interrupts disabled.
+*
+*              3) With OS_CFG_MEM_LOCK_FREE_EN, the free list is a lock-free (Treiber) stack and these functions can
+*                 be called from tasks and ISRs with interrupts enabled.  '.FreeListTop' holds, in one CPU_ADDR:
+*
+*                     the index + 1 of the first free block      in the OS_MEM_QTY wide low bits, 0 if none
+*                     a generation tag                            in the upper bits
+*
+*                 and each free block holds the index + 1 of the next one.  '.FreeListTop' is only changed with
+*                 OS_CPU_CmpXchg(), and every change increments the tag.  A pop that read a block's link while the
+*                 block was taken and given back by an ISR, or by a task on another core, then fails its swap
+*                 because the tag differs, and starts over (the 'ABA' problem).  With a 32-bit CPU_ADDR the tag
+*                 has 16 bits: a pop preempted by exactly a multiple of 65536 partition operations could still be
+*                 fooled.  The blocks stay in the partition, so reading a stale link is harmless.
+*
+*              4) With OS_CFG_MEM_LOCK_FREE_EN, '.NbrFree' is updated with its own OS_CPU_CmpXchg() loop: a put first
+*                 reserves its place (see OS_ERR_MEM_FULL), a get decrements it after its pop.  It can thus be
+*                 briefly higher than the number of blocks in the list, but never above '.NbrMax'.  '.NbrUsedMax'
+*                 is updated without a lock and may miss a concurrent peak.
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_MEM_CLASS_NBR > 0u) || (OS_CFG_MEM_LOCK_FREE_EN > 0u))
+static  void  *OS_MemBlkGet (OS_MEM  *p_mem)
+{
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    CPU_ADDR     top;
+    CPU_ADDR     ix;
+    CPU_ADDR     nbr;
+    CPU_INT08U  *p_blk;
+
+
+    do {                                                        /* Pop the first free block (see Note #3)               */
+        top = p_mem->FreeListTop;
+        ix  = top & OS_MEM_LF_IX_MSK;
+        if (ix == 0u) {
+            return ((void *)0);
+        }
+        p_blk = (CPU_INT08U *)p_mem->AddrPtr + ((ix - 1u) * p_mem->BlkSize);
+    } while (OS_CPU_CmpXchg((void **)&p_mem->FreeListTop,
+                            (void  *)top,
+                            (void  *)(((top & ~OS_MEM_LF_IX_MSK) + OS_MEM_LF_TAG_INC) |
+                                      (*(CPU_ADDR *)(void *)p_blk & OS_MEM_LF_IX_MSK))) == DEF_NO);
+
+    do {                                                        /* One less free block (see Note #4)                    */
+        nbr = p_mem->NbrFree;
+    } while (OS_CPU_CmpXchg((void **)&p_mem->NbrFree, (void *)nbr, (void *)(nbr - 1u)) == DEF_NO);
+#if (OS_CFG_DBG_EN > 0u)
+    if ((p_mem->NbrMax - (nbr - 1u)) > p_mem->NbrUsedMax) {
+        p_mem->NbrUsedMax = (OS_MEM_QTY)(p_mem->NbrMax - (nbr - 1u));
+    }
+#endif
+    return ((void *)p_blk);
+#else
+    void  *p_blk;
+
+
+    if (p_mem->NbrFree == 0u) {
+        return ((void *)0);
+    }
+    p_blk              = p_mem->FreeListPtr;
+    p_mem->FreeListPtr = *(void **)p_blk;
+    p_mem->NbrFree--;
+#if (OS_CFG_DBG_EN > 0u)
+    if ((p_mem->NbrMax - p_mem->NbrFree) > p_mem->NbrUsedMax) {
+        p_mem->NbrUsedMax = p_mem->NbrMax - p_mem->NbrFree;
+    }
+#endif
+    return (p_blk);
+#endif
+}
+
+
+static  CPU_BOOLEAN  OS_MemBlkPut (OS_MEM  *p_mem,
+                                   void    *p_blk)
+{
+#if (OS_CFG_MEM_LOCK_FREE_EN > 0u)
+    CPU_ADDR  top;
+    CPU_ADDR  ix;
+    CPU_ADDR  nbr;
+
+
+    do {                                                        /* Reserve a place (see Note #4)                        */
+        nbr = p_mem->NbrFree;
+        if (nbr >= p_mem->NbrMax) {
+            return (DEF_FAIL);
+        }
+    } while (OS_CPU_CmpXchg((void **)&p_mem->NbrFree, (void *)nbr, (void *)(nbr + 1u)) == DEF_NO);
+
+    ix = (((CPU_ADDR)p_blk - (CPU_ADDR)p_mem->AddrPtr) / p_mem->BlkSize) + 1u;
+    do {                                                        /* Push the block (see Note #3)                         */
+        top                = p_mem->FreeListTop;
+       *(CPU_ADDR *)p_blk  = top & OS_MEM_LF_IX_MSK;
+    } while (OS_CPU_CmpXchg((void **)&p_mem->FreeListTop,
+                            (void  *)top,
+                            (void  *)(((top & ~OS_MEM_LF_IX_MSK) + OS_MEM_LF_TAG_INC) | ix)) == DEF_NO);
+    return (DEF_OK);
+#else
+    if (p_mem->NbrFree >= p_mem->NbrMax) {
+        return (DEF_FAIL);
+    }
+    *(void **)p_blk    = p_mem->FreeListPtr;
+    p_mem->FreeListPtr = p_blk;
+    p_mem->NbrFree++;
+    return (DEF_OK);
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          TASK WHOSE MAGAZINES MAY BE USED
+*
+* Description : Returns the calling task's OS_TCB when OSMemAlloc()/OSMemFree() may use its magazines.
+*
+* Arguments   : none
+*
+* Returns     : A pointer to the OS_TCB of the calling task
+*               A pointer to NULL from an ISR, or before OSStart()
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_MEM_CLASS_NBR > 0u) && (OS_CFG_MEM_MAG_SIZE > 0u))
+static  OS_TCB  *OS_MemMagTCBGet (void)
+{
+    if ((OSIntNestingCtr >  0u) ||
+        (OSRunning       != OS_STATE_OS_RUNNING)) {
+        return ((OS_TCB *)0);
+    }
+    return (OSTCBCurPtr);
+}
+#endif
 #endif
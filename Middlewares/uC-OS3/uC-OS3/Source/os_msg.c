@@ -21,6 +21,13 @@
 * File    : os_msg.c
 * Version : V3.08.01
 *********************************************************************************************************
+* Note(s) : (1) Every message queue and task message queue takes its OS_MSGs from OSMsgPool, built by OSInit()
+*               from OSCfg_MsgPool[].  With OS_CFG_MSG_POOL_PRIV_EN, OSQPoolSet() and OSTaskQPoolSet() give a
+*               queue a pool of its own, made by OSMsgPoolCreate(), so that a busy queue can no longer use up
+*               the OS_MSGs of the others.  Several queues may share one pool.  A queue never takes an OS_MSG
+*               from another pool than its own, OSMsgPool included, and returns each OS_MSG to the pool of the
+*               queue it was taken for.  The pool of a queue can only be changed while the queue is empty.
+*********************************************************************************************************
 */
 
 #define  MICRIUM_SOURCE
@@ -33,6 +40,125 @@ const  CPU_CHAR  *os_msg__c = "$Id: $";
 
 #if (OS_MSG_EN > 0u)
 
+/*
+************************************************************************************************************************
+*                                                       MACROS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+#define  OS_MSG_Q_POOL(p_msg_q)         ((p_msg_q)->PoolPtr)   /* Pool of the queue, see Note #1                       */
+#else
+#define  OS_MSG_Q_POOL(p_msg_q)         (&OSMsgPool)
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL FUNCTIONS
+************************************************************************************************************************
+*/
+
+static  void  OS_MsgPoolBuild (OS_MSG_POOL  *p_pool,
+                               OS_MSG       *p_msg_tbl,
+                               OS_MSG_QTY    nbr_msgs);
+
+
+/*
+************************************************************************************************************************
+*                                              CREATE A POOL OF 'OS_MSG'
+*
+* Description: This function is called by your application to create a pool of OS_MSGs, to be given to one or more
+*              message queues with OSQPoolSet() or OSTaskQPoolSet().
+*
+* Arguments  : p_pool       is a pointer to the pool
+*
+*              p_name       is a pointer to an ASCII string that will be used to name the pool
+*
+*              p_msg_tbl    is a pointer to an array of 'nbr_msgs' OS_MSGs that become the free list of the pool
+*
+*              nbr_msgs     is the number of OS_MSGs in the array
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                        If the pool was created
+*                               OS_ERR_CREATE_ISR                  If you called this function from an ISR
+*                               OS_ERR_ILLEGAL_CREATE_RUN_TIME     If you are trying to create the pool after you
+*                                                                    called OSSafetyCriticalStart()
+*                               OS_ERR_MSG_POOL_EMPTY              If 'nbr_msgs' is 0
+*                               OS_ERR_MSG_POOL_NULL_PTR           If 'p_msg_tbl' is a NULL pointer
+*                               OS_ERR_OBJ_PTR_NULL                If 'p_pool' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) A pool that a queue uses MUST NOT be created again.  See 'os_msg.c  Note #1'.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+void  OSMsgPoolCreate (OS_MSG_POOL  *p_pool,
+                       CPU_CHAR     *p_name,
+                       OS_MSG       *p_msg_tbl,
+                       OS_MSG_QTY    nbr_msgs,
+                       OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_DBG_EN == 0u)
+    (void)p_name;
+#endif
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pool == (OS_MSG_POOL *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_msg_tbl == (OS_MSG *)0) {
+       *p_err = OS_ERR_MSG_POOL_NULL_PTR;
+        return;
+    }
+    if (nbr_msgs == 0u) {
+       *p_err = OS_ERR_MSG_POOL_EMPTY;
+        return;
+    }
+#endif
+
+    OS_MsgPoolBuild(p_pool, p_msg_tbl, nbr_msgs);
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_DBG_EN > 0u)
+    p_pool->NamePtr = p_name;
+    OS_MsgPoolDbgListAdd(p_pool);
+    OSMsgPoolQty++;
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                            INITIALIZE THE POOL OF 'OS_MSG'
@@ -53,12 +179,6 @@ const  CPU_CHAR  *os_msg__c = "$Id: $";
 
 void  OS_MsgPoolInit (OS_ERR  *p_err)
 {
-    OS_MSG      *p_msg1;
-    OS_MSG      *p_msg2;
-    OS_MSG_QTY   i;
-    OS_MSG_QTY   loops;
-
-
 #if (OS_CFG_ARG_CHK_EN > 0u)
     if (OSCfg_MsgPoolBasePtr == (OS_MSG *)0) {
        *p_err = OS_ERR_MSG_POOL_NULL_PTR;
@@ -70,10 +190,77 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     }
 #endif
 
-    p_msg1 = OSCfg_MsgPoolBasePtr;
-    p_msg2 = OSCfg_MsgPoolBasePtr;
+    OS_MsgPoolBuild(&OSMsgPool, OSCfg_MsgPoolBasePtr, OSCfg_MsgPoolSize);
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+    OSMsgPool.NamePtr   = (CPU_CHAR *)((void *)"OS_MSG Pool");
+    OSMsgPoolDbgListPtr = (OS_MSG_POOL *)0;
+    OSMsgPoolQty        = 0u;
+#endif
+   *p_err               = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            ADD A POOL TO THE DEBUG LIST
+*
+* Description: This function adds a pool made by OSMsgPoolCreate() to the debug list.
+*
+* Arguments  : p_pool     is a pointer to the pool
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+void  OS_MsgPoolDbgListAdd (OS_MSG_POOL  *p_pool)
+{
+    p_pool->DbgPrevPtr                  = (OS_MSG_POOL *)0;
+    if (OSMsgPoolDbgListPtr == (OS_MSG_POOL *)0) {
+        p_pool->DbgNextPtr              = (OS_MSG_POOL *)0;
+    } else {
+        p_pool->DbgNextPtr              =  OSMsgPoolDbgListPtr;
+        OSMsgPoolDbgListPtr->DbgPrevPtr =  p_pool;
+    }
+    OSMsgPoolDbgListPtr                 =  p_pool;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         BUILD THE FREE LIST OF A POOL OF 'OS_MSG'
+*
+* Description: This function links an array of OS_MSGs into the free list of a pool and clears its statistics.
+*
+* Arguments  : p_pool       is a pointer to the pool
+*
+*              p_msg_tbl    is a pointer to the array of OS_MSGs
+*
+*              nbr_msgs     is the number of OS_MSGs in the array (at least 1)
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_MsgPoolBuild (OS_MSG_POOL  *p_pool,
+                               OS_MSG       *p_msg_tbl,
+                               OS_MSG_QTY    nbr_msgs)
+{
+    OS_MSG      *p_msg1;
+    OS_MSG      *p_msg2;
+    OS_MSG_QTY   i;
+    OS_MSG_QTY   loops;
+
+
+    p_msg1 = p_msg_tbl;
+    p_msg2 = p_msg_tbl;
     p_msg2++;
-    loops  = OSCfg_MsgPoolSize - 1u;
+    loops  = nbr_msgs - 1u;
     for (i = 0u; i < loops; i++) {                              /* Init. list of free OS_MSGs                           */
         p_msg1->NextPtr = p_msg2;
         p_msg1->MsgPtr  = (void *)0;
@@ -91,13 +278,13 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     p_msg1->MsgTS   =           0u;
 #endif
 
-    OSMsgPool.NextPtr    = OSCfg_MsgPoolBasePtr;
-    OSMsgPool.NbrFree    = OSCfg_MsgPoolSize;
-    OSMsgPool.NbrUsed    = 0u;
+    p_pool->NextPtr    = p_msg_tbl;
+    p_pool->NbrFree    = nbr_msgs;
+    p_pool->NbrUsed    = 0u;
 #if (OS_CFG_DBG_EN > 0u)
-    OSMsgPool.NbrUsedMax = 0u;
+    p_pool->NbrUsedMax = 0u;
+    p_pool->EmptyCtr   = 0u;
 #endif
-   *p_err                = OS_ERR_NONE;
 }
 
 
@@ -118,18 +305,20 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
 
 OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
 {
-    OS_MSG      *p_msg;
-    OS_MSG_QTY   qty;
+    OS_MSG       *p_msg;
+    OS_MSG_POOL  *p_pool;
+    OS_MSG_QTY    qty;
 
 
 
     qty = p_msg_q->NbrEntries;                                  /* Get the number of OS_MSGs being freed                */
     if (p_msg_q->NbrEntries > 0u) {
+        p_pool                  = OS_MSG_Q_POOL(p_msg_q);       /* Each OS_MSG goes back to the pool of the queue       */
         p_msg                   = p_msg_q->InPtr;               /* Point to end of message chain                        */
-        p_msg->NextPtr          = OSMsgPool.NextPtr;
-        OSMsgPool.NextPtr       = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
-        OSMsgPool.NbrUsed      -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
-        OSMsgPool.NbrFree      += p_msg_q->NbrEntries;
+        p_msg->NextPtr          = p_pool->NextPtr;
+        p_pool->NextPtr         = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
+        p_pool->NbrUsed        -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
+        p_pool->NbrFree        += p_msg_q->NbrEntries;
         p_msg_q->NbrEntries     =           0u;                 /* Flush the message queue                              */
 #if (OS_CFG_DBG_EN > 0u)
         p_msg_q->NbrEntriesMax  =           0u;
@@ -168,6 +357,9 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 #endif
     p_msg_q->InPtr          = (OS_MSG *)0;
     p_msg_q->OutPtr         = (OS_MSG *)0;
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+    p_msg_q->PoolPtr        = &OSMsgPool;                       /* OSMsgPool until OSQPoolSet()/OSTaskQPoolSet()        */
+#endif
 }
 
 
@@ -200,8 +392,9 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
                    CPU_TS       *p_ts,
                    OS_ERR       *p_err)
 {
-    OS_MSG  *p_msg;
-    void    *p_void;
+    OS_MSG       *p_msg;
+    OS_MSG_POOL  *p_pool;
+    void         *p_void;
 
 
 #if (OS_CFG_TS_EN == 0u)
@@ -237,16 +430,99 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
         p_msg_q->NbrEntries--;                                  /* Yes, One less message in the queue                   */
     }
 
-    p_msg->NextPtr    = OSMsgPool.NextPtr;                      /* Return message control block to free list            */
-    OSMsgPool.NextPtr = p_msg;
-    OSMsgPool.NbrFree++;
-    OSMsgPool.NbrUsed--;
+    p_pool            = OS_MSG_Q_POOL(p_msg_q);
+    p_msg->NextPtr    = p_pool->NextPtr;                        /* Return message control block to free list            */
+    p_pool->NextPtr   = p_msg;
+    p_pool->NbrFree++;
+    p_pool->NbrUsed--;
 
    *p_err             = OS_ERR_NONE;
     return (p_void);
 }
 
 
+/*
+************************************************************************************************************************
+*                                       GET SEVERAL MESSAGES FROM A MESSAGE QUEUE
+*
+* Description: This function retrieves up to 'nbr_msgs' messages from a message queue, in queue order.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue where we want to extract the messages from
+*              -------
+*
+*              p_msgs      is a pointer to an array of 'nbr_msgs' entries that will receive the messages
+*
+*              nbr_msgs    is the maximum number of messages to extract
+*
+*              p_ts        is a pointer to where the time stamp of the first message will be placed
+*
+* Returns    : The number of messages extracted, 0 if the queue is empty
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The messages extracted are unlinked from the queue and returned to the pool as one list.
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_Q_EN > 0u) && (OS_CFG_Q_MULTI_EN > 0u))
+OS_MSG_QTY  OS_MsgQGetMulti (OS_MSG_Q     *p_msg_q,
+                             OS_MSG_INFO  *p_msgs,
+                             OS_MSG_QTY    nbr_msgs,
+                             CPU_TS       *p_ts)
+{
+    OS_MSG       *p_first;
+    OS_MSG       *p_last;
+    OS_MSG_POOL  *p_pool;
+    OS_MSG_QTY    nbr_got;
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+    if (p_msg_q->NbrEntries == 0u) {                            /* Is the queue empty?                                  */
+        return (0u);                                            /* Yes                                                  */
+    }
+    if (nbr_msgs > p_msg_q->NbrEntries) {
+        nbr_msgs = p_msg_q->NbrEntries;
+    }
+
+    p_first = p_msg_q->OutPtr;
+#if (OS_CFG_TS_EN > 0u)
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = p_first->MsgTS;
+    }
+#endif
+    p_last  = p_first;
+    nbr_got = 0u;
+    for (;;) {                                                  /* Copy out the messages                                */
+        p_msgs[nbr_got].MsgPtr  = p_last->MsgPtr;
+        p_msgs[nbr_got].MsgSize = p_last->MsgSize;
+        nbr_got++;
+        if (nbr_got == nbr_msgs) {
+            break;
+        }
+        p_last = p_last->NextPtr;
+    }
+
+    p_msg_q->OutPtr     = p_last->NextPtr;                      /* Unlink them from the queue ...                       */
+    p_msg_q->NbrEntries = (OS_MSG_QTY)(p_msg_q->NbrEntries - nbr_got);
+    if (p_msg_q->NbrEntries == 0u) {                            /* Did we empty the queue?                              */
+        p_msg_q->InPtr  = (OS_MSG *)0;                          /* Yes                                                  */
+        p_msg_q->OutPtr = (OS_MSG *)0;
+    }
+
+    p_pool              = OS_MSG_Q_POOL(p_msg_q);
+    p_last->NextPtr     = p_pool->NextPtr;                      /* ... and return them to the free list in one step     */
+    p_pool->NextPtr     = p_first;
+    p_pool->NbrFree     = (OS_MSG_QTY)(p_pool->NbrFree + nbr_got);
+    p_pool->NbrUsed     = (OS_MSG_QTY)(p_pool->NbrUsed - nbr_got);
+
+    return (nbr_got);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                           DEPOSIT MESSAGE IN MESSAGE QUEUE
@@ -270,7 +546,7 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
 *              p_err       is a pointer to a variable that will contain an error code returned by this function.
 *
 *                              OS_ERR_Q_MAX           if the queue is full
-*                              OS_ERR_MSG_POOL_EMPTY  if we no longer have any OS_MSG to use
+*                              OS_ERR_MSG_POOL_EMPTY  if the pool of the queue has no OS_MSG left
 *                              OS_ERR_NONE            the message was deposited in the queue
 *
 * Returns    : none
@@ -286,8 +562,9 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
                   CPU_TS        ts,
                   OS_ERR       *p_err)
 {
-    OS_MSG  *p_msg;
-    OS_MSG  *p_msg_in;
+    OS_MSG       *p_msg;
+    OS_MSG       *p_msg_in;
+    OS_MSG_POOL  *p_pool;
 
 
 #if (OS_CFG_TS_EN == 0u)
@@ -299,19 +576,23 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
         return;
     }
 
-    if (OSMsgPool.NbrFree == 0u) {
+    p_pool = OS_MSG_Q_POOL(p_msg_q);
+    if (p_pool->NbrFree == 0u) {
+#if (OS_CFG_DBG_EN > 0u)
+        p_pool->EmptyCtr++;
+#endif
        *p_err = OS_ERR_MSG_POOL_EMPTY;                          /* No more OS_MSG to use                                */
         return;
     }
 
-    p_msg = OSMsgPool.NextPtr;                                  /* Remove message control block from free list          */
-    OSMsgPool.NextPtr = p_msg->NextPtr;
-    OSMsgPool.NbrFree--;
-    OSMsgPool.NbrUsed++;
+    p_msg = p_pool->NextPtr;                                    /* Remove message control block from free list          */
+    p_pool->NextPtr = p_msg->NextPtr;
+    p_pool->NbrFree--;
+    p_pool->NbrUsed++;
 
 #if (OS_CFG_DBG_EN > 0u)
-    if (OSMsgPool.NbrUsedMax < OSMsgPool.NbrUsed) {
-        OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;
+    if (p_pool->NbrUsedMax < p_pool->NbrUsed) {
+        p_pool->NbrUsedMax = p_pool->NbrUsed;
     }
 #endif
 
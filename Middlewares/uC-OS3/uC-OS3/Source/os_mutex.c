@@ -112,6 +112,11 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
     p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
     p_mutex->OwnerNestingCtr   =             0u;                /* Mutex is available                                   */
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    p_mutex->FastLockPtr       = (void     *)0;
+    p_mutex->FastCtr           =             0u;
+    p_mutex->SlowCtr           =             0u;
+#endif
 #if (OS_CFG_TS_EN > 0u)
     p_mutex->TS                =             0u;
 #endif
@@ -121,6 +126,9 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     OS_MutexDbgListAdd(p_mutex);
     OSMutexQty++;
 #endif
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    OS_MutexFastListAdd(p_mutex);                               /* See OS_MutexFastInflateAll()                         */
+#endif
 
     OS_TRACE_MUTEX_CREATE(p_mutex, p_name);
     CPU_CRITICAL_EXIT();
@@ -231,6 +239,7 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 #endif
 
     CPU_CRITICAL_ENTER();
+    OS_MUTEX_FAST_INFLATE(p_mutex);                             /* The owner may hold the mutex on the fast path        */
     p_pend_list = &p_mutex->PendList;
     nbr_tasks   = 0u;
     switch (opt) {
@@ -239,6 +248,9 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 #if (OS_CFG_DBG_EN > 0u)
                  OS_MutexDbgListRemove(p_mutex);
                  OSMutexQty--;
+#endif
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+                 OS_MutexFastListRemove(p_mutex);
 #endif
                  OS_TRACE_MUTEX_DEL(p_mutex);
                  if (p_mutex->OwnerTCBPtr != (OS_TCB *)0) {     /* Does the mutex belong to a task?                     */
@@ -269,6 +281,9 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 #if (OS_CFG_DBG_EN > 0u)
              OS_MutexDbgListRemove(p_mutex);
              OSMutexQty--;
+#endif
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+             OS_MutexFastListRemove(p_mutex);
 #endif
              OS_TRACE_MUTEX_DEL(p_mutex);
              p_tcb_owner = p_mutex->OwnerTCBPtr;
@@ -348,7 +363,14 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : This API 'MUST NOT' be called from a timer callback function.
+* Note(s)    : 1) This API 'MUST NOT' be called from a timer callback function.
+*
+*              2) When OS_CFG_MUTEX_FAST_EN is enabled, a free mutex is acquired by swapping '.FastLockPtr' from NULL
+*                 to the TCB of the caller with OS_CPU_CmpXchg(), without a critical section.  The mutex is not added
+*                 to the group of the owner and '.OwnerTCBPtr' stays NULL until another task needs the mutex: the slow
+*                 path then 'inflates' the mutex (see OS_MutexFastInflate()), after which the owner releases it on the
+*                 slow path.  OSTaskDel() inflates, then releases, the mutexes the deleted task holds on the fast path
+*                 (see OS_MutexFastInflateAll()).
 ************************************************************************************************************************
 */
 
@@ -430,7 +452,28 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     }
 #endif
 
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    if (OS_CPU_CmpXchg(&p_mutex->FastLockPtr,                   /* Uncontended, see Note #2                             */
+                       (void *)0,
+                       (void *)OSTCBCurPtr) == DEF_YES) {
+        p_mutex->FastCtr++;
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_mutex->TS;
+        }
+#endif
+        OS_TRACE_MUTEX_PEND(p_mutex);
+        OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    OS_MutexFastInflate(p_mutex);
+    p_mutex->SlowCtr++;
+#endif
     if (p_mutex->OwnerNestingCtr == 0u) {                       /* Resource available?                                  */
         p_mutex->OwnerTCBPtr     = OSTCBCurPtr;                 /* Yes, caller may proceed                              */
         p_mutex->OwnerNestingCtr = 1u;
@@ -731,7 +774,8 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) A mutex acquired on the fast path is released by swapping '.FastLockPtr' back to NULL, unless another
+*                 task inflated it in the meantime (see OSMutexPend(), Note #2).
 ************************************************************************************************************************
 */
 
@@ -801,7 +845,29 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     }
 #endif
 
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    if (p_mutex->FastLockPtr == (void *)OSTCBCurPtr) {          /* Held on the fast path?                               */
+#if (OS_CFG_TS_EN > 0u)
+        p_mutex->TS = OS_TS_GET();
+#endif
+        p_mutex->FastCtr++;
+        if (OS_CPU_CmpXchg(&p_mutex->FastLockPtr,               /* Yes, release it unless it was inflated (see Note #1) */
+                           (void *)OSTCBCurPtr,
+                           (void *)0) == DEF_YES) {
+            OS_TRACE_MUTEX_POST(p_mutex);
+            OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
+           *p_err = OS_ERR_NONE;
+            return;
+        }
+        p_mutex->FastCtr--;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    OS_MutexFastInflate(p_mutex);
+    p_mutex->SlowCtr++;
+#endif
     if (OSTCBCurPtr != p_mutex->OwnerTCBPtr) {                  /* Make sure the mutex owner is releasing the mutex     */
         CPU_CRITICAL_EXIT();
         OS_TRACE_MUTEX_POST_FAILED(p_mutex);
@@ -832,6 +898,7 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
         p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
         p_mutex->OwnerNestingCtr =           0u;
+        OS_MUTEX_FAST_DEFLATE(p_mutex);                         /* Next pend may take the fast path again               */
         CPU_CRITICAL_EXIT();
         OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
        *p_err = OS_ERR_NONE;
@@ -899,6 +966,9 @@ void  OS_MutexClr (OS_MUTEX  *p_mutex)
     p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
     p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
     p_mutex->OwnerNestingCtr   =             0u;
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    p_mutex->FastLockPtr       = (void     *)0;
+#endif
 #if (OS_CFG_TS_EN > 0u)
     p_mutex->TS                =             0u;
 #endif
@@ -1109,10 +1179,11 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
         if (p_pend_list->HeadPtr == (OS_TCB *)0) {              /* Any task waiting on mutex?                           */
             p_mutex->OwnerNestingCtr =           0u;            /* Decrement owner's nesting counter                    */
             p_mutex->OwnerTCBPtr     = (OS_TCB *)0;             /* No                                                   */
+            OS_MUTEX_FAST_DEFLATE(p_mutex);
         } else {
                                                                 /* Get TCB from head of pend list                       */
             p_tcb_new                = p_pend_list->HeadPtr;
-            p_mutex->OwnerTCBPtr     = p_tcb;                   /* Give mutex to new owner                              */
+            p_mutex->OwnerTCBPtr     = p_tcb_new;               /* Give mutex to new owner                              */
             p_mutex->OwnerNestingCtr = 1u;
             OS_MutexGrpAdd(p_tcb_new, p_mutex);
                                                                 /* Post to mutex                                        */
@@ -1128,4 +1199,139 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
 
 }
 
+
+/*
+************************************************************************************************************************
+*                                              INFLATE A FAST PATH MUTEX
+*
+* Description: This function is called by the kernel before it reads or changes the owner of a mutex, the nesting counter
+*              or the group of the owner.  A mutex held on the fast path has none of these set: its owner is only
+*              recorded in '.FastLockPtr' (see OSMutexPend(), Note #2).
+*
+* Argument(s): p_mutex      is a pointer to the mutex to inflate.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.  The owner of the mutex may still swap
+*                 '.FastLockPtr' from another core (OS_CFG_SMP_CORE_NBR > 1), or once it resumes on this one, so the
+*                 fast path is closed with a compare and swap: either the owner's release completes first and the
+*                 mutex is found free, or the release fails and the owner goes through the slow path of OSMutexPost().
+*
+*              3) '.FastLockPtr' is set to the mutex itself, which is never a TCB, so the fast path is closed until the
+*                 slow path leaves the mutex free with no task waiting and resets '.FastLockPtr' to NULL.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+void  OS_MutexFastInflate (OS_MUTEX  *p_mutex)
+{
+    OS_TCB  *p_tcb;
+
+
+    do {
+        p_tcb = (OS_TCB *)p_mutex->FastLockPtr;
+        if (p_tcb == (OS_TCB *)p_mutex) {                       /* Already on the slow path?                            */
+            return;
+        }
+    } while (OS_CPU_CmpXchg(&p_mutex->FastLockPtr,              /* Close the fast path (see Notes #2 & #3)              */
+                            (void *)p_tcb,
+                            (void *)p_mutex) == DEF_NO);
+    if (p_tcb != (OS_TCB *)0) {                                 /* Record the fast path owner                           */
+        p_mutex->OwnerTCBPtr     = p_tcb;
+        p_mutex->OwnerNestingCtr = 1u;
+        OS_MutexGrpAdd(p_tcb, p_mutex);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                     INFLATE THE FAST PATH MUTEXES OF A DELETED TASK
+*
+* Description: This function is called by OSTaskDel() so that the mutexes the deleted task holds on the fast path are
+*              released with the others of its group by OS_MutexGrpPostAll().
+*
+* Argument(s): p_tcb        is a pointer to the TCB of the task being deleted.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) A mutex held on the fast path is only recorded in its own '.FastLockPtr', so every mutex created is
+*                 checked: the time spent grows with the number of mutexes.  The deleted task is not running, so it
+*                 cannot take or release a mutex on the fast path meanwhile.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+void  OS_MutexFastInflateAll (OS_TCB  *p_tcb)
+{
+    OS_MUTEX  *p_mutex;
+
+
+    p_mutex = OSMutexFastListPtr;
+    while (p_mutex != (OS_MUTEX *)0) {
+        if (p_mutex->FastLockPtr == (void *)p_tcb) {            /* Held by the deleted task on the fast path?           */
+            OS_MutexFastInflate(p_mutex);                       /* Yes, add it to the task's group                      */
+        }
+        p_mutex = p_mutex->FastNextPtr;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                     ADD/REMOVE MUTEX TO/FROM THE FAST PATH LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a mutex to/from the list of mutexes that may be
+*              held on the fast path (see OS_MutexFastInflateAll()).
+*
+* Arguments  : p_mutex     is a pointer to the mutex to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+void  OS_MutexFastListAdd (OS_MUTEX  *p_mutex)
+{
+    p_mutex->FastPrevPtr                = (OS_MUTEX *)0;
+    p_mutex->FastNextPtr                =  OSMutexFastListPtr;
+    if (OSMutexFastListPtr != (OS_MUTEX *)0) {
+        OSMutexFastListPtr->FastPrevPtr =  p_mutex;
+    }
+    OSMutexFastListPtr                  =  p_mutex;
+}
+
+
+void  OS_MutexFastListRemove (OS_MUTEX  *p_mutex)
+{
+    OS_MUTEX  *p_mutex_next;
+    OS_MUTEX  *p_mutex_prev;
+
+
+    p_mutex_prev = p_mutex->FastPrevPtr;
+    p_mutex_next = p_mutex->FastNextPtr;
+
+    if (p_mutex_prev == (OS_MUTEX *)0) {
+        OSMutexFastListPtr        = p_mutex_next;
+    } else {
+        p_mutex_prev->FastNextPtr = p_mutex_next;
+    }
+    if (p_mutex_next != (OS_MUTEX *)0) {
+        p_mutex_next->FastPrevPtr = p_mutex_prev;
+    }
+    p_mutex->FastPrevPtr = (OS_MUTEX *)0;
+    p_mutex->FastNextPtr = (OS_MUTEX *)0;
+}
+#endif
+
 #endif /* OS_CFG_MUTEX_EN */
@@ -54,6 +54,9 @@ void  OS_PrioInit (void)
     for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
          OSPrioTbl[i] = 0u;
     }
+#if (OS_CFG_PRIO_MAX > (2u * (CPU_CFG_DATA_SIZE * 8u)))
+    OSPrioGrp = 0u;
+#endif
 
 #if (OS_CFG_TASK_IDLE_EN == 0u)
     OS_PrioInsert ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));            /* Insert what would be the idle task                   */
@@ -72,6 +75,10 @@ void  OS_PrioInit (void)
 * Returns    : The priority of the Highest Priority Task (HPT) waiting for the event
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Beyond two CPU_DATA words of priorities the bitmap has two levels: bit 'n' of OSPrioGrp is set when
+*                 OSPrioTbl[n] is not empty.  The highest priority is found with two count leading zeros, whatever
+*                 OS_CFG_PRIO_MAX is.
 ************************************************************************************************************************
 */
 
@@ -89,20 +96,13 @@ OS_PRIO  OS_PrioGetHighest (void)
     }
 
 
-#else
-    CPU_DATA  *p_tbl;
-    OS_PRIO    prio;
+#else                                                           /* Two-level bitmap for more priorities                 */
+    OS_PRIO  ix;
 
 
-    prio  = 0u;
-    p_tbl = &OSPrioTbl[0];
-    while (*p_tbl == 0u) {                                      /* Search the bitmap table for the highest priority     */
-        prio = (OS_PRIO)(prio + (CPU_CFG_DATA_SIZE * 8u));      /* Compute the step of each CPU_DATA entry              */
-        p_tbl++;
-    }
-    prio += (OS_PRIO)CPU_CntLeadZeros(*p_tbl);                  /* Find the position of the first bit set at the entry  */
-
-    return (prio);
+    ix = (OS_PRIO)CPU_CntLeadZeros(OSPrioGrp);                  /* Find the first entry of the table with a bit set     */
+                                                                /* Find the position of the first bit set at the entry  */
+    return ((OS_PRIO)((ix * (CPU_CFG_DATA_SIZE * 8u)) + CPU_CntLeadZeros(OSPrioTbl[ix])));
 #endif
 }
 
@@ -134,13 +134,14 @@ void  OS_PrioInsert (OS_PRIO  prio)
     }
 
 
-#else
+#else                                                           /* Two-level bitmap for more priorities                 */
     CPU_DATA  bit_nbr;
     OS_PRIO   ix;
 
     ix             = (OS_PRIO)(prio /  (CPU_CFG_DATA_SIZE * 8u));
     bit_nbr        = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr);
+    OSPrioGrp     |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix);
 #endif
 }
 
@@ -172,12 +173,15 @@ void  OS_PrioRemove (OS_PRIO  prio)
     }
 
 
-#else
+#else                                                           /* Two-level bitmap for more priorities                 */
     CPU_DATA  bit_nbr;
     OS_PRIO   ix;
 
     ix             =   (OS_PRIO)(prio  /   (CPU_CFG_DATA_SIZE * 8u));
     bit_nbr        =   (CPU_DATA)prio  &  ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] &= ~((CPU_DATA)  1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr));
+    if (OSPrioTbl[ix] == 0u) {                                  /* Entry is now empty, clear its bit in the summary     */
+        OSPrioGrp &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix));
+    }
 #endif
 }
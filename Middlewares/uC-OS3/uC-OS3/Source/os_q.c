@@ -147,6 +147,10 @@ void  OSQCreate (OS_Q        *p_q,
 *                            OS_OPT_DEL_ALWAYS           Deletes the queue even if tasks are waiting.
 *                                                        In this case, all the tasks pending will be readied.
 *
+*                        either of which may be combined with:
+*
+*                            OS_OPT_DEL_BUF              Release the buffers still in the queue, see Note #3
+*
 *              p_err     is a pointer to a variable that will contain an error code returned by this function.
 *
 *                            OS_ERR_NONE                    The call was successful and the queue was deleted
@@ -167,6 +171,9 @@ void  OSQCreate (OS_Q        *p_q,
 *
 *              2) Because ALL tasks pending on the queue will be readied, you MUST be careful in applications where the
 *                 queue is used for mutual exclusion because the resource(s) will no longer be guarded by the queue.
+*
+*              3) OS_OPT_DEL_BUF is for a queue used with OSQPostBuf(): the buffer chains still in the queue are
+*                 released, see OSQFlushBuf().  Without it, like any other message, they are lost with the queue.
 ************************************************************************************************************************
 */
 
@@ -179,6 +186,10 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     CPU_TS         ts;
+#if (OS_CFG_BUF_EN > 0u)
+    OS_OPT         opt_buf;
+    OS_MSG_Q       msg_q;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -231,6 +242,12 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
     }
 #endif
 
+#if (OS_CFG_BUF_EN > 0u)
+    opt_buf          = (OS_OPT)(opt &  OS_OPT_DEL_BUF);         /* See Note #3                                          */
+    opt              = (OS_OPT)(opt & ~OS_OPT_DEL_BUF);
+    msg_q.NbrEntries = 0u;
+#endif
+
     CPU_CRITICAL_ENTER();
     p_pend_list = &p_q->PendList;
     nbr_tasks   = 0u;
@@ -242,6 +259,11 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
                  OSQQty--;
 #endif
                  OS_TRACE_Q_DEL(p_q);
+#if (OS_CFG_BUF_EN > 0u)
+                 if (opt_buf != 0u) {                           /* Take the buffers out before the OS_MSGs are freed    */
+                     OS_QBufDetach(p_q, &msg_q);
+                 }
+#endif
                  OS_QClr(p_q);
                  CPU_CRITICAL_EXIT();
                 *p_err = OS_ERR_NONE;
@@ -269,6 +291,11 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
              OSQQty--;
 #endif
              OS_TRACE_Q_DEL(p_q);
+#if (OS_CFG_BUF_EN > 0u)
+             if (opt_buf != 0u) {
+                 OS_QBufDetach(p_q, &msg_q);
+             }
+#endif
              OS_QClr(p_q);
              CPU_CRITICAL_EXIT();
              OSSched();                                         /* Find highest priority task ready to run              */
@@ -280,6 +307,9 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
             *p_err = OS_ERR_OPT_INVALID;
              break;
     }
+#if (OS_CFG_BUF_EN > 0u)
+    (void)OS_QBufRelease(&msg_q);                               /* Release the buffers taken out of the queue, if any   */
+#endif
     OS_TRACE_Q_DEL_EXIT(*p_err);
     return (nbr_tasks);
 }
@@ -308,7 +338,7 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
 * Note(s)     : 1) You should use this function with great care because, when to flush the queue, you LOOSE the
 *                  references to what the queue entries are pointing to and thus, you could cause 'memory leaks'.  In
 *                  other words, the data you are pointing to that's being referenced by the queue entries should, most
-*                  likely, need to be de-allocated (i.e. freed).
+*                  likely, need to be de-allocated (i.e. freed).  Use OSQFlushBuf() for a queue used with OSQPostBuf().
 ************************************************************************************************************************
 */
 
@@ -365,6 +395,81 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                               FLUSH A QUEUE OF BUFFERS
+*
+* Description : This function is used to flush a queue used with OSQPostBuf().  The buffer chains in the queue are
+*               released, as if each one had been received and passed to OSBufFree().
+*
+* Arguments   : p_q        is a pointer to the message queue to flush
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*                          See OSQFlush() for the possible values.
+*
+* Returns     : == 0       if no entries were freed, or upon error.
+*               >  0       the number of buffer chains released.
+*
+* Note(s)     : 1) Only buffers posted with OSQPostBuf() may be in the queue.
+*
+*               2) The messages are taken out of the queue in one critical section.  The chains are then released one
+*                  at a time, with interrupts enabled, since OS_BufRelease() returns each buffer to its partition.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_FLUSH_EN > 0u) && (OS_CFG_BUF_EN > 0u)
+OS_MSG_QTY  OSQFlushBuf (OS_Q    *p_q,
+                         OS_ERR  *p_err)
+{
+    OS_MSG_Q  msg_q;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't flush a message queue from an ISR              */
+       *p_err = OS_ERR_FLUSH_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OS_QBufDetach(p_q, &msg_q);                                 /* See Note #2                                          */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (OS_QBufRelease(&msg_q));
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                            PEND ON A QUEUE FOR A MESSAGE
@@ -599,6 +704,58 @@ void  *OSQPend (OS_Q         *p_q,
 }
 
 
+/*
+************************************************************************************************************************
+*                                            PEND ON A QUEUE FOR A BUFFER
+*
+* Description: This function waits for a buffer chain posted to a queue by OSQPostBuf().
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              timeout       is an optional timeout period (in clock ticks), see OSQPend()
+*
+*              opt           determines whether the user wants to block if the queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp, see OSQPend()
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*                            See OSQPend() for the possible values.
+*
+* Returns    : != (OS_BUF *)0  is a pointer to the first buffer of the chain received
+*              == (OS_BUF *)0  if no buffer was received
+*
+* Note(s)    : 1) The reference held by the poster now belongs to the caller, which releases it with OSBufFree() or
+*                 passes it on with OSQPostBuf().  The size of the message is the '.TotLen' of the chain.
+*
+*              2) Only buffers posted with OSQPostBuf() may be in the queue.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_BUF_EN > 0u)
+OS_BUF  *OSQPendBuf (OS_Q     *p_q,
+                     OS_TICK   timeout,
+                     OS_OPT    opt,
+                     CPU_TS   *p_ts,
+                     OS_ERR   *p_err)
+{
+    OS_MSG_SIZE  msg_size;
+
+
+    return ((OS_BUF *)OSQPend(p_q,
+                              timeout,
+                              opt,
+                             &msg_size,
+                              p_ts,
+                              p_err));
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                             ABORT WAITING ON A MESSAGE QUEUE
@@ -729,172 +886,789 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 
 /*
 ************************************************************************************************************************
-*                                               POST MESSAGE TO A QUEUE
+*                                        PEND ON A QUEUE FOR SEVERAL MESSAGES
 *
-* Description: This function sends a message to a queue.  With the 'opt' argument, you can specify whether the message
-*              is broadcast to all waiting tasks and/or whether you post the message to the front of the queue (LIFO)
-*              or normally (FIFO) at the end of the queue.
+* Description: This function waits for messages to be sent to a queue and retrieves up to 'nbr_msgs' of them in one
+*              call.
 *
-* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+* Arguments  : p_q           is a pointer to the message queue
 *
-*              p_void        is a pointer to the message to send.
+*              p_msgs        is a pointer to an array of 'nbr_msgs' entries that will receive the messages and their
+*                            sizes, in the order they are retrieved from the queue
 *
-*              msg_size      specifies the size of the message (in bytes)
+*              nbr_msgs      is the maximum number of messages to retrieve
 *
-*              opt           determines the type of POST performed:
+*              timeout       is an optional timeout period (in clock ticks), as for OSQPend()
 *
-*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue.  This option
-*                                                         can be added to either OS_OPT_POST_FIFO or OS_OPT_POST_LIFO
-*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO) and wake up a single
-*                                                         waiting task.
-*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO) and wake up
-*                                                         a single waiting task.
-*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*              opt           determines whether the user wants to block if the queue is empty or not:
 *
-*                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
-*                                     2) OS_OPT_POST_ALL      can be added (or OR'd) with one of the other options.
-*                                     3) Possible combination of options are:
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
 *
-*                                        OS_OPT_POST_FIFO
-*                                        OS_OPT_POST_LIFO
-*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL
-*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL
-*                                        OS_OPT_POST_FIFO + OS_OPT_POST_NO_SCHED
-*                                        OS_OPT_POST_LIFO + OS_OPT_POST_NO_SCHED
-*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
-*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
+*              p_ts          is a pointer to a variable that will receive the timestamp of the first message
+*                            received, of the pend abort or of the deletion of the queue.  If you pass a NULL pointer
+*                            (i.e. (CPU_TS *)0) then you will not get the timestamp.
 *
 *              p_err         is a pointer to a variable that will contain an error code returned by this function.
 *
-*                                OS_ERR_NONE              The call was successful and the message was sent
-*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
-*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
-*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
-*                                OS_ERR_OPT_INVALID       You specified an invalid option
-*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
-*                                OS_ERR_Q_MAX             If the queue is full
+*                                OS_ERR_NONE               The call was successful and your task received messages
+*                                OS_ERR_OBJ_DEL            If 'p_q' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_q'
+*                                OS_ERR_OBJ_TYPE           If the message queue was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was empty
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_msgs'
+*                                OS_ERR_Q_SIZE             If 'nbr_msgs' is 0
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
 *
-* Returns    : None
+* Returns    : The number of messages received, 0 on error.
 *
-* Note(s)    : none
+* Note(s)    : 1) This API 'MUST NOT' be called from a timer callback function.
+*
+*              2) The messages already in the queue are all retrieved in one critical section.  If the queue is empty,
+*                 the task waits for one message and, once it is readied, also takes the messages posted with it (see
+*                 OSQPostMulti()).
 ************************************************************************************************************************
 */
 
-void  OSQPost (OS_Q         *p_q,
-               void         *p_void,
-               OS_MSG_SIZE   msg_size,
-               OS_OPT        opt,
-               OS_ERR       *p_err)
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY  OSQPendMulti (OS_Q         *p_q,
+                          OS_MSG_INFO  *p_msgs,
+                          OS_MSG_QTY    nbr_msgs,
+                          OS_TICK       timeout,
+                          OS_OPT        opt,
+                          CPU_TS       *p_ts,
+                          OS_ERR       *p_err)
 {
-    OS_OPT         post_type;
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
-    CPU_TS         ts;
+    OS_MSG_QTY  nbr_got;
     CPU_SR_ALLOC();
 
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return;
+        return (0u);
     }
 #endif
 
-    OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt);
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
 
 #if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
     if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-        OS_TRACE_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
        *p_err = OS_ERR_OS_NOT_RUNNING;
-        return;
+        return (0u);
     }
 #endif
 
 #if (OS_CFG_ARG_CHK_EN > 0u)
-    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
-        OS_TRACE_Q_POST_FAILED(p_q);
-        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
        *p_err = OS_ERR_OBJ_PTR_NULL;
-        return;
+        return (0u);
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_POST_FIFO:
-        case OS_OPT_POST_LIFO:
-        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
-        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
-        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
-        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+    if (p_msgs == (OS_MSG_INFO *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (nbr_msgs == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
              break;
 
         default:
-             OS_TRACE_Q_POST_FAILED(p_q);
-             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
-            *p_err =  OS_ERR_OPT_INVALID;
-             return;
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
     }
 #endif
 
 #if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
     if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
-        OS_TRACE_Q_POST_FAILED(p_q);
-        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
        *p_err = OS_ERR_OBJ_TYPE;
-        return;
+        return (0u);
     }
 #endif
-#if (OS_CFG_TS_EN > 0u)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
-#else
-    ts = 0u;
-#endif
 
-    OS_TRACE_Q_POST(p_q);
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
 
     CPU_CRITICAL_ENTER();
-    p_pend_list = &p_q->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on message queue?                   */
-        if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* Determine whether we post FIFO or LIFO               */
-            post_type = OS_OPT_POST_FIFO;
-        } else {
-            post_type = OS_OPT_POST_LIFO;
-        }
-        OS_MsgQPut(&p_q->MsgQ,                                  /* Place message in the message queue                   */
-                   p_void,
-                   msg_size,
-                   post_type,
-                   ts,
-                   p_err);
+    nbr_got = OS_MsgQGetMulti(&p_q->MsgQ,                       /* Any messages waiting in the message queue?           */
+                              p_msgs,
+                              nbr_msgs,
+                              p_ts);
+    if (nbr_got > 0u) {
         CPU_CRITICAL_EXIT();
-        OS_TRACE_Q_POST_EXIT(*p_err);
-        return;
+       *p_err = OS_ERR_NONE;
+        return (nbr_got);                                       /* Yes, Return messages received                        */
     }
 
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
-        OS_Post((OS_PEND_OBJ *)((void *)p_q),
-                p_tcb,
-                p_void,
-                msg_size,
-                ts);
-        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
-            break;                                              /* No                                                   */
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
         }
-        p_tcb = p_tcb_next;
     }
 
-    CPU_CRITICAL_EXIT();
+    OS_Pend((OS_PEND_OBJ *)((void *)p_q),                       /* Block task pending on Message Queue                  */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_Q,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
+             p_msgs[0].MsgPtr  = OSTCBCurPtr->MsgPtr;
+             p_msgs[0].MsgSize = OSTCBCurPtr->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             nbr_got = 1u;
+             if (nbr_msgs > 1u) {                               /* Also take the messages queued behind it              */
+                 nbr_got += OS_MsgQGetMulti(&p_q->MsgQ,
+                                            &p_msgs[1],
+                                            (OS_MSG_QTY)(nbr_msgs - 1u),
+                                            (CPU_TS *)0);
+             }
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (nbr_got);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          GIVE A QUEUE ITS OWN POOL OF 'OS_MSG'
+*
+* Description: This function makes a message queue take its OS_MSGs from 'p_pool' instead of the global pool, so that
+*              the messages of the other queues cannot use up its capacity.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_pool        is a pointer to a pool made by OSMsgPoolCreate(), or a NULL pointer to return to the
+*                            global pool.  Several queues may share one pool.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The queue now uses 'p_pool'
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_Q_NOT_EMPTY       If the queue holds messages
+*                                OS_ERR_SET_ISR           If you called this function from an ISR
+*
+* Returns    : None
+*
+* Note(s)    : 1) See 'os_msg.c  Note #1'.  A queue with 'nbr_msgs' OS_MSGs of its own in 'p_pool' always has room for
+*                 'nbr_msgs' messages.  OSQDel() returns the queue to the global pool.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+void  OSQPoolSet (OS_Q         *p_q,
+                  OS_MSG_POOL  *p_pool,
+                  OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't change the pool from an ISR                    */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (p_pool == (OS_MSG_POOL *)0) {                           /* Back to the global pool                              */
+        p_pool = &OSMsgPool;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_q->MsgQ.NbrEntries > 0u) {                            /* Queued OS_MSGs belong to the current pool            */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_Q_NOT_EMPTY;
+        return;
+    }
+    p_q->MsgQ.PoolPtr = p_pool;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               POST MESSAGE TO A QUEUE
+*
+* Description: This function sends a message to a queue.  With the 'opt' argument, you can specify whether the message
+*              is broadcast to all waiting tasks and/or whether you post the message to the front of the queue (LIFO)
+*              or normally (FIFO) at the end of the queue.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue.  This option
+*                                                         can be added to either OS_OPT_POST_FIFO or OS_OPT_POST_LIFO
+*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO) and wake up a single
+*                                                         waiting task.
+*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO) and wake up
+*                                                         a single waiting task.
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
+*                                     2) OS_OPT_POST_ALL      can be added (or OR'd) with one of the other options.
+*                                     3) Possible combination of options are:
+*
+*                                        OS_OPT_POST_FIFO
+*                                        OS_OPT_POST_LIFO
+*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL
+*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL
+*                                        OS_OPT_POST_FIFO + OS_OPT_POST_NO_SCHED
+*                                        OS_OPT_POST_LIFO + OS_OPT_POST_NO_SCHED
+*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
+*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the message was sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_Q_MAX             If the queue is full
+*                                OS_ERR_INT_Q_FULL        If called from an ISR and the ISR queue is full
+*
+* Returns    : None
+*
+* Note(s)    : 1) When OS_CFG_ISR_POST_EN is enabled, a post made from an ISR is only recorded in the ISR queue; the ISR
+*                 handler task performs it later.
+************************************************************************************************************************
+*/
+
+void  OSQPost (OS_Q         *p_q,
+               void         *p_void,
+               OS_MSG_SIZE   msg_size,
+               OS_OPT        opt,
+               OS_ERR       *p_err)
+{
+    CPU_TS  ts;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+             break;
+
+        default:
+             OS_TRACE_Q_POST_FAILED(p_q);
+             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_TRACE_Q_POST(p_q);
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR ...                        */
+        OS_IntQPost(OS_OBJ_TYPE_Q,                              /* ... defer the post to the ISR handler task           */
+                    p_q,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return;
+    }
+#endif
+
+    OS_QPost(p_q,
+             p_void,
+             msg_size,
+             opt,
+             ts,
+             p_err);
+    OS_TRACE_Q_POST_EXIT(*p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              POST A BUFFER TO A QUEUE
+*
+* Description: This function sends a buffer chain to a queue, handing the caller's reference to the task that gets it
+*              with OSQPendBuf().
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_buf         is a pointer to the first buffer of the chain
+*
+*              opt           determines the type of POST performed, see OSQPost().  OS_OPT_POST_ALL is not allowed:
+*                            the reference can only go to one task.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the buffer was sent
+*                                OS_ERR_BUF_INVALID_P_BUF If you passed a NULL pointer for 'p_buf'
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_Q_MAX             If the queue is full
+*                                OS_ERR_INT_Q_FULL        If called from an ISR and the ISR queue is full
+*
+* Returns    : none
+*
+* Note(s)    : 1) The caller's reference is passed on whatever the outcome: when the post fails, the chain is released.
+*                 With OS_CFG_ISR_POST_EN, a post from an ISR that fails when the ISR handler task replays it also
+*                 releases the chain.  See 'os_buf.c  Note #4'.
+*
+*              2) The size of the message is the '.TotLen' of the chain.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_BUF_EN > 0u)
+void  OSQPostBuf (OS_Q    *p_q,
+                  OS_BUF  *p_buf,
+                  OS_OPT   opt,
+                  OS_ERR  *p_err)
+{
+    CPU_TS  ts;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_BUF *)0) {                                 /* Validate 'p_buf'                                     */
+       *p_err = OS_ERR_BUF_INVALID_P_BUF;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_BufRelease(p_buf);                                   /* See Note #1                                          */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+        OS_BufRelease(p_buf);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_BufRelease(p_buf);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_BufRelease(p_buf);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR ...                        */
+        OS_IntQPost(OS_OBJ_TYPE_BUF,                            /* ... defer the post to the ISR handler task           */
+                    p_q,
+                    p_buf,
+                    p_buf->TotLen,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        if (*p_err != OS_ERR_NONE) {
+            OS_BufRelease(p_buf);
+        }
+        return;
+    }
+#endif
+
+    OS_QPost(p_q,
+             p_buf,
+             p_buf->TotLen,
+             opt,
+             ts,
+             p_err);
+    if (*p_err != OS_ERR_NONE) {
+        OS_BufRelease(p_buf);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          POST SEVERAL MESSAGES TO A QUEUE
+*
+* Description: This function sends an array of messages to a queue in one call.  The result is the same as calling
+*              OSQPost() for each message, in order, with OS_OPT_POST_NO_SCHED, followed by one call to the scheduler.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_msgs        is a pointer to an array of 'nbr_msgs' messages and their sizes
+*
+*              nbr_msgs      is the number of messages to send
+*
+*              opt           determines the type of POST performed, see OSQPost()
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and all the messages were sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place a message into
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_PTR_INVALID       If 'p_msgs' is a NULL pointer
+*                                OS_ERR_Q_MAX             If the queue is full
+*                                OS_ERR_Q_SIZE            If 'nbr_msgs' is 0
+*                                OS_ERR_INT_Q_FULL        If called from an ISR and the ISR queue is full
+*
+* Returns    : The number of messages sent.  On an error, the messages from that one onward were not sent.
+*
+* Note(s)    : 1) The messages are all sent in one critical section, so interrupts are disabled for a time proportional
+*                 to 'nbr_msgs'.
+*
+*              2) When OS_CFG_ISR_POST_EN is enabled, a post made from an ISR records one entry per message in the ISR
+*                 queue.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY  OSQPostMulti (OS_Q         *p_q,
+                          OS_MSG_INFO  *p_msgs,
+                          OS_MSG_QTY    nbr_msgs,
+                          OS_OPT        opt,
+                          OS_ERR       *p_err)
+{
+    CPU_TS      ts;
+#if (OS_CFG_ISR_POST_EN > 0u)
+    OS_MSG_QTY  nbr_posted;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
 
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();                                              /* Run the scheduler                                    */
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_msgs == (OS_MSG_INFO *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (nbr_msgs == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
     }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+             break;
 
-   *p_err = OS_ERR_NONE;
-    OS_TRACE_Q_POST_EXIT(*p_err);
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR ...                        */
+        for (nbr_posted = 0u; nbr_posted < nbr_msgs; nbr_posted++) {
+            OS_IntQPost(OS_OBJ_TYPE_Q,                          /* ... defer each post to the ISR handler task          */
+                        p_q,
+                        p_msgs[nbr_posted].MsgPtr,
+                        p_msgs[nbr_posted].MsgSize,
+                        0u,
+                        opt,
+                        ts,
+                        p_err);
+            if (*p_err != OS_ERR_NONE) {
+                break;
+            }
+        }
+        return (nbr_posted);
+    }
+#endif
+
+    return (OS_QPostMulti(p_q,
+                          p_msgs,
+                          nbr_msgs,
+                          opt,
+                          ts,
+                          p_err));
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          TAKE THE BUFFERS OUT OF A QUEUE
+*
+* Description: This function moves the messages of a queue used with OSQPostBuf() to a local list, which is then passed
+*              to OS_QBufRelease().  The queue is left empty.
+*
+* Argument(s): p_q        is a pointer to the queue
+*
+*              p_msg_q    is a pointer to the local list that receives the messages
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called within a critical section.  The OS_MSGs stay in use until
+*                 OS_QBufRelease() returns them, one at a time, to the pool of the queue.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_BUF_EN > 0u)
+void  OS_QBufDetach (OS_Q      *p_q,
+                     OS_MSG_Q  *p_msg_q)
+{
+   *p_msg_q                  =  p_q->MsgQ;                      /* The list keeps the pool of the queue                 */
+    p_q->MsgQ.NbrEntries     =           0u;
+#if (OS_CFG_DBG_EN > 0u)
+    p_q->MsgQ.NbrEntriesMax  =           0u;
+#endif
+    p_q->MsgQ.InPtr          = (OS_MSG *)0;
+    p_q->MsgQ.OutPtr         = (OS_MSG *)0;
+}
+
+
+/*
+************************************************************************************************************************
+*                                      RELEASE THE BUFFERS TAKEN OUT OF A QUEUE
+*
+* Description: This function releases the buffer chains of a list filled by OS_QBufDetach() and returns its OS_MSGs to
+*              their pool.
+*
+* Argument(s): p_msg_q    is a pointer to the list
+*
+* Returns    : The number of buffer chains released.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts enabled, see 'OSQFlushBuf()  Note #2'.
+************************************************************************************************************************
+*/
+
+OS_MSG_QTY  OS_QBufRelease (OS_MSG_Q  *p_msg_q)
+{
+    OS_BUF       *p_buf;
+    OS_MSG_SIZE   msg_size;
+    OS_MSG_QTY    qty;
+    OS_ERR        err;
+    CPU_SR_ALLOC();
+
+
+    qty = 0u;
+    for (;;) {
+        CPU_CRITICAL_ENTER();
+        p_buf = (OS_BUF *)OS_MsgQGet(p_msg_q,                   /* Return the OS_MSG to the pool of the queue           */
+                                    &msg_size,
+                                     (CPU_TS *)0,
+                                    &err);
+        CPU_CRITICAL_EXIT();
+        if (err != OS_ERR_NONE) {                               /* List empty?                                          */
+            break;
+        }
+        OS_BufRelease(p_buf);                                   /* Drop the reference the queue held                    */
+        qty++;
+    }
+    return (qty);
 }
+#endif
 
 
 /*
@@ -986,4 +1760,192 @@ void  OS_QDbgListRemove (OS_Q  *p_q)
     }
 }
 #endif
+
+
+/*
+************************************************************************************************************************
+*                                               POST MESSAGE TO A QUEUE
+*
+* Description: This function sends a message to a queue.  It is called by OSQPost() and by the ISR handler task when it
+*              replays a post deferred by an ISR.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*              ---
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed (see OSQPost())
+*
+*              ts            is the timestamp of the post
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the message was sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_Q_MAX             If the queue is full
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_QPost (OS_Q         *p_q,
+               void         *p_void,
+               OS_MSG_SIZE   msg_size,
+               OS_OPT        opt,
+               CPU_TS        ts,
+               OS_ERR       *p_err)
+{
+    OS_OPT         post_type;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_next;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_q->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on message queue?                   */
+        if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* Determine whether we post FIFO or LIFO               */
+            post_type = OS_OPT_POST_FIFO;
+        } else {
+            post_type = OS_OPT_POST_LIFO;
+        }
+        OS_MsgQPut(&p_q->MsgQ,                                  /* Place message in the message queue                   */
+                   p_void,
+                   msg_size,
+                   post_type,
+                   ts,
+                   p_err);
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    p_tcb = p_pend_list->HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        p_tcb_next = p_tcb->PendNextPtr;
+        OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                p_tcb,
+                p_void,
+                msg_size,
+                ts);
+        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = p_tcb_next;
+    }
+
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          POST SEVERAL MESSAGES TO A QUEUE
+*
+* Description: This function sends an array of messages to a queue.  It is called by OSQPostMulti().
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*              ---
+*
+*              p_msgs        is a pointer to an array of 'nbr_msgs' messages and their sizes
+*
+*              nbr_msgs      is the number of messages to send
+*
+*              opt           determines the type of POST performed (see OSQPost())
+*
+*              ts            is the timestamp of the post
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the messages were sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place a message into
+*                                OS_ERR_Q_MAX             If the queue is full
+*
+* Returns    : The number of messages sent
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Each message goes to the highest priority waiting task (or to all of them, with OS_OPT_POST_ALL) while
+*                 there is one, and to the message queue after that.  The scheduler runs once, at the end, if a task was
+*                 readied.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY  OS_QPostMulti (OS_Q         *p_q,
+                           OS_MSG_INFO  *p_msgs,
+                           OS_MSG_QTY    nbr_msgs,
+                           OS_OPT        opt,
+                           CPU_TS        ts,
+                           OS_ERR       *p_err)
+{
+    OS_OPT         post_type;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_next;
+    OS_MSG_QTY     nbr_posted;
+    CPU_BOOLEAN    sched;
+    CPU_SR_ALLOC();
+
+
+    if ((opt & OS_OPT_POST_LIFO) == 0u) {                       /* Determine whether we post FIFO or LIFO               */
+        post_type = OS_OPT_POST_FIFO;
+    } else {
+        post_type = OS_OPT_POST_LIFO;
+    }
+    sched      = OS_FALSE;
+    nbr_posted = 0u;
+   *p_err      = OS_ERR_NONE;
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_q->PendList;
+    while (nbr_posted < nbr_msgs) {
+        p_tcb = p_pend_list->HeadPtr;
+        if (p_tcb == (OS_TCB *)0) {                             /* Any task waiting on message queue?                   */
+            OS_MsgQPut(&p_q->MsgQ,                              /* No, place message in the message queue               */
+                       p_msgs[nbr_posted].MsgPtr,
+                       p_msgs[nbr_posted].MsgSize,
+                       post_type,
+                       ts,
+                       p_err);
+            if (*p_err != OS_ERR_NONE) {
+                break;
+            }
+        } else {
+            while (p_tcb != (OS_TCB *)0) {                      /* Yes, hand the message over                           */
+                p_tcb_next = p_tcb->PendNextPtr;
+                OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                        p_tcb,
+                        p_msgs[nbr_posted].MsgPtr,
+                        p_msgs[nbr_posted].MsgSize,
+                        ts);
+                if ((opt & OS_OPT_POST_ALL) == 0u)  {           /* Post message to all tasks waiting?                   */
+                    break;                                      /* No                                                   */
+                }
+                p_tcb = p_tcb_next;
+            }
+            sched = OS_TRUE;
+        }
+        nbr_posted++;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((sched == OS_TRUE) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+    return (nbr_posted);
+}
+#endif
 #endif
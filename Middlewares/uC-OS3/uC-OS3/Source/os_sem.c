@@ -677,10 +677,14 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 *                           OS_ERR_OPT_INVALID       If you specified an invalid option
 *                           OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
 *                           OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
+*                           OS_ERR_INT_Q_FULL        If called from an ISR and the ISR queue is full
 *
-* Returns    : The current value of the semaphore counter or 0 upon error.
+* Returns    : The current value of the semaphore counter or 0 upon error or if called from an ISR.
 *
 * Note(s)    : 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*
+*              2) When OS_CFG_ISR_POST_EN is enabled, a post made from an ISR is only recorded in the ISR queue; the ISR
+*                 handler task performs it later.
 ************************************************************************************************************************
 */
 
@@ -688,12 +692,8 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
                        OS_OPT   opt,
                        OS_ERR  *p_err)
 {
-    OS_SEM_CTR     ctr;
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
-    CPU_TS         ts;
-    CPU_SR_ALLOC();
+    OS_SEM_CTR  ctr;
+    CPU_TS      ts;
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -750,47 +750,28 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
 #endif
 
     OS_TRACE_SEM_POST(p_sem);
-    CPU_CRITICAL_ENTER();
-    p_pend_list = &p_sem->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
-        if (p_sem->Ctr == (OS_SEM_CTR)-1) {
-           CPU_CRITICAL_EXIT();
-          *p_err = OS_ERR_SEM_OVF;
-           OS_TRACE_SEM_POST_EXIT(*p_err);
-           return (0u);
-        }
-        p_sem->Ctr++;                                           /* No                                                   */
-        ctr       = p_sem->Ctr;
-#if (OS_CFG_TS_EN > 0u)
-        p_sem->TS = ts;                                         /* Save timestamp in semaphore control block            */
-#endif
-        CPU_CRITICAL_EXIT();
-       *p_err     = OS_ERR_NONE;
-        OS_TRACE_SEM_POST_EXIT(*p_err);
-        return (ctr);
-    }
 
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
-        OS_Post((OS_PEND_OBJ *)((void *)p_sem),
-                p_tcb,
-                (void *)0,
-                0u,
-                ts);
-        if ((opt & OS_OPT_POST_ALL) == 0u) {                     /* Post to all tasks waiting?                           */
-            break;                                              /* No                                                   */
-        }
-        p_tcb = p_tcb_next;
-    }
-    CPU_CRITICAL_EXIT();
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();                                              /* Run the scheduler                                    */
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR ...                        */
+        OS_IntQPost(OS_OBJ_TYPE_SEM,                            /* ... defer the post to the ISR handler task           */
+                    p_sem,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
     }
-   *p_err = OS_ERR_NONE;
+#endif
 
+    ctr = OS_SemPost(p_sem,
+                     opt,
+                     ts,
+                     p_err);
     OS_TRACE_SEM_POST_EXIT(*p_err);
-    return (0u);
+    return (ctr);
 }
 
 
@@ -965,4 +946,81 @@ void  OS_SemDbgListRemove (OS_SEM  *p_sem)
     }
 }
 #endif
+
+
+/*
+************************************************************************************************************************
+*                                                 POST TO A SEMAPHORE
+*
+* Description: This function signals a semaphore.  It is called by OSSemPost() and by the ISR handler task when it
+*              replays a post deferred by an ISR.
+*
+* Arguments  : p_sem    is a pointer to the semaphore
+*              -----
+*
+*              opt      determines the type of POST performed (see OSSemPost())
+*
+*              ts       is the timestamp of the post
+*
+*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE              The call was successful and the semaphore was signaled
+*                           OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
+*
+* Returns    : The current value of the semaphore counter or 0 if tasks were waiting or upon error.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem,
+                        OS_OPT   opt,
+                        CPU_TS   ts,
+                        OS_ERR  *p_err)
+{
+    OS_SEM_CTR     ctr;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_next;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_sem->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
+        if (p_sem->Ctr == (OS_SEM_CTR)-1) {
+           CPU_CRITICAL_EXIT();
+          *p_err = OS_ERR_SEM_OVF;
+           return (0u);
+        }
+        p_sem->Ctr++;                                           /* No                                                   */
+        ctr       = p_sem->Ctr;
+#if (OS_CFG_TS_EN > 0u)
+        p_sem->TS = ts;                                         /* Save timestamp in semaphore control block            */
+#endif
+        CPU_CRITICAL_EXIT();
+       *p_err     = OS_ERR_NONE;
+        return (ctr);
+    }
+
+    p_tcb = p_pend_list->HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        p_tcb_next = p_tcb->PendNextPtr;
+        OS_Post((OS_PEND_OBJ *)((void *)p_sem),
+                p_tcb,
+                (void *)0,
+                0u,
+                ts);
+        if ((opt & OS_OPT_POST_ALL) == 0u) {                     /* Post to all tasks waiting?                           */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = p_tcb_next;
+    }
+    CPU_CRITICAL_EXIT();
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+    return (0u);
+}
 #endif
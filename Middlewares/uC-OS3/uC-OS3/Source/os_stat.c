@@ -59,6 +59,9 @@ void  OSStatReset (OS_ERR  *p_err)
 #if (OS_CFG_Q_EN > 0u)
     OS_Q        *p_q;
 #endif
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u) && (OS_MSG_EN > 0u)
+    OS_MSG_POOL *p_pool;
+#endif
 #endif
     CPU_SR_ALLOC();
 
@@ -91,6 +94,16 @@ void  OSStatReset (OS_ERR  *p_err)
 #endif
 #endif
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+    OSIntQNbrEntriesMax   = 0u;
+    OSIntQOvfCtr          = 0u;
+    OSIntQRePostFailCtr   = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    OSIntQLatencyMax      = 0u;
+    OSIntQTaskTimeMax     = 0u;
+#endif
+#endif
+
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
 #if (OS_CFG_TS_EN > 0u)
     OSIntDisTimeMax       = 0u;                                 /* Reset the maximum interrupt disable time             */
@@ -104,6 +117,7 @@ void  OSStatReset (OS_ERR  *p_err)
 
 #if ((OS_MSG_EN > 0u) && (OS_CFG_DBG_EN > 0u))
     OSMsgPool.NbrUsedMax  = 0u;
+    OSMsgPool.EmptyCtr    = 0u;
 #endif
     CPU_CRITICAL_EXIT();
 
@@ -159,6 +173,19 @@ void  OSStatReset (OS_ERR  *p_err)
     }
 #endif
 
+#if (OS_CFG_MSG_POOL_PRIV_EN > 0u) && (OS_MSG_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    p_pool = OSMsgPoolDbgListPtr;
+    CPU_CRITICAL_EXIT();
+    while (p_pool != (OS_MSG_POOL *)0) {                        /* Reset OS_MSG pools statistics                        */
+        CPU_CRITICAL_ENTER();
+        p_pool->NbrUsedMax = 0u;
+        p_pool->EmptyCtr   = 0u;
+        p_pool             = p_pool->DbgNextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+#endif
+
 
    *p_err = OS_ERR_NONE;
 }
@@ -0,0 +1,1373 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       STREAM BUFFER MANAGEMENT
+*
+* File    : os_stream.c
+* Version : V3.08.01
+*********************************************************************************************************
+* Note(s) : (1) A stream buffer carries bytes from ONE writer (typically an ISR) to ONE reader task through a
+*               ring supplied by the application.  The writer only moves '.In' and the reader only moves '.Out',
+*               so copying data in and out of the ring needs no critical section.  Using a stream buffer with
+*               more than one writer or more than one reader requires an external lock.
+*
+*           (2) The reader is only woken up once the ring holds its pend level: the trigger level of the stream,
+*               or the number of bytes asked for if smaller.  A write that does not reach the pend level only
+*               costs the copy and a test of the pend list.
+*
+*           (3) With OS_CFG_ISR_POST_EN, a write from an ISR that reaches the pend level defers the wake-up to
+*               the ISR handler task.  At most one wake-up per stream is in the ISR queue at any time.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_stream__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_STREAM_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL FUNCTIONS
+************************************************************************************************************************
+*/
+
+static  void         OS_StreamCopy   (CPU_INT08U   *p_dest,
+                                      CPU_INT08U   *p_src,
+                                      OS_MSG_SIZE   len);
+
+static  OS_MSG_SIZE  OS_StreamPend   (OS_STREAM    *p_stream,
+                                      OS_MSG_SIZE   level,
+                                      OS_TICK       timeout,
+                                      OS_OPT        opt,
+                                      CPU_TS       *p_ts,
+                                      OS_ERR       *p_err);
+
+static  void         OS_StreamSignal (OS_STREAM    *p_stream,
+                                      OS_OPT        opt,
+                                      OS_ERR       *p_err);
+
+
+/*
+************************************************************************************************************************
+*                                               CREATE A STREAM BUFFER
+*
+* Description: This function is called by your application to create a stream buffer.  Stream buffers MUST be created
+*              before they can be used.
+*
+* Arguments  : p_stream        is a pointer to the stream buffer
+*
+*              p_name          is a pointer to an ASCII string that will be used to name the stream buffer
+*
+*              p_buf           is a pointer to the storage of the ring.  Your application is responsible for
+*                              allocating it.
+*
+*              size            is the size of 'p_buf' in bytes.  It must be a power of 2 and, with a 16-bit
+*                              OS_MSG_SIZE, not larger than 32768.
+*
+*              trigger_level   is the number of bytes that must be in the ring before a waiting reader is woken up
+*                              (1 to 'size').
+*
+*              p_err           is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                  OS_ERR_NONE                    The call was successful
+*                                  OS_ERR_CREATE_ISR              Can't create from an ISR
+*                                  OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the stream buffer after
+*                                                                   you called OSSafetyCriticalStart()
+*                                  OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_stream'
+*                                  OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_buf'
+*                                  OS_ERR_STREAM_SIZE_INVALID     If 'size' is 0, not a power of 2 or too large
+*                                  OS_ERR_STREAM_TRIGGER_INVALID  If 'trigger_level' is 0 or larger than 'size'
+*                                  OS_ERR_OBJ_CREATED             If the stream buffer was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSStreamCreate (OS_STREAM    *p_stream,
+                      CPU_CHAR     *p_name,
+                      CPU_INT08U   *p_buf,
+                      OS_MSG_SIZE   size,
+                      OS_MSG_SIZE   trigger_level,
+                      OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_buf == (CPU_INT08U *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if ((size == 0u) ||                                         /* Size must be a power of 2 ...                        */
+        ((size & (size - 1u)) != 0u) ||
+        (size > (((OS_MSG_SIZE)-1 >> 1u) + 1u))) {              /* ... that '.In - .Out' can hold                       */
+       *p_err = OS_ERR_STREAM_SIZE_INVALID;
+        return;
+    }
+    if ((trigger_level == 0u) ||
+        (trigger_level > size)) {
+       *p_err = OS_ERR_STREAM_TRIGGER_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_stream->Type == OS_OBJ_TYPE_STREAM) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_stream->Type         = OS_OBJ_TYPE_STREAM;                /* Mark the data structure as a stream buffer           */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_stream->NamePtr      = p_name;
+#else
+    (void)p_name;
+#endif
+    p_stream->BufPtr       = p_buf;
+    p_stream->Size         = size;
+    p_stream->TriggerLevel = trigger_level;
+    p_stream->PendLevel    = trigger_level;
+    p_stream->In           = 0u;                                /* The ring is empty                                    */
+    p_stream->Out          = 0u;
+#if (OS_CFG_ISR_POST_EN > 0u)
+    p_stream->PostPend     = OS_FALSE;
+#endif
+    p_stream->OvfCtr       = 0u;
+#if (OS_CFG_DBG_EN > 0u)
+    p_stream->NbrBytesMax  = 0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    p_stream->TS           = 0u;
+#endif
+    OS_PendListInit(&p_stream->PendList);                       /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_StreamDbgListAdd(p_stream);
+    OSStreamQty++;
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               DELETE A STREAM BUFFER
+*
+* Description: This function deletes a stream buffer.  The bytes still in the ring are discarded.
+*
+* Arguments  : p_stream      is a pointer to the stream buffer to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the stream buffer ONLY if the reader is not waiting
+*                                OS_OPT_DEL_ALWAYS           Deletes the stream buffer even if the reader is waiting.
+*                                                            In this case, the reader will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the stream was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the stream from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the stream buffer after
+*                                                                 you called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_stream' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_stream' is not pointing at a stream buffer
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            The reader was waiting on the stream buffer
+*
+* Returns    : == 0          if the reader was not waiting on the stream buffer, or upon error.
+*              >  0          if the reader was waiting on the stream buffer and is now readied and informed.
+*
+* Note(s)    : 1) The writer MUST NOT use the stream buffer once it is deleted.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STREAM_DEL_EN > 0u)
+OS_OBJ_QTY  OSStreamDel (OS_STREAM  *p_stream,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a stream buffer from an ISR    */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate 'p_stream'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream buffer was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_stream->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete stream buffer only if reader not waiting      */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_StreamDbgListRemove(p_stream);
+                 OSStreamQty--;
+#endif
+                 OS_StreamClr(p_stream);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the stream buffer                      */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove the reader from the pend list                 */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_StreamDbgListRemove(p_stream);
+             OSStreamQty--;
+#endif
+             OS_StreamClr(p_stream);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             READ FROM A STREAM BUFFER
+*
+* Description: This function copies bytes out of a stream buffer.  If the ring holds fewer bytes than the pend level,
+*              the caller waits until the writer brings it to that level or until the timeout expires.
+*
+* Arguments  : p_stream      is a pointer to the stream buffer
+*
+*              p_data        is a pointer to where the bytes will be copied
+*
+*              len           is the maximum number of bytes to read.  The pend level is the smaller of 'len' and the
+*                            trigger level of the stream buffer.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            data up to the amount of time (in 'ticks') specified by this argument.  If you specify 0,
+*                            however, your task will wait forever for the data.
+*
+*              opt           determines whether the user wants to block if the pend level is not reached:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the reader was woken up
+*                            by the writer or the stream buffer deleted.  It receives 0 if the caller did not wait.
+*                            Passing a NULL pointer is valid and indicates that you don't need the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The pend level was reached
+*                                OS_ERR_OBJ_DEL            If 'p_stream' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_stream' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_stream' is not pointing at a stream buffer
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                                          would lead to a suspension
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the pend level was not
+*                                                          reached
+*                                OS_ERR_PTR_INVALID        If 'p_data' is a NULL pointer
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            The pend level was not reached within the timeout
+*
+* Returns    : The number of bytes copied to 'p_data'.  With OS_ERR_TIMEOUT and OS_ERR_PEND_WOULD_BLOCK, the bytes that
+*              were in the ring are still returned.
+*
+* Note(s)    : 1) Only ONE task may read from a stream buffer.
+*
+*              2) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+OS_MSG_SIZE  OSStreamRead (OS_STREAM    *p_stream,
+                           CPU_INT08U   *p_data,
+                           OS_MSG_SIZE   len,
+                           OS_TICK       timeout,
+                           OS_OPT        opt,
+                           CPU_TS       *p_ts,
+                           OS_ERR       *p_err)
+{
+    OS_MSG_SIZE  level;
+    OS_MSG_SIZE  nbr_bytes;
+    OS_MSG_SIZE  out;
+    OS_MSG_SIZE  ix;
+    OS_MSG_SIZE  nbr_first;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_data == (CPU_INT08U *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream buffer was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    level = p_stream->TriggerLevel;
+    if (level > len) {                                          /* Don't wait for more than the caller wants            */
+        level = len;
+    }
+    nbr_bytes = OS_StreamPend(p_stream,
+                              level,
+                              timeout,
+                              opt,
+                              p_ts,
+                              p_err);
+    switch (*p_err) {
+        case OS_ERR_NONE:
+        case OS_ERR_TIMEOUT:                                    /* Return what arrived before the timeout               */
+        case OS_ERR_PEND_WOULD_BLOCK:
+             break;
+
+        default:
+             return (0u);
+    }
+
+    if (nbr_bytes > len) {
+        nbr_bytes = len;
+    }
+    out       = p_stream->Out;
+    ix        = out & (OS_MSG_SIZE)(p_stream->Size - 1u);
+    nbr_first = p_stream->Size - ix;                            /* Bytes up to the end of the ring                      */
+    if (nbr_first > nbr_bytes) {
+        nbr_first = nbr_bytes;
+    }
+    OS_StreamCopy(p_data,
+                 &p_stream->BufPtr[ix],
+                  nbr_first);
+    OS_StreamCopy(&p_data[nbr_first],                           /* Wrap around to the start of the ring                 */
+                  &p_stream->BufPtr[0],
+                  nbr_bytes - nbr_first);
+    CPU_MB();                                                   /* Finish reading the bytes before freeing them         */
+    p_stream->Out = out + nbr_bytes;
+
+    return (nbr_bytes);
+}
+
+
+/*
+************************************************************************************************************************
+*                                       RESERVE THE DATA OF A STREAM BUFFER
+*
+* Description: This function gives the reader direct access to the bytes in the ring, without copying them.  If the
+*              ring holds fewer bytes than the trigger level, the caller waits until the writer brings it to that level
+*              or until the timeout expires.  The bytes stay in the ring until OSStreamReadCommit() is called.
+*
+* Arguments  : p_stream      is a pointer to the stream buffer
+*
+*              timeout       is an optional timeout period (in clock ticks), see OSStreamRead()
+*
+*              opt           determines whether the user wants to block if the trigger level is not reached:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_size        is a pointer to a variable that will receive the number of contiguous bytes available at
+*                            the returned address
+*
+*              p_ts          is a pointer to a variable that will receive a timestamp, see OSStreamRead()
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*                            The codes are those of OSStreamRead(), with OS_ERR_PTR_INVALID if 'p_size' is a NULL
+*                            pointer.
+*
+* Returns    : A pointer to the oldest byte in the ring, or a NULL pointer if the ring is empty or upon error.
+*
+* Note(s)    : 1) When the data wraps around the end of the ring, '*p_size' only covers the bytes up to the end.  The
+*                 rest is returned by the next call, once those bytes are committed.
+*
+*              2) Only ONE task may read from a stream buffer.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+CPU_INT08U  *OSStreamReadReserve (OS_STREAM    *p_stream,
+                                  OS_TICK       timeout,
+                                  OS_OPT        opt,
+                                  OS_MSG_SIZE  *p_size,
+                                  CPU_TS       *p_ts,
+                                  OS_ERR       *p_err)
+{
+    OS_MSG_SIZE  nbr_bytes;
+    OS_MSG_SIZE  ix;
+    OS_MSG_SIZE  nbr_first;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return ((CPU_INT08U *)0);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((CPU_INT08U *)0);
+    }
+    if (p_size == (OS_MSG_SIZE *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((CPU_INT08U *)0);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((CPU_INT08U *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream buffer was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+   *p_size    = 0u;
+    nbr_bytes = OS_StreamPend(p_stream,
+                              p_stream->TriggerLevel,
+                              timeout,
+                              opt,
+                              p_ts,
+                              p_err);
+    switch (*p_err) {
+        case OS_ERR_NONE:
+        case OS_ERR_TIMEOUT:                                    /* Return what arrived before the timeout               */
+        case OS_ERR_PEND_WOULD_BLOCK:
+             break;
+
+        default:
+             return ((CPU_INT08U *)0);
+    }
+    if (nbr_bytes == 0u) {
+        return ((CPU_INT08U *)0);
+    }
+
+    ix        = p_stream->Out & (OS_MSG_SIZE)(p_stream->Size - 1u);
+    nbr_first = p_stream->Size - ix;                            /* Bytes up to the end of the ring                      */
+    if (nbr_first > nbr_bytes) {
+        nbr_first = nbr_bytes;
+    }
+   *p_size = nbr_first;
+    return (&p_stream->BufPtr[ix]);
+}
+
+
+/*
+************************************************************************************************************************
+*                                  RELEASE RESERVED DATA BACK TO A STREAM BUFFER
+*
+* Description: This function frees the first 'len' bytes obtained with OSStreamReadReserve(), so that the writer can
+*              reuse their space.
+*
+* Arguments  : p_stream      is a pointer to the stream buffer
+*
+*              len           is the number of bytes consumed.  It may be smaller than the size that was reserved.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The bytes were freed
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_stream' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_stream' is not pointing at a stream buffer
+*                                OS_ERR_STREAM_COMMIT_INVALID   If 'len' is larger than the number of bytes in the ring
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSStreamReadCommit (OS_STREAM    *p_stream,
+                          OS_MSG_SIZE   len,
+                          OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (len > (OS_MSG_SIZE)(p_stream->In - p_stream->Out)) {
+       *p_err = OS_ERR_STREAM_COMMIT_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream buffer was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_MB();                                                   /* Finish reading the bytes before freeing them         */
+    p_stream->Out += len;
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              WRITE TO A STREAM BUFFER
+*
+* Description: This function copies bytes into a stream buffer and wakes up the reader if the ring reaches its pend
+*              level.  It never waits: the bytes that do not fit are dropped and counted in '.OvfCtr'.
+*
+* Arguments  : p_stream      is a pointer to the stream buffer
+*
+*              p_data        is a pointer to the bytes to write
+*
+*              len           is the number of bytes to write
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE          No option specified
+*                                OS_OPT_POST_NO_SCHED      Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               All the bytes were written
+*                                OS_ERR_INT_Q_FULL         If called from an ISR and the ISR queue is full.  The bytes
+*                                                          are in the ring but the reader was not woken up.
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_stream' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_stream' is not pointing at a stream buffer
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PTR_INVALID        If 'p_data' is a NULL pointer
+*                                OS_ERR_STREAM_FULL        If only part of the bytes fit in the ring
+*
+* Returns    : The number of bytes written.
+*
+* Note(s)    : 1) Only ONE task or ISR may write to a stream buffer.
+************************************************************************************************************************
+*/
+
+OS_MSG_SIZE  OSStreamWrite (OS_STREAM    *p_stream,
+                            CPU_INT08U   *p_data,
+                            OS_MSG_SIZE   len,
+                            OS_OPT        opt,
+                            OS_ERR       *p_err)
+{
+    OS_MSG_SIZE  in;
+    OS_MSG_SIZE  nbr_bytes;
+    OS_MSG_SIZE  nbr_free;
+    OS_MSG_SIZE  ix;
+    OS_MSG_SIZE  nbr_first;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_data == (CPU_INT08U *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream buffer was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    in        = p_stream->In;
+    nbr_free  = p_stream->Size - (OS_MSG_SIZE)(in - p_stream->Out);
+    nbr_bytes = len;
+    if (nbr_bytes > nbr_free) {                                 /* Drop what does not fit                               */
+        p_stream->OvfCtr += (OS_CTR)(nbr_bytes - nbr_free);
+        nbr_bytes         = nbr_free;
+    }
+    ix        = in & (OS_MSG_SIZE)(p_stream->Size - 1u);
+    nbr_first = p_stream->Size - ix;                            /* Room up to the end of the ring                       */
+    if (nbr_first > nbr_bytes) {
+        nbr_first = nbr_bytes;
+    }
+    OS_StreamCopy(&p_stream->BufPtr[ix],
+                   p_data,
+                   nbr_first);
+    OS_StreamCopy(&p_stream->BufPtr[0],                         /* Wrap around to the start of the ring                 */
+                  &p_data[nbr_first],
+                   nbr_bytes - nbr_first);
+    CPU_WMB();                                                  /* Store the bytes before publishing them               */
+    p_stream->In = in + nbr_bytes;
+#if (OS_CFG_DBG_EN > 0u)
+    if (p_stream->NbrBytesMax < (OS_MSG_SIZE)(in + nbr_bytes - p_stream->Out)) {
+        p_stream->NbrBytesMax = (OS_MSG_SIZE)(in + nbr_bytes - p_stream->Out);
+    }
+#endif
+
+    OS_StreamSignal(p_stream,                                   /* Wake up the reader if it has enough data             */
+                    opt,
+                    p_err);
+    if ((*p_err == OS_ERR_NONE) && (nbr_bytes < len)) {
+       *p_err = OS_ERR_STREAM_FULL;
+    }
+    return (nbr_bytes);
+}
+
+
+/*
+************************************************************************************************************************
+*                                     COMMIT DATA WRITTEN IN PLACE TO A STREAM BUFFER
+*
+* Description: This function publishes the first 'len' bytes written at the address returned by OSStreamWriteReserve()
+*              and wakes up the reader if the ring reaches its pend level.
+*
+* Arguments  : p_stream      is a pointer to the stream buffer
+*
+*              len           is the number of bytes written.  It may be smaller than the size that was reserved.
+*
+*              opt           determines the type of POST performed, see OSStreamWrite()
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The bytes were published
+*                                OS_ERR_INT_Q_FULL              If called from an ISR and the ISR queue is full.  The
+*                                                               bytes are in the ring but the reader was not woken up.
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_stream' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_stream' is not pointing at a stream buffer
+*                                OS_ERR_OPT_INVALID             If you specified an invalid option
+*                                OS_ERR_STREAM_COMMIT_INVALID   If 'len' is larger than the free space of the ring
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSStreamWriteCommit (OS_STREAM    *p_stream,
+                           OS_MSG_SIZE   len,
+                           OS_OPT        opt,
+                           OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (len > (OS_MSG_SIZE)(p_stream->Size - (OS_MSG_SIZE)(p_stream->In - p_stream->Out))) {
+       *p_err = OS_ERR_STREAM_COMMIT_INVALID;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream buffer was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_WMB();                                                  /* Store the bytes before publishing them               */
+    p_stream->In += len;
+#if (OS_CFG_DBG_EN > 0u)
+    if (p_stream->NbrBytesMax < (OS_MSG_SIZE)(p_stream->In - p_stream->Out)) {
+        p_stream->NbrBytesMax = (OS_MSG_SIZE)(p_stream->In - p_stream->Out);
+    }
+#endif
+
+    OS_StreamSignal(p_stream,                                   /* Wake up the reader if it has enough data             */
+                    opt,
+                    p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        RESERVE SPACE IN A STREAM BUFFER
+*
+* Description: This function gives the writer direct access to the free space of the ring, so that it can produce the
+*              data in place (e.g. from a DMA or a peripheral FIFO).  The bytes are published by OSStreamWriteCommit().
+*
+* Arguments  : p_stream      is a pointer to the stream buffer
+*
+*              p_size        is a pointer to a variable that will receive the number of contiguous bytes free at the
+*                            returned address
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The space was reserved
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_stream' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_stream' is not pointing at a stream buffer
+*                                OS_ERR_PTR_INVALID        If 'p_size' is a NULL pointer
+*                                OS_ERR_STREAM_FULL        If the ring is full
+*
+* Returns    : A pointer to the first free byte of the ring, or a NULL pointer if the ring is full or upon error.
+*
+* Note(s)    : 1) When the free space wraps around the end of the ring, '*p_size' only covers the bytes up to the end.
+*
+*              2) Only ONE task or ISR may write to a stream buffer.
+************************************************************************************************************************
+*/
+
+CPU_INT08U  *OSStreamWriteReserve (OS_STREAM    *p_stream,
+                                   OS_MSG_SIZE  *p_size,
+                                   OS_ERR       *p_err)
+{
+    OS_MSG_SIZE  nbr_free;
+    OS_MSG_SIZE  ix;
+    OS_MSG_SIZE  nbr_first;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((CPU_INT08U *)0);
+    }
+    if (p_size == (OS_MSG_SIZE *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream buffer was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+    nbr_free = p_stream->Size - (OS_MSG_SIZE)(p_stream->In - p_stream->Out);
+    if (nbr_free == 0u) {
+       *p_size = 0u;
+       *p_err  = OS_ERR_STREAM_FULL;
+        return ((CPU_INT08U *)0);
+    }
+    ix        = p_stream->In & (OS_MSG_SIZE)(p_stream->Size - 1u);
+    nbr_first = p_stream->Size - ix;                            /* Room up to the end of the ring                       */
+    if (nbr_first > nbr_free) {
+        nbr_first = nbr_free;
+    }
+   *p_size = nbr_first;
+   *p_err  = OS_ERR_NONE;
+    return (&p_stream->BufPtr[ix]);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        CLEAR THE CONTENTS OF A STREAM BUFFER
+*
+* Description: This function is called by OSStreamDel() to clear the contents of a stream buffer
+*
+* Argument(s): p_stream   is a pointer to the stream buffer to clear
+*              --------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_StreamClr (OS_STREAM  *p_stream)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_stream->Type         = OS_OBJ_TYPE_NONE;                  /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_stream->NamePtr      = (CPU_CHAR *)((void *)"?STREAM");
+#endif
+    p_stream->BufPtr       = (CPU_INT08U *)0;
+    p_stream->Size         = 0u;
+    p_stream->TriggerLevel = 0u;
+    p_stream->PendLevel    = 0u;
+    p_stream->In           = 0u;
+    p_stream->Out          = 0u;
+#if (OS_CFG_ISR_POST_EN > 0u)
+    p_stream->PostPend     = OS_FALSE;
+#endif
+    p_stream->OvfCtr       = 0u;
+#if (OS_CFG_DBG_EN > 0u)
+    p_stream->NbrBytesMax  = 0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    p_stream->TS           = 0u;
+#endif
+    OS_PendListInit(&p_stream->PendList);                       /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                     ADD/REMOVE STREAM BUFFER TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a stream buffer to/from the debug list.
+*
+* Arguments  : p_stream     is a pointer to the stream buffer to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_StreamDbgListAdd (OS_STREAM  *p_stream)
+{
+    p_stream->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_stream->DbgPrevPtr               = (OS_STREAM *)0;
+    if (OSStreamDbgListPtr == (OS_STREAM *)0) {
+        p_stream->DbgNextPtr           = (OS_STREAM *)0;
+    } else {
+        p_stream->DbgNextPtr           =  OSStreamDbgListPtr;
+        OSStreamDbgListPtr->DbgPrevPtr =  p_stream;
+    }
+    OSStreamDbgListPtr                 =  p_stream;
+}
+
+
+void  OS_StreamDbgListRemove (OS_STREAM  *p_stream)
+{
+    OS_STREAM  *p_stream_next;
+    OS_STREAM  *p_stream_prev;
+
+
+    p_stream_prev = p_stream->DbgPrevPtr;
+    p_stream_next = p_stream->DbgNextPtr;
+
+    if (p_stream_prev == (OS_STREAM *)0) {
+        OSStreamDbgListPtr = p_stream_next;
+        if (p_stream_next != (OS_STREAM *)0) {
+            p_stream_next->DbgPrevPtr = (OS_STREAM *)0;
+        }
+        p_stream->DbgNextPtr = (OS_STREAM *)0;
+
+    } else if (p_stream_next == (OS_STREAM *)0) {
+        p_stream_prev->DbgNextPtr = (OS_STREAM *)0;
+        p_stream->DbgPrevPtr      = (OS_STREAM *)0;
+
+    } else {
+        p_stream_prev->DbgNextPtr =  p_stream_next;
+        p_stream_next->DbgPrevPtr =  p_stream_prev;
+        p_stream->DbgNextPtr      = (OS_STREAM *)0;
+        p_stream->DbgPrevPtr      = (OS_STREAM *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         WAKE UP THE READER OF A STREAM BUFFER
+*
+* Description: This function readies the reader of a stream buffer if the ring holds its pend level.  It is called by
+*              the writer and by the ISR handler task when it replays a wake-up deferred by an ISR.
+*
+* Arguments  : p_stream     is a pointer to the stream buffer
+*              --------
+*
+*              opt          determines the type of POST performed (see OSStreamWrite())
+*
+*              ts           is the timestamp of the wake-up
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE              The call was successful
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The pend list and the level are tested again in the critical section: the reader may have timed out,
+*                 or consumed the data, since the writer tested them.
+************************************************************************************************************************
+*/
+
+void  OS_StreamPost (OS_STREAM  *p_stream,
+                     OS_OPT      opt,
+                     CPU_TS      ts,
+                     OS_ERR     *p_err)
+{
+    OS_TCB  *p_tcb;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_ISR_POST_EN > 0u)
+    p_stream->PostPend = OS_FALSE;
+#endif
+    p_tcb = p_stream->PendList.HeadPtr;
+    if ((p_tcb == (OS_TCB *)0) ||                               /* Is the reader waiting for the data in the ring?      */
+        ((OS_MSG_SIZE)(p_stream->In - p_stream->Out) < p_stream->PendLevel)) {
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    p_stream->TS = ts;
+#endif
+    OS_Post((OS_PEND_OBJ *)((void *)p_stream),
+            p_tcb,
+            (void *)0,
+            0u,
+            ts);
+    CPU_CRITICAL_EXIT();
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   COPY BYTES
+*
+* Description: This function copies bytes to or from the ring of a stream buffer.
+*
+* Arguments  : p_dest       is a pointer to the destination
+*
+*              p_src        is a pointer to the source
+*
+*              len          is the number of bytes to copy
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_StreamCopy (CPU_INT08U   *p_dest,
+                             CPU_INT08U   *p_src,
+                             OS_MSG_SIZE   len)
+{
+    while (len > 0u) {
+       *p_dest = *p_src;
+        p_dest++;
+        p_src++;
+        len--;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                        WAIT FOR DATA IN A STREAM BUFFER
+*
+* Description: This function makes the reader wait until the ring holds 'level' bytes.
+*
+* Arguments  : p_stream     is a pointer to the stream buffer
+*
+*              level        is the number of bytes to wait for
+*
+*              timeout      is the timeout, see OSStreamRead()
+*
+*              opt          is the pend option, see OSStreamRead()
+*
+*              p_ts         is a pointer to a variable that will receive a timestamp, see OSStreamRead()
+*
+*              p_err        is a pointer to a variable that will contain an error code, see OSStreamRead()
+*
+* Returns    : The number of bytes in the ring when the wait ended.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The level is tested and the reader placed in the pend list in one critical section.  A writer that
+*                 finds the pend list empty has therefore published its bytes before the test.
+************************************************************************************************************************
+*/
+
+static  OS_MSG_SIZE  OS_StreamPend (OS_STREAM    *p_stream,
+                                    OS_MSG_SIZE   level,
+                                    OS_TICK       timeout,
+                                    OS_OPT        opt,
+                                    CPU_TS       *p_ts,
+                                    OS_ERR       *p_err)
+{
+    OS_MSG_SIZE  nbr_bytes;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#else
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    nbr_bytes = (OS_MSG_SIZE)(p_stream->In - p_stream->Out);
+    if (nbr_bytes >= level) {                                   /* Enough data?                                         */
+        CPU_CRITICAL_EXIT();                                    /* Yes, caller may proceed                              */
+        CPU_RMB();                                              /* Read '.In' before the bytes it covers                */
+       *p_err = OS_ERR_NONE;
+        return (nbr_bytes);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not enough data?            */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+        CPU_RMB();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return (nbr_bytes);
+    }
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't pend when the scheduler is locked              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return (0u);
+    }
+
+    p_stream->PendLevel = level;                                /* Tell the writer how much data wakes us up            */
+    OS_Pend((OS_PEND_OBJ *)((void *)p_stream),                  /* Block task pending on the stream buffer              */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_STREAM,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* The ring reached the pend level                      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that the data did not arrive in time        */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    nbr_bytes = (OS_MSG_SIZE)(p_stream->In - p_stream->Out);
+    CPU_CRITICAL_EXIT();
+    CPU_RMB();                                                  /* Read '.In' before the bytes it covers                */
+    return (nbr_bytes);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        SIGNAL THE WRITE TO A STREAM BUFFER
+*
+* Description: This function is called by the writer once it has published new bytes.  It wakes up the reader if the
+*              ring reached its pend level.
+*
+* Arguments  : p_stream     is a pointer to the stream buffer
+*
+*              opt          is the post option, see OSStreamWrite()
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE              The call was successful
+*                               OS_ERR_INT_Q_FULL        If called from an ISR and the ISR queue is full
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The pend list and the pend level are tested without a critical section.  The reader sets both in one
+*                 critical section (see OS_StreamPend() Note #2), and OS_StreamPost() tests them again.
+************************************************************************************************************************
+*/
+
+static  void  OS_StreamSignal (OS_STREAM  *p_stream,
+                               OS_OPT      opt,
+                               OS_ERR     *p_err)
+{
+    CPU_TS  ts;
+
+
+    CPU_MB();                                                   /* Publish '.In' before looking for the reader          */
+    if ((p_stream->PendList.HeadPtr == (OS_TCB *)0) ||          /* Is the reader waiting for the data in the ring?      */
+        ((OS_MSG_SIZE)(p_stream->In - p_stream->Out) < p_stream->PendLevel)) {
+       *p_err = OS_ERR_NONE;                                    /* No, it will find the data when it reads              */
+        return;
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR ...                        */
+        if (p_stream->PostPend == OS_TRUE) {                    /* ... a wake-up is already in the ISR queue            */
+           *p_err = OS_ERR_NONE;
+            return;
+        }
+        p_stream->PostPend = OS_TRUE;
+        OS_IntQPost(OS_OBJ_TYPE_STREAM,                         /* ... defer the wake-up to the ISR handler task        */
+                    p_stream,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        if (*p_err != OS_ERR_NONE) {
+            p_stream->PostPend = OS_FALSE;
+        }
+        return;
+    }
+#endif
+
+    OS_StreamPost(p_stream,
+                  opt,
+                  ts,
+                  p_err);
+}
+#endif
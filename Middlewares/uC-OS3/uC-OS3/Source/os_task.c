@@ -48,7 +48,7 @@ const  CPU_CHAR  *os_task__c = "$Id: $";
 *                             OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
 *                             OS_ERR_PRIO_INVALID            If the priority you specify is higher that the maximum allowed
 *                                                              (i.e. >= (OS_CFG_PRIO_MAX-1)) or already in use by a kernel
-*                                                              task
+*                                                              task (including 0 when OS_CFG_ISR_POST_EN is enabled)
 *                             OS_ERR_STATE_INVALID           If the task is in an invalid state
 *                             OS_ERR_TASK_CHANGE_PRIO_ISR    If you tried to change the task's priority from an ISR
 *
@@ -95,6 +95,14 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
         return;
     }
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if ((prio_new == 0u) ||                                     /* Cannot set to the ISR handler task priority ...      */
+        (p_tcb    == &OSIntQTaskTCB)) {                         /* ... nor change the priority of that task             */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
 
     if (p_tcb == (OS_TCB *)0) {                                 /* Are we changing the priority of 'self'?              */
@@ -194,6 +202,9 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                                 OS_OPT_TASK_NO_TLS          If the caller doesn't want or need TLS (Thread Local
 *                                                             Storage) support for the task.  If you do not include this
 *                                                             option, TLS will be supported by default.
+*                                 OS_OPT_TASK_CORE(n)         With OS_CFG_SMP_CORE_NBR > 1, the task may run on core
+*                                                             'n'.  May be OR'd for several cores.  Without any, the
+*                                                             task may run on every core.
 *
 *              p_err          is a pointer to an error code that will be set during this call.  The value pointer
 *                             to by 'p_err' can be:
@@ -201,8 +212,10 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                                 OS_ERR_NONE                    If the function was successful
 *                                 OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the task after you called
 *                                                                   OSSafetyCriticalStart()
+*                                 OS_ERR_OPT_INVALID             If OS_OPT_TASK_CORE() names a core that does not exist
 *                                 OS_ERR_PRIO_INVALID            If the priority you specify is higher that the maximum
-*                                                                   allowed (i.e. >= OS_CFG_PRIO_MAX-1) or,
+*                                                                   allowed (i.e. >= OS_CFG_PRIO_MAX-1) or, when
+*                                                                   OS_CFG_ISR_POST_EN is enabled, is 0
 *                                 OS_ERR_STK_OVF                 If the stack was overflowed during stack init
 *                                 OS_ERR_STK_INVALID             If you specified a NULL pointer for 'p_stk_base'
 *                                 OS_ERR_STK_SIZE_INVALID        If you specified zero for the 'stk_size'
@@ -304,9 +317,17 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     }
 #endif
 
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    if (((opt & OS_OPT_TASK_CORE_MASK) >> 8u) >= (1u << OS_CFG_SMP_CORE_NBR)) {
+        OS_TRACE_TASK_CREATE_FAILED(p_tcb);
+       *p_err = OS_ERR_OPT_INVALID;                             /* Not allowed to run on a core that does not exist     */
+        return;
+    }
+#endif
+
     if (prio == (OS_CFG_PRIO_MAX - 1u)) {
 #if (OS_CFG_TASK_IDLE_EN > 0u)
-        if (p_tcb != &OSIdleTaskTCB) {
+        if (!OS_TASK_IS_IDLE(p_tcb)) {
             OS_TRACE_TASK_CREATE_FAILED(p_tcb);
            *p_err = OS_ERR_PRIO_INVALID;                        /* Not allowed to use same priority as idle task        */
             return;
@@ -318,6 +339,14 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #endif
     }
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if ((prio == 0u) && (p_tcb != &OSIntQTaskTCB)) {
+        OS_TRACE_TASK_CREATE_FAILED(p_tcb);
+       *p_err = OS_ERR_PRIO_INVALID;                            /* Priority 0 is reserved for the ISR handler task      */
+        return;
+    }
+#endif
+
     OS_TaskInitTCB(p_tcb);                                      /* Initialize the TCB to default values                 */
 
    *p_err = OS_ERR_NONE;
@@ -400,6 +429,13 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     p_tcb->StkSize       = stk_size;                            /* Save the stack size (in number of CPU_STK elements)  */
 #endif
     p_tcb->Opt           = opt;                                 /* Save task options                                    */
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    p_tcb->CoreCur       = OS_CORE_NONE;                        /* Not running yet, on the cores of OS_OPT_TASK_CORE()  */
+    p_tcb->CoreMask      = (CPU_INT08U)((opt & OS_OPT_TASK_CORE_MASK) >> 8u);
+    if (p_tcb->CoreMask == 0u) {
+        p_tcb->CoreMask  = (CPU_INT08U)((1u << OS_CFG_SMP_CORE_NBR) - 1u);
+    }
+#endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
     for (reg_nbr = 0u; reg_nbr < OS_CFG_TASK_REG_TBL_SIZE; reg_nbr++) {
@@ -470,6 +506,7 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 *                             OS_ERR_TASK_DEL_IDLE           If you attempted to delete uC/OS-III's idle task
 *                             OS_ERR_TASK_DEL_INVALID        If you attempted to delete uC/OS-III's ISR handler task
 *                             OS_ERR_TASK_DEL_ISR            If you tried to delete a task from an ISR
+*                             OS_ERR_TASK_RUNNING            If the task runs on another core (OS_CFG_SMP_CORE_NBR > 1)
 *
 * Returns    : none
 *
@@ -519,12 +556,19 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #endif
 
 #if (OS_CFG_TASK_IDLE_EN > 0u)
-    if (p_tcb == &OSIdleTaskTCB) {                              /* Not allowed to delete the idle task                  */
+    if (OS_TASK_IS_IDLE(p_tcb)) {                               /* Not allowed to delete the idle task                  */
        *p_err = OS_ERR_TASK_DEL_IDLE;
         return;
     }
 #endif
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (p_tcb == &OSIntQTaskTCB) {                              /* Not allowed to delete the ISR handler task           */
+       *p_err = OS_ERR_TASK_DEL_INVALID;
+        return;
+    }
+#endif
+
     if (p_tcb == (OS_TCB *)0) {                                 /* Delete 'Self'?                                       */
         CPU_CRITICAL_ENTER();
         p_tcb  = OSTCBCurPtr;                                   /* Yes.                                                 */
@@ -532,6 +576,14 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    if ((p_tcb->CoreCur != OS_CORE_NONE) &&                     /* Not allowed to delete a task running on another core */
+        (p_tcb          != OSTCBCurPtr)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_RUNNING;
+        return;
+    }
+#endif
     switch (p_tcb->TaskState) {
         case OS_TASK_STATE_RDY:
              OS_RdyListRemove(p_tcb);
@@ -560,6 +612,8 @@ void  OSTaskDel (OS_TCB  *p_tcb,
                  case OS_TASK_PEND_ON_FLAG:                     /* Remove from pend list                                */
                  case OS_TASK_PEND_ON_Q:
                  case OS_TASK_PEND_ON_SEM:
+                 case OS_TASK_PEND_ON_STREAM:
+                 case OS_TASK_PEND_ON_COND:
                       OS_PendListRemove(p_tcb);
                       break;
 
@@ -601,6 +655,9 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 
 #if (OS_CFG_MUTEX_EN > 0u)
+#if (OS_CFG_MUTEX_FAST_EN > 0u)
+    OS_MutexFastInflateAll(p_tcb);                              /* Mutexes held on the fast path join the task's group  */
+#endif
     if(p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {
         OS_MutexGrpPostAll(p_tcb);
     }
@@ -610,6 +667,10 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     (void)OS_MsgQFreeAll(&p_tcb->MsgQ);                         /* Free task's message queue messages                   */
 #endif
 
+#if (OS_CFG_MEM_EN > 0u) && (OS_CFG_MEM_CLASS_NBR > 0u) && (OS_CFG_MEM_MAG_SIZE > 0u)
+    OS_MemMagFlush(p_tcb);                                      /* Return the blocks cached by the task                 */
+#endif
+
     OSTaskDelHook(p_tcb);                                       /* Call user defined hook                               */
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
@@ -1022,6 +1083,74 @@ CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                       GIVE A TASK QUEUE ITS OWN POOL OF 'OS_MSG'
+*
+* Description: This function makes the message queue of a task take its OS_MSGs from 'p_pool' instead of the global
+*              pool, so that the messages of the other queues cannot use up its capacity.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task.  If you specify a NULL pointer then the pool of the
+*                         calling task's queue is changed.
+*
+*              p_pool     is a pointer to a pool made by OSMsgPoolCreate(), or a NULL pointer to return to the global
+*                         pool.  Several queues may share one pool.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE              The task's queue now uses 'p_pool'
+*                             OS_ERR_Q_NOT_EMPTY       If the task's queue holds messages
+*                             OS_ERR_SET_ISR           If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) See 'os_msg.c  Note #1'.  OSTaskCreate() gives the task's queue the global pool, so call this
+*                 function before the task is known to its posters, e.g. from the task itself.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_MSG_POOL_PRIV_EN > 0u)
+void  OSTaskQPoolSet (OS_TCB       *p_tcb,
+                      OS_MSG_POOL  *p_pool,
+                      OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't change the pool from an ISR                    */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    if (p_pool == (OS_MSG_POOL *)0) {                           /* Back to the global pool                              */
+        p_pool = &OSMsgPool;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Pool of the calling task's queue?                    */
+        p_tcb = OSTCBCurPtr;
+    }
+    if (p_tcb->MsgQ.NbrEntries > 0u) {                          /* Queued OS_MSGs belong to the current pool            */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_Q_NOT_EMPTY;
+        return;
+    }
+    p_tcb->MsgQ.PoolPtr = p_pool;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               POST MESSAGE TO A TASK
@@ -1056,10 +1185,12 @@ CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,
 *                             OS_ERR_Q_MAX             If the queue is full
 *                             OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
 *                                                      and if it does, would be considered a system failure
+*                             OS_ERR_INT_Q_FULL        If called from an ISR and the ISR queue is full
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) When OS_CFG_ISR_POST_EN is enabled, a post made from an ISR is only recorded in the ISR queue; the ISR
+*                 handler task performs it later.  A NULL 'p_tcb' then designates the interrupted task.
 ************************************************************************************************************************
 */
 
@@ -1071,7 +1202,6 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
                    OS_ERR       *p_err)
 {
     CPU_TS  ts;
-    CPU_SR_ALLOC();
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -1115,57 +1245,159 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
 
     OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
 
-   *p_err = OS_ERR_NONE;                                        /* Assume we won't have any errors                      */
-    CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {                                 /* Post msg to 'self'?                                  */
-        p_tcb = OSTCBCurPtr;
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR ...                        */
+        if (p_tcb == (OS_TCB *)0) {                             /* Post to the interrupted task?                        */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_MSG,                       /* ... defer the post to the ISR handler task           */
+                    p_tcb,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+        return;
     }
-    switch (p_tcb->TaskState) {
-        case OS_TASK_STATE_RDY:
-        case OS_TASK_STATE_DLY:
-        case OS_TASK_STATE_SUSPENDED:
-        case OS_TASK_STATE_DLY_SUSPENDED:
-             OS_MsgQPut(&p_tcb->MsgQ,                           /* Deposit the message in the queue                     */
-                        p_void,
-                        msg_size,
-                        opt,
-                        ts,
-                        p_err);
-             CPU_CRITICAL_EXIT();
-             break;
+#endif
 
-        case OS_TASK_STATE_PEND:
-        case OS_TASK_STATE_PEND_TIMEOUT:
-        case OS_TASK_STATE_PEND_SUSPENDED:
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
-                 OS_Post((OS_PEND_OBJ *)0,
-                          p_tcb,
-                          p_void,
-                          msg_size,
-                          ts);
-                 CPU_CRITICAL_EXIT();
-                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-                     OSSched();                                 /* Run the scheduler                                    */
-                 }
-             } else {
-                 OS_MsgQPut(&p_tcb->MsgQ,                       /* No,  Task is pending on something else ...           */
-                            p_void,                             /* ... Deposit the message in the task's queue          */
-                            msg_size,
-                            opt,
-                            ts,
-                            p_err);
-                 CPU_CRITICAL_EXIT();
-             }
+    OS_TaskQPost(p_tcb,
+                 p_void,
+                 msg_size,
+                 opt,
+                 ts,
+                 p_err);
+    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           POST SEVERAL MESSAGES TO A TASK
+*
+* Description: This function sends an array of messages to a task in one call.  The result is the same as calling
+*              OSTaskQPost() for each message, in order, with OS_OPT_POST_NO_SCHED, followed by one call to the
+*              scheduler.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task receiving the messages.  If you specify a NULL pointer then
+*                         the messages will be posted to the task's queue of the calling task.
+*
+*              p_msgs     is a pointer to an array of 'nbr_msgs' messages and their sizes
+*
+*              nbr_msgs   is the number of messages to send
+*
+*              opt        specifies whether the post will be FIFO or LIFO, see OSTaskQPost()
+*
+*              p_err      is a pointer to a variable that will hold the error code associated
+*                         with the outcome of this call.  Errors can be:
+*
+*                             OS_ERR_NONE              The call was successful and all the messages were sent
+*                             OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs available from the pool
+*                             OS_ERR_OPT_INVALID       If you specified an invalid option
+*                             OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                             OS_ERR_PTR_INVALID       If 'p_msgs' is a NULL pointer
+*                             OS_ERR_Q_MAX             If the queue is full
+*                             OS_ERR_Q_SIZE            If 'nbr_msgs' is 0
+*                             OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
+*                                                      and if it does, would be considered a system failure
+*                             OS_ERR_INT_Q_FULL        If called from an ISR and the ISR queue is full
+*
+* Returns    : The number of messages sent.  On an error, the messages from that one onward were not sent.
+*
+* Note(s)    : 1) The messages are all sent in one critical section, so interrupts are disabled for a time proportional
+*                 to 'nbr_msgs'.
+*
+*              2) When OS_CFG_ISR_POST_EN is enabled, a post made from an ISR records one entry per message in the ISR
+*                 queue.  A NULL 'p_tcb' then designates the interrupted task.
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_MULTI_EN > 0u))
+OS_MSG_QTY  OSTaskQPostMulti (OS_TCB       *p_tcb,
+                              OS_MSG_INFO  *p_msgs,
+                              OS_MSG_QTY    nbr_msgs,
+                              OS_OPT        opt,
+                              OS_ERR       *p_err)
+{
+    CPU_TS      ts;
+#if (OS_CFG_ISR_POST_EN > 0u)
+    OS_MSG_QTY  nbr_posted;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_msgs == (OS_MSG_INFO *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (nbr_msgs == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+    switch (opt) {                                              /* User must supply a valid option                      */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
              break;
 
         default:
-             CPU_CRITICAL_EXIT();
-            *p_err = OS_ERR_STATE_INVALID;
-             break;
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
     }
+#endif
 
-    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR ...                        */
+        if (p_tcb == (OS_TCB *)0) {                             /* Post to the interrupted task?                        */
+            p_tcb = OSTCBCurPtr;
+        }
+        for (nbr_posted = 0u; nbr_posted < nbr_msgs; nbr_posted++) {
+            OS_IntQPost(OS_OBJ_TYPE_TASK_MSG,                   /* ... defer each post to the ISR handler task          */
+                        p_tcb,
+                        p_msgs[nbr_posted].MsgPtr,
+                        p_msgs[nbr_posted].MsgSize,
+                        0u,
+                        opt,
+                        ts,
+                        p_err);
+            if (*p_err != OS_ERR_NONE) {
+                break;
+            }
+        }
+        return (nbr_posted);
+    }
+#endif
+
+    return (OS_TaskQPostMulti(p_tcb,
+                              p_msgs,
+                              nbr_msgs,
+                              opt,
+                              ts,
+                              p_err));
 }
 #endif
 
@@ -1814,10 +2046,12 @@ CPU_BOOLEAN  OSTaskSemPendAbort (OS_TCB  *p_tcb,
 *                            OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
 *                            OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
 *                                                     and if it does, would be considered a system failure
+*                            OS_ERR_INT_Q_FULL        If called from an ISR and the ISR queue is full
 *
 * Returns    : The current value of the task's signal counter or 0 if called from an ISR
 *
-* Note(s)    : none
+* Note(s)    : 1) When OS_CFG_ISR_POST_EN is enabled, a post made from an ISR is only recorded in the ISR queue; the ISR
+*                 handler task performs it later.  A NULL 'p_tcb' then designates the interrupted task.
 ************************************************************************************************************************
 */
 
@@ -1827,7 +2061,6 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
 {
     OS_SEM_CTR  ctr;
     CPU_TS      ts;
-    CPU_SR_ALLOC();
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -1869,65 +2102,28 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
 
     OS_TRACE_TASK_SEM_POST(p_tcb);
 
-    CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {                                 /* Post signal to 'self'?                               */
-        p_tcb = OSTCBCurPtr;
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR ...                        */
+        if (p_tcb == (OS_TCB *)0) {                             /* Post to the interrupted task?                        */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_SIGNAL,                    /* ... defer the post to the ISR handler task           */
+                    p_tcb,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
+        return (0u);
     }
-#if (OS_CFG_TS_EN > 0u)
-    p_tcb->TS = ts;
 #endif
-   *p_err     = OS_ERR_NONE;                                    /* Assume we won't have any errors                      */
-    switch (p_tcb->TaskState) {
-        case OS_TASK_STATE_RDY:
-        case OS_TASK_STATE_DLY:
-        case OS_TASK_STATE_SUSPENDED:
-        case OS_TASK_STATE_DLY_SUSPENDED:
-             if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
-                 CPU_CRITICAL_EXIT();
-                *p_err = OS_ERR_SEM_OVF;
-                 OS_TRACE_SEM_POST_EXIT(*p_err);
-                 return (0u);
-             }
-             p_tcb->SemCtr++;                                   /* Task signaled is not pending on anything             */
-             ctr = p_tcb->SemCtr;
-             CPU_CRITICAL_EXIT();
-             break;
-
-        case OS_TASK_STATE_PEND:
-        case OS_TASK_STATE_PEND_TIMEOUT:
-        case OS_TASK_STATE_PEND_SUSPENDED:
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM) {   /* Is task signaled waiting for a signal?               */
-                 OS_Post((OS_PEND_OBJ *)0,                      /* Task is pending on signal                            */
-                          p_tcb,
-                          (void *)0,
-                          0u,
-                          ts);
-                 ctr = p_tcb->SemCtr;
-                 CPU_CRITICAL_EXIT();
-                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-                     OSSched();                                 /* Run the scheduler                                    */
-                 }
-             } else {
-                 if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
-                     CPU_CRITICAL_EXIT();
-                    *p_err = OS_ERR_SEM_OVF;
-                     OS_TRACE_SEM_POST_EXIT(*p_err);
-                     return (0u);
-                 }
-                 p_tcb->SemCtr++;                               /* No,  Task signaled is NOT pending on semaphore ...   */
-                 ctr = p_tcb->SemCtr;                           /* ... it must be waiting on something else             */
-                 CPU_CRITICAL_EXIT();
-             }
-             break;
-
-        default:
-             CPU_CRITICAL_EXIT();
-            *p_err = OS_ERR_STATE_INVALID;
-             ctr   = 0u;
-             break;
-    }
 
+    ctr = OS_TaskSemPost(p_tcb,
+                         opt,
+                         ts,
+                         p_err);
     OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
 
     return (ctr);
@@ -2182,8 +2378,8 @@ CPU_BOOLEAN  OSTaskStkRedzoneChk (OS_TCB  *p_tcb)
 *                           OS_ERR_TASK_SUSPEND_ISR            If you called this function from an ISR
 *                           OS_ERR_TASK_SUSPEND_IDLE           If you attempted to suspend the idle task which is not
 *                                                                  allowed
-*                           OS_ERR_TASK_SUSPEND_INT_HANDLER    If you attempted to suspend the idle task which is not
-*                                                                  allowed
+*                           OS_ERR_TASK_SUSPEND_INT_HANDLER    If you attempted to suspend the ISR handler task which is
+*                                                                  not allowed
 *
 * Returns    : none
 *
@@ -2218,13 +2414,21 @@ void   OSTaskSuspend (OS_TCB  *p_tcb,
 #endif
 
 #if (OS_CFG_TASK_IDLE_EN > 0u)
-    if (p_tcb == &OSIdleTaskTCB) {                              /* Make sure not suspending the idle task               */
+    if (OS_TASK_IS_IDLE(p_tcb)) {                               /* Make sure not suspending the idle task               */
        *p_err = OS_ERR_TASK_SUSPEND_IDLE;
         OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_TASK_SUSPEND_IDLE);
         return;
     }
 #endif
 
+#if (OS_CFG_ISR_POST_EN > 0u)
+    if (p_tcb == &OSIntQTaskTCB) {                              /* Make sure not suspending the ISR handler task        */
+       *p_err = OS_ERR_TASK_SUSPEND_INT_HANDLER;
+        OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_TASK_SUSPEND_INT_HANDLER);
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     if (p_tcb == (OS_TCB *)0) {                                 /* See if specified to suspend self                     */
         if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Can't suspend self when the kernel isn't running     */
@@ -2480,6 +2684,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     OS_TLS_ID   id;
 #endif
+#if (OS_CFG_MEM_EN > 0u) && (OS_CFG_MEM_CLASS_NBR > 0u) && (OS_CFG_MEM_MAG_SIZE > 0u)
+    CPU_DATA    mem_ix;
+#endif
 
 
     p_tcb->StkPtr               = (CPU_STK          *)0;
@@ -2493,6 +2700,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if (OS_CFG_TICK_EN > 0u)
     p_tcb->TickNextPtr          = (OS_TCB           *)0;
     p_tcb->TickPrevPtr          = (OS_TCB           *)0;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    p_tcb->TickSpokePtr         = (OS_TICK_SPOKE    *)0;
+#endif
 #endif
 
 #if (OS_CFG_DBG_EN > 0u)
@@ -2544,6 +2754,13 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     }
 #endif
 
+#if (OS_CFG_MEM_EN > 0u) && (OS_CFG_MEM_CLASS_NBR > 0u) && (OS_CFG_MEM_MAG_SIZE > 0u)
+    for (mem_ix = 0u; mem_ix < OS_CFG_MEM_CLASS_NBR; mem_ix++) {
+        p_tcb->MemMagTbl[mem_ix] = (void             *)0;
+        p_tcb->MemMagCtr[mem_ix] =                     0u;
+    }
+#endif
+
     p_tcb->SemCtr               =                     0u;
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     p_tcb->SemPendTime          =                     0u;
@@ -2565,10 +2782,17 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #endif
 
     p_tcb->Opt                  =                     0u;
+#if (OS_CFG_SMP_CORE_NBR > 1u)
+    p_tcb->CoreCur              =           OS_CORE_NONE;
+    p_tcb->CoreMask             =                     0u;
+#endif
 
 #if (OS_CFG_TICK_EN > 0u)
     p_tcb->TickRemain           =                     0u;
     p_tcb->TickCtrPrev          =                     0u;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    p_tcb->TickCtrMatch         =                     0u;
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
@@ -2599,6 +2823,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->PendNextPtr          = (OS_TCB           *)0;
     p_tcb->PendPrevPtr          = (OS_TCB           *)0;
     p_tcb->PendObjPtr           = (OS_PEND_OBJ      *)0;
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN > 0u)
+    p_tcb->PendPrio             =  OS_PRIO_INIT;
+#endif
     p_tcb->PendOn               =  OS_TASK_PEND_ON_NOTHING;
     p_tcb->PendStatus           =  OS_STATUS_PEND_OK;
     p_tcb->TaskState            =  OS_TASK_STATE_RDY;
@@ -2617,6 +2844,206 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                                POST MESSAGE TO A TASK
+*
+* Description: This function sends a message to a task.  It is called by OSTaskQPost() and by the ISR handler task when
+*              it replays a post deferred by an ISR.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task receiving a message.  A NULL pointer designates the calling
+*                         task.
+*
+*              p_void     is a pointer to the message to send.
+*
+*              msg_size   is the size of the message sent (in bytes)
+*
+*              opt        specifies whether the post will be FIFO or LIFO (see OSTaskQPost())
+*
+*              ts         is the timestamp of the post
+*
+*              p_err      is a pointer to a variable that will hold the error code associated
+*                         with the outcome of this call.  Errors can be:
+*
+*                             OS_ERR_NONE              The call was successful and the message was sent
+*                             OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs available from the pool
+*                             OS_ERR_Q_MAX             If the queue is full
+*                             OS_ERR_STATE_INVALID     If the task is in an invalid state
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+void  OS_TaskQPost (OS_TCB       *p_tcb,
+                    void         *p_void,
+                    OS_MSG_SIZE   msg_size,
+                    OS_OPT        opt,
+                    CPU_TS        ts,
+                    OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+   *p_err = OS_ERR_NONE;                                        /* Assume we won't have any errors                      */
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post msg to 'self'?                                  */
+        p_tcb = OSTCBCurPtr;
+    }
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             OS_MsgQPut(&p_tcb->MsgQ,                           /* Deposit the message in the queue                     */
+                        p_void,
+                        msg_size,
+                        opt,
+                        ts,
+                        p_err);
+             CPU_CRITICAL_EXIT();
+             break;
+
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
+                 OS_Post((OS_PEND_OBJ *)0,
+                          p_tcb,
+                          p_void,
+                          msg_size,
+                          ts);
+                 CPU_CRITICAL_EXIT();
+                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+                     OSSched();                                 /* Run the scheduler                                    */
+                 }
+             } else {
+                 OS_MsgQPut(&p_tcb->MsgQ,                       /* No,  Task is pending on something else ...           */
+                            p_void,                             /* ... Deposit the message in the task's queue          */
+                            msg_size,
+                            opt,
+                            ts,
+                            p_err);
+                 CPU_CRITICAL_EXIT();
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;
+             break;
+    }
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                           POST SEVERAL MESSAGES TO A TASK
+*
+* Description: This function sends an array of messages to a task.  It is called by OSTaskQPostMulti().
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task receiving the messages.  A NULL pointer designates the
+*                         calling task.
+*
+*              p_msgs     is a pointer to an array of 'nbr_msgs' messages and their sizes
+*
+*              nbr_msgs   is the number of messages to send
+*
+*              opt        specifies whether the post will be FIFO or LIFO (see OSTaskQPost())
+*
+*              ts         is the timestamp of the post
+*
+*              p_err      is a pointer to a variable that will hold the error code associated
+*                         with the outcome of this call.  Errors can be:
+*
+*                             OS_ERR_NONE              The call was successful and the messages were sent
+*                             OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs available from the pool
+*                             OS_ERR_Q_MAX             If the queue is full
+*                             OS_ERR_STATE_INVALID     If the task is in an invalid state
+*
+* Returns    : The number of messages sent
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) If the task waits on its queue, the first message is handed over to it and the others are queued.
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_MULTI_EN > 0u))
+OS_MSG_QTY  OS_TaskQPostMulti (OS_TCB       *p_tcb,
+                               OS_MSG_INFO  *p_msgs,
+                               OS_MSG_QTY    nbr_msgs,
+                               OS_OPT        opt,
+                               CPU_TS        ts,
+                               OS_ERR       *p_err)
+{
+    OS_MSG_QTY   nbr_posted;
+    CPU_BOOLEAN  sched;
+    CPU_SR_ALLOC();
+
+
+    nbr_posted = 0u;
+    sched      = OS_FALSE;
+   *p_err      = OS_ERR_NONE;                                   /* Assume we won't have any errors                      */
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post msgs to 'self'?                                 */
+        p_tcb = OSTCBCurPtr;
+    }
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             break;
+
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
+                 OS_Post((OS_PEND_OBJ *)0,                      /* Yes, hand the first message over                     */
+                          p_tcb,
+                          p_msgs[0].MsgPtr,
+                          p_msgs[0].MsgSize,
+                          ts);
+                 nbr_posted = 1u;
+                 sched      = OS_TRUE;
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;
+             return (0u);
+    }
+
+    while (nbr_posted < nbr_msgs) {                             /* Deposit the other messages in the task's queue       */
+        OS_MsgQPut(&p_tcb->MsgQ,
+                   p_msgs[nbr_posted].MsgPtr,
+                   p_msgs[nbr_posted].MsgSize,
+                   opt,
+                   ts,
+                   p_err);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+        nbr_posted++;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((sched == OS_TRUE) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+    return (nbr_posted);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                              CATCH ACCIDENTAL TASK RETURN
@@ -2652,6 +3079,101 @@ void  OS_TaskReturn (void)
 }
 
 
+/*
+************************************************************************************************************************
+*                                                    SIGNAL A TASK
+*
+* Description: This function signals a task.  It is called by OSTaskSemPost() and by the ISR handler task when it
+*              replays a post deferred by an ISR.
+*
+* Arguments  : p_tcb     is the pointer to the TCB of the task to signal.  A NULL pointer designates the calling task.
+*
+*              opt       determines the type of POST performed (see OSTaskSemPost())
+*
+*              ts        is the timestamp of the post
+*
+*              p_err     is a pointer to an error code returned by this function:
+*
+*                            OS_ERR_NONE              If the requested task is signaled
+*                            OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
+*                            OS_ERR_STATE_INVALID     If the task is in an invalid state
+*
+* Returns    : The current value of the task's signal counter or 0 upon error.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_SEM_CTR  OS_TaskSemPost (OS_TCB  *p_tcb,
+                            OS_OPT   opt,
+                            CPU_TS   ts,
+                            OS_ERR  *p_err)
+{
+    OS_SEM_CTR  ctr;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post signal to 'self'?                               */
+        p_tcb = OSTCBCurPtr;
+    }
+#if (OS_CFG_TS_EN > 0u)
+    p_tcb->TS = ts;
+#endif
+   *p_err     = OS_ERR_NONE;                                    /* Assume we won't have any errors                      */
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_SEM_OVF;
+                 return (0u);
+             }
+             p_tcb->SemCtr++;                                   /* Task signaled is not pending on anything             */
+             ctr = p_tcb->SemCtr;
+             CPU_CRITICAL_EXIT();
+             break;
+
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM) {   /* Is task signaled waiting for a signal?               */
+                 OS_Post((OS_PEND_OBJ *)0,                      /* Task is pending on signal                            */
+                          p_tcb,
+                          (void *)0,
+                          0u,
+                          ts);
+                 ctr = p_tcb->SemCtr;
+                 CPU_CRITICAL_EXIT();
+                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+                     OSSched();                                 /* Run the scheduler                                    */
+                 }
+             } else {
+                 if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
+                     CPU_CRITICAL_EXIT();
+                    *p_err = OS_ERR_SEM_OVF;
+                     return (0u);
+                 }
+                 p_tcb->SemCtr++;                               /* No,  Task signaled is NOT pending on semaphore ...   */
+                 ctr = p_tcb->SemCtr;                           /* ... it must be waiting on something else             */
+                 CPU_CRITICAL_EXIT();
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;
+             ctr   = 0u;
+             break;
+    }
+
+    return (ctr);
+}
+
+
 /*
 ************************************************************************************************************************
 *                                          CHECK THE STACK REDZONE OF A TASK
@@ -2798,6 +3320,8 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
                      case OS_TASK_PEND_ON_FLAG:
                      case OS_TASK_PEND_ON_Q:
                      case OS_TASK_PEND_ON_SEM:
+                     case OS_TASK_PEND_ON_STREAM:
+                     case OS_TASK_PEND_ON_COND:
                           OS_PendListChangePrio(p_tcb);
                           break;
 
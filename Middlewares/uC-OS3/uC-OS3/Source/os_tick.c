@@ -37,7 +37,17 @@ const  CPU_CHAR  *os_tick__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-static  void  OS_TickListUpdate (OS_TICK  ticks);
+static  void     OS_TickListUpdate   (OS_TICK  ticks);
+
+static  void     OS_TickListExpire   (OS_TCB  *p_tcb);
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+static  void     OS_TickWheelUnlink  (OS_TCB  *p_tcb);
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  OS_TICK  OS_TickWheelNextGet (void);
+#endif
+#endif
 
 
 /*
@@ -50,6 +60,7 @@ static  void  OS_TickListUpdate (OS_TICK  ticks);
 * Arguments  : p_err          is a pointer to a variable that will contain an error code returned by this function.
 *              -----
 *                                 OS_ERR_NONE           the tick variables were initialized successfully
+*                                 OS_ERR_TICK_WHEEL_SIZE  if the tick wheel has less than 2 spokes
 *
 * Returns    : none
 *
@@ -59,6 +70,17 @@ static  void  OS_TickListUpdate (OS_TICK  ticks);
 
 void  OS_TickInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TICK_SPOKE  *p_spoke;
+    OS_TICK         i;
+
+
+    if (OSCfg_TickWheelSize < 2u) {                             /* Need at least 2 spokes for the wheel to turn         */
+       *p_err = OS_ERR_TICK_WHEEL_SIZE;
+        return;
+    }
+#endif
+
     *p_err                = OS_ERR_NONE;
 
     OSTickCtr             = 0u;                               /* Clear the tick counter                               */
@@ -69,8 +91,26 @@ void  OS_TickInit (OS_ERR  *p_err)
 
     OSTickList.TCB_Ptr    = (OS_TCB *)0;
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    p_spoke               = &OSCfg_TickWheel[0];
+    for (i = 0u; i < OSCfg_TickWheelSize; i++) {                /* Initialize the spokes of the tick wheel              */
+        p_spoke->FirstPtr      = (OS_TCB *)0;
+        p_spoke->NbrEntries    = 0u;
 #if (OS_CFG_DBG_EN > 0u)
+        p_spoke->NbrEntriesMax = 0u;
+#endif
+        p_spoke++;
+    }
+
+    OSTickList.SpokePtr   = &OSCfg_TickWheel[0];
+    OSTickList.SpokeSize  =  OSCfg_TickWheelSize;
+    OSTickList.Ctr        =  0u;
+#endif
+
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_TICK_WHEEL_EN > 0u))
     OSTickList.NbrEntries = 0u;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
     OSTickList.NbrUpdated = 0u;
 #endif
 }
@@ -117,17 +157,116 @@ void  OS_TickUpdate (OS_TICK  ticks)
 #endif
 
 #if (OS_CFG_DYN_TICK_EN > 0u)
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OSTickCtrStep = OS_TickWheelNextGet();
+#else
     if (OSTickList.TCB_Ptr != (OS_TCB *)0) {
         OSTickCtrStep = OSTickList.TCB_Ptr->TickRemain;
     } else {
         OSTickCtrStep = 0u;
     }
+#endif
 
     OS_DynTickSet(OSTickCtrStep);
 #endif
     CPU_CRITICAL_EXIT();
 }
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                      INSERT
+*
+* Description: This task is internal to uC/OS-III and allows the insertion of a task in the tick wheel.
+*
+* Arguments  : p_tcb       is a pointer to the TCB to insert in the wheel
+*
+*              elapsed     is the number of elapsed ticks since the last tick interrupt
+*
+*              tick_base   is value of OSTickCtr from which time is offset
+*
+*              time        is the amount of time remaining (in ticks) for the task to become ready
+*
+* Returns    : OS_TRUE     if time is valid for the given tick base
+*
+*              OS_FALSE    if time is invalid (i.e. zero delay)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function supports both Periodic Tick Mode (PTM) and Dynamic Tick Mode (DTM).
+*
+*              3) PTM should always call this function with elapsed == 0u.
+*
+*              4) The task is placed at the head of the spoke selected by its absolute expiration count, so the cost of
+*                 the insertion does not depend on the number of tasks in the wheel.  The expiration count is kept
+*                 relative to the wheel's own counter so that OSTimeSet() does not disturb pending delays.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
+                                OS_TICK   elapsed,
+                                OS_TICK   tick_base,
+                                OS_TICK   time)
+{
+    OS_TCB         *p_tcb2;
+    OS_TICK_LIST   *p_list;
+    OS_TICK_SPOKE  *p_spoke;
+    OS_TICK         delta;
+    OS_TICK         match;
+
+
+    delta = (time + tick_base) - (OSTickCtr + elapsed);         /* How many ticks until our delay expires?              */
+
+    if (delta == 0u) {
+        p_tcb->TickRemain = 0u;
+        return (OS_FALSE);
+    }
+
+    OS_TRACE_TASK_DLY(delta);
+
+    p_list               =  &OSTickList;
+    match                =   p_list->Ctr + elapsed + delta;     /* Wheel count at which our delay expires               */
+    p_spoke              =  &p_list->SpokePtr[match % p_list->SpokeSize];
+
+    p_tcb->TickRemain    =   delta;
+    p_tcb->TickCtrMatch  =   match;
+    p_tcb->TickSpokePtr  =   p_spoke;
+
+    p_tcb2               =   p_spoke->FirstPtr;                 /* Insert at the head of the spoke                      */
+    p_tcb->TickPrevPtr   =  (OS_TCB *)0;
+    p_tcb->TickNextPtr   =   p_tcb2;
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb;
+    }
+    p_spoke->FirstPtr    =   p_tcb;
+
+    p_spoke->NbrEntries++;
+#if (OS_CFG_DBG_EN > 0u)
+    if (p_spoke->NbrEntriesMax < p_spoke->NbrEntries) {         /* Keep track of the peak spoke load                    */
+        p_spoke->NbrEntriesMax = p_spoke->NbrEntries;
+    }
+#endif
+    p_list->NbrEntries++;
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if ((p_list->NbrEntries == 1u) ||                           /* If our entry is the first in the wheel or ...        */
+        ((elapsed < OSTickCtrStep) &&                           /* ... expires before the tick timer is due to fire ... */
+         (delta   < (OSTickCtrStep - elapsed)))) {
+        if (elapsed != 0u) {
+            OSTickCtr      += elapsed;                          /* Update OSTickCtr before we set a new tick step.      */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+            p_list->Ctr    += elapsed;                          /* No other entry expires within 'elapsed'              */
+        }
+                                                                /* ... the tick timer must interrupt at our delay.      */
+        OSTickCtrStep       = delta;
+        OS_DynTickSet(OSTickCtrStep);
+    }
+#endif
+
+    return (OS_TRUE);
+}
+
+#else
 /*
 ************************************************************************************************************************
 *                                                      INSERT
@@ -256,6 +395,7 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
 
     return (OS_TRUE);
 }
+#endif
 
 /*
 ************************************************************************************************************************
@@ -357,6 +497,57 @@ void  OS_TickListInsertDly (OS_TCB   *p_tcb,
     }
 }
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                         REMOVE A TASK FROM THE TICK LIST
+*
+* Description: This function is called to remove a task from the tick wheel
+*
+* Arguments  : p_tcb          Is a pointer to the OS_TCB to remove.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) In DTM, the tick timer is only stopped when the wheel becomes empty.  Otherwise, it is left to fire at
+*                 its programmed time, and OS_TickUpdate() will then program the next step.
+************************************************************************************************************************
+*/
+
+void  OS_TickListRemove (OS_TCB  *p_tcb)
+{
+    OS_TICK_LIST  *p_list;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK        elapsed;
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    elapsed = OS_DynTickGet();
+#endif
+
+    OS_TickWheelUnlink(p_tcb);
+
+    p_list = &OSTickList;
+    p_list->NbrEntries--;
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if (p_list->NbrEntries == 0u) {                             /* Removed the ONLY entry in the wheel?                 */
+        if (elapsed != 0u) {
+            OSTickCtr   += elapsed;                             /* Keep track of time.                                  */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+            p_list->Ctr += elapsed;
+        }
+        OSTickCtrStep    = 0u;
+        OS_DynTickSet(OSTickCtrStep);
+    }
+#endif
+}
+
+#else
 /*
 ************************************************************************************************************************
 *                                         REMOVE A TASK FROM THE TICK LIST
@@ -441,7 +632,84 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
         p_tcb->TickRemain        =           0u;
     }
 }
+#endif
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                 UPDATE THE LIST OF TASKS DELAYED OR PENDING WITH TIMEOUT
+*
+* Description: This function advances the tick wheel and readies the tasks whose delay or timeout has expired.
+*
+* Arguments  : ticks          the number of ticks which have elapsed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Only the spokes covered by 'ticks' are visited (one spoke per tick in PTM).  A spoke may also hold
+*                 tasks which expire on a later revolution of the wheel; those are left in place.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListUpdate (OS_TICK  ticks)
+{
+    OS_TCB         *p_tcb;
+    OS_TCB         *p_tcb_next;
+    OS_TICK_LIST   *p_list;
+    OS_TICK_SPOKE  *p_spoke;
+    OS_TICK         ctr;
+    OS_TICK         spoke;
+    OS_TICK         nbr_spokes;
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY      nbr_updated;
+#endif
+
+
+
+#if (OS_CFG_DBG_EN > 0u)
+    nbr_updated  = 0u;
+#endif
+    p_list       = &OSTickList;
+    ctr          = p_list->Ctr + 1u;                                     /* First wheel count covered by this update             */
+    p_list->Ctr += ticks;
+
+    if (ticks < p_list->SpokeSize) {                                     /* Never visit a spoke more than once                   */
+        nbr_spokes = ticks;
+    } else {
+        nbr_spokes = p_list->SpokeSize;
+    }
+    spoke        = ctr % p_list->SpokeSize;
+
+    while ((nbr_spokes         > 0u) &&
+           (p_list->NbrEntries > 0u)) {
+        p_spoke = &p_list->SpokePtr[spoke];
+        p_tcb   =  p_spoke->FirstPtr;
+        while (p_tcb != (OS_TCB *)0) {
+            p_tcb_next = p_tcb->TickNextPtr;
+            if ((OS_TICK)(p_tcb->TickCtrMatch - ctr) < ticks) {          /* Did the delay expire within the elapsed ticks?       */
+#if (OS_CFG_DBG_EN > 0u)
+                nbr_updated++;
+#endif
+                OS_TickWheelUnlink(p_tcb);
+                p_list->NbrEntries--;
+                OS_TickListExpire(p_tcb);
+            }
+            p_tcb = p_tcb_next;
+        }
+
+        spoke++;
+        if (spoke == p_list->SpokeSize) {
+            spoke = 0u;
+        }
+        nbr_spokes--;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_list->NbrUpdated = nbr_updated;
+#endif
+}
+
+#else
 /*
 ************************************************************************************************************************
 *                                 UPDATE THE LIST OF TASKS DELAYED OR PENDING WITH TIMEOUT
@@ -463,10 +731,6 @@ static  void  OS_TickListUpdate (OS_TICK  ticks)
 #if (OS_CFG_DBG_EN > 0u)
     OS_OBJ_QTY     nbr_updated;
 #endif
-#if (OS_CFG_MUTEX_EN > 0u)
-    OS_TCB        *p_tcb_owner;
-    OS_PRIO        prio_new;
-#endif
 
 
 
@@ -488,64 +752,7 @@ static  void  OS_TickListUpdate (OS_TICK  ticks)
             nbr_updated++;
 #endif
 
-            switch (p_tcb->TaskState) {
-                case OS_TASK_STATE_DLY:
-                     p_tcb->TaskState = OS_TASK_STATE_RDY;
-                     OS_RdyListInsert(p_tcb);                            /* Insert the task in the ready list                    */
-                     break;
-
-                case OS_TASK_STATE_DLY_SUSPENDED:
-                     p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
-                     break;
-
-                default:
-#if (OS_CFG_MUTEX_EN > 0u)
-                     p_tcb_owner = (OS_TCB *)0;
-                     if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
-                         p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
-                     }
-#endif
-
-#if (OS_MSG_EN > 0u)
-                     p_tcb->MsgPtr  = (void *)0;
-                     p_tcb->MsgSize = 0u;
-#endif
-#if (OS_CFG_TS_EN > 0u)
-                     p_tcb->TS      = OS_TS_GET();
-#endif
-                     OS_PendListRemove(p_tcb);                           /* Remove task from pend list                           */
-
-                     switch (p_tcb->TaskState) {
-                         case OS_TASK_STATE_PEND_TIMEOUT:
-                              OS_RdyListInsert(p_tcb);                   /* Insert the task in the ready list                    */
-                              p_tcb->TaskState  = OS_TASK_STATE_RDY;
-                              break;
-
-                         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-                              p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
-                              break;
-
-                         default:
-                              break;
-                     }
-                     p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;         /* Indicate pend timed out                              */
-                     p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;        /* Indicate no longer pending                           */
-
-#if (OS_CFG_MUTEX_EN > 0u)
-                     if (p_tcb_owner != (OS_TCB *)0) {
-                         if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
-                             (p_tcb_owner->Prio == p_tcb->Prio)) {       /* Has the owner inherited a priority?                  */
-                             prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
-                             prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
-                             if (prio_new != p_tcb_owner->Prio) {
-                                 OS_TaskChangePrio(p_tcb_owner, prio_new);
-                                 OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
-                             }
-                         }
-                     }
-#endif
-                     break;
-            }
+            OS_TickListExpire(p_tcb);
 
             p_list->TCB_Ptr = p_tcb->TickNextPtr;
             p_tcb           = p_list->TCB_Ptr;                           /* Get 'p_tcb' again for loop                           */
@@ -572,5 +779,190 @@ static  void  OS_TickListUpdate (OS_TICK  ticks)
     p_list->NbrUpdated = nbr_updated;
 #endif
 }
+#endif
+
+/*
+************************************************************************************************************************
+*                                           READY A TASK WHOSE DELAY EXPIRED
+*
+* Description: This function readies (or leaves suspended) a task that was removed from the tick list because its delay
+*              or pend timeout expired.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task that timed out.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) If the task was pending on a mutex, the owner's inherited priority is lowered as needed.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListExpire (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_TCB   *p_tcb_owner;
+    OS_PRIO   prio_new;
+#endif
+
+
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_DLY:
+             p_tcb->TaskState = OS_TASK_STATE_RDY;
+             OS_RdyListInsert(p_tcb);                                    /* Insert the task in the ready list                    */
+             break;
+
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
+             break;
+
+        default:
+#if (OS_CFG_MUTEX_EN > 0u)
+             p_tcb_owner = (OS_TCB *)0;
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
+                 p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
+             }
+#endif
+
+#if (OS_MSG_EN > 0u)
+             p_tcb->MsgPtr  = (void *)0;
+             p_tcb->MsgSize = 0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+             p_tcb->TS      = OS_TS_GET();
+#endif
+             OS_PendListRemove(p_tcb);                                   /* Remove task from pend list                           */
+
+             switch (p_tcb->TaskState) {
+                 case OS_TASK_STATE_PEND_TIMEOUT:
+                      OS_RdyListInsert(p_tcb);                           /* Insert the task in the ready list                    */
+                      p_tcb->TaskState  = OS_TASK_STATE_RDY;
+                      break;
+
+                 case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                      p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+                      break;
+
+                 default:
+                      break;
+             }
+             p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;                 /* Indicate pend timed out                              */
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;                /* Indicate no longer pending                           */
+
+#if (OS_CFG_MUTEX_EN > 0u)
+             if (p_tcb_owner != (OS_TCB *)0) {
+                 if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+                     (p_tcb_owner->Prio == p_tcb->Prio)) {               /* Has the owner inherited a priority?                  */
+                     prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                     prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                     if (prio_new != p_tcb_owner->Prio) {
+                         OS_TaskChangePrio(p_tcb_owner, prio_new);
+                         OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+                     }
+                 }
+             }
+#endif
+             break;
+    }
+}
+
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                          UNLINK A TASK FROM ITS TICK SPOKE
+*
+* Description: This function removes a task from the spoke of the tick wheel it was placed in.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB to unlink.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The caller is responsible for updating OSTickList.NbrEntries.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickWheelUnlink (OS_TCB  *p_tcb)
+{
+    OS_TICK_SPOKE  *p_spoke;
+    OS_TCB         *p_tcb1;
+    OS_TCB         *p_tcb2;
+
+
+    p_spoke = p_tcb->TickSpokePtr;
+    p_tcb1  = p_tcb->TickPrevPtr;
+    p_tcb2  = p_tcb->TickNextPtr;
+    if (p_tcb1 == (OS_TCB *)0) {                                         /* Removing the first entry of the spoke?               */
+        p_spoke->FirstPtr   = p_tcb2;
+    } else {
+        p_tcb1->TickNextPtr = p_tcb2;
+    }
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb1;
+    }
+    p_spoke->NbrEntries--;
+
+    p_tcb->TickNextPtr  = (OS_TCB        *)0;
+    p_tcb->TickPrevPtr  = (OS_TCB        *)0;
+    p_tcb->TickSpokePtr = (OS_TICK_SPOKE *)0;
+    p_tcb->TickRemain   =                  0u;
+}
+
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+/*
+************************************************************************************************************************
+*                                        FIND THE NUMBER OF TICKS TO THE NEXT EXPIRY
+*
+* Description: This function determines how many ticks the dynamic tick timer should be programmed for.
+*
+* Arguments  : none
+*
+* Returns    : The number of ticks until the next task in the wheel expires, or 0 if the wheel is empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Only one revolution of the wheel is searched.  If no task expires within that window, one full
+*                 revolution is returned and the search is repeated on the next tick interrupt.
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_TickWheelNextGet (void)
+{
+    OS_TCB        *p_tcb;
+    OS_TICK_LIST  *p_list;
+    OS_TICK        match;
+    OS_TICK        spoke;
+    OS_TICK        dly;
+
+
+    p_list = &OSTickList;
+    if (p_list->NbrEntries == 0u) {                                      /* Nothing to wait for, stop the tick timer             */
+        return (0u);
+    }
+
+    match = p_list->Ctr;
+    spoke = match % p_list->SpokeSize;
+    for (dly = 1u; dly < p_list->SpokeSize; dly++) {
+        match++;
+        spoke++;
+        if (spoke == p_list->SpokeSize) {
+            spoke = 0u;
+        }
+        p_tcb = p_list->SpokePtr[spoke].FirstPtr;
+        while (p_tcb != (OS_TCB *)0) {
+            if (p_tcb->TickCtrMatch == match) {                          /* Expires on this revolution?                          */
+                return (dly);
+            }
+            p_tcb = p_tcb->TickNextPtr;
+        }
+    }
+
+    return (p_list->SpokeSize);
+}
+#endif
+#endif
 
 #endif                                                                   /* #if OS_CFG_TICK_EN                                   */
@@ -45,6 +45,13 @@ static  void  OS_TmrCondCreate(void);
 static  void  OS_TmrCondSignal(void);
 static  void  OS_TmrCondWait  (OS_TICK  timeout);
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+static  void     OS_TmrWheelInsert  (OS_TMR  *p_tmr);
+static  void     OS_TmrWheelRemove  (OS_TMR  *p_tmr);
+static  void     OS_TmrWheelAdvance (OS_TICK  time);
+static  OS_TICK  OS_TmrWheelNextGet (void);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -191,6 +198,10 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
     p_tmr->CallbackPtrArg =  p_callback_arg;
     p_tmr->NextPtr        = (OS_TMR *)0;
     p_tmr->PrevPtr        = (OS_TMR *)0;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    p_tmr->SpokePtr       = (OS_TMR_SPOKE *)0;
+    p_tmr->Match          =  0u;
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     OS_TmrDbgListAdd(p_tmr);
@@ -370,7 +381,12 @@ CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
 OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
                          OS_ERR  *p_err)
 {
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    OS_TICK   time;
+    CPU_SR_ALLOC();
+#else
     OS_TMR   *p_tmr1;
+#endif
     OS_TICK   remain;
 
 
@@ -413,6 +429,23 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
 
     switch (p_tmr->State) {
         case OS_TMR_STATE_RUNNING:
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+             CPU_CRITICAL_ENTER();
+             if (OSTCBCurPtr == &OSTmrTaskTCB) {                /* Callbacks operate on the Tmr Task's tick base.       */
+                 time = OSTmrTaskTickBase;
+             } else {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+                 time = OSTickCtr + OS_DynTickGet();
+#else
+                 time = OSTickCtr;
+#endif
+             }
+             CPU_CRITICAL_EXIT();
+             remain = p_tmr->Match - time;                      /* The expiry tick is kept in the timer itself          */
+             if (remain > (OS_TICK)(p_tmr->Match - OSTmrTaskTickBase)) {
+                 remain = 0u;                                   /* Expired, but not yet processed by the timer task     */
+             }
+#else
              p_tmr1 = OSTmrListPtr;
              remain = 0u;
              while (p_tmr1 != (OS_TMR *)0) {                    /* Add up all the deltas up until the current timer     */
@@ -422,6 +455,7 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
                  }
                  p_tmr1 = p_tmr1->NextPtr;
              }
+#endif
              remain /= OSTmrToTicksMult;
             *p_err   = OS_ERR_NONE;
              break;
@@ -1005,6 +1039,10 @@ void  OS_TmrClr (OS_TMR  *p_tmr)
     p_tmr->CallbackPtrArg = (void              *)0;
     p_tmr->NextPtr        = (OS_TMR            *)0;
     p_tmr->PrevPtr        = (OS_TMR            *)0;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    p_tmr->SpokePtr       = (OS_TMR_SPOKE      *)0;
+    p_tmr->Match          =                      0u;
+#endif
 }
 
 
@@ -1090,15 +1128,42 @@ void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
 
 void  OS_TmrInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    OS_TMR_SPOKE  *p_spoke;
+    OS_OBJ_QTY     i;
+#endif
+
+
 #if (OS_CFG_DBG_EN > 0u)
     OSTmrQty             =           0u;                        /* Keep track of the number of timers created           */
     OSTmrDbgListPtr      = (OS_TMR *)0;
 #endif
 
     OSTmrListPtr         = (OS_TMR *)0;                         /* Create an empty timer list                           */
-#if (OS_CFG_DBG_EN > 0u)
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_TMR_WHEEL_EN > 0u))
     OSTmrListEntries     =           0u;
 #endif
+
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    p_spoke = &OSCfg_TmrWheel[0];
+    for (i = 0u; i < OSCfg_TmrWheelSize; i++) {                 /* Create an empty timer wheel                          */
+        p_spoke->FirstPtr      = (OS_TMR *)0;
+#if (OS_CFG_DBG_EN > 0u)
+        p_spoke->NbrEntries    =           0u;
+        p_spoke->NbrEntriesMax =           0u;
+#endif
+        p_spoke++;
+    }
+    OSTmrWheelExpired.FirstPtr = (OS_TMR *)0;
+#if (OS_CFG_DBG_EN > 0u)
+    OSTmrWheelExpired.NbrEntries    = 0u;
+    OSTmrWheelExpired.NbrEntriesMax = 0u;
+#endif
+    OSTmrWheelNearEntries      = 0u;
+    OSTmrWheelCtr        = OSTickCtr + 1u;                      /* Ticks up to OSTickCtr are considered processed       */
+    OSTmrWheelWake       = OSTickCtr;
+    OSTmrTaskTickBase    = OSTickCtr;
+#endif
                                                                 /* Calculate Timer to Ticks multiplier                  */
     OSTmrToTicksMult = OSCfg_TickRate_Hz / OSCfg_TmrTaskRate_Hz;
 
@@ -1172,6 +1237,35 @@ void  OS_TmrInit (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+void OS_TmrLink (OS_TMR   *p_tmr,
+                 OS_TICK   time)
+{
+    CPU_BOOLEAN  signal;
+
+
+    if (OSTmrListEntries == 0u) {                               /* Is the wheel empty?                                  */
+        OSTmrWheelCtr     = time + 1u;                          /* Yes, skip the idle ticks, nothing to process ...     */
+        OSTmrTaskTickBase = time;
+        signal            = OS_TRUE;                            /* ... and wake up the timer task to arm its timeout    */
+    } else {
+        signal            = OS_FALSE;
+    }
+
+    p_tmr->Match = time + p_tmr->Remain;                        /* Store the absolute expiry tick                       */
+    OS_TmrWheelInsert(p_tmr);
+    OSTmrListEntries++;
+
+    if ((OS_TICK)(p_tmr->Match   - OSTmrTaskTickBase) <         /* Expires before the timer task is due to wake up?     */
+        (OS_TICK)(OSTmrWheelWake - OSTmrTaskTickBase)) {
+        signal = OS_TRUE;
+    }
+
+    if (signal == OS_TRUE) {
+        OS_TmrCondSignal();
+    }
+}
+#else
 void OS_TmrLink (OS_TMR   *p_tmr,
                  OS_TICK   time)
 {
@@ -1247,6 +1341,7 @@ void OS_TmrLink (OS_TMR   *p_tmr,
         p_tmr1->NextPtr  = p_tmr;
     }
 }
+#endif
 
 
 /*
@@ -1266,6 +1361,19 @@ void OS_TmrLink (OS_TMR   *p_tmr,
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+void  OS_TmrUnlink (OS_TMR   *p_tmr,
+                    OS_TICK   time)
+{
+    (void)time;                                                 /* Expiry is absolute, nothing to adjust                */
+
+    if (p_tmr->SpokePtr != (OS_TMR_SPOKE *)0) {                 /* No need to signal the timer task, at worst it ...    */
+        OS_TmrWheelRemove(p_tmr);                               /* ... wakes up early and finds nothing to process.     */
+        OSTmrListEntries--;
+    }
+    p_tmr->Remain = 0u;
+}
+#else
 void  OS_TmrUnlink (OS_TMR   *p_tmr,
                     OS_TICK   time)
 {
@@ -1334,6 +1442,7 @@ void  OS_TmrUnlink (OS_TMR   *p_tmr,
         p_tmr->Remain               =           0u;
     }
 }
+#endif
 
 
 /*
@@ -1357,6 +1466,83 @@ void  OS_TmrUnlink (OS_TMR   *p_tmr,
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+void  OS_TmrTask (void  *p_arg)
+{
+    OS_TMR_CALLBACK_PTR   p_fnct;
+    OS_TMR               *p_tmr;
+    OS_TICK               timeout;
+    OS_TICK               time;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS                ts_start;
+#endif
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;                                                /* Not using 'p_arg', prevent compiler warning          */
+
+    OS_TmrLock();
+
+    for (;;) {
+        timeout = OS_TmrWheelNextGet();                         /* Ticks until the next spoke that needs attention      */
+
+        OS_TmrCondWait(timeout);                                /* Suspend the timer task until it needs to process ... */
+                                                                /* ... the timer wheel again. Also release the mutex .. */
+                                                                /* ... so that application tasks can add/remove timers. */
+
+#if (OS_CFG_TS_EN > 0u)
+        ts_start = OS_TS_GET();
+#endif
+
+        CPU_CRITICAL_ENTER();
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        time                       = OSTickCtr + OS_DynTickGet();
+#else
+        time                       = OSTickCtr;
+#endif
+        CPU_CRITICAL_EXIT();
+        OSTmrTaskTickBase          = time;
+
+        OS_TmrWheelAdvance(time);                               /* Collect the timers that expired up to 'time'         */
+
+                                                                /* Process timers that have expired.                    */
+        p_tmr                      = OSTmrWheelExpired.FirstPtr;
+
+        while (p_tmr != (OS_TMR *)0) {
+            p_tmr->State           = OS_TMR_STATE_TIMEOUT;
+                                                                /* Execute callback function if available               */
+            p_fnct                 = p_tmr->CallbackPtr;
+            if (p_fnct != (OS_TMR_CALLBACK_PTR)0u) {
+                (*p_fnct)(p_tmr, p_tmr->CallbackPtrArg);
+            }
+
+            if (p_tmr->State == OS_TMR_STATE_TIMEOUT) {
+                OS_TmrUnlink(p_tmr, OSTmrTaskTickBase);
+
+                if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
+                    p_tmr->State   = OS_TMR_STATE_RUNNING;
+                    p_tmr->Remain  = p_tmr->Period;
+                    OS_TmrLink(p_tmr, OSTmrTaskTickBase);
+                } else {
+                    p_tmr->PrevPtr = (OS_TMR *)0;
+                    p_tmr->NextPtr = (OS_TMR *)0;
+                    p_tmr->Remain  = 0u;
+                    p_tmr->State   = OS_TMR_STATE_COMPLETED;
+                }
+            }
+
+            p_tmr                  = OSTmrWheelExpired.FirstPtr;
+        }
+
+#if (OS_CFG_TS_EN > 0u)
+        OSTmrTaskTime = OS_TS_GET() - ts_start;                 /* Measure execution time of timer task                 */
+        if (OSTmrTaskTimeMax < OSTmrTaskTime) {
+            OSTmrTaskTimeMax       = OSTmrTaskTime;
+        }
+#endif
+    }
+}
+#else
 void  OS_TmrTask (void  *p_arg)
 {
     OS_TMR_CALLBACK_PTR   p_fnct;
@@ -1457,6 +1643,7 @@ void  OS_TmrTask (void  *p_arg)
 #endif
     }
 }
+#endif
 
 
 /*
@@ -1553,6 +1740,7 @@ static  void  OS_TmrCondWait (OS_TICK  timeout)
 #else
     ts             = 0u;
 #endif
+    OS_MUTEX_FAST_INFLATE(&OSTmrMutex);                         /* The mutex may have been taken on the fast path       */
                                                                 /* Release mutex to other tasks.                        */
     OS_MutexGrpRemove(&OSTmrTaskTCB, &OSTmrMutex);
     p_pend_list                    = &OSTmrMutex.PendList;
@@ -1566,6 +1754,7 @@ static  void  OS_TmrCondWait (OS_TICK  timeout)
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
         OSTmrMutex.OwnerTCBPtr     = (OS_TCB *)0;               /* No                                                   */
         OSTmrMutex.OwnerNestingCtr =           0u;
+        OS_MUTEX_FAST_DEFLATE(&OSTmrMutex);
     } else {
         p_tcb                      = p_pend_list->HeadPtr;      /* Yes, give mutex to new owner                         */
         OSTmrMutex.OwnerTCBPtr     = p_tcb;
@@ -1588,6 +1777,7 @@ static  void  OS_TmrCondWait (OS_TICK  timeout)
     OSSched();
 
     CPU_CRITICAL_ENTER();                                       /* Either we timed out, or were signaled.               */
+    OS_MUTEX_FAST_INFLATE(&OSTmrMutex);
 
     if (OSTmrMutex.OwnerTCBPtr == (OS_TCB *)0) {                /* Can we grab the mutex?                               */
         OS_MutexGrpAdd(&OSTmrTaskTCB, &OSTmrMutex);             /* Yes, no-one else pending.                            */
@@ -1657,4 +1847,310 @@ static  void  OS_TmrCondSignal (void)
 
     CPU_CRITICAL_EXIT();
 }
+
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                         INSERT A TIMER IN THE TIMER WHEEL
+*
+* Description: This function places a timer in the spoke that matches its absolute expiry tick ('p_tmr->Match').
+*              Level 'k' of the wheel covers the ticks that are less than OS_TMR_WHEEL_SIZE^(k+1) away from
+*              'OSTmrWheelCtr' and is indexed by bits [k*OS_CFG_TMR_WHEEL_BITS ...] of the expiry tick.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to insert.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A timer that is already due is placed in the spoke that will be processed next.
+*
+*              3) A timer beyond the range of the top level is parked in the last spoke the top level can reach.
+*                 It is re-inserted, using its real expiry tick, when that spoke is cascaded.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrWheelInsert (OS_TMR  *p_tmr)
+{
+    OS_TMR_SPOKE  *p_spoke;
+    OS_TMR        *p_tmr1;
+    OS_TICK        expires;
+    OS_TICK        idx;
+    CPU_INT08U     level;
+    CPU_INT08U     shift;
+
+
+    expires = p_tmr->Match;
+    idx     = expires - OSTmrWheelCtr;
+    if (idx > ((OS_TICK)~(OS_TICK)0 / 2u)) {                    /* Already due? See Note #2.                            */
+        expires = OSTmrWheelCtr;
+        idx     = 0u;
+    }
+
+    level = 0u;                                                 /* Find the lowest level that can hold the timer        */
+    shift = 0u;
+    while (level < (OS_CFG_TMR_WHEEL_LEVELS - 1u)) {
+        if (idx < ((OS_TICK)1u << (shift + OS_CFG_TMR_WHEEL_BITS))) {
+            break;
+        }
+        level++;
+        shift += OS_CFG_TMR_WHEEL_BITS;
+    }
+
+#if ((OS_CFG_TMR_WHEEL_BITS * OS_CFG_TMR_WHEEL_LEVELS) < 32u)
+    if (idx >= ((OS_TICK)1u << (OS_CFG_TMR_WHEEL_BITS * OS_CFG_TMR_WHEEL_LEVELS))) {
+        expires = OSTmrWheelCtr                                 /* Out of range, see Note #3.                           */
+                + ((OS_TICK)1u << (OS_CFG_TMR_WHEEL_BITS * OS_CFG_TMR_WHEEL_LEVELS))
+                - 1u;
+    }
+#endif
+
+    p_spoke         = &OSCfg_TmrWheel[((OS_OBJ_QTY)level * OS_TMR_WHEEL_SIZE) + ((expires >> shift) & OS_TMR_WHEEL_MASK)];
+    p_tmr1          =  p_spoke->FirstPtr;
+    p_tmr->SpokePtr =  p_spoke;
+    p_tmr->PrevPtr  = (OS_TMR *)0;
+    p_tmr->NextPtr  =  p_tmr1;
+    if (p_tmr1 != (OS_TMR *)0) {
+        p_tmr1->PrevPtr = p_tmr;
+    }
+    p_spoke->FirstPtr = p_tmr;
+    if (level == 0u) {
+        OSTmrWheelNearEntries++;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_spoke->NbrEntries++;
+    if (p_spoke->NbrEntriesMax < p_spoke->NbrEntries) {
+        p_spoke->NbrEntriesMax = p_spoke->NbrEntries;
+    }
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                        REMOVE A TIMER FROM THE TIMER WHEEL
+*
+* Description: This function removes a timer from the spoke it is linked in (a spoke of the wheel or the list of
+*              expired timers being processed by the timer task).
+*
+* Arguments  : p_tmr          Is a pointer to the timer to remove.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrWheelRemove (OS_TMR  *p_tmr)
+{
+    OS_TMR_SPOKE  *p_spoke;
+    OS_TMR        *p_tmr1;
+    OS_TMR        *p_tmr2;
+
+
+    p_spoke = p_tmr->SpokePtr;
+    p_tmr1  = p_tmr->PrevPtr;
+    p_tmr2  = p_tmr->NextPtr;
+    if (p_tmr1 == (OS_TMR *)0) {                                /* Removing the first entry of the spoke?               */
+        p_spoke->FirstPtr = p_tmr2;
+    } else {
+        p_tmr1->NextPtr   = p_tmr2;
+    }
+    if (p_tmr2 != (OS_TMR *)0) {
+        p_tmr2->PrevPtr   = p_tmr1;
+    }
+    if (p_spoke != &OSTmrWheelExpired) {
+        if ((OS_OBJ_QTY)(p_spoke - &OSCfg_TmrWheel[0]) < OS_TMR_WHEEL_SIZE) {
+            OSTmrWheelNearEntries--;                            /* Timer was in the lowest level                        */
+        }
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_spoke->NbrEntries--;
+#endif
+    p_tmr->SpokePtr = (OS_TMR_SPOKE *)0;
+    p_tmr->PrevPtr  = (OS_TMR       *)0;
+    p_tmr->NextPtr  = (OS_TMR       *)0;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             ADVANCE THE TIMER WHEEL
+*
+* Description: This function processes the ticks from 'OSTmrWheelCtr' up to and including 'time'.  For each tick:
+*                a) When the lowest level wraps, the matching spoke of the next level is cascaded, i.e. its timers
+*                   are re-inserted closer to their expiry.  This repeats upwards while the levels wrap.
+*                b) The timers in the lowest level spoke of that tick are moved to 'OSTmrWheelExpired'.
+*
+* Arguments  : time           Is the current time as seen by the timer task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Expired timers are appended, so that timers are processed in order of expiry.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrWheelAdvance (OS_TICK  time)
+{
+    OS_TMR_SPOKE  *p_spoke;
+    OS_TMR        *p_tmr;
+    OS_TMR        *p_tmr_next;
+    OS_TMR        *p_tail;
+    OS_TICK        idx;
+    CPU_INT08U     level;
+
+
+    if ((OS_TICK)(time - OSTmrWheelCtr) > ((OS_TICK)~(OS_TICK)0 / 2u)) {
+        return;                                                 /* 'time' has already been processed                    */
+    }
+
+    if (OSTmrListEntries == 0u) {                               /* Nothing to expire, skip the idle ticks               */
+        OSTmrWheelCtr = time + 1u;
+        return;
+    }
+
+    p_tail = OSTmrWheelExpired.FirstPtr;                        /* Find the end of the expired list (see Note #2)       */
+    if (p_tail != (OS_TMR *)0) {
+        while (p_tail->NextPtr != (OS_TMR *)0) {
+            p_tail = p_tail->NextPtr;
+        }
+    }
+
+    while (OSTmrWheelCtr != (OS_TICK)(time + 1u)) {
+        if ((OSTmrWheelCtr & OS_TMR_WHEEL_MASK) == 0u) {        /* Lowest level wrapped, cascade the upper levels       */
+            level = 1u;
+            while (level < OS_CFG_TMR_WHEEL_LEVELS) {
+                idx                  = (OSTmrWheelCtr >> (level * OS_CFG_TMR_WHEEL_BITS)) & OS_TMR_WHEEL_MASK;
+                p_spoke              = &OSCfg_TmrWheel[((OS_OBJ_QTY)level * OS_TMR_WHEEL_SIZE) + idx];
+                p_tmr                =  p_spoke->FirstPtr;
+                p_spoke->FirstPtr    = (OS_TMR *)0;
+#if (OS_CFG_DBG_EN > 0u)
+                p_spoke->NbrEntries  =           0u;
+#endif
+                while (p_tmr != (OS_TMR *)0) {
+                    p_tmr_next = p_tmr->NextPtr;
+                    OS_TmrWheelInsert(p_tmr);
+                    p_tmr      = p_tmr_next;
+                }
+                if (idx != 0u) {                                /* Only cascade further if this level wrapped too       */
+                    break;
+                }
+                level++;
+            }
+        }
+
+        p_spoke = &OSCfg_TmrWheel[OSTmrWheelCtr & OS_TMR_WHEEL_MASK];
+        p_tmr   =  p_spoke->FirstPtr;
+        if (p_tmr != (OS_TMR *)0) {                             /* Move the expired spoke to the expired list           */
+            if (p_tail == (OS_TMR *)0) {
+                OSTmrWheelExpired.FirstPtr = p_tmr;
+            } else {
+                p_tail->NextPtr            = p_tmr;
+            }
+            p_tmr->PrevPtr = p_tail;
+            while (p_tmr != (OS_TMR *)0) {
+                p_tmr->SpokePtr = &OSTmrWheelExpired;
+                p_tail          =  p_tmr;
+                p_tmr           =  p_tmr->NextPtr;
+                OSTmrWheelNearEntries--;
+            }
+            p_spoke->FirstPtr = (OS_TMR *)0;
+#if (OS_CFG_DBG_EN > 0u)
+            OSTmrWheelExpired.NbrEntries += p_spoke->NbrEntries;
+            if (OSTmrWheelExpired.NbrEntriesMax < OSTmrWheelExpired.NbrEntries) {
+                OSTmrWheelExpired.NbrEntriesMax = OSTmrWheelExpired.NbrEntries;
+            }
+            p_spoke->NbrEntries = 0u;
+#endif
+        }
+
+        OSTmrWheelCtr++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                      FIND THE NEXT TICK THE TIMER TASK MUST PROCESS
+*
+* Description: This function looks for the next tick at which either a lowest level spoke holds timers, or a non-empty
+*              upper level spoke is cascaded.  Ticks without work, including wraps that would only cascade empty
+*              spokes, are skipped so that the timer task does not wake up for nothing.
+*
+* Arguments  : none
+*
+* Returns    : The number of ticks, relative to 'OSTmrTaskTickBase', before the timer task must run again.
+*              A value of zero means that the wheel is empty and the timer task can pend indefinitely.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Timers in the lowest level all expire less than OS_TMR_WHEEL_SIZE ticks ahead, so the lowest level is
+*                 only scanned tick by tick while it holds timers.  Otherwise only the wraps are visited.
+*
+*              3) The search covers the two lowest levels (OS_TMR_WHEEL_SIZE^2 ticks).  If nothing is found the timer
+*                 task simply wakes up at the end of that range and searches again.
+*
+*              4) The wake-up tick is saved in 'OSTmrWheelWake', so that OS_TmrLink() only signals the timer task
+*                 when a timer expires before that.
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_TmrWheelNextGet (void)
+{
+    OS_TMR_SPOKE  *p_spoke;
+    OS_TICK        tick;
+    OS_TICK        timeout;
+    OS_TICK        idx;
+    CPU_INT08U     level;
+    CPU_BOOLEAN    found;
+
+
+    if (OSTmrListEntries == 0u) {                               /* Empty wheel, pend until a timer is linked            */
+        OSTmrWheelWake = OSTmrTaskTickBase;
+        return (0u);
+    }
+
+    tick  = OSTmrWheelCtr;
+    found = OS_FALSE;
+    while ((found == OS_FALSE) &&                               /* See Note #3.                                         */
+           ((OS_TICK)(tick - OSTmrWheelCtr) < (OS_TICK)(OS_TMR_WHEEL_SIZE * OS_TMR_WHEEL_SIZE))) {
+        if ((tick & OS_TMR_WHEEL_MASK) == 0u) {                 /* Does this tick cascade non-empty spokes?             */
+            level = 1u;
+            while (level < OS_CFG_TMR_WHEEL_LEVELS) {
+                idx     = (tick >> (level * OS_CFG_TMR_WHEEL_BITS)) & OS_TMR_WHEEL_MASK;
+                p_spoke = &OSCfg_TmrWheel[((OS_OBJ_QTY)level * OS_TMR_WHEEL_SIZE) + idx];
+                if (p_spoke->FirstPtr != (OS_TMR *)0) {
+                    found = OS_TRUE;
+                    break;
+                }
+                if (idx != 0u) {
+                    break;
+                }
+                level++;
+            }
+        }
+
+        if (found == OS_FALSE) {
+            if (OSTmrWheelNearEntries == 0u) {                  /* Skip to the next wrap, see Note #2.                  */
+                tick = (tick | OS_TMR_WHEEL_MASK) + 1u;
+            } else if (OSCfg_TmrWheel[tick & OS_TMR_WHEEL_MASK].FirstPtr != (OS_TMR *)0) {
+                found = OS_TRUE;
+            } else {
+                tick++;
+            }
+        }
+    }
+    OSTmrWheelWake = tick;
+
+    timeout = tick - OSTmrTaskTickBase;
+    if (timeout == 0u) {                                        /* Always wait at least one tick                        */
+        timeout = 1u;
+    }
+
+    return (timeout);
+}
+#endif
 #endif
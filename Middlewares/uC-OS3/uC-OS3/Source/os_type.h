@@ -63,7 +63,11 @@ typedef   CPU_INT32U      OS_OBJ_TYPE;                 /* Special flag to determ
 
 typedef   CPU_INT16U      OS_OPT;                      /* Holds function options,                             <16>/32 */
 
-typedef   CPU_INT08U      OS_PRIO;                     /* Priority of a task,                               <8>/16/32 */
+#if (OS_CFG_PRIO_MAX > 255u)                           /* Priority of a task, must hold OS_CFG_PRIO_MAX     <8>/16/32 */
+typedef   CPU_INT16U      OS_PRIO;
+#else
+typedef   CPU_INT08U      OS_PRIO;
+#endif
 
 typedef   CPU_INT16U      OS_QTY;                      /* Quantity                                            <16>/32 */
 
@@ -178,12 +178,12 @@ void USART1_IRQHandler(void)
     if (USART_GetITStatus(USART1, USART_IT_RXNE) != RESET)
     {
         rx_byte = USART_ReceiveData(USART1); // ȡֽ
-        /* 滻OSQPostISRΪOSQPostV3.08.01汾 */
-        OSQPost(&USART_Rx_Queue,                // ָ
-                (void *)rx_byte,                // Ϣݣ1ֽڣ
-                sizeof(uint8_t),                // ϢС
-                OS_OPT_POST_FIFO,               // FIFOģʽ
-                &err);                          // 
+        /* дռOS_MSGﵽŻѽ */
+        OSStreamWrite(&USART_Rx_Stream,         // ָ
+                      &rx_byte,                 // 
+                      sizeof(uint8_t),          // ݴС
+                      OS_OPT_POST_NONE,         // ѡ
+                      &err);                    // 루ʱֽڣ
         USART_ClearITPendingBit(USART1, USART_IT_RXNE); // жϱ־
     }
 